@@ -0,0 +1,214 @@
+#include <stdlib.h>
+#include <getopt.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <iostream>
+
+#include "slash/include/env.h"
+#include "include/zp_binlog.h"
+#include "include/zp_const.h"
+
+// zp_binlog_bench: microbenchmarks for the binlog engine.
+// Covers Binlog::Put throughput against record size and writer thread
+// count (the group commit ceiling), BinlogReader::Consume scan rate and
+// SetProducerStatus fallback cost, so binlog-file-size changes in conf
+// are not tuned blind.
+
+static std::string g_path = "./binlog_bench_data";
+static int g_file_size = 100 * 1024 * 1024;
+static int g_records = 100000;
+static int g_fallbacks = 1000;
+
+void print_usage_exit() {
+  std::cout << "Usage:" << std::endl;
+  std::cout << "    ./zp-binlog-bench [--path dir] [--file_size bytes]"
+    " [--records n] [--fallbacks n]" << std::endl;
+  exit(-1);
+}
+
+Binlog* OpenFreshBinlog() {
+  slash::DeleteDirIfExist(g_path);
+  slash::CreatePath(g_path);
+  Binlog* binlog = NULL;
+  Status s = Binlog::Create(g_path, g_file_size, &binlog);
+  if (!s.ok()) {
+    std::cout << "Create binlog failed: " << s.ToString() << std::endl;
+    exit(-1);
+  }
+  return binlog;
+}
+
+void Report(const std::string& name, uint64_t records,
+    uint64_t bytes, uint64_t elapsed_us) {
+  if (elapsed_us < 1) {
+    elapsed_us = 1;
+  }
+  std::cout << "| " << name
+    << " | " << records * 1000000 / elapsed_us << " op/s"
+    << " | " << bytes / elapsed_us << " MB/s"
+    << " | " << elapsed_us * 1000 / records << " ns/op | " << std::endl;
+}
+
+// Single writer Put throughput over record sizes
+void BenchPutRecordSize() {
+  std::cout << "---- Put throughput vs record size ("
+    << g_records << " records each) ----" << std::endl;
+  int sizes[] = {64, 512, 4096, 65536};
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    Binlog* binlog = OpenFreshBinlog();
+    std::string item(sizes[i], 'b');
+    int records = g_records;
+    if (sizes[i] >= 65536) {
+      records /= 10;  // keep the big-record pass short
+    }
+    uint64_t begin_us = slash::NowMicros();
+    for (int n = 0; n < records; n++) {
+      Status s = binlog->Put(item);
+      if (!s.ok()) {
+        std::cout << "Put failed: " << s.ToString() << std::endl;
+        exit(-1);
+      }
+    }
+    Report("size " + std::to_string(sizes[i]), records,
+        static_cast<uint64_t>(records) * sizes[i],
+        slash::NowMicros() - begin_us);
+    delete binlog;
+  }
+}
+
+// Concurrent Put against one binlog, the group commit ceiling
+void BenchPutThreads() {
+  std::cout << "---- Put throughput vs thread count (512 byte records, "
+    << g_records << " records total) ----" << std::endl;
+  int thread_nums[] = {1, 2, 4, 8};
+  std::string item(512, 'b');
+  for (size_t i = 0; i < sizeof(thread_nums) / sizeof(thread_nums[0]); i++) {
+    Binlog* binlog = OpenFreshBinlog();
+    int per_thread = g_records / thread_nums[i];
+    std::vector<std::thread> threads;
+    uint64_t begin_us = slash::NowMicros();
+    for (int t = 0; t < thread_nums[i]; t++) {
+      threads.push_back(std::thread([binlog, &item, per_thread]() {
+            for (int n = 0; n < per_thread; n++) {
+              binlog->Put(item);
+            }
+          }));
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    Report(std::to_string(thread_nums[i]) + " threads",
+        static_cast<uint64_t>(per_thread) * thread_nums[i],
+        static_cast<uint64_t>(per_thread) * thread_nums[i] * 512,
+        slash::NowMicros() - begin_us);
+    delete binlog;
+  }
+}
+
+// Scan rate of what BenchPutRecordSize left on disk
+void BenchReaderConsume() {
+  std::cout << "---- BinlogReader::Consume scan rate (512 byte records, "
+    << g_records << " records) ----" << std::endl;
+  Binlog* binlog = OpenFreshBinlog();
+  std::string item(512, 'b');
+  for (int n = 0; n < g_records; n++) {
+    binlog->Put(item);
+  }
+
+  std::string profile = NewFileName(binlog->filename(), 0);
+  slash::SequentialFile* queue = NULL;
+  Status s = slash::NewSequentialFile(profile, &queue);
+  if (!s.ok()) {
+    std::cout << "Open " << profile << " failed: "
+      << s.ToString() << std::endl;
+    exit(-1);
+  }
+  BinlogReader* reader = new BinlogReader(queue);
+  reader->Seek(0);
+
+  uint64_t records = 0, bytes = 0, consume_len = 0;
+  std::string record;
+  uint64_t begin_us = slash::NowMicros();
+  while (true) {
+    record.clear();
+    s = reader->Consume(&consume_len, &record);
+    if (!s.ok()) {
+      break;
+    }
+    records++;
+    bytes += consume_len;
+  }
+  Report("scan", records, bytes, slash::NowMicros() - begin_us);
+
+  delete reader;
+  delete queue;
+  delete binlog;
+}
+
+// Cost of rewinding the producer point, the slave fallback path
+void BenchSetProducerStatus() {
+  std::cout << "---- SetProducerStatus fallback cost ("
+    << g_fallbacks << " fallbacks) ----" << std::endl;
+  Binlog* binlog = OpenFreshBinlog();
+  std::string item(512, 'b');
+  for (int n = 0; n < g_records; n++) {
+    binlog->Put(item);
+  }
+
+  uint32_t cur_num = 0;
+  uint64_t cur_offset = 0, actual_offset = 0;
+  binlog->GetProducerStatus(&cur_num, &cur_offset);
+  uint64_t begin_us = slash::NowMicros();
+  for (int n = 0; n < g_fallbacks; n++) {
+    // Bounce between the tail and one block back
+    uint64_t target = (n % 2 == 0)
+      ? BinlogBlockStart(cur_offset) : cur_offset;
+    Status s = binlog->SetProducerStatus(cur_num, target,
+        &actual_offset, &cur_num, &cur_offset);
+    if (!s.ok()) {
+      std::cout << "SetProducerStatus failed: " << s.ToString() << std::endl;
+      exit(-1);
+    }
+    cur_offset = actual_offset;
+  }
+  uint64_t elapsed_us = slash::NowMicros() - begin_us;
+  std::cout << "| fallback | " << elapsed_us / g_fallbacks
+    << " us/op | " << std::endl;
+  delete binlog;
+}
+
+int main(int argc, char* argv[]) {
+  static struct option const long_options[] = {
+    {"path", required_argument, NULL, 'p'},
+    {"file_size", required_argument, NULL, 's'},
+    {"records", required_argument, NULL, 'n'},
+    {"fallbacks", required_argument, NULL, 'f'},
+    {NULL, 0, NULL, 0} };
+
+  int opt, optindex;
+  while ((opt = getopt_long(argc, argv, "p:s:n:f:",
+          long_options, &optindex)) != -1) {
+    switch (opt) {
+      case 'p': g_path = optarg; break;
+      case 's': g_file_size = atoi(optarg); break;
+      case 'n': g_records = atoi(optarg); break;
+      case 'f': g_fallbacks = atoi(optarg); break;
+      default: print_usage_exit();
+    }
+  }
+  if (g_records < 1 || g_fallbacks < 1 || g_file_size < kBlockSize) {
+    print_usage_exit();
+  }
+  if (g_path.back() != '/') {
+    g_path.push_back('/');
+  }
+
+  BenchPutRecordSize();
+  BenchPutThreads();
+  BenchReaderConsume();
+  BenchSetProducerStatus();
+
+  slash::DeleteDirIfExist(g_path);
+  return 0;
+}
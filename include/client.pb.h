@@ -47,6 +47,10 @@ class CmdRequest_Del;
 class CmdRequest_Info;
 class CmdRequest_Mget;
 class CmdRequest_FlushDB;
+class CmdRequest_Mset;
+class CmdRequest_Scan;
+class CmdRequest_Cas;
+class CmdRequest_Incrby;
 class CmdResponse;
 class CmdResponse_Sync;
 class CmdResponse_Get;
@@ -55,9 +59,18 @@ class CmdResponse_InfoCapacity;
 class CmdResponse_InfoRepl;
 class CmdResponse_Mget;
 class CmdResponse_InfoServer;
+class CmdResponse_Scan;
+class CmdResponse_InfoLatency;
+class CmdResponse_Cas;
+class CmdResponse_Incrby;
+class CmdResponse_InfoSlowlog;
 class BinlogSkip;
 class SyncLease;
+class SyncAck;
 class SyncRequest;
+class Kv;
+class SyncItem;
+class BinlogBatch;
 
 enum Type {
   SYNC = 0,
@@ -69,11 +82,16 @@ enum Type {
   INFOREPL = 6,
   MGET = 7,
   INFOSERVER = 8,
-  FLUSHDB = 9
+  FLUSHDB = 9,
+  MSET = 10,
+  SCAN = 11,
+  INFOLATENCY = 12,
+  CAS = 13,
+  INCRBY = 14
 };
 bool Type_IsValid(int value);
 const Type Type_MIN = SYNC;
-const Type Type_MAX = FLUSHDB;
+const Type Type_MAX = INCRBY;
 const int Type_ARRAYSIZE = Type_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* Type_descriptor();
@@ -89,11 +107,13 @@ inline bool Type_Parse(
 enum SyncType {
   CMD = 0,
   SKIP = 1,
-  LEASE = 2
+  LEASE = 2,
+  BATCH = 3,
+  ACK = 4
 };
 bool SyncType_IsValid(int value);
 const SyncType SyncType_MIN = CMD;
-const SyncType SyncType_MAX = LEASE;
+const SyncType SyncType_MAX = ACK;
 const int SyncType_ARRAYSIZE = SyncType_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* SyncType_descriptor();
@@ -921,6 +941,13 @@ class CmdRequest_Set : public ::google::protobuf::Message {
   inline ::client::KeyExpire* release_expire();
   inline void set_allocated_expire(::client::KeyExpire* expire);
 
+  // optional int32 ack_replicas = 6;
+  inline bool has_ack_replicas() const;
+  inline void clear_ack_replicas();
+  static const int kAckReplicasFieldNumber = 6;
+  inline ::google::protobuf::int32 ack_replicas() const;
+  inline void set_ack_replicas(::google::protobuf::int32 value);
+
   // @@protoc_insertion_point(class_scope:client.CmdRequest.Set)
  private:
   inline void set_has_table_name();
@@ -933,6 +960,8 @@ class CmdRequest_Set : public ::google::protobuf::Message {
   inline void clear_has_uuid();
   inline void set_has_expire();
   inline void clear_has_expire();
+  inline void set_has_ack_replicas();
+  inline void clear_has_ack_replicas();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -941,9 +970,10 @@ class CmdRequest_Set : public ::google::protobuf::Message {
   ::std::string* value_;
   ::std::string* uuid_;
   ::client::KeyExpire* expire_;
+  ::google::protobuf::int32 ack_replicas_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
@@ -1044,6 +1074,13 @@ class CmdRequest_Get : public ::google::protobuf::Message {
   inline ::std::string* release_uuid();
   inline void set_allocated_uuid(::std::string* uuid);
 
+  // optional bool allow_stale = 4;
+  inline bool has_allow_stale() const;
+  inline void clear_allow_stale();
+  static const int kAllowStaleFieldNumber = 4;
+  inline bool allow_stale() const;
+  inline void set_allow_stale(bool value);
+
   // @@protoc_insertion_point(class_scope:client.CmdRequest.Get)
  private:
   inline void set_has_table_name();
@@ -1052,15 +1089,18 @@ class CmdRequest_Get : public ::google::protobuf::Message {
   inline void clear_has_key();
   inline void set_has_uuid();
   inline void clear_has_uuid();
+  inline void set_has_allow_stale();
+  inline void clear_has_allow_stale();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* table_name_;
   ::std::string* key_;
   ::std::string* uuid_;
+  bool allow_stale_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
@@ -1476,14 +1516,14 @@ class CmdRequest_FlushDB : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class CmdRequest : public ::google::protobuf::Message {
+class CmdRequest_Mset : public ::google::protobuf::Message {
  public:
-  CmdRequest();
-  virtual ~CmdRequest();
+  CmdRequest_Mset();
+  virtual ~CmdRequest_Mset();
 
-  CmdRequest(const CmdRequest& from);
+  CmdRequest_Mset(const CmdRequest_Mset& from);
 
-  inline CmdRequest& operator=(const CmdRequest& from) {
+  inline CmdRequest_Mset& operator=(const CmdRequest_Mset& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1497,17 +1537,17 @@ class CmdRequest : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest& default_instance();
+  static const CmdRequest_Mset& default_instance();
 
-  void Swap(CmdRequest* other);
+  void Swap(CmdRequest_Mset* other);
 
   // implements Message ----------------------------------------------
 
-  CmdRequest* New() const;
+  CmdRequest_Mset* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest& from);
-  void MergeFrom(const CmdRequest& from);
+  void CopyFrom(const CmdRequest_Mset& from);
+  void MergeFrom(const CmdRequest_Mset& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1528,136 +1568,62 @@ class CmdRequest : public ::google::protobuf::Message {
 
   // nested types ----------------------------------------------------
 
-  typedef CmdRequest_Sync Sync;
-  typedef CmdRequest_Set Set;
-  typedef CmdRequest_Get Get;
-  typedef CmdRequest_Del Del;
-  typedef CmdRequest_Info Info;
-  typedef CmdRequest_Mget Mget;
-  typedef CmdRequest_FlushDB FlushDB;
-
   // accessors -------------------------------------------------------
 
-  // required .client.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::client::Type type() const;
-  inline void set_type(::client::Type value);
-
-  // optional .client.CmdRequest.Sync sync = 2;
-  inline bool has_sync() const;
-  inline void clear_sync();
-  static const int kSyncFieldNumber = 2;
-  inline const ::client::CmdRequest_Sync& sync() const;
-  inline ::client::CmdRequest_Sync* mutable_sync();
-  inline ::client::CmdRequest_Sync* release_sync();
-  inline void set_allocated_sync(::client::CmdRequest_Sync* sync);
-
-  // optional .client.CmdRequest.Set set = 3;
-  inline bool has_set() const;
-  inline void clear_set();
-  static const int kSetFieldNumber = 3;
-  inline const ::client::CmdRequest_Set& set() const;
-  inline ::client::CmdRequest_Set* mutable_set();
-  inline ::client::CmdRequest_Set* release_set();
-  inline void set_allocated_set(::client::CmdRequest_Set* set);
-
-  // optional .client.CmdRequest.Get get = 4;
-  inline bool has_get() const;
-  inline void clear_get();
-  static const int kGetFieldNumber = 4;
-  inline const ::client::CmdRequest_Get& get() const;
-  inline ::client::CmdRequest_Get* mutable_get();
-  inline ::client::CmdRequest_Get* release_get();
-  inline void set_allocated_get(::client::CmdRequest_Get* get);
-
-  // optional .client.CmdRequest.Del del = 5;
-  inline bool has_del() const;
-  inline void clear_del();
-  static const int kDelFieldNumber = 5;
-  inline const ::client::CmdRequest_Del& del() const;
-  inline ::client::CmdRequest_Del* mutable_del();
-  inline ::client::CmdRequest_Del* release_del();
-  inline void set_allocated_del(::client::CmdRequest_Del* del);
-
-  // optional .client.CmdRequest.Info info = 6;
-  inline bool has_info() const;
-  inline void clear_info();
-  static const int kInfoFieldNumber = 6;
-  inline const ::client::CmdRequest_Info& info() const;
-  inline ::client::CmdRequest_Info* mutable_info();
-  inline ::client::CmdRequest_Info* release_info();
-  inline void set_allocated_info(::client::CmdRequest_Info* info);
-
-  // optional .client.CmdRequest.Mget mget = 7;
-  inline bool has_mget() const;
-  inline void clear_mget();
-  static const int kMgetFieldNumber = 7;
-  inline const ::client::CmdRequest_Mget& mget() const;
-  inline ::client::CmdRequest_Mget* mutable_mget();
-  inline ::client::CmdRequest_Mget* release_mget();
-  inline void set_allocated_mget(::client::CmdRequest_Mget* mget);
-
-  // optional .client.CmdRequest.FlushDB flushdb = 8;
-  inline bool has_flushdb() const;
-  inline void clear_flushdb();
-  static const int kFlushdbFieldNumber = 8;
-  inline const ::client::CmdRequest_FlushDB& flushdb() const;
-  inline ::client::CmdRequest_FlushDB* mutable_flushdb();
-  inline ::client::CmdRequest_FlushDB* release_flushdb();
-  inline void set_allocated_flushdb(::client::CmdRequest_FlushDB* flushdb);
+  // required string table_name = 1;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 1;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
 
-  // @@protoc_insertion_point(class_scope:client.CmdRequest)
+  // repeated .client.Kv kvs = 2;
+  inline int kvs_size() const;
+  inline void clear_kvs();
+  static const int kKvsFieldNumber = 2;
+  inline const ::client::Kv& kvs(int index) const;
+  inline ::client::Kv* mutable_kvs(int index);
+  inline ::client::Kv* add_kvs();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::Kv >&
+      kvs() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::Kv >*
+      mutable_kvs();
+
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Mset)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_sync();
-  inline void clear_has_sync();
-  inline void set_has_set();
-  inline void clear_has_set();
-  inline void set_has_get();
-  inline void clear_has_get();
-  inline void set_has_del();
-  inline void clear_has_del();
-  inline void set_has_info();
-  inline void clear_has_info();
-  inline void set_has_mget();
-  inline void clear_has_mget();
-  inline void set_has_flushdb();
-  inline void clear_has_flushdb();
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
-  ::client::CmdRequest_Sync* sync_;
-  ::client::CmdRequest_Set* set_;
-  ::client::CmdRequest_Get* get_;
-  ::client::CmdRequest_Del* del_;
-  ::client::CmdRequest_Info* info_;
-  ::client::CmdRequest_Mget* mget_;
-  ::client::CmdRequest_FlushDB* flushdb_;
-  int type_;
+  ::std::string* table_name_;
+  ::google::protobuf::RepeatedPtrField< ::client::Kv > kvs_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdRequest* default_instance_;
+  static CmdRequest_Mset* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_Sync : public ::google::protobuf::Message {
+class CmdRequest_Scan : public ::google::protobuf::Message {
  public:
-  CmdResponse_Sync();
-  virtual ~CmdResponse_Sync();
+  CmdRequest_Scan();
+  virtual ~CmdRequest_Scan();
 
-  CmdResponse_Sync(const CmdResponse_Sync& from);
+  CmdRequest_Scan(const CmdRequest_Scan& from);
 
-  inline CmdResponse_Sync& operator=(const CmdResponse_Sync& from) {
+  inline CmdRequest_Scan& operator=(const CmdRequest_Scan& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1671,17 +1637,17 @@ class CmdResponse_Sync : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_Sync& default_instance();
+  static const CmdRequest_Scan& default_instance();
 
-  void Swap(CmdResponse_Sync* other);
+  void Swap(CmdRequest_Scan* other);
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_Sync* New() const;
+  CmdRequest_Scan* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_Sync& from);
-  void MergeFrom(const CmdResponse_Sync& from);
+  void CopyFrom(const CmdRequest_Scan& from);
+  void MergeFrom(const CmdRequest_Scan& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1716,47 +1682,80 @@ class CmdResponse_Sync : public ::google::protobuf::Message {
   inline ::std::string* release_table_name();
   inline void set_allocated_table_name(::std::string* table_name);
 
-  // required .client.SyncOffset sync_offset = 2;
-  inline bool has_sync_offset() const;
-  inline void clear_sync_offset();
-  static const int kSyncOffsetFieldNumber = 2;
-  inline const ::client::SyncOffset& sync_offset() const;
-  inline ::client::SyncOffset* mutable_sync_offset();
-  inline ::client::SyncOffset* release_sync_offset();
-  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+  // required int32 partition_id = 2;
+  inline bool has_partition_id() const;
+  inline void clear_partition_id();
+  static const int kPartitionIdFieldNumber = 2;
+  inline ::google::protobuf::int32 partition_id() const;
+  inline void set_partition_id(::google::protobuf::int32 value);
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.Sync)
+  // optional string key_start = 3;
+  inline bool has_key_start() const;
+  inline void clear_key_start();
+  static const int kKeyStartFieldNumber = 3;
+  inline const ::std::string& key_start() const;
+  inline void set_key_start(const ::std::string& value);
+  inline void set_key_start(const char* value);
+  inline void set_key_start(const char* value, size_t size);
+  inline ::std::string* mutable_key_start();
+  inline ::std::string* release_key_start();
+  inline void set_allocated_key_start(::std::string* key_start);
+
+  // optional int32 limit = 4;
+  inline bool has_limit() const;
+  inline void clear_limit();
+  static const int kLimitFieldNumber = 4;
+  inline ::google::protobuf::int32 limit() const;
+  inline void set_limit(::google::protobuf::int32 value);
+
+  // optional int64 max_bytes = 5;
+  inline bool has_max_bytes() const;
+  inline void clear_max_bytes();
+  static const int kMaxBytesFieldNumber = 5;
+  inline ::google::protobuf::int64 max_bytes() const;
+  inline void set_max_bytes(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Scan)
  private:
   inline void set_has_table_name();
   inline void clear_has_table_name();
-  inline void set_has_sync_offset();
-  inline void clear_has_sync_offset();
+  inline void set_has_partition_id();
+  inline void clear_has_partition_id();
+  inline void set_has_key_start();
+  inline void clear_has_key_start();
+  inline void set_has_limit();
+  inline void clear_has_limit();
+  inline void set_has_max_bytes();
+  inline void clear_has_max_bytes();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* table_name_;
-  ::client::SyncOffset* sync_offset_;
+  ::std::string* key_start_;
+  ::google::protobuf::int32 partition_id_;
+  ::google::protobuf::int32 limit_;
+  ::google::protobuf::int64 max_bytes_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdResponse_Sync* default_instance_;
+  static CmdRequest_Scan* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_Get : public ::google::protobuf::Message {
+class CmdRequest_Cas : public ::google::protobuf::Message {
  public:
-  CmdResponse_Get();
-  virtual ~CmdResponse_Get();
+  CmdRequest_Cas();
+  virtual ~CmdRequest_Cas();
 
-  CmdResponse_Get(const CmdResponse_Get& from);
+  CmdRequest_Cas(const CmdRequest_Cas& from);
 
-  inline CmdResponse_Get& operator=(const CmdResponse_Get& from) {
+  inline CmdRequest_Cas& operator=(const CmdRequest_Cas& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1770,17 +1769,17 @@ class CmdResponse_Get : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_Get& default_instance();
+  static const CmdRequest_Cas& default_instance();
 
-  void Swap(CmdResponse_Get* other);
+  void Swap(CmdRequest_Cas* other);
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_Get* New() const;
+  CmdRequest_Cas* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_Get& from);
-  void MergeFrom(const CmdResponse_Get& from);
+  void CopyFrom(const CmdRequest_Cas& from);
+  void MergeFrom(const CmdRequest_Cas& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1803,10 +1802,34 @@ class CmdResponse_Get : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
-  // optional bytes value = 1;
+  // required string table_name = 1;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 1;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
+
+  // required string key = 2;
+  inline bool has_key() const;
+  inline void clear_key();
+  static const int kKeyFieldNumber = 2;
+  inline const ::std::string& key() const;
+  inline void set_key(const ::std::string& value);
+  inline void set_key(const char* value);
+  inline void set_key(const char* value, size_t size);
+  inline ::std::string* mutable_key();
+  inline ::std::string* release_key();
+  inline void set_allocated_key(::std::string* key);
+
+  // required bytes value = 3;
   inline bool has_value() const;
   inline void clear_value();
-  static const int kValueFieldNumber = 1;
+  static const int kValueFieldNumber = 3;
   inline const ::std::string& value() const;
   inline void set_value(const ::std::string& value);
   inline void set_value(const char* value);
@@ -1815,35 +1838,71 @@ class CmdResponse_Get : public ::google::protobuf::Message {
   inline ::std::string* release_value();
   inline void set_allocated_value(::std::string* value);
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.Get)
+  // optional bytes expect = 4;
+  inline bool has_expect() const;
+  inline void clear_expect();
+  static const int kExpectFieldNumber = 4;
+  inline const ::std::string& expect() const;
+  inline void set_expect(const ::std::string& value);
+  inline void set_expect(const char* value);
+  inline void set_expect(const void* value, size_t size);
+  inline ::std::string* mutable_expect();
+  inline ::std::string* release_expect();
+  inline void set_allocated_expect(::std::string* expect);
+
+  // optional string uuid = 5;
+  inline bool has_uuid() const;
+  inline void clear_uuid();
+  static const int kUuidFieldNumber = 5;
+  inline const ::std::string& uuid() const;
+  inline void set_uuid(const ::std::string& value);
+  inline void set_uuid(const char* value);
+  inline void set_uuid(const char* value, size_t size);
+  inline ::std::string* mutable_uuid();
+  inline ::std::string* release_uuid();
+  inline void set_allocated_uuid(::std::string* uuid);
+
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Cas)
  private:
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
+  inline void set_has_key();
+  inline void clear_has_key();
   inline void set_has_value();
   inline void clear_has_value();
+  inline void set_has_expect();
+  inline void clear_has_expect();
+  inline void set_has_uuid();
+  inline void clear_has_uuid();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
+  ::std::string* table_name_;
+  ::std::string* key_;
   ::std::string* value_;
+  ::std::string* expect_;
+  ::std::string* uuid_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdResponse_Get* default_instance_;
+  static CmdRequest_Cas* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_InfoStats : public ::google::protobuf::Message {
+class CmdRequest_Incrby : public ::google::protobuf::Message {
  public:
-  CmdResponse_InfoStats();
-  virtual ~CmdResponse_InfoStats();
+  CmdRequest_Incrby();
+  virtual ~CmdRequest_Incrby();
 
-  CmdResponse_InfoStats(const CmdResponse_InfoStats& from);
+  CmdRequest_Incrby(const CmdRequest_Incrby& from);
 
-  inline CmdResponse_InfoStats& operator=(const CmdResponse_InfoStats& from) {
+  inline CmdRequest_Incrby& operator=(const CmdRequest_Incrby& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1857,17 +1916,17 @@ class CmdResponse_InfoStats : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_InfoStats& default_instance();
+  static const CmdRequest_Incrby& default_instance();
 
-  void Swap(CmdResponse_InfoStats* other);
+  void Swap(CmdRequest_Incrby* other);
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_InfoStats* New() const;
+  CmdRequest_Incrby* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_InfoStats& from);
-  void MergeFrom(const CmdResponse_InfoStats& from);
+  void CopyFrom(const CmdRequest_Incrby& from);
+  void MergeFrom(const CmdRequest_Incrby& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1902,55 +1961,75 @@ class CmdResponse_InfoStats : public ::google::protobuf::Message {
   inline ::std::string* release_table_name();
   inline void set_allocated_table_name(::std::string* table_name);
 
-  // required int64 total_querys = 2;
-  inline bool has_total_querys() const;
-  inline void clear_total_querys();
-  static const int kTotalQuerysFieldNumber = 2;
-  inline ::google::protobuf::int64 total_querys() const;
-  inline void set_total_querys(::google::protobuf::int64 value);
+  // required string key = 2;
+  inline bool has_key() const;
+  inline void clear_key();
+  static const int kKeyFieldNumber = 2;
+  inline const ::std::string& key() const;
+  inline void set_key(const ::std::string& value);
+  inline void set_key(const char* value);
+  inline void set_key(const char* value, size_t size);
+  inline ::std::string* mutable_key();
+  inline ::std::string* release_key();
+  inline void set_allocated_key(::std::string* key);
 
-  // required int32 qps = 3;
-  inline bool has_qps() const;
-  inline void clear_qps();
-  static const int kQpsFieldNumber = 3;
-  inline ::google::protobuf::int32 qps() const;
-  inline void set_qps(::google::protobuf::int32 value);
+  // required int64 by = 3;
+  inline bool has_by() const;
+  inline void clear_by();
+  static const int kByFieldNumber = 3;
+  inline ::google::protobuf::int64 by() const;
+  inline void set_by(::google::protobuf::int64 value);
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoStats)
+  // optional string uuid = 4;
+  inline bool has_uuid() const;
+  inline void clear_uuid();
+  static const int kUuidFieldNumber = 4;
+  inline const ::std::string& uuid() const;
+  inline void set_uuid(const ::std::string& value);
+  inline void set_uuid(const char* value);
+  inline void set_uuid(const char* value, size_t size);
+  inline ::std::string* mutable_uuid();
+  inline ::std::string* release_uuid();
+  inline void set_allocated_uuid(::std::string* uuid);
+
+  // @@protoc_insertion_point(class_scope:client.CmdRequest.Incrby)
  private:
   inline void set_has_table_name();
   inline void clear_has_table_name();
-  inline void set_has_total_querys();
-  inline void clear_has_total_querys();
-  inline void set_has_qps();
-  inline void clear_has_qps();
+  inline void set_has_key();
+  inline void clear_has_key();
+  inline void set_has_by();
+  inline void clear_has_by();
+  inline void set_has_uuid();
+  inline void clear_has_uuid();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* table_name_;
-  ::google::protobuf::int64 total_querys_;
-  ::google::protobuf::int32 qps_;
+  ::std::string* key_;
+  ::google::protobuf::int64 by_;
+  ::std::string* uuid_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdResponse_InfoStats* default_instance_;
+  static CmdRequest_Incrby* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_InfoCapacity : public ::google::protobuf::Message {
+class CmdRequest : public ::google::protobuf::Message {
  public:
-  CmdResponse_InfoCapacity();
-  virtual ~CmdResponse_InfoCapacity();
+  CmdRequest();
+  virtual ~CmdRequest();
 
-  CmdResponse_InfoCapacity(const CmdResponse_InfoCapacity& from);
+  CmdRequest(const CmdRequest& from);
 
-  inline CmdResponse_InfoCapacity& operator=(const CmdResponse_InfoCapacity& from) {
+  inline CmdRequest& operator=(const CmdRequest& from) {
     CopyFrom(from);
     return *this;
   }
@@ -1964,17 +2043,17 @@ class CmdResponse_InfoCapacity : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_InfoCapacity& default_instance();
+  static const CmdRequest& default_instance();
 
-  void Swap(CmdResponse_InfoCapacity* other);
+  void Swap(CmdRequest* other);
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_InfoCapacity* New() const;
+  CmdRequest* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_InfoCapacity& from);
-  void MergeFrom(const CmdResponse_InfoCapacity& from);
+  void CopyFrom(const CmdRequest& from);
+  void MergeFrom(const CmdRequest& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -1995,69 +2074,188 @@ class CmdResponse_InfoCapacity : public ::google::protobuf::Message {
 
   // nested types ----------------------------------------------------
 
+  typedef CmdRequest_Sync Sync;
+  typedef CmdRequest_Set Set;
+  typedef CmdRequest_Get Get;
+  typedef CmdRequest_Del Del;
+  typedef CmdRequest_Info Info;
+  typedef CmdRequest_Mget Mget;
+  typedef CmdRequest_FlushDB FlushDB;
+  typedef CmdRequest_Mset Mset;
+  typedef CmdRequest_Scan Scan;
+  typedef CmdRequest_Cas Cas;
+  typedef CmdRequest_Incrby Incrby;
+
   // accessors -------------------------------------------------------
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
+  // required .client.Type type = 1;
+  inline bool has_type() const;
+  inline void clear_type();
+  static const int kTypeFieldNumber = 1;
+  inline ::client::Type type() const;
+  inline void set_type(::client::Type value);
 
-  // required int64 used = 2;
-  inline bool has_used() const;
-  inline void clear_used();
-  static const int kUsedFieldNumber = 2;
-  inline ::google::protobuf::int64 used() const;
-  inline void set_used(::google::protobuf::int64 value);
+  // optional .client.CmdRequest.Sync sync = 2;
+  inline bool has_sync() const;
+  inline void clear_sync();
+  static const int kSyncFieldNumber = 2;
+  inline const ::client::CmdRequest_Sync& sync() const;
+  inline ::client::CmdRequest_Sync* mutable_sync();
+  inline ::client::CmdRequest_Sync* release_sync();
+  inline void set_allocated_sync(::client::CmdRequest_Sync* sync);
 
-  // required int64 remain = 3;
-  inline bool has_remain() const;
-  inline void clear_remain();
-  static const int kRemainFieldNumber = 3;
-  inline ::google::protobuf::int64 remain() const;
-  inline void set_remain(::google::protobuf::int64 value);
+  // optional .client.CmdRequest.Set set = 3;
+  inline bool has_set() const;
+  inline void clear_set();
+  static const int kSetFieldNumber = 3;
+  inline const ::client::CmdRequest_Set& set() const;
+  inline ::client::CmdRequest_Set* mutable_set();
+  inline ::client::CmdRequest_Set* release_set();
+  inline void set_allocated_set(::client::CmdRequest_Set* set);
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoCapacity)
+  // optional .client.CmdRequest.Get get = 4;
+  inline bool has_get() const;
+  inline void clear_get();
+  static const int kGetFieldNumber = 4;
+  inline const ::client::CmdRequest_Get& get() const;
+  inline ::client::CmdRequest_Get* mutable_get();
+  inline ::client::CmdRequest_Get* release_get();
+  inline void set_allocated_get(::client::CmdRequest_Get* get);
+
+  // optional .client.CmdRequest.Del del = 5;
+  inline bool has_del() const;
+  inline void clear_del();
+  static const int kDelFieldNumber = 5;
+  inline const ::client::CmdRequest_Del& del() const;
+  inline ::client::CmdRequest_Del* mutable_del();
+  inline ::client::CmdRequest_Del* release_del();
+  inline void set_allocated_del(::client::CmdRequest_Del* del);
+
+  // optional .client.CmdRequest.Info info = 6;
+  inline bool has_info() const;
+  inline void clear_info();
+  static const int kInfoFieldNumber = 6;
+  inline const ::client::CmdRequest_Info& info() const;
+  inline ::client::CmdRequest_Info* mutable_info();
+  inline ::client::CmdRequest_Info* release_info();
+  inline void set_allocated_info(::client::CmdRequest_Info* info);
+
+  // optional .client.CmdRequest.Mget mget = 7;
+  inline bool has_mget() const;
+  inline void clear_mget();
+  static const int kMgetFieldNumber = 7;
+  inline const ::client::CmdRequest_Mget& mget() const;
+  inline ::client::CmdRequest_Mget* mutable_mget();
+  inline ::client::CmdRequest_Mget* release_mget();
+  inline void set_allocated_mget(::client::CmdRequest_Mget* mget);
+
+  // optional .client.CmdRequest.FlushDB flushdb = 8;
+  inline bool has_flushdb() const;
+  inline void clear_flushdb();
+  static const int kFlushdbFieldNumber = 8;
+  inline const ::client::CmdRequest_FlushDB& flushdb() const;
+  inline ::client::CmdRequest_FlushDB* mutable_flushdb();
+  inline ::client::CmdRequest_FlushDB* release_flushdb();
+  inline void set_allocated_flushdb(::client::CmdRequest_FlushDB* flushdb);
+
+  // optional .client.CmdRequest.Mset mset = 9;
+  inline bool has_mset() const;
+  inline void clear_mset();
+  static const int kMsetFieldNumber = 9;
+  inline const ::client::CmdRequest_Mset& mset() const;
+  inline ::client::CmdRequest_Mset* mutable_mset();
+  inline ::client::CmdRequest_Mset* release_mset();
+  inline void set_allocated_mset(::client::CmdRequest_Mset* mset);
+
+  // optional .client.CmdRequest.Scan scan = 10;
+  inline bool has_scan() const;
+  inline void clear_scan();
+  static const int kScanFieldNumber = 10;
+  inline const ::client::CmdRequest_Scan& scan() const;
+  inline ::client::CmdRequest_Scan* mutable_scan();
+  inline ::client::CmdRequest_Scan* release_scan();
+  inline void set_allocated_scan(::client::CmdRequest_Scan* scan);
+
+  // optional .client.CmdRequest.Cas cas = 11;
+  inline bool has_cas() const;
+  inline void clear_cas();
+  static const int kCasFieldNumber = 11;
+  inline const ::client::CmdRequest_Cas& cas() const;
+  inline ::client::CmdRequest_Cas* mutable_cas();
+  inline ::client::CmdRequest_Cas* release_cas();
+  inline void set_allocated_cas(::client::CmdRequest_Cas* cas);
+
+  // optional .client.CmdRequest.Incrby incrby = 12;
+  inline bool has_incrby() const;
+  inline void clear_incrby();
+  static const int kIncrbyFieldNumber = 12;
+  inline const ::client::CmdRequest_Incrby& incrby() const;
+  inline ::client::CmdRequest_Incrby* mutable_incrby();
+  inline ::client::CmdRequest_Incrby* release_incrby();
+  inline void set_allocated_incrby(::client::CmdRequest_Incrby* incrby);
+
+  // @@protoc_insertion_point(class_scope:client.CmdRequest)
  private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_used();
-  inline void clear_has_used();
-  inline void set_has_remain();
-  inline void clear_has_remain();
+  inline void set_has_type();
+  inline void clear_has_type();
+  inline void set_has_sync();
+  inline void clear_has_sync();
+  inline void set_has_set();
+  inline void clear_has_set();
+  inline void set_has_get();
+  inline void clear_has_get();
+  inline void set_has_del();
+  inline void clear_has_del();
+  inline void set_has_info();
+  inline void clear_has_info();
+  inline void set_has_mget();
+  inline void clear_has_mget();
+  inline void set_has_flushdb();
+  inline void clear_has_flushdb();
+  inline void set_has_mset();
+  inline void clear_has_mset();
+  inline void set_has_scan();
+  inline void clear_has_scan();
+  inline void set_has_cas();
+  inline void clear_has_cas();
+  inline void set_has_incrby();
+  inline void clear_has_incrby();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
-  ::std::string* table_name_;
-  ::google::protobuf::int64 used_;
-  ::google::protobuf::int64 remain_;
+  ::client::CmdRequest_Sync* sync_;
+  ::client::CmdRequest_Set* set_;
+  ::client::CmdRequest_Get* get_;
+  ::client::CmdRequest_Del* del_;
+  ::client::CmdRequest_Info* info_;
+  ::client::CmdRequest_Mget* mget_;
+  ::client::CmdRequest_FlushDB* flushdb_;
+  ::client::CmdRequest_Mset* mset_;
+  ::client::CmdRequest_Scan* scan_;
+  ::client::CmdRequest_Cas* cas_;
+  ::client::CmdRequest_Incrby* incrby_;
+  int type_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(12 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdResponse_InfoCapacity* default_instance_;
+  static CmdRequest* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_InfoRepl : public ::google::protobuf::Message {
+class CmdResponse_Sync : public ::google::protobuf::Message {
  public:
-  CmdResponse_InfoRepl();
-  virtual ~CmdResponse_InfoRepl();
+  CmdResponse_Sync();
+  virtual ~CmdResponse_Sync();
 
-  CmdResponse_InfoRepl(const CmdResponse_InfoRepl& from);
+  CmdResponse_Sync(const CmdResponse_Sync& from);
 
-  inline CmdResponse_InfoRepl& operator=(const CmdResponse_InfoRepl& from) {
+  inline CmdResponse_Sync& operator=(const CmdResponse_Sync& from) {
     CopyFrom(from);
     return *this;
   }
@@ -2071,17 +2269,17 @@ class CmdResponse_InfoRepl : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_InfoRepl& default_instance();
+  static const CmdResponse_Sync& default_instance();
 
-  void Swap(CmdResponse_InfoRepl* other);
+  void Swap(CmdResponse_Sync* other);
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_InfoRepl* New() const;
+  CmdResponse_Sync* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_InfoRepl& from);
-  void MergeFrom(const CmdResponse_InfoRepl& from);
+  void CopyFrom(const CmdResponse_Sync& from);
+  void MergeFrom(const CmdResponse_Sync& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -2116,58 +2314,47 @@ class CmdResponse_InfoRepl : public ::google::protobuf::Message {
   inline ::std::string* release_table_name();
   inline void set_allocated_table_name(::std::string* table_name);
 
-  // required int64 partition_cnt = 2;
-  inline bool has_partition_cnt() const;
-  inline void clear_partition_cnt();
-  static const int kPartitionCntFieldNumber = 2;
-  inline ::google::protobuf::int64 partition_cnt() const;
-  inline void set_partition_cnt(::google::protobuf::int64 value);
-
-  // repeated .client.PartitionState partition_state = 3;
-  inline int partition_state_size() const;
-  inline void clear_partition_state();
-  static const int kPartitionStateFieldNumber = 3;
-  inline const ::client::PartitionState& partition_state(int index) const;
-  inline ::client::PartitionState* mutable_partition_state(int index);
-  inline ::client::PartitionState* add_partition_state();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::PartitionState >&
-      partition_state() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::PartitionState >*
-      mutable_partition_state();
+  // required .client.SyncOffset sync_offset = 2;
+  inline bool has_sync_offset() const;
+  inline void clear_sync_offset();
+  static const int kSyncOffsetFieldNumber = 2;
+  inline const ::client::SyncOffset& sync_offset() const;
+  inline ::client::SyncOffset* mutable_sync_offset();
+  inline ::client::SyncOffset* release_sync_offset();
+  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoRepl)
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Sync)
  private:
   inline void set_has_table_name();
   inline void clear_has_table_name();
-  inline void set_has_partition_cnt();
-  inline void clear_has_partition_cnt();
+  inline void set_has_sync_offset();
+  inline void clear_has_sync_offset();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* table_name_;
-  ::google::protobuf::int64 partition_cnt_;
-  ::google::protobuf::RepeatedPtrField< ::client::PartitionState > partition_state_;
+  ::client::SyncOffset* sync_offset_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdResponse_InfoRepl* default_instance_;
+  static CmdResponse_Sync* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_Mget : public ::google::protobuf::Message {
+class CmdResponse_Get : public ::google::protobuf::Message {
  public:
-  CmdResponse_Mget();
-  virtual ~CmdResponse_Mget();
+  CmdResponse_Get();
+  virtual ~CmdResponse_Get();
 
-  CmdResponse_Mget(const CmdResponse_Mget& from);
+  CmdResponse_Get(const CmdResponse_Get& from);
 
-  inline CmdResponse_Mget& operator=(const CmdResponse_Mget& from) {
+  inline CmdResponse_Get& operator=(const CmdResponse_Get& from) {
     CopyFrom(from);
     return *this;
   }
@@ -2181,17 +2368,17 @@ class CmdResponse_Mget : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_Mget& default_instance();
+  static const CmdResponse_Get& default_instance();
 
-  void Swap(CmdResponse_Mget* other);
+  void Swap(CmdResponse_Get* other);
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_Mget* New() const;
+  CmdResponse_Get* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_Mget& from);
-  void MergeFrom(const CmdResponse_Mget& from);
+  void CopyFrom(const CmdResponse_Get& from);
+  void MergeFrom(const CmdResponse_Get& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -2214,22 +2401,10 @@ class CmdResponse_Mget : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
-  // required string key = 1;
-  inline bool has_key() const;
-  inline void clear_key();
-  static const int kKeyFieldNumber = 1;
-  inline const ::std::string& key() const;
-  inline void set_key(const ::std::string& value);
-  inline void set_key(const char* value);
-  inline void set_key(const char* value, size_t size);
-  inline ::std::string* mutable_key();
-  inline ::std::string* release_key();
-  inline void set_allocated_key(::std::string* key);
-
-  // required bytes value = 2;
+  // optional bytes value = 1;
   inline bool has_value() const;
   inline void clear_value();
-  static const int kValueFieldNumber = 2;
+  static const int kValueFieldNumber = 1;
   inline const ::std::string& value() const;
   inline void set_value(const ::std::string& value);
   inline void set_value(const char* value);
@@ -2238,38 +2413,35 @@ class CmdResponse_Mget : public ::google::protobuf::Message {
   inline ::std::string* release_value();
   inline void set_allocated_value(::std::string* value);
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.Mget)
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Get)
  private:
-  inline void set_has_key();
-  inline void clear_has_key();
   inline void set_has_value();
   inline void clear_has_value();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
-  ::std::string* key_;
   ::std::string* value_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdResponse_Mget* default_instance_;
+  static CmdResponse_Get* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_InfoServer : public ::google::protobuf::Message {
+class CmdResponse_InfoStats : public ::google::protobuf::Message {
  public:
-  CmdResponse_InfoServer();
-  virtual ~CmdResponse_InfoServer();
+  CmdResponse_InfoStats();
+  virtual ~CmdResponse_InfoStats();
 
-  CmdResponse_InfoServer(const CmdResponse_InfoServer& from);
+  CmdResponse_InfoStats(const CmdResponse_InfoStats& from);
 
-  inline CmdResponse_InfoServer& operator=(const CmdResponse_InfoServer& from) {
+  inline CmdResponse_InfoStats& operator=(const CmdResponse_InfoStats& from) {
     CopyFrom(from);
     return *this;
   }
@@ -2283,17 +2455,17 @@ class CmdResponse_InfoServer : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_InfoServer& default_instance();
+  static const CmdResponse_InfoStats& default_instance();
 
-  void Swap(CmdResponse_InfoServer* other);
+  void Swap(CmdResponse_InfoStats* other);
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_InfoServer* New() const;
+  CmdResponse_InfoStats* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_InfoServer& from);
-  void MergeFrom(const CmdResponse_InfoServer& from);
+  void CopyFrom(const CmdResponse_InfoStats& from);
+  void MergeFrom(const CmdResponse_InfoStats& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -2316,81 +2488,67 @@ class CmdResponse_InfoServer : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
-  // required int64 epoch = 1;
-  inline bool has_epoch() const;
-  inline void clear_epoch();
-  static const int kEpochFieldNumber = 1;
-  inline ::google::protobuf::int64 epoch() const;
-  inline void set_epoch(::google::protobuf::int64 value);
-
-  // repeated string table_names = 2;
-  inline int table_names_size() const;
-  inline void clear_table_names();
-  static const int kTableNamesFieldNumber = 2;
-  inline const ::std::string& table_names(int index) const;
-  inline ::std::string* mutable_table_names(int index);
-  inline void set_table_names(int index, const ::std::string& value);
-  inline void set_table_names(int index, const char* value);
-  inline void set_table_names(int index, const char* value, size_t size);
-  inline ::std::string* add_table_names();
-  inline void add_table_names(const ::std::string& value);
-  inline void add_table_names(const char* value);
-  inline void add_table_names(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& table_names() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_table_names();
+  // required string table_name = 1;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 1;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
 
-  // required .client.Node cur_meta = 3;
-  inline bool has_cur_meta() const;
-  inline void clear_cur_meta();
-  static const int kCurMetaFieldNumber = 3;
-  inline const ::client::Node& cur_meta() const;
-  inline ::client::Node* mutable_cur_meta();
-  inline ::client::Node* release_cur_meta();
-  inline void set_allocated_cur_meta(::client::Node* cur_meta);
+  // required int64 total_querys = 2;
+  inline bool has_total_querys() const;
+  inline void clear_total_querys();
+  static const int kTotalQuerysFieldNumber = 2;
+  inline ::google::protobuf::int64 total_querys() const;
+  inline void set_total_querys(::google::protobuf::int64 value);
 
-  // required bool meta_renewing = 4;
-  inline bool has_meta_renewing() const;
-  inline void clear_meta_renewing();
-  static const int kMetaRenewingFieldNumber = 4;
-  inline bool meta_renewing() const;
-  inline void set_meta_renewing(bool value);
+  // required int32 qps = 3;
+  inline bool has_qps() const;
+  inline void clear_qps();
+  static const int kQpsFieldNumber = 3;
+  inline ::google::protobuf::int32 qps() const;
+  inline void set_qps(::google::protobuf::int32 value);
 
-  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoServer)
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoStats)
  private:
-  inline void set_has_epoch();
-  inline void clear_has_epoch();
-  inline void set_has_cur_meta();
-  inline void clear_has_cur_meta();
-  inline void set_has_meta_renewing();
-  inline void clear_has_meta_renewing();
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
+  inline void set_has_total_querys();
+  inline void clear_has_total_querys();
+  inline void set_has_qps();
+  inline void clear_has_qps();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
-  ::google::protobuf::int64 epoch_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> table_names_;
-  ::client::Node* cur_meta_;
-  bool meta_renewing_;
+  ::std::string* table_name_;
+  ::google::protobuf::int64 total_querys_;
+  ::google::protobuf::int32 qps_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdResponse_InfoServer* default_instance_;
+  static CmdResponse_InfoStats* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse : public ::google::protobuf::Message {
+class CmdResponse_InfoCapacity : public ::google::protobuf::Message {
  public:
-  CmdResponse();
-  virtual ~CmdResponse();
+  CmdResponse_InfoCapacity();
+  virtual ~CmdResponse_InfoCapacity();
 
-  CmdResponse(const CmdResponse& from);
+  CmdResponse_InfoCapacity(const CmdResponse_InfoCapacity& from);
 
-  inline CmdResponse& operator=(const CmdResponse& from) {
+  inline CmdResponse_InfoCapacity& operator=(const CmdResponse_InfoCapacity& from) {
     CopyFrom(from);
     return *this;
   }
@@ -2404,17 +2562,17 @@ class CmdResponse : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse& default_instance();
+  static const CmdResponse_InfoCapacity& default_instance();
 
-  void Swap(CmdResponse* other);
+  void Swap(CmdResponse_InfoCapacity* other);
 
   // implements Message ----------------------------------------------
 
-  CmdResponse* New() const;
+  CmdResponse_InfoCapacity* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse& from);
-  void MergeFrom(const CmdResponse& from);
+  void CopyFrom(const CmdResponse_InfoCapacity& from);
+  void MergeFrom(const CmdResponse_InfoCapacity& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -2435,177 +2593,69 @@ class CmdResponse : public ::google::protobuf::Message {
 
   // nested types ----------------------------------------------------
 
-  typedef CmdResponse_Sync Sync;
-  typedef CmdResponse_Get Get;
-  typedef CmdResponse_InfoStats InfoStats;
-  typedef CmdResponse_InfoCapacity InfoCapacity;
-  typedef CmdResponse_InfoRepl InfoRepl;
-  typedef CmdResponse_Mget Mget;
-  typedef CmdResponse_InfoServer InfoServer;
-
   // accessors -------------------------------------------------------
 
-  // required .client.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::client::Type type() const;
-  inline void set_type(::client::Type value);
+  // required string table_name = 1;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 1;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
 
-  // required .client.StatusCode code = 2;
-  inline bool has_code() const;
-  inline void clear_code();
-  static const int kCodeFieldNumber = 2;
-  inline ::client::StatusCode code() const;
-  inline void set_code(::client::StatusCode value);
+  // required int64 used = 2;
+  inline bool has_used() const;
+  inline void clear_used();
+  static const int kUsedFieldNumber = 2;
+  inline ::google::protobuf::int64 used() const;
+  inline void set_used(::google::protobuf::int64 value);
 
-  // optional string msg = 3;
-  inline bool has_msg() const;
-  inline void clear_msg();
-  static const int kMsgFieldNumber = 3;
-  inline const ::std::string& msg() const;
-  inline void set_msg(const ::std::string& value);
-  inline void set_msg(const char* value);
-  inline void set_msg(const char* value, size_t size);
-  inline ::std::string* mutable_msg();
-  inline ::std::string* release_msg();
-  inline void set_allocated_msg(::std::string* msg);
+  // required int64 remain = 3;
+  inline bool has_remain() const;
+  inline void clear_remain();
+  static const int kRemainFieldNumber = 3;
+  inline ::google::protobuf::int64 remain() const;
+  inline void set_remain(::google::protobuf::int64 value);
 
-  // optional .client.CmdResponse.Sync sync = 4;
-  inline bool has_sync() const;
-  inline void clear_sync();
-  static const int kSyncFieldNumber = 4;
-  inline const ::client::CmdResponse_Sync& sync() const;
-  inline ::client::CmdResponse_Sync* mutable_sync();
-  inline ::client::CmdResponse_Sync* release_sync();
-  inline void set_allocated_sync(::client::CmdResponse_Sync* sync);
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoCapacity)
+ private:
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
+  inline void set_has_used();
+  inline void clear_has_used();
+  inline void set_has_remain();
+  inline void clear_has_remain();
 
-  // optional .client.CmdResponse.Get get = 5;
-  inline bool has_get() const;
-  inline void clear_get();
-  static const int kGetFieldNumber = 5;
-  inline const ::client::CmdResponse_Get& get() const;
-  inline ::client::CmdResponse_Get* mutable_get();
-  inline ::client::CmdResponse_Get* release_get();
-  inline void set_allocated_get(::client::CmdResponse_Get* get);
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
-  // optional .client.Node redirect = 6;
-  inline bool has_redirect() const;
-  inline void clear_redirect();
-  static const int kRedirectFieldNumber = 6;
-  inline const ::client::Node& redirect() const;
-  inline ::client::Node* mutable_redirect();
-  inline ::client::Node* release_redirect();
-  inline void set_allocated_redirect(::client::Node* redirect);
-
-  // repeated .client.CmdResponse.InfoStats info_stats = 7;
-  inline int info_stats_size() const;
-  inline void clear_info_stats();
-  static const int kInfoStatsFieldNumber = 7;
-  inline const ::client::CmdResponse_InfoStats& info_stats(int index) const;
-  inline ::client::CmdResponse_InfoStats* mutable_info_stats(int index);
-  inline ::client::CmdResponse_InfoStats* add_info_stats();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >&
-      info_stats() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >*
-      mutable_info_stats();
-
-  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-  inline int info_capacity_size() const;
-  inline void clear_info_capacity();
-  static const int kInfoCapacityFieldNumber = 8;
-  inline const ::client::CmdResponse_InfoCapacity& info_capacity(int index) const;
-  inline ::client::CmdResponse_InfoCapacity* mutable_info_capacity(int index);
-  inline ::client::CmdResponse_InfoCapacity* add_info_capacity();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >&
-      info_capacity() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >*
-      mutable_info_capacity();
-
-  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-  inline int info_repl_size() const;
-  inline void clear_info_repl();
-  static const int kInfoReplFieldNumber = 9;
-  inline const ::client::CmdResponse_InfoRepl& info_repl(int index) const;
-  inline ::client::CmdResponse_InfoRepl* mutable_info_repl(int index);
-  inline ::client::CmdResponse_InfoRepl* add_info_repl();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >&
-      info_repl() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >*
-      mutable_info_repl();
-
-  // repeated .client.CmdResponse.Mget mget = 10;
-  inline int mget_size() const;
-  inline void clear_mget();
-  static const int kMgetFieldNumber = 10;
-  inline const ::client::CmdResponse_Mget& mget(int index) const;
-  inline ::client::CmdResponse_Mget* mutable_mget(int index);
-  inline ::client::CmdResponse_Mget* add_mget();
-  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >&
-      mget() const;
-  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >*
-      mutable_mget();
-
-  // optional .client.CmdResponse.InfoServer info_server = 11;
-  inline bool has_info_server() const;
-  inline void clear_info_server();
-  static const int kInfoServerFieldNumber = 11;
-  inline const ::client::CmdResponse_InfoServer& info_server() const;
-  inline ::client::CmdResponse_InfoServer* mutable_info_server();
-  inline ::client::CmdResponse_InfoServer* release_info_server();
-  inline void set_allocated_info_server(::client::CmdResponse_InfoServer* info_server);
-
-  // @@protoc_insertion_point(class_scope:client.CmdResponse)
- private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_code();
-  inline void clear_has_code();
-  inline void set_has_msg();
-  inline void clear_has_msg();
-  inline void set_has_sync();
-  inline void clear_has_sync();
-  inline void set_has_get();
-  inline void clear_has_get();
-  inline void set_has_redirect();
-  inline void clear_has_redirect();
-  inline void set_has_info_server();
-  inline void clear_has_info_server();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  int type_;
-  int code_;
-  ::std::string* msg_;
-  ::client::CmdResponse_Sync* sync_;
-  ::client::CmdResponse_Get* get_;
-  ::client::Node* redirect_;
-  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats > info_stats_;
-  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity > info_capacity_;
-  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl > info_repl_;
-  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget > mget_;
-  ::client::CmdResponse_InfoServer* info_server_;
+  ::std::string* table_name_;
+  ::google::protobuf::int64 used_;
+  ::google::protobuf::int64 remain_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(11 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static CmdResponse* default_instance_;
+  static CmdResponse_InfoCapacity* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class BinlogSkip : public ::google::protobuf::Message {
+class CmdResponse_InfoRepl : public ::google::protobuf::Message {
  public:
-  BinlogSkip();
-  virtual ~BinlogSkip();
+  CmdResponse_InfoRepl();
+  virtual ~CmdResponse_InfoRepl();
 
-  BinlogSkip(const BinlogSkip& from);
+  CmdResponse_InfoRepl(const CmdResponse_InfoRepl& from);
 
-  inline BinlogSkip& operator=(const BinlogSkip& from) {
+  inline CmdResponse_InfoRepl& operator=(const CmdResponse_InfoRepl& from) {
     CopyFrom(from);
     return *this;
   }
@@ -2619,17 +2669,17 @@ class BinlogSkip : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const BinlogSkip& default_instance();
+  static const CmdResponse_InfoRepl& default_instance();
 
-  void Swap(BinlogSkip* other);
+  void Swap(CmdResponse_InfoRepl* other);
 
   // implements Message ----------------------------------------------
 
-  BinlogSkip* New() const;
+  CmdResponse_InfoRepl* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const BinlogSkip& from);
-  void MergeFrom(const BinlogSkip& from);
+  void CopyFrom(const CmdResponse_InfoRepl& from);
+  void MergeFrom(const CmdResponse_InfoRepl& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -2664,34 +2714,37 @@ class BinlogSkip : public ::google::protobuf::Message {
   inline ::std::string* release_table_name();
   inline void set_allocated_table_name(::std::string* table_name);
 
-  // required int32 partition_id = 2;
-  inline bool has_partition_id() const;
-  inline void clear_partition_id();
-  static const int kPartitionIdFieldNumber = 2;
-  inline ::google::protobuf::int32 partition_id() const;
-  inline void set_partition_id(::google::protobuf::int32 value);
+  // required int64 partition_cnt = 2;
+  inline bool has_partition_cnt() const;
+  inline void clear_partition_cnt();
+  static const int kPartitionCntFieldNumber = 2;
+  inline ::google::protobuf::int64 partition_cnt() const;
+  inline void set_partition_cnt(::google::protobuf::int64 value);
 
-  // required int64 gap = 3;
-  inline bool has_gap() const;
-  inline void clear_gap();
-  static const int kGapFieldNumber = 3;
-  inline ::google::protobuf::int64 gap() const;
-  inline void set_gap(::google::protobuf::int64 value);
+  // repeated .client.PartitionState partition_state = 3;
+  inline int partition_state_size() const;
+  inline void clear_partition_state();
+  static const int kPartitionStateFieldNumber = 3;
+  inline const ::client::PartitionState& partition_state(int index) const;
+  inline ::client::PartitionState* mutable_partition_state(int index);
+  inline ::client::PartitionState* add_partition_state();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::PartitionState >&
+      partition_state() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::PartitionState >*
+      mutable_partition_state();
 
-  // @@protoc_insertion_point(class_scope:client.BinlogSkip)
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoRepl)
  private:
   inline void set_has_table_name();
   inline void clear_has_table_name();
-  inline void set_has_partition_id();
-  inline void clear_has_partition_id();
-  inline void set_has_gap();
-  inline void clear_has_gap();
+  inline void set_has_partition_cnt();
+  inline void clear_has_partition_cnt();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* table_name_;
-  ::google::protobuf::int64 gap_;
-  ::google::protobuf::int32 partition_id_;
+  ::google::protobuf::int64 partition_cnt_;
+  ::google::protobuf::RepeatedPtrField< ::client::PartitionState > partition_state_;
 
   mutable int _cached_size_;
   ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
@@ -2701,18 +2754,18 @@ class BinlogSkip : public ::google::protobuf::Message {
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static BinlogSkip* default_instance_;
+  static CmdResponse_InfoRepl* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class SyncLease : public ::google::protobuf::Message {
+class CmdResponse_Mget : public ::google::protobuf::Message {
  public:
-  SyncLease();
-  virtual ~SyncLease();
+  CmdResponse_Mget();
+  virtual ~CmdResponse_Mget();
 
-  SyncLease(const SyncLease& from);
+  CmdResponse_Mget(const CmdResponse_Mget& from);
 
-  inline SyncLease& operator=(const SyncLease& from) {
+  inline CmdResponse_Mget& operator=(const CmdResponse_Mget& from) {
     CopyFrom(from);
     return *this;
   }
@@ -2726,17 +2779,17 @@ class SyncLease : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const SyncLease& default_instance();
+  static const CmdResponse_Mget& default_instance();
 
-  void Swap(SyncLease* other);
+  void Swap(CmdResponse_Mget* other);
 
   // implements Message ----------------------------------------------
 
-  SyncLease* New() const;
+  CmdResponse_Mget* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SyncLease& from);
-  void MergeFrom(const SyncLease& from);
+  void CopyFrom(const CmdResponse_Mget& from);
+  void MergeFrom(const CmdResponse_Mget& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -2759,67 +2812,62 @@ class SyncLease : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
-  // required string table_name = 1;
-  inline bool has_table_name() const;
-  inline void clear_table_name();
-  static const int kTableNameFieldNumber = 1;
-  inline const ::std::string& table_name() const;
-  inline void set_table_name(const ::std::string& value);
-  inline void set_table_name(const char* value);
-  inline void set_table_name(const char* value, size_t size);
-  inline ::std::string* mutable_table_name();
-  inline ::std::string* release_table_name();
-  inline void set_allocated_table_name(::std::string* table_name);
-
-  // required int32 partition_id = 2;
-  inline bool has_partition_id() const;
-  inline void clear_partition_id();
-  static const int kPartitionIdFieldNumber = 2;
-  inline ::google::protobuf::int32 partition_id() const;
-  inline void set_partition_id(::google::protobuf::int32 value);
+  // required string key = 1;
+  inline bool has_key() const;
+  inline void clear_key();
+  static const int kKeyFieldNumber = 1;
+  inline const ::std::string& key() const;
+  inline void set_key(const ::std::string& value);
+  inline void set_key(const char* value);
+  inline void set_key(const char* value, size_t size);
+  inline ::std::string* mutable_key();
+  inline ::std::string* release_key();
+  inline void set_allocated_key(::std::string* key);
 
-  // required int64 lease = 3;
-  inline bool has_lease() const;
-  inline void clear_lease();
-  static const int kLeaseFieldNumber = 3;
-  inline ::google::protobuf::int64 lease() const;
-  inline void set_lease(::google::protobuf::int64 value);
+  // required bytes value = 2;
+  inline bool has_value() const;
+  inline void clear_value();
+  static const int kValueFieldNumber = 2;
+  inline const ::std::string& value() const;
+  inline void set_value(const ::std::string& value);
+  inline void set_value(const char* value);
+  inline void set_value(const void* value, size_t size);
+  inline ::std::string* mutable_value();
+  inline ::std::string* release_value();
+  inline void set_allocated_value(::std::string* value);
 
-  // @@protoc_insertion_point(class_scope:client.SyncLease)
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Mget)
  private:
-  inline void set_has_table_name();
-  inline void clear_has_table_name();
-  inline void set_has_partition_id();
-  inline void clear_has_partition_id();
-  inline void set_has_lease();
-  inline void clear_has_lease();
+  inline void set_has_key();
+  inline void clear_has_key();
+  inline void set_has_value();
+  inline void clear_has_value();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
-  ::std::string* table_name_;
-  ::google::protobuf::int64 lease_;
-  ::google::protobuf::int32 partition_id_;
+  ::std::string* key_;
+  ::std::string* value_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static SyncLease* default_instance_;
+  static CmdResponse_Mget* default_instance_;
 };
 // -------------------------------------------------------------------
 
-class SyncRequest : public ::google::protobuf::Message {
+class CmdResponse_InfoServer : public ::google::protobuf::Message {
  public:
-  SyncRequest();
-  virtual ~SyncRequest();
+  CmdResponse_InfoServer();
+  virtual ~CmdResponse_InfoServer();
 
-  SyncRequest(const SyncRequest& from);
+  CmdResponse_InfoServer(const CmdResponse_InfoServer& from);
 
-  inline SyncRequest& operator=(const SyncRequest& from) {
+  inline CmdResponse_InfoServer& operator=(const CmdResponse_InfoServer& from) {
     CopyFrom(from);
     return *this;
   }
@@ -2833,18 +2881,18 @@ class SyncRequest : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const SyncRequest& default_instance();
+  static const CmdResponse_InfoServer& default_instance();
 
-  void Swap(SyncRequest* other);
+  void Swap(CmdResponse_InfoServer* other);
 
   // implements Message ----------------------------------------------
 
-  SyncRequest* New() const;
+  CmdResponse_InfoServer* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const SyncRequest& from);
-  void MergeFrom(const SyncRequest& from);
-  void Clear();
+  void CopyFrom(const CmdResponse_InfoServer& from);
+  void MergeFrom(const CmdResponse_InfoServer& from);
+  void Clear();
   bool IsInitialized() const;
 
   int ByteSize() const;
@@ -2866,816 +2914,3766 @@ class SyncRequest : public ::google::protobuf::Message {
 
   // accessors -------------------------------------------------------
 
-  // required .client.SyncType sync_type = 1;
-  inline bool has_sync_type() const;
-  inline void clear_sync_type();
-  static const int kSyncTypeFieldNumber = 1;
-  inline ::client::SyncType sync_type() const;
-  inline void set_sync_type(::client::SyncType value);
-
-  // required int64 epoch = 2;
+  // required int64 epoch = 1;
   inline bool has_epoch() const;
   inline void clear_epoch();
-  static const int kEpochFieldNumber = 2;
+  static const int kEpochFieldNumber = 1;
   inline ::google::protobuf::int64 epoch() const;
   inline void set_epoch(::google::protobuf::int64 value);
 
-  // required .client.Node from = 3;
-  inline bool has_from() const;
-  inline void clear_from();
-  static const int kFromFieldNumber = 3;
-  inline const ::client::Node& from() const;
-  inline ::client::Node* mutable_from();
-  inline ::client::Node* release_from();
-  inline void set_allocated_from(::client::Node* from);
-
-  // optional .client.SyncOffset sync_offset = 4;
-  inline bool has_sync_offset() const;
-  inline void clear_sync_offset();
-  static const int kSyncOffsetFieldNumber = 4;
-  inline const ::client::SyncOffset& sync_offset() const;
-  inline ::client::SyncOffset* mutable_sync_offset();
-  inline ::client::SyncOffset* release_sync_offset();
-  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
-
-  // optional .client.CmdRequest request = 5;
-  inline bool has_request() const;
-  inline void clear_request();
-  static const int kRequestFieldNumber = 5;
-  inline const ::client::CmdRequest& request() const;
-  inline ::client::CmdRequest* mutable_request();
-  inline ::client::CmdRequest* release_request();
-  inline void set_allocated_request(::client::CmdRequest* request);
+  // repeated string table_names = 2;
+  inline int table_names_size() const;
+  inline void clear_table_names();
+  static const int kTableNamesFieldNumber = 2;
+  inline const ::std::string& table_names(int index) const;
+  inline ::std::string* mutable_table_names(int index);
+  inline void set_table_names(int index, const ::std::string& value);
+  inline void set_table_names(int index, const char* value);
+  inline void set_table_names(int index, const char* value, size_t size);
+  inline ::std::string* add_table_names();
+  inline void add_table_names(const ::std::string& value);
+  inline void add_table_names(const char* value);
+  inline void add_table_names(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& table_names() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_table_names();
 
-  // optional .client.BinlogSkip binlog_skip = 6;
-  inline bool has_binlog_skip() const;
-  inline void clear_binlog_skip();
-  static const int kBinlogSkipFieldNumber = 6;
-  inline const ::client::BinlogSkip& binlog_skip() const;
-  inline ::client::BinlogSkip* mutable_binlog_skip();
-  inline ::client::BinlogSkip* release_binlog_skip();
-  inline void set_allocated_binlog_skip(::client::BinlogSkip* binlog_skip);
+  // required .client.Node cur_meta = 3;
+  inline bool has_cur_meta() const;
+  inline void clear_cur_meta();
+  static const int kCurMetaFieldNumber = 3;
+  inline const ::client::Node& cur_meta() const;
+  inline ::client::Node* mutable_cur_meta();
+  inline ::client::Node* release_cur_meta();
+  inline void set_allocated_cur_meta(::client::Node* cur_meta);
 
-  // optional .client.SyncLease sync_lease = 7;
-  inline bool has_sync_lease() const;
-  inline void clear_sync_lease();
-  static const int kSyncLeaseFieldNumber = 7;
-  inline const ::client::SyncLease& sync_lease() const;
-  inline ::client::SyncLease* mutable_sync_lease();
-  inline ::client::SyncLease* release_sync_lease();
-  inline void set_allocated_sync_lease(::client::SyncLease* sync_lease);
+  // required bool meta_renewing = 4;
+  inline bool has_meta_renewing() const;
+  inline void clear_meta_renewing();
+  static const int kMetaRenewingFieldNumber = 4;
+  inline bool meta_renewing() const;
+  inline void set_meta_renewing(bool value);
 
-  // @@protoc_insertion_point(class_scope:client.SyncRequest)
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoServer)
  private:
-  inline void set_has_sync_type();
-  inline void clear_has_sync_type();
   inline void set_has_epoch();
   inline void clear_has_epoch();
-  inline void set_has_from();
-  inline void clear_has_from();
-  inline void set_has_sync_offset();
-  inline void clear_has_sync_offset();
-  inline void set_has_request();
-  inline void clear_has_request();
-  inline void set_has_binlog_skip();
-  inline void clear_has_binlog_skip();
-  inline void set_has_sync_lease();
-  inline void clear_has_sync_lease();
+  inline void set_has_cur_meta();
+  inline void clear_has_cur_meta();
+  inline void set_has_meta_renewing();
+  inline void clear_has_meta_renewing();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::int64 epoch_;
-  ::client::Node* from_;
-  ::client::SyncOffset* sync_offset_;
-  ::client::CmdRequest* request_;
-  ::client::BinlogSkip* binlog_skip_;
-  ::client::SyncLease* sync_lease_;
-  int sync_type_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> table_names_;
+  ::client::Node* cur_meta_;
+  bool meta_renewing_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(7 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
 
   friend void  protobuf_AddDesc_client_2eproto();
   friend void protobuf_AssignDesc_client_2eproto();
   friend void protobuf_ShutdownFile_client_2eproto();
 
   void InitAsDefaultInstance();
-  static SyncRequest* default_instance_;
+  static CmdResponse_InfoServer* default_instance_;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class CmdResponse_Scan : public ::google::protobuf::Message {
+ public:
+  CmdResponse_Scan();
+  virtual ~CmdResponse_Scan();
 
-// Node
+  CmdResponse_Scan(const CmdResponse_Scan& from);
 
-// required string ip = 1;
-inline bool Node::has_ip() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Node::set_has_ip() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Node::clear_has_ip() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void Node::clear_ip() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    ip_->clear();
-  }
-  clear_has_ip();
-}
-inline const ::std::string& Node::ip() const {
-  return *ip_;
-}
-inline void Node::set_ip(const ::std::string& value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
-}
-inline void Node::set_ip(const char* value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
-}
-inline void Node::set_ip(const char* value, size_t size) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Node::mutable_ip() {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  return ip_;
-}
-inline ::std::string* Node::release_ip() {
-  clear_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = ip_;
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+  inline CmdResponse_Scan& operator=(const CmdResponse_Scan& from) {
+    CopyFrom(from);
+    return *this;
   }
-}
-inline void Node::set_allocated_ip(::std::string* ip) {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
   }
-  if (ip) {
-    set_has_ip();
-    ip_ = ip;
-  } else {
-    clear_has_ip();
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
   }
-}
 
-// required int32 port = 2;
-inline bool Node::has_port() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Node::set_has_port() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Node::clear_has_port() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void Node::clear_port() {
-  port_ = 0;
-  clear_has_port();
-}
-inline ::google::protobuf::int32 Node::port() const {
-  return port_;
-}
-inline void Node::set_port(::google::protobuf::int32 value) {
-  set_has_port();
-  port_ = value;
-}
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CmdResponse_Scan& default_instance();
 
-// -------------------------------------------------------------------
+  void Swap(CmdResponse_Scan* other);
 
-// SyncOffset
+  // implements Message ----------------------------------------------
 
-// required int32 filenum = 1;
-inline bool SyncOffset::has_filenum() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SyncOffset::set_has_filenum() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SyncOffset::clear_has_filenum() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void SyncOffset::clear_filenum() {
-  filenum_ = 0;
-  clear_has_filenum();
-}
-inline ::google::protobuf::int32 SyncOffset::filenum() const {
-  return filenum_;
-}
-inline void SyncOffset::set_filenum(::google::protobuf::int32 value) {
-  set_has_filenum();
-  filenum_ = value;
-}
+  CmdResponse_Scan* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CmdResponse_Scan& from);
+  void MergeFrom(const CmdResponse_Scan& from);
+  void Clear();
+  bool IsInitialized() const;
 
-// required int64 offset = 2;
-inline bool SyncOffset::has_offset() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SyncOffset::set_has_offset() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SyncOffset::clear_has_offset() {
-  _has_bits_[0] &= ~0x00000002u;
-}
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .client.Kv kvs = 1;
+  inline int kvs_size() const;
+  inline void clear_kvs();
+  static const int kKvsFieldNumber = 1;
+  inline const ::client::Kv& kvs(int index) const;
+  inline ::client::Kv* mutable_kvs(int index);
+  inline ::client::Kv* add_kvs();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::Kv >&
+      kvs() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::Kv >*
+      mutable_kvs();
+
+  // optional string next_key = 2;
+  inline bool has_next_key() const;
+  inline void clear_next_key();
+  static const int kNextKeyFieldNumber = 2;
+  inline const ::std::string& next_key() const;
+  inline void set_next_key(const ::std::string& value);
+  inline void set_next_key(const char* value);
+  inline void set_next_key(const char* value, size_t size);
+  inline ::std::string* mutable_next_key();
+  inline ::std::string* release_next_key();
+  inline void set_allocated_next_key(::std::string* next_key);
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Scan)
+ private:
+  inline void set_has_next_key();
+  inline void clear_has_next_key();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::RepeatedPtrField< ::client::Kv > kvs_;
+  ::std::string* next_key_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static CmdResponse_Scan* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_InfoLatency : public ::google::protobuf::Message {
+ public:
+  CmdResponse_InfoLatency();
+  virtual ~CmdResponse_InfoLatency();
+
+  CmdResponse_InfoLatency(const CmdResponse_InfoLatency& from);
+
+  inline CmdResponse_InfoLatency& operator=(const CmdResponse_InfoLatency& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CmdResponse_InfoLatency& default_instance();
+
+  void Swap(CmdResponse_InfoLatency* other);
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_InfoLatency* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CmdResponse_InfoLatency& from);
+  void MergeFrom(const CmdResponse_InfoLatency& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required int32 cmd_type = 1;
+  inline bool has_cmd_type() const;
+  inline void clear_cmd_type();
+  static const int kCmdTypeFieldNumber = 1;
+  inline ::google::protobuf::int32 cmd_type() const;
+  inline void set_cmd_type(::google::protobuf::int32 value);
+
+  // required int64 count = 2;
+  inline bool has_count() const;
+  inline void clear_count();
+  static const int kCountFieldNumber = 2;
+  inline ::google::protobuf::int64 count() const;
+  inline void set_count(::google::protobuf::int64 value);
+
+  // required int64 p50_us = 3;
+  inline bool has_p50_us() const;
+  inline void clear_p50_us();
+  static const int kP50UsFieldNumber = 3;
+  inline ::google::protobuf::int64 p50_us() const;
+  inline void set_p50_us(::google::protobuf::int64 value);
+
+  // required int64 p99_us = 4;
+  inline bool has_p99_us() const;
+  inline void clear_p99_us();
+  static const int kP99UsFieldNumber = 4;
+  inline ::google::protobuf::int64 p99_us() const;
+  inline void set_p99_us(::google::protobuf::int64 value);
+
+  // required int64 p999_us = 5;
+  inline bool has_p999_us() const;
+  inline void clear_p999_us();
+  static const int kP999UsFieldNumber = 5;
+  inline ::google::protobuf::int64 p999_us() const;
+  inline void set_p999_us(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoLatency)
+ private:
+  inline void set_has_cmd_type();
+  inline void clear_has_cmd_type();
+  inline void set_has_count();
+  inline void clear_has_count();
+  inline void set_has_p50_us();
+  inline void clear_has_p50_us();
+  inline void set_has_p99_us();
+  inline void clear_has_p99_us();
+  inline void set_has_p999_us();
+  inline void clear_has_p999_us();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::int64 count_;
+  ::google::protobuf::int64 p50_us_;
+  ::google::protobuf::int64 p99_us_;
+  ::google::protobuf::int64 p999_us_;
+  ::google::protobuf::int32 cmd_type_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static CmdResponse_InfoLatency* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_Cas : public ::google::protobuf::Message {
+ public:
+  CmdResponse_Cas();
+  virtual ~CmdResponse_Cas();
+
+  CmdResponse_Cas(const CmdResponse_Cas& from);
+
+  inline CmdResponse_Cas& operator=(const CmdResponse_Cas& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CmdResponse_Cas& default_instance();
+
+  void Swap(CmdResponse_Cas* other);
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Cas* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CmdResponse_Cas& from);
+  void MergeFrom(const CmdResponse_Cas& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional bytes value = 1;
+  inline bool has_value() const;
+  inline void clear_value();
+  static const int kValueFieldNumber = 1;
+  inline const ::std::string& value() const;
+  inline void set_value(const ::std::string& value);
+  inline void set_value(const char* value);
+  inline void set_value(const void* value, size_t size);
+  inline ::std::string* mutable_value();
+  inline ::std::string* release_value();
+  inline void set_allocated_value(::std::string* value);
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Cas)
+ private:
+  inline void set_has_value();
+  inline void clear_has_value();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* value_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static CmdResponse_Cas* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_Incrby : public ::google::protobuf::Message {
+ public:
+  CmdResponse_Incrby();
+  virtual ~CmdResponse_Incrby();
+
+  CmdResponse_Incrby(const CmdResponse_Incrby& from);
+
+  inline CmdResponse_Incrby& operator=(const CmdResponse_Incrby& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CmdResponse_Incrby& default_instance();
+
+  void Swap(CmdResponse_Incrby* other);
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Incrby* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CmdResponse_Incrby& from);
+  void MergeFrom(const CmdResponse_Incrby& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required int64 value = 1;
+  inline bool has_value() const;
+  inline void clear_value();
+  static const int kValueFieldNumber = 1;
+  inline ::google::protobuf::int64 value() const;
+  inline void set_value(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.Incrby)
+ private:
+  inline void set_has_value();
+  inline void clear_has_value();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::int64 value_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static CmdResponse_Incrby* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_InfoSlowlog : public ::google::protobuf::Message {
+ public:
+  CmdResponse_InfoSlowlog();
+  virtual ~CmdResponse_InfoSlowlog();
+
+  CmdResponse_InfoSlowlog(const CmdResponse_InfoSlowlog& from);
+
+  inline CmdResponse_InfoSlowlog& operator=(const CmdResponse_InfoSlowlog& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CmdResponse_InfoSlowlog& default_instance();
+
+  void Swap(CmdResponse_InfoSlowlog* other);
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_InfoSlowlog* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CmdResponse_InfoSlowlog& from);
+  void MergeFrom(const CmdResponse_InfoSlowlog& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required int64 time = 1;
+  inline bool has_time() const;
+  inline void clear_time();
+  static const int kTimeFieldNumber = 1;
+  inline ::google::protobuf::int64 time() const;
+  inline void set_time(::google::protobuf::int64 value);
+
+  // required string table_name = 2;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 2;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
+
+  // required int32 partition = 3;
+  inline bool has_partition() const;
+  inline void clear_partition();
+  static const int kPartitionFieldNumber = 3;
+  inline ::google::protobuf::int32 partition() const;
+  inline void set_partition(::google::protobuf::int32 value);
+
+  // required int32 cmd_type = 4;
+  inline bool has_cmd_type() const;
+  inline void clear_cmd_type();
+  static const int kCmdTypeFieldNumber = 4;
+  inline ::google::protobuf::int32 cmd_type() const;
+  inline void set_cmd_type(::google::protobuf::int32 value);
+
+  // required int64 total_us = 5;
+  inline bool has_total_us() const;
+  inline void clear_total_us();
+  static const int kTotalUsFieldNumber = 5;
+  inline ::google::protobuf::int64 total_us() const;
+  inline void set_total_us(::google::protobuf::int64 value);
+
+  // required int64 suspend_wait_us = 6;
+  inline bool has_suspend_wait_us() const;
+  inline void clear_suspend_wait_us();
+  static const int kSuspendWaitUsFieldNumber = 6;
+  inline ::google::protobuf::int64 suspend_wait_us() const;
+  inline void set_suspend_wait_us(::google::protobuf::int64 value);
+
+  // required int64 lock_wait_us = 7;
+  inline bool has_lock_wait_us() const;
+  inline void clear_lock_wait_us();
+  static const int kLockWaitUsFieldNumber = 7;
+  inline ::google::protobuf::int64 lock_wait_us() const;
+  inline void set_lock_wait_us(::google::protobuf::int64 value);
+
+  // required int64 db_us = 8;
+  inline bool has_db_us() const;
+  inline void clear_db_us();
+  static const int kDbUsFieldNumber = 8;
+  inline ::google::protobuf::int64 db_us() const;
+  inline void set_db_us(::google::protobuf::int64 value);
+
+  // required int64 binlog_us = 9;
+  inline bool has_binlog_us() const;
+  inline void clear_binlog_us();
+  static const int kBinlogUsFieldNumber = 9;
+  inline ::google::protobuf::int64 binlog_us() const;
+  inline void set_binlog_us(::google::protobuf::int64 value);
+
+  // required int64 ack_wait_us = 10;
+  inline bool has_ack_wait_us() const;
+  inline void clear_ack_wait_us();
+  static const int kAckWaitUsFieldNumber = 10;
+  inline ::google::protobuf::int64 ack_wait_us() const;
+  inline void set_ack_wait_us(::google::protobuf::int64 value);
+  // @@protoc_insertion_point(class_scope:client.CmdResponse.InfoSlowlog)
+ private:
+  inline void set_has_time();
+  inline void clear_has_time();
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
+  inline void set_has_partition();
+  inline void clear_has_partition();
+  inline void set_has_cmd_type();
+  inline void clear_has_cmd_type();
+  inline void set_has_total_us();
+  inline void clear_has_total_us();
+  inline void set_has_suspend_wait_us();
+  inline void clear_has_suspend_wait_us();
+  inline void set_has_lock_wait_us();
+  inline void clear_has_lock_wait_us();
+  inline void set_has_db_us();
+  inline void clear_has_db_us();
+  inline void set_has_binlog_us();
+  inline void clear_has_binlog_us();
+  inline void set_has_ack_wait_us();
+  inline void clear_has_ack_wait_us();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::int64 time_;
+  ::std::string* table_name_;
+  ::google::protobuf::int64 total_us_;
+  ::google::protobuf::int64 suspend_wait_us_;
+  ::google::protobuf::int64 lock_wait_us_;
+  ::google::protobuf::int64 db_us_;
+  ::google::protobuf::int64 binlog_us_;
+  ::google::protobuf::int64 ack_wait_us_;
+  ::google::protobuf::int32 partition_;
+  ::google::protobuf::int32 cmd_type_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(10 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static CmdResponse_InfoSlowlog* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse : public ::google::protobuf::Message {
+ public:
+  CmdResponse();
+  virtual ~CmdResponse();
+
+  CmdResponse(const CmdResponse& from);
+
+  inline CmdResponse& operator=(const CmdResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CmdResponse& default_instance();
+
+  void Swap(CmdResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const CmdResponse& from);
+  void MergeFrom(const CmdResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef CmdResponse_Sync Sync;
+  typedef CmdResponse_Get Get;
+  typedef CmdResponse_InfoStats InfoStats;
+  typedef CmdResponse_InfoCapacity InfoCapacity;
+  typedef CmdResponse_InfoRepl InfoRepl;
+  typedef CmdResponse_Mget Mget;
+  typedef CmdResponse_InfoServer InfoServer;
+  typedef CmdResponse_Scan Scan;
+  typedef CmdResponse_InfoLatency InfoLatency;
+  typedef CmdResponse_Cas Cas;
+  typedef CmdResponse_Incrby Incrby;
+  typedef CmdResponse_InfoSlowlog InfoSlowlog;
+
+  // accessors -------------------------------------------------------
+
+  // required .client.Type type = 1;
+  inline bool has_type() const;
+  inline void clear_type();
+  static const int kTypeFieldNumber = 1;
+  inline ::client::Type type() const;
+  inline void set_type(::client::Type value);
+
+  // required .client.StatusCode code = 2;
+  inline bool has_code() const;
+  inline void clear_code();
+  static const int kCodeFieldNumber = 2;
+  inline ::client::StatusCode code() const;
+  inline void set_code(::client::StatusCode value);
+
+  // optional string msg = 3;
+  inline bool has_msg() const;
+  inline void clear_msg();
+  static const int kMsgFieldNumber = 3;
+  inline const ::std::string& msg() const;
+  inline void set_msg(const ::std::string& value);
+  inline void set_msg(const char* value);
+  inline void set_msg(const char* value, size_t size);
+  inline ::std::string* mutable_msg();
+  inline ::std::string* release_msg();
+  inline void set_allocated_msg(::std::string* msg);
+
+  // optional .client.CmdResponse.Sync sync = 4;
+  inline bool has_sync() const;
+  inline void clear_sync();
+  static const int kSyncFieldNumber = 4;
+  inline const ::client::CmdResponse_Sync& sync() const;
+  inline ::client::CmdResponse_Sync* mutable_sync();
+  inline ::client::CmdResponse_Sync* release_sync();
+  inline void set_allocated_sync(::client::CmdResponse_Sync* sync);
+
+  // optional .client.CmdResponse.Get get = 5;
+  inline bool has_get() const;
+  inline void clear_get();
+  static const int kGetFieldNumber = 5;
+  inline const ::client::CmdResponse_Get& get() const;
+  inline ::client::CmdResponse_Get* mutable_get();
+  inline ::client::CmdResponse_Get* release_get();
+  inline void set_allocated_get(::client::CmdResponse_Get* get);
+
+  // optional .client.Node redirect = 6;
+  inline bool has_redirect() const;
+  inline void clear_redirect();
+  static const int kRedirectFieldNumber = 6;
+  inline const ::client::Node& redirect() const;
+  inline ::client::Node* mutable_redirect();
+  inline ::client::Node* release_redirect();
+  inline void set_allocated_redirect(::client::Node* redirect);
+
+  // repeated .client.CmdResponse.InfoStats info_stats = 7;
+  inline int info_stats_size() const;
+  inline void clear_info_stats();
+  static const int kInfoStatsFieldNumber = 7;
+  inline const ::client::CmdResponse_InfoStats& info_stats(int index) const;
+  inline ::client::CmdResponse_InfoStats* mutable_info_stats(int index);
+  inline ::client::CmdResponse_InfoStats* add_info_stats();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >&
+      info_stats() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >*
+      mutable_info_stats();
+
+  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+  inline int info_capacity_size() const;
+  inline void clear_info_capacity();
+  static const int kInfoCapacityFieldNumber = 8;
+  inline const ::client::CmdResponse_InfoCapacity& info_capacity(int index) const;
+  inline ::client::CmdResponse_InfoCapacity* mutable_info_capacity(int index);
+  inline ::client::CmdResponse_InfoCapacity* add_info_capacity();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >&
+      info_capacity() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >*
+      mutable_info_capacity();
+
+  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
+  inline int info_repl_size() const;
+  inline void clear_info_repl();
+  static const int kInfoReplFieldNumber = 9;
+  inline const ::client::CmdResponse_InfoRepl& info_repl(int index) const;
+  inline ::client::CmdResponse_InfoRepl* mutable_info_repl(int index);
+  inline ::client::CmdResponse_InfoRepl* add_info_repl();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >&
+      info_repl() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >*
+      mutable_info_repl();
+
+  // repeated .client.CmdResponse.Mget mget = 10;
+  inline int mget_size() const;
+  inline void clear_mget();
+  static const int kMgetFieldNumber = 10;
+  inline const ::client::CmdResponse_Mget& mget(int index) const;
+  inline ::client::CmdResponse_Mget* mutable_mget(int index);
+  inline ::client::CmdResponse_Mget* add_mget();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >&
+      mget() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >*
+      mutable_mget();
+
+  // optional .client.CmdResponse.InfoServer info_server = 11;
+  inline bool has_info_server() const;
+  inline void clear_info_server();
+  static const int kInfoServerFieldNumber = 11;
+  inline const ::client::CmdResponse_InfoServer& info_server() const;
+  inline ::client::CmdResponse_InfoServer* mutable_info_server();
+  inline ::client::CmdResponse_InfoServer* release_info_server();
+  inline void set_allocated_info_server(::client::CmdResponse_InfoServer* info_server);
+
+  // optional .client.CmdResponse.Scan scan = 12;
+  inline bool has_scan() const;
+  inline void clear_scan();
+  static const int kScanFieldNumber = 12;
+  inline const ::client::CmdResponse_Scan& scan() const;
+  inline ::client::CmdResponse_Scan* mutable_scan();
+  inline ::client::CmdResponse_Scan* release_scan();
+  inline void set_allocated_scan(::client::CmdResponse_Scan* scan);
+
+  // repeated .client.CmdResponse.InfoLatency info_latency = 13;
+  inline int info_latency_size() const;
+  inline void clear_info_latency();
+  static const int kInfoLatencyFieldNumber = 13;
+  inline const ::client::CmdResponse_InfoLatency& info_latency(int index) const;
+  inline ::client::CmdResponse_InfoLatency* mutable_info_latency(int index);
+  inline ::client::CmdResponse_InfoLatency* add_info_latency();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoLatency >&
+      info_latency() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoLatency >*
+      mutable_info_latency();
+
+  // optional .client.CmdResponse.Cas cas = 14;
+  inline bool has_cas() const;
+  inline void clear_cas();
+  static const int kCasFieldNumber = 14;
+  inline const ::client::CmdResponse_Cas& cas() const;
+  inline ::client::CmdResponse_Cas* mutable_cas();
+  inline ::client::CmdResponse_Cas* release_cas();
+  inline void set_allocated_cas(::client::CmdResponse_Cas* cas);
+
+  // optional .client.CmdResponse.Incrby incrby = 15;
+  inline bool has_incrby() const;
+  inline void clear_incrby();
+  static const int kIncrbyFieldNumber = 15;
+  inline const ::client::CmdResponse_Incrby& incrby() const;
+  inline ::client::CmdResponse_Incrby* mutable_incrby();
+  inline ::client::CmdResponse_Incrby* release_incrby();
+  inline void set_allocated_incrby(::client::CmdResponse_Incrby* incrby);
+
+  // repeated .client.CmdResponse.InfoSlowlog info_slowlog = 16;
+  inline int info_slowlog_size() const;
+  inline void clear_info_slowlog();
+  static const int kInfoSlowlogFieldNumber = 16;
+  inline const ::client::CmdResponse_InfoSlowlog& info_slowlog(int index) const;
+  inline ::client::CmdResponse_InfoSlowlog* mutable_info_slowlog(int index);
+  inline ::client::CmdResponse_InfoSlowlog* add_info_slowlog();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoSlowlog >&
+      info_slowlog() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoSlowlog >*
+      mutable_info_slowlog();
+
+  // @@protoc_insertion_point(class_scope:client.CmdResponse)
+ private:
+  inline void set_has_type();
+  inline void clear_has_type();
+  inline void set_has_code();
+  inline void clear_has_code();
+  inline void set_has_msg();
+  inline void clear_has_msg();
+  inline void set_has_sync();
+  inline void clear_has_sync();
+  inline void set_has_get();
+  inline void clear_has_get();
+  inline void set_has_redirect();
+  inline void clear_has_redirect();
+  inline void set_has_info_server();
+  inline void clear_has_info_server();
+  inline void set_has_scan();
+  inline void clear_has_scan();
+  inline void set_has_cas();
+  inline void clear_has_cas();
+  inline void set_has_incrby();
+  inline void clear_has_incrby();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  int type_;
+  int code_;
+  ::std::string* msg_;
+  ::client::CmdResponse_Sync* sync_;
+  ::client::CmdResponse_Get* get_;
+  ::client::Node* redirect_;
+  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats > info_stats_;
+  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity > info_capacity_;
+  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl > info_repl_;
+  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget > mget_;
+  ::client::CmdResponse_InfoServer* info_server_;
+  ::client::CmdResponse_Scan* scan_;
+  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoLatency > info_latency_;
+  ::client::CmdResponse_Cas* cas_;
+  ::client::CmdResponse_Incrby* incrby_;
+  ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoSlowlog > info_slowlog_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(16 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static CmdResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class BinlogSkip : public ::google::protobuf::Message {
+ public:
+  BinlogSkip();
+  virtual ~BinlogSkip();
+
+  BinlogSkip(const BinlogSkip& from);
+
+  inline BinlogSkip& operator=(const BinlogSkip& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const BinlogSkip& default_instance();
+
+  void Swap(BinlogSkip* other);
+
+  // implements Message ----------------------------------------------
+
+  BinlogSkip* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const BinlogSkip& from);
+  void MergeFrom(const BinlogSkip& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string table_name = 1;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 1;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
+
+  // required int32 partition_id = 2;
+  inline bool has_partition_id() const;
+  inline void clear_partition_id();
+  static const int kPartitionIdFieldNumber = 2;
+  inline ::google::protobuf::int32 partition_id() const;
+  inline void set_partition_id(::google::protobuf::int32 value);
+
+  // required int64 gap = 3;
+  inline bool has_gap() const;
+  inline void clear_gap();
+  static const int kGapFieldNumber = 3;
+  inline ::google::protobuf::int64 gap() const;
+  inline void set_gap(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:client.BinlogSkip)
+ private:
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
+  inline void set_has_partition_id();
+  inline void clear_has_partition_id();
+  inline void set_has_gap();
+  inline void clear_has_gap();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* table_name_;
+  ::google::protobuf::int64 gap_;
+  ::google::protobuf::int32 partition_id_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static BinlogSkip* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class SyncLease : public ::google::protobuf::Message {
+ public:
+  SyncLease();
+  virtual ~SyncLease();
+
+  SyncLease(const SyncLease& from);
+
+  inline SyncLease& operator=(const SyncLease& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SyncLease& default_instance();
+
+  void Swap(SyncLease* other);
+
+  // implements Message ----------------------------------------------
+
+  SyncLease* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const SyncLease& from);
+  void MergeFrom(const SyncLease& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string table_name = 1;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 1;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
+
+  // required int32 partition_id = 2;
+  inline bool has_partition_id() const;
+  inline void clear_partition_id();
+  static const int kPartitionIdFieldNumber = 2;
+  inline ::google::protobuf::int32 partition_id() const;
+  inline void set_partition_id(::google::protobuf::int32 value);
+
+  // required int64 lease = 3;
+  inline bool has_lease() const;
+  inline void clear_lease();
+  static const int kLeaseFieldNumber = 3;
+  inline ::google::protobuf::int64 lease() const;
+  inline void set_lease(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:client.SyncLease)
+ private:
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
+  inline void set_has_partition_id();
+  inline void clear_has_partition_id();
+  inline void set_has_lease();
+  inline void clear_has_lease();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* table_name_;
+  ::google::protobuf::int64 lease_;
+  ::google::protobuf::int32 partition_id_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static SyncLease* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class SyncAck : public ::google::protobuf::Message {
+ public:
+  SyncAck();
+  virtual ~SyncAck();
+
+  SyncAck(const SyncAck& from);
+
+  inline SyncAck& operator=(const SyncAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SyncAck& default_instance();
+
+  void Swap(SyncAck* other);
+
+  // implements Message ----------------------------------------------
+
+  SyncAck* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const SyncAck& from);
+  void MergeFrom(const SyncAck& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string table_name = 1;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 1;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
+
+  // required int32 partition_id = 2;
+  inline bool has_partition_id() const;
+  inline void clear_partition_id();
+  static const int kPartitionIdFieldNumber = 2;
+  inline ::google::protobuf::int32 partition_id() const;
+  inline void set_partition_id(::google::protobuf::int32 value);
+
+  // required .client.SyncOffset sync_offset = 3;
+  inline bool has_sync_offset() const;
+  inline void clear_sync_offset();
+  static const int kSyncOffsetFieldNumber = 3;
+  inline const ::client::SyncOffset& sync_offset() const;
+  inline ::client::SyncOffset* mutable_sync_offset();
+  inline ::client::SyncOffset* release_sync_offset();
+  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+
+  // @@protoc_insertion_point(class_scope:client.SyncAck)
+ private:
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
+  inline void set_has_partition_id();
+  inline void clear_has_partition_id();
+  inline void set_has_sync_offset();
+  inline void clear_has_sync_offset();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* table_name_;
+  ::client::SyncOffset* sync_offset_;
+  ::google::protobuf::int32 partition_id_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static SyncAck* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class SyncRequest : public ::google::protobuf::Message {
+ public:
+  SyncRequest();
+  virtual ~SyncRequest();
+
+  SyncRequest(const SyncRequest& from);
+
+  inline SyncRequest& operator=(const SyncRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SyncRequest& default_instance();
+
+  void Swap(SyncRequest* other);
+
+  // implements Message ----------------------------------------------
+
+  SyncRequest* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const SyncRequest& from);
+  void MergeFrom(const SyncRequest& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required .client.SyncType sync_type = 1;
+  inline bool has_sync_type() const;
+  inline void clear_sync_type();
+  static const int kSyncTypeFieldNumber = 1;
+  inline ::client::SyncType sync_type() const;
+  inline void set_sync_type(::client::SyncType value);
+
+  // required int64 epoch = 2;
+  inline bool has_epoch() const;
+  inline void clear_epoch();
+  static const int kEpochFieldNumber = 2;
+  inline ::google::protobuf::int64 epoch() const;
+  inline void set_epoch(::google::protobuf::int64 value);
+
+  // required .client.Node from = 3;
+  inline bool has_from() const;
+  inline void clear_from();
+  static const int kFromFieldNumber = 3;
+  inline const ::client::Node& from() const;
+  inline ::client::Node* mutable_from();
+  inline ::client::Node* release_from();
+  inline void set_allocated_from(::client::Node* from);
+
+  // optional .client.SyncOffset sync_offset = 4;
+  inline bool has_sync_offset() const;
+  inline void clear_sync_offset();
+  static const int kSyncOffsetFieldNumber = 4;
+  inline const ::client::SyncOffset& sync_offset() const;
+  inline ::client::SyncOffset* mutable_sync_offset();
+  inline ::client::SyncOffset* release_sync_offset();
+  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+
+  // optional .client.CmdRequest request = 5;
+  inline bool has_request() const;
+  inline void clear_request();
+  static const int kRequestFieldNumber = 5;
+  inline const ::client::CmdRequest& request() const;
+  inline ::client::CmdRequest* mutable_request();
+  inline ::client::CmdRequest* release_request();
+  inline void set_allocated_request(::client::CmdRequest* request);
+
+  // optional .client.BinlogSkip binlog_skip = 6;
+  inline bool has_binlog_skip() const;
+  inline void clear_binlog_skip();
+  static const int kBinlogSkipFieldNumber = 6;
+  inline const ::client::BinlogSkip& binlog_skip() const;
+  inline ::client::BinlogSkip* mutable_binlog_skip();
+  inline ::client::BinlogSkip* release_binlog_skip();
+  inline void set_allocated_binlog_skip(::client::BinlogSkip* binlog_skip);
+
+  // optional .client.SyncLease sync_lease = 7;
+  inline bool has_sync_lease() const;
+  inline void clear_sync_lease();
+  static const int kSyncLeaseFieldNumber = 7;
+  inline const ::client::SyncLease& sync_lease() const;
+  inline ::client::SyncLease* mutable_sync_lease();
+  inline ::client::SyncLease* release_sync_lease();
+  inline void set_allocated_sync_lease(::client::SyncLease* sync_lease);
+
+  // optional .client.BinlogBatch binlog_batch = 8;
+  inline bool has_binlog_batch() const;
+  inline void clear_binlog_batch();
+  static const int kBinlogBatchFieldNumber = 8;
+  inline const ::client::BinlogBatch& binlog_batch() const;
+  inline ::client::BinlogBatch* mutable_binlog_batch();
+  inline ::client::BinlogBatch* release_binlog_batch();
+  inline void set_allocated_binlog_batch(::client::BinlogBatch* binlog_batch);
+
+  // optional .client.SyncAck sync_ack = 9;
+  inline bool has_sync_ack() const;
+  inline void clear_sync_ack();
+  static const int kSyncAckFieldNumber = 9;
+  inline const ::client::SyncAck& sync_ack() const;
+  inline ::client::SyncAck* mutable_sync_ack();
+  inline ::client::SyncAck* release_sync_ack();
+  inline void set_allocated_sync_ack(::client::SyncAck* sync_ack);
+
+  // @@protoc_insertion_point(class_scope:client.SyncRequest)
+ private:
+  inline void set_has_sync_type();
+  inline void clear_has_sync_type();
+  inline void set_has_epoch();
+  inline void clear_has_epoch();
+  inline void set_has_from();
+  inline void clear_has_from();
+  inline void set_has_sync_offset();
+  inline void clear_has_sync_offset();
+  inline void set_has_request();
+  inline void clear_has_request();
+  inline void set_has_binlog_skip();
+  inline void clear_has_binlog_skip();
+  inline void set_has_sync_lease();
+  inline void clear_has_sync_lease();
+  inline void set_has_binlog_batch();
+  inline void clear_has_binlog_batch();
+  inline void set_has_sync_ack();
+  inline void clear_has_sync_ack();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::int64 epoch_;
+  ::client::Node* from_;
+  ::client::SyncOffset* sync_offset_;
+  ::client::CmdRequest* request_;
+  ::client::BinlogSkip* binlog_skip_;
+  ::client::SyncLease* sync_lease_;
+  ::client::BinlogBatch* binlog_batch_;
+  ::client::SyncAck* sync_ack_;
+  int sync_type_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(9 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static SyncRequest* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Kv : public ::google::protobuf::Message {
+ public:
+  Kv();
+  virtual ~Kv();
+
+  Kv(const Kv& from);
+
+  inline Kv& operator=(const Kv& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Kv& default_instance();
+
+  void Swap(Kv* other);
+
+  // implements Message ----------------------------------------------
+
+  Kv* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Kv& from);
+  void MergeFrom(const Kv& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string key = 1;
+  inline bool has_key() const;
+  inline void clear_key();
+  static const int kKeyFieldNumber = 1;
+  inline const ::std::string& key() const;
+  inline void set_key(const ::std::string& value);
+  inline void set_key(const char* value);
+  inline void set_key(const char* value, size_t size);
+  inline ::std::string* mutable_key();
+  inline ::std::string* release_key();
+  inline void set_allocated_key(::std::string* key);
+
+  // required bytes value = 2;
+  inline bool has_value() const;
+  inline void clear_value();
+  static const int kValueFieldNumber = 2;
+  inline const ::std::string& value() const;
+  inline void set_value(const ::std::string& value);
+  inline void set_value(const char* value);
+  inline void set_value(const void* value, size_t size);
+  inline ::std::string* mutable_value();
+  inline ::std::string* release_value();
+  inline void set_allocated_value(::std::string* value);
+
+  // @@protoc_insertion_point(class_scope:client.Kv)
+ private:
+  inline void set_has_key();
+  inline void clear_has_key();
+  inline void set_has_value();
+  inline void clear_has_value();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* key_;
+  ::std::string* value_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static Kv* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class SyncItem : public ::google::protobuf::Message {
+ public:
+  SyncItem();
+  virtual ~SyncItem();
+
+  SyncItem(const SyncItem& from);
+
+  inline SyncItem& operator=(const SyncItem& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SyncItem& default_instance();
+
+  void Swap(SyncItem* other);
+
+  // implements Message ----------------------------------------------
+
+  SyncItem* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const SyncItem& from);
+  void MergeFrom(const SyncItem& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required .client.SyncOffset sync_offset = 1;
+  inline bool has_sync_offset() const;
+  inline void clear_sync_offset();
+  static const int kSyncOffsetFieldNumber = 1;
+  inline const ::client::SyncOffset& sync_offset() const;
+  inline ::client::SyncOffset* mutable_sync_offset();
+  inline ::client::SyncOffset* release_sync_offset();
+  inline void set_allocated_sync_offset(::client::SyncOffset* sync_offset);
+
+  // optional .client.CmdRequest request = 2;
+  inline bool has_request() const;
+  inline void clear_request();
+  static const int kRequestFieldNumber = 2;
+  inline const ::client::CmdRequest& request() const;
+  inline ::client::CmdRequest* mutable_request();
+  inline ::client::CmdRequest* release_request();
+  inline void set_allocated_request(::client::CmdRequest* request);
+
+  // optional int64 skip_gap = 3;
+  inline bool has_skip_gap() const;
+  inline void clear_skip_gap();
+  static const int kSkipGapFieldNumber = 3;
+  inline ::google::protobuf::int64 skip_gap() const;
+  inline void set_skip_gap(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:client.SyncItem)
+ private:
+  inline void set_has_sync_offset();
+  inline void clear_has_sync_offset();
+  inline void set_has_request();
+  inline void clear_has_request();
+  inline void set_has_skip_gap();
+  inline void clear_has_skip_gap();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::client::SyncOffset* sync_offset_;
+  ::client::CmdRequest* request_;
+  ::google::protobuf::int64 skip_gap_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static SyncItem* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class BinlogBatch : public ::google::protobuf::Message {
+ public:
+  BinlogBatch();
+  virtual ~BinlogBatch();
+
+  BinlogBatch(const BinlogBatch& from);
+
+  inline BinlogBatch& operator=(const BinlogBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const BinlogBatch& default_instance();
+
+  void Swap(BinlogBatch* other);
+
+  // implements Message ----------------------------------------------
+
+  BinlogBatch* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const BinlogBatch& from);
+  void MergeFrom(const BinlogBatch& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string table_name = 1;
+  inline bool has_table_name() const;
+  inline void clear_table_name();
+  static const int kTableNameFieldNumber = 1;
+  inline const ::std::string& table_name() const;
+  inline void set_table_name(const ::std::string& value);
+  inline void set_table_name(const char* value);
+  inline void set_table_name(const char* value, size_t size);
+  inline ::std::string* mutable_table_name();
+  inline ::std::string* release_table_name();
+  inline void set_allocated_table_name(::std::string* table_name);
+
+  // required int32 partition_id = 2;
+  inline bool has_partition_id() const;
+  inline void clear_partition_id();
+  static const int kPartitionIdFieldNumber = 2;
+  inline ::google::protobuf::int32 partition_id() const;
+  inline void set_partition_id(::google::protobuf::int32 value);
+
+  // repeated .client.SyncItem items = 3;
+  inline int items_size() const;
+  inline void clear_items();
+  static const int kItemsFieldNumber = 3;
+  inline const ::client::SyncItem& items(int index) const;
+  inline ::client::SyncItem* mutable_items(int index);
+  inline ::client::SyncItem* add_items();
+  inline const ::google::protobuf::RepeatedPtrField< ::client::SyncItem >&
+      items() const;
+  inline ::google::protobuf::RepeatedPtrField< ::client::SyncItem >*
+      mutable_items();
+
+  // @@protoc_insertion_point(class_scope:client.BinlogBatch)
+ private:
+  inline void set_has_table_name();
+  inline void clear_has_table_name();
+  inline void set_has_partition_id();
+  inline void clear_has_partition_id();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* table_name_;
+  ::google::protobuf::RepeatedPtrField< ::client::SyncItem > items_;
+  ::google::protobuf::int32 partition_id_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_client_2eproto();
+  friend void protobuf_AssignDesc_client_2eproto();
+  friend void protobuf_ShutdownFile_client_2eproto();
+
+  void InitAsDefaultInstance();
+  static BinlogBatch* default_instance_;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+// Node
+
+// required string ip = 1;
+inline bool Node::has_ip() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Node::set_has_ip() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Node::clear_has_ip() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Node::clear_ip() {
+  if (ip_ != &::google::protobuf::internal::kEmptyString) {
+    ip_->clear();
+  }
+  clear_has_ip();
+}
+inline const ::std::string& Node::ip() const {
+  return *ip_;
+}
+inline void Node::set_ip(const ::std::string& value) {
+  set_has_ip();
+  if (ip_ == &::google::protobuf::internal::kEmptyString) {
+    ip_ = new ::std::string;
+  }
+  ip_->assign(value);
+}
+inline void Node::set_ip(const char* value) {
+  set_has_ip();
+  if (ip_ == &::google::protobuf::internal::kEmptyString) {
+    ip_ = new ::std::string;
+  }
+  ip_->assign(value);
+}
+inline void Node::set_ip(const char* value, size_t size) {
+  set_has_ip();
+  if (ip_ == &::google::protobuf::internal::kEmptyString) {
+    ip_ = new ::std::string;
+  }
+  ip_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* Node::mutable_ip() {
+  set_has_ip();
+  if (ip_ == &::google::protobuf::internal::kEmptyString) {
+    ip_ = new ::std::string;
+  }
+  return ip_;
+}
+inline ::std::string* Node::release_ip() {
+  clear_has_ip();
+  if (ip_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = ip_;
+    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void Node::set_allocated_ip(::std::string* ip) {
+  if (ip_ != &::google::protobuf::internal::kEmptyString) {
+    delete ip_;
+  }
+  if (ip) {
+    set_has_ip();
+    ip_ = ip;
+  } else {
+    clear_has_ip();
+    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required int32 port = 2;
+inline bool Node::has_port() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Node::set_has_port() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Node::clear_has_port() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Node::clear_port() {
+  port_ = 0;
+  clear_has_port();
+}
+inline ::google::protobuf::int32 Node::port() const {
+  return port_;
+}
+inline void Node::set_port(::google::protobuf::int32 value) {
+  set_has_port();
+  port_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// SyncOffset
+
+// required int32 filenum = 1;
+inline bool SyncOffset::has_filenum() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void SyncOffset::set_has_filenum() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void SyncOffset::clear_has_filenum() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void SyncOffset::clear_filenum() {
+  filenum_ = 0;
+  clear_has_filenum();
+}
+inline ::google::protobuf::int32 SyncOffset::filenum() const {
+  return filenum_;
+}
+inline void SyncOffset::set_filenum(::google::protobuf::int32 value) {
+  set_has_filenum();
+  filenum_ = value;
+}
+
+// required int64 offset = 2;
+inline bool SyncOffset::has_offset() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void SyncOffset::set_has_offset() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void SyncOffset::clear_has_offset() {
+  _has_bits_[0] &= ~0x00000002u;
+}
 inline void SyncOffset::clear_offset() {
   offset_ = GOOGLE_LONGLONG(0);
   clear_has_offset();
 }
-inline ::google::protobuf::int64 SyncOffset::offset() const {
-  return offset_;
+inline ::google::protobuf::int64 SyncOffset::offset() const {
+  return offset_;
+}
+inline void SyncOffset::set_offset(::google::protobuf::int64 value) {
+  set_has_offset();
+  offset_ = value;
+}
+
+// optional int32 partition = 3;
+inline bool SyncOffset::has_partition() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void SyncOffset::set_has_partition() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void SyncOffset::clear_has_partition() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void SyncOffset::clear_partition() {
+  partition_ = 0;
+  clear_has_partition();
+}
+inline ::google::protobuf::int32 SyncOffset::partition() const {
+  return partition_;
+}
+inline void SyncOffset::set_partition(::google::protobuf::int32 value) {
+  set_has_partition();
+  partition_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// KeyExpire
+
+// optional int32 base = 1;
+inline bool KeyExpire::has_base() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void KeyExpire::set_has_base() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void KeyExpire::clear_has_base() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void KeyExpire::clear_base() {
+  base_ = 0;
+  clear_has_base();
+}
+inline ::google::protobuf::int32 KeyExpire::base() const {
+  return base_;
+}
+inline void KeyExpire::set_base(::google::protobuf::int32 value) {
+  set_has_base();
+  base_ = value;
+}
+
+// required int32 ttl = 2;
+inline bool KeyExpire::has_ttl() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void KeyExpire::set_has_ttl() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void KeyExpire::clear_has_ttl() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void KeyExpire::clear_ttl() {
+  ttl_ = 0;
+  clear_has_ttl();
+}
+inline ::google::protobuf::int32 KeyExpire::ttl() const {
+  return ttl_;
+}
+inline void KeyExpire::set_ttl(::google::protobuf::int32 value) {
+  set_has_ttl();
+  ttl_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// SlaveFallback
+
+// required int64 time = 1;
+inline bool SlaveFallback::has_time() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void SlaveFallback::set_has_time() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void SlaveFallback::clear_has_time() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void SlaveFallback::clear_time() {
+  time_ = GOOGLE_LONGLONG(0);
+  clear_has_time();
+}
+inline ::google::protobuf::int64 SlaveFallback::time() const {
+  return time_;
+}
+inline void SlaveFallback::set_time(::google::protobuf::int64 value) {
+  set_has_time();
+  time_ = value;
+}
+
+// required .client.SyncOffset before = 2;
+inline bool SlaveFallback::has_before() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void SlaveFallback::set_has_before() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void SlaveFallback::clear_has_before() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void SlaveFallback::clear_before() {
+  if (before_ != NULL) before_->::client::SyncOffset::Clear();
+  clear_has_before();
+}
+inline const ::client::SyncOffset& SlaveFallback::before() const {
+  return before_ != NULL ? *before_ : *default_instance_->before_;
+}
+inline ::client::SyncOffset* SlaveFallback::mutable_before() {
+  set_has_before();
+  if (before_ == NULL) before_ = new ::client::SyncOffset;
+  return before_;
+}
+inline ::client::SyncOffset* SlaveFallback::release_before() {
+  clear_has_before();
+  ::client::SyncOffset* temp = before_;
+  before_ = NULL;
+  return temp;
+}
+inline void SlaveFallback::set_allocated_before(::client::SyncOffset* before) {
+  delete before_;
+  before_ = before;
+  if (before) {
+    set_has_before();
+  } else {
+    clear_has_before();
+  }
+}
+
+// required .client.SyncOffset after = 3;
+inline bool SlaveFallback::has_after() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void SlaveFallback::set_has_after() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void SlaveFallback::clear_has_after() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void SlaveFallback::clear_after() {
+  if (after_ != NULL) after_->::client::SyncOffset::Clear();
+  clear_has_after();
+}
+inline const ::client::SyncOffset& SlaveFallback::after() const {
+  return after_ != NULL ? *after_ : *default_instance_->after_;
+}
+inline ::client::SyncOffset* SlaveFallback::mutable_after() {
+  set_has_after();
+  if (after_ == NULL) after_ = new ::client::SyncOffset;
+  return after_;
+}
+inline ::client::SyncOffset* SlaveFallback::release_after() {
+  clear_has_after();
+  ::client::SyncOffset* temp = after_;
+  after_ = NULL;
+  return temp;
+}
+inline void SlaveFallback::set_allocated_after(::client::SyncOffset* after) {
+  delete after_;
+  after_ = after;
+  if (after) {
+    set_has_after();
+  } else {
+    clear_has_after();
+  }
+}
+
+// -------------------------------------------------------------------
+
+// PartitionState
+
+// required int32 partition_id = 1;
+inline bool PartitionState::has_partition_id() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void PartitionState::set_has_partition_id() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void PartitionState::clear_has_partition_id() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void PartitionState::clear_partition_id() {
+  partition_id_ = 0;
+  clear_has_partition_id();
+}
+inline ::google::protobuf::int32 PartitionState::partition_id() const {
+  return partition_id_;
+}
+inline void PartitionState::set_partition_id(::google::protobuf::int32 value) {
+  set_has_partition_id();
+  partition_id_ = value;
+}
+
+// required string role = 2;
+inline bool PartitionState::has_role() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void PartitionState::set_has_role() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void PartitionState::clear_has_role() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void PartitionState::clear_role() {
+  if (role_ != &::google::protobuf::internal::kEmptyString) {
+    role_->clear();
+  }
+  clear_has_role();
+}
+inline const ::std::string& PartitionState::role() const {
+  return *role_;
+}
+inline void PartitionState::set_role(const ::std::string& value) {
+  set_has_role();
+  if (role_ == &::google::protobuf::internal::kEmptyString) {
+    role_ = new ::std::string;
+  }
+  role_->assign(value);
+}
+inline void PartitionState::set_role(const char* value) {
+  set_has_role();
+  if (role_ == &::google::protobuf::internal::kEmptyString) {
+    role_ = new ::std::string;
+  }
+  role_->assign(value);
+}
+inline void PartitionState::set_role(const char* value, size_t size) {
+  set_has_role();
+  if (role_ == &::google::protobuf::internal::kEmptyString) {
+    role_ = new ::std::string;
+  }
+  role_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* PartitionState::mutable_role() {
+  set_has_role();
+  if (role_ == &::google::protobuf::internal::kEmptyString) {
+    role_ = new ::std::string;
+  }
+  return role_;
+}
+inline ::std::string* PartitionState::release_role() {
+  clear_has_role();
+  if (role_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = role_;
+    role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void PartitionState::set_allocated_role(::std::string* role) {
+  if (role_ != &::google::protobuf::internal::kEmptyString) {
+    delete role_;
+  }
+  if (role) {
+    set_has_role();
+    role_ = role;
+  } else {
+    clear_has_role();
+    role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required string repl_state = 3;
+inline bool PartitionState::has_repl_state() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void PartitionState::set_has_repl_state() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void PartitionState::clear_has_repl_state() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void PartitionState::clear_repl_state() {
+  if (repl_state_ != &::google::protobuf::internal::kEmptyString) {
+    repl_state_->clear();
+  }
+  clear_has_repl_state();
+}
+inline const ::std::string& PartitionState::repl_state() const {
+  return *repl_state_;
+}
+inline void PartitionState::set_repl_state(const ::std::string& value) {
+  set_has_repl_state();
+  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
+    repl_state_ = new ::std::string;
+  }
+  repl_state_->assign(value);
+}
+inline void PartitionState::set_repl_state(const char* value) {
+  set_has_repl_state();
+  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
+    repl_state_ = new ::std::string;
+  }
+  repl_state_->assign(value);
+}
+inline void PartitionState::set_repl_state(const char* value, size_t size) {
+  set_has_repl_state();
+  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
+    repl_state_ = new ::std::string;
+  }
+  repl_state_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* PartitionState::mutable_repl_state() {
+  set_has_repl_state();
+  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
+    repl_state_ = new ::std::string;
+  }
+  return repl_state_;
+}
+inline ::std::string* PartitionState::release_repl_state() {
+  clear_has_repl_state();
+  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = repl_state_;
+    repl_state_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void PartitionState::set_allocated_repl_state(::std::string* repl_state) {
+  if (repl_state_ != &::google::protobuf::internal::kEmptyString) {
+    delete repl_state_;
+  }
+  if (repl_state) {
+    set_has_repl_state();
+    repl_state_ = repl_state;
+  } else {
+    clear_has_repl_state();
+    repl_state_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required .client.Node master = 4;
+inline bool PartitionState::has_master() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void PartitionState::set_has_master() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void PartitionState::clear_has_master() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void PartitionState::clear_master() {
+  if (master_ != NULL) master_->::client::Node::Clear();
+  clear_has_master();
+}
+inline const ::client::Node& PartitionState::master() const {
+  return master_ != NULL ? *master_ : *default_instance_->master_;
+}
+inline ::client::Node* PartitionState::mutable_master() {
+  set_has_master();
+  if (master_ == NULL) master_ = new ::client::Node;
+  return master_;
+}
+inline ::client::Node* PartitionState::release_master() {
+  clear_has_master();
+  ::client::Node* temp = master_;
+  master_ = NULL;
+  return temp;
+}
+inline void PartitionState::set_allocated_master(::client::Node* master) {
+  delete master_;
+  master_ = master;
+  if (master) {
+    set_has_master();
+  } else {
+    clear_has_master();
+  }
+}
+
+// repeated .client.Node slaves = 5;
+inline int PartitionState::slaves_size() const {
+  return slaves_.size();
+}
+inline void PartitionState::clear_slaves() {
+  slaves_.Clear();
+}
+inline const ::client::Node& PartitionState::slaves(int index) const {
+  return slaves_.Get(index);
+}
+inline ::client::Node* PartitionState::mutable_slaves(int index) {
+  return slaves_.Mutable(index);
+}
+inline ::client::Node* PartitionState::add_slaves() {
+  return slaves_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::Node >&
+PartitionState::slaves() const {
+  return slaves_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::Node >*
+PartitionState::mutable_slaves() {
+  return &slaves_;
+}
+
+// required .client.SyncOffset sync_offset = 6;
+inline bool PartitionState::has_sync_offset() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void PartitionState::set_has_sync_offset() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void PartitionState::clear_has_sync_offset() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void PartitionState::clear_sync_offset() {
+  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+  clear_has_sync_offset();
+}
+inline const ::client::SyncOffset& PartitionState::sync_offset() const {
+  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+}
+inline ::client::SyncOffset* PartitionState::mutable_sync_offset() {
+  set_has_sync_offset();
+  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
+  return sync_offset_;
+}
+inline ::client::SyncOffset* PartitionState::release_sync_offset() {
+  clear_has_sync_offset();
+  ::client::SyncOffset* temp = sync_offset_;
+  sync_offset_ = NULL;
+  return temp;
+}
+inline void PartitionState::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+  delete sync_offset_;
+  sync_offset_ = sync_offset;
+  if (sync_offset) {
+    set_has_sync_offset();
+  } else {
+    clear_has_sync_offset();
+  }
+}
+
+// optional .client.SlaveFallback fallback = 7;
+inline bool PartitionState::has_fallback() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void PartitionState::set_has_fallback() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void PartitionState::clear_has_fallback() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void PartitionState::clear_fallback() {
+  if (fallback_ != NULL) fallback_->::client::SlaveFallback::Clear();
+  clear_has_fallback();
+}
+inline const ::client::SlaveFallback& PartitionState::fallback() const {
+  return fallback_ != NULL ? *fallback_ : *default_instance_->fallback_;
+}
+inline ::client::SlaveFallback* PartitionState::mutable_fallback() {
+  set_has_fallback();
+  if (fallback_ == NULL) fallback_ = new ::client::SlaveFallback;
+  return fallback_;
+}
+inline ::client::SlaveFallback* PartitionState::release_fallback() {
+  clear_has_fallback();
+  ::client::SlaveFallback* temp = fallback_;
+  fallback_ = NULL;
+  return temp;
+}
+inline void PartitionState::set_allocated_fallback(::client::SlaveFallback* fallback) {
+  delete fallback_;
+  fallback_ = fallback;
+  if (fallback) {
+    set_has_fallback();
+  } else {
+    clear_has_fallback();
+  }
+}
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Sync
+
+// required .client.Node node = 1;
+inline bool CmdRequest_Sync::has_node() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void CmdRequest_Sync::set_has_node() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void CmdRequest_Sync::clear_has_node() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void CmdRequest_Sync::clear_node() {
+  if (node_ != NULL) node_->::client::Node::Clear();
+  clear_has_node();
+}
+inline const ::client::Node& CmdRequest_Sync::node() const {
+  return node_ != NULL ? *node_ : *default_instance_->node_;
+}
+inline ::client::Node* CmdRequest_Sync::mutable_node() {
+  set_has_node();
+  if (node_ == NULL) node_ = new ::client::Node;
+  return node_;
+}
+inline ::client::Node* CmdRequest_Sync::release_node() {
+  clear_has_node();
+  ::client::Node* temp = node_;
+  node_ = NULL;
+  return temp;
+}
+inline void CmdRequest_Sync::set_allocated_node(::client::Node* node) {
+  delete node_;
+  node_ = node;
+  if (node) {
+    set_has_node();
+  } else {
+    clear_has_node();
+  }
+}
+
+// required string table_name = 2;
+inline bool CmdRequest_Sync::has_table_name() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CmdRequest_Sync::set_has_table_name() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CmdRequest_Sync::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CmdRequest_Sync::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
+}
+inline const ::std::string& CmdRequest_Sync::table_name() const {
+  return *table_name_;
+}
+inline void CmdRequest_Sync::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdRequest_Sync::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdRequest_Sync::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Sync::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
+}
+inline ::std::string* CmdRequest_Sync::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Sync::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required .client.SyncOffset sync_offset = 3;
+inline bool CmdRequest_Sync::has_sync_offset() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void CmdRequest_Sync::set_has_sync_offset() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void CmdRequest_Sync::clear_has_sync_offset() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void CmdRequest_Sync::clear_sync_offset() {
+  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+  clear_has_sync_offset();
+}
+inline const ::client::SyncOffset& CmdRequest_Sync::sync_offset() const {
+  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+}
+inline ::client::SyncOffset* CmdRequest_Sync::mutable_sync_offset() {
+  set_has_sync_offset();
+  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
+  return sync_offset_;
+}
+inline ::client::SyncOffset* CmdRequest_Sync::release_sync_offset() {
+  clear_has_sync_offset();
+  ::client::SyncOffset* temp = sync_offset_;
+  sync_offset_ = NULL;
+  return temp;
+}
+inline void CmdRequest_Sync::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+  delete sync_offset_;
+  sync_offset_ = sync_offset;
+  if (sync_offset) {
+    set_has_sync_offset();
+  } else {
+    clear_has_sync_offset();
+  }
+}
+
+// required int64 epoch = 4;
+inline bool CmdRequest_Sync::has_epoch() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void CmdRequest_Sync::set_has_epoch() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void CmdRequest_Sync::clear_has_epoch() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void CmdRequest_Sync::clear_epoch() {
+  epoch_ = GOOGLE_LONGLONG(0);
+  clear_has_epoch();
+}
+inline ::google::protobuf::int64 CmdRequest_Sync::epoch() const {
+  return epoch_;
+}
+inline void CmdRequest_Sync::set_epoch(::google::protobuf::int64 value) {
+  set_has_epoch();
+  epoch_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Set
+
+// required string table_name = 1;
+inline bool CmdRequest_Set::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void CmdRequest_Set::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void CmdRequest_Set::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void CmdRequest_Set::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
+}
+inline const ::std::string& CmdRequest_Set::table_name() const {
+  return *table_name_;
+}
+inline void CmdRequest_Set::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdRequest_Set::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdRequest_Set::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Set::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
+}
+inline ::std::string* CmdRequest_Set::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Set::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required string key = 2;
+inline bool CmdRequest_Set::has_key() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CmdRequest_Set::set_has_key() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CmdRequest_Set::clear_has_key() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CmdRequest_Set::clear_key() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    key_->clear();
+  }
+  clear_has_key();
+}
+inline const ::std::string& CmdRequest_Set::key() const {
+  return *key_;
+}
+inline void CmdRequest_Set::set_key(const ::std::string& value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
+}
+inline void CmdRequest_Set::set_key(const char* value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
+}
+inline void CmdRequest_Set::set_key(const char* value, size_t size) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Set::mutable_key() {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  return key_;
+}
+inline ::std::string* CmdRequest_Set::release_key() {
+  clear_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = key_;
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Set::set_allocated_key(::std::string* key) {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (key) {
+    set_has_key();
+    key_ = key;
+  } else {
+    clear_has_key();
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required bytes value = 3;
+inline bool CmdRequest_Set::has_value() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void CmdRequest_Set::set_has_value() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void CmdRequest_Set::clear_has_value() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void CmdRequest_Set::clear_value() {
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    value_->clear();
+  }
+  clear_has_value();
+}
+inline const ::std::string& CmdRequest_Set::value() const {
+  return *value_;
+}
+inline void CmdRequest_Set::set_value(const ::std::string& value) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(value);
+}
+inline void CmdRequest_Set::set_value(const char* value) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(value);
+}
+inline void CmdRequest_Set::set_value(const void* value, size_t size) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Set::mutable_value() {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  return value_;
+}
+inline ::std::string* CmdRequest_Set::release_value() {
+  clear_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = value_;
+    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Set::set_allocated_value(::std::string* value) {
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    delete value_;
+  }
+  if (value) {
+    set_has_value();
+    value_ = value;
+  } else {
+    clear_has_value();
+    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional string uuid = 4;
+inline bool CmdRequest_Set::has_uuid() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void CmdRequest_Set::set_has_uuid() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void CmdRequest_Set::clear_has_uuid() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void CmdRequest_Set::clear_uuid() {
+  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+    uuid_->clear();
+  }
+  clear_has_uuid();
+}
+inline const ::std::string& CmdRequest_Set::uuid() const {
+  return *uuid_;
+}
+inline void CmdRequest_Set::set_uuid(const ::std::string& value) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(value);
+}
+inline void CmdRequest_Set::set_uuid(const char* value) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(value);
+}
+inline void CmdRequest_Set::set_uuid(const char* value, size_t size) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Set::mutable_uuid() {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  return uuid_;
+}
+inline ::std::string* CmdRequest_Set::release_uuid() {
+  clear_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = uuid_;
+    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Set::set_allocated_uuid(::std::string* uuid) {
+  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+    delete uuid_;
+  }
+  if (uuid) {
+    set_has_uuid();
+    uuid_ = uuid;
+  } else {
+    clear_has_uuid();
+    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional .client.KeyExpire expire = 5;
+inline bool CmdRequest_Set::has_expire() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void CmdRequest_Set::set_has_expire() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void CmdRequest_Set::clear_has_expire() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void CmdRequest_Set::clear_expire() {
+  if (expire_ != NULL) expire_->::client::KeyExpire::Clear();
+  clear_has_expire();
 }
-inline void SyncOffset::set_offset(::google::protobuf::int64 value) {
-  set_has_offset();
-  offset_ = value;
+inline const ::client::KeyExpire& CmdRequest_Set::expire() const {
+  return expire_ != NULL ? *expire_ : *default_instance_->expire_;
+}
+inline ::client::KeyExpire* CmdRequest_Set::mutable_expire() {
+  set_has_expire();
+  if (expire_ == NULL) expire_ = new ::client::KeyExpire;
+  return expire_;
+}
+inline ::client::KeyExpire* CmdRequest_Set::release_expire() {
+  clear_has_expire();
+  ::client::KeyExpire* temp = expire_;
+  expire_ = NULL;
+  return temp;
+}
+inline void CmdRequest_Set::set_allocated_expire(::client::KeyExpire* expire) {
+  delete expire_;
+  expire_ = expire;
+  if (expire) {
+    set_has_expire();
+  } else {
+    clear_has_expire();
+  }
 }
 
-// optional int32 partition = 3;
-inline bool SyncOffset::has_partition() const {
+// optional int32 ack_replicas = 6;
+inline bool CmdRequest_Set::has_ack_replicas() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void CmdRequest_Set::set_has_ack_replicas() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void CmdRequest_Set::clear_has_ack_replicas() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void CmdRequest_Set::clear_ack_replicas() {
+  ack_replicas_ = 0;
+  clear_has_ack_replicas();
+}
+inline ::google::protobuf::int32 CmdRequest_Set::ack_replicas() const {
+  return ack_replicas_;
+}
+inline void CmdRequest_Set::set_ack_replicas(::google::protobuf::int32 value) {
+  set_has_ack_replicas();
+  ack_replicas_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Get
+
+// required string table_name = 1;
+inline bool CmdRequest_Get::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void CmdRequest_Get::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void CmdRequest_Get::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void CmdRequest_Get::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
+}
+inline const ::std::string& CmdRequest_Get::table_name() const {
+  return *table_name_;
+}
+inline void CmdRequest_Get::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdRequest_Get::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdRequest_Get::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Get::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
+}
+inline ::std::string* CmdRequest_Get::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Get::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required string key = 2;
+inline bool CmdRequest_Get::has_key() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CmdRequest_Get::set_has_key() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CmdRequest_Get::clear_has_key() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CmdRequest_Get::clear_key() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    key_->clear();
+  }
+  clear_has_key();
+}
+inline const ::std::string& CmdRequest_Get::key() const {
+  return *key_;
+}
+inline void CmdRequest_Get::set_key(const ::std::string& value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
+}
+inline void CmdRequest_Get::set_key(const char* value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
+}
+inline void CmdRequest_Get::set_key(const char* value, size_t size) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Get::mutable_key() {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  return key_;
+}
+inline ::std::string* CmdRequest_Get::release_key() {
+  clear_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = key_;
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Get::set_allocated_key(::std::string* key) {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (key) {
+    set_has_key();
+    key_ = key;
+  } else {
+    clear_has_key();
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional string uuid = 3;
+inline bool CmdRequest_Get::has_uuid() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void SyncOffset::set_has_partition() {
+inline void CmdRequest_Get::set_has_uuid() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void SyncOffset::clear_has_partition() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest_Get::clear_has_uuid() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void CmdRequest_Get::clear_uuid() {
+  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+    uuid_->clear();
+  }
+  clear_has_uuid();
+}
+inline const ::std::string& CmdRequest_Get::uuid() const {
+  return *uuid_;
+}
+inline void CmdRequest_Get::set_uuid(const ::std::string& value) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(value);
+}
+inline void CmdRequest_Get::set_uuid(const char* value) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(value);
+}
+inline void CmdRequest_Get::set_uuid(const char* value, size_t size) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Get::mutable_uuid() {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  return uuid_;
+}
+inline ::std::string* CmdRequest_Get::release_uuid() {
+  clear_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = uuid_;
+    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Get::set_allocated_uuid(::std::string* uuid) {
+  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+    delete uuid_;
+  }
+  if (uuid) {
+    set_has_uuid();
+    uuid_ = uuid;
+  } else {
+    clear_has_uuid();
+    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional bool allow_stale = 4;
+inline bool CmdRequest_Get::has_allow_stale() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void CmdRequest_Get::set_has_allow_stale() {
+  _has_bits_[0] |= 0x00000008u;
 }
-inline void SyncOffset::clear_partition() {
-  partition_ = 0;
-  clear_has_partition();
+inline void CmdRequest_Get::clear_has_allow_stale() {
+  _has_bits_[0] &= ~0x00000008u;
 }
-inline ::google::protobuf::int32 SyncOffset::partition() const {
-  return partition_;
+inline void CmdRequest_Get::clear_allow_stale() {
+  allow_stale_ = false;
+  clear_has_allow_stale();
 }
-inline void SyncOffset::set_partition(::google::protobuf::int32 value) {
-  set_has_partition();
-  partition_ = value;
+inline bool CmdRequest_Get::allow_stale() const {
+  return allow_stale_;
+}
+inline void CmdRequest_Get::set_allow_stale(bool value) {
+  set_has_allow_stale();
+  allow_stale_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// KeyExpire
+// CmdRequest_Del
 
-// optional int32 base = 1;
-inline bool KeyExpire::has_base() const {
+// required string table_name = 1;
+inline bool CmdRequest_Del::has_table_name() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void KeyExpire::set_has_base() {
+inline void CmdRequest_Del::set_has_table_name() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void KeyExpire::clear_has_base() {
+inline void CmdRequest_Del::clear_has_table_name() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void KeyExpire::clear_base() {
-  base_ = 0;
-  clear_has_base();
+inline void CmdRequest_Del::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
 }
-inline ::google::protobuf::int32 KeyExpire::base() const {
-  return base_;
+inline const ::std::string& CmdRequest_Del::table_name() const {
+  return *table_name_;
 }
-inline void KeyExpire::set_base(::google::protobuf::int32 value) {
-  set_has_base();
-  base_ = value;
+inline void CmdRequest_Del::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdRequest_Del::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdRequest_Del::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Del::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
+}
+inline ::std::string* CmdRequest_Del::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Del::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
 
-// required int32 ttl = 2;
-inline bool KeyExpire::has_ttl() const {
+// required string key = 2;
+inline bool CmdRequest_Del::has_key() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void KeyExpire::set_has_ttl() {
+inline void CmdRequest_Del::set_has_key() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void KeyExpire::clear_has_ttl() {
+inline void CmdRequest_Del::clear_has_key() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void KeyExpire::clear_ttl() {
-  ttl_ = 0;
-  clear_has_ttl();
-}
-inline ::google::protobuf::int32 KeyExpire::ttl() const {
-  return ttl_;
+inline void CmdRequest_Del::clear_key() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    key_->clear();
+  }
+  clear_has_key();
 }
-inline void KeyExpire::set_ttl(::google::protobuf::int32 value) {
-  set_has_ttl();
-  ttl_ = value;
+inline const ::std::string& CmdRequest_Del::key() const {
+  return *key_;
 }
-
-// -------------------------------------------------------------------
-
-// SlaveFallback
-
-// required int64 time = 1;
-inline bool SlaveFallback::has_time() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline void CmdRequest_Del::set_key(const ::std::string& value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
 }
-inline void SlaveFallback::set_has_time() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdRequest_Del::set_key(const char* value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
 }
-inline void SlaveFallback::clear_has_time() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_Del::set_key(const char* value, size_t size) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline void SlaveFallback::clear_time() {
-  time_ = GOOGLE_LONGLONG(0);
-  clear_has_time();
+inline ::std::string* CmdRequest_Del::mutable_key() {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  return key_;
 }
-inline ::google::protobuf::int64 SlaveFallback::time() const {
-  return time_;
+inline ::std::string* CmdRequest_Del::release_key() {
+  clear_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = key_;
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
 }
-inline void SlaveFallback::set_time(::google::protobuf::int64 value) {
-  set_has_time();
-  time_ = value;
+inline void CmdRequest_Del::set_allocated_key(::std::string* key) {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (key) {
+    set_has_key();
+    key_ = key;
+  } else {
+    clear_has_key();
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
 
-// required .client.SyncOffset before = 2;
-inline bool SlaveFallback::has_before() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional string uuid = 3;
+inline bool CmdRequest_Del::has_uuid() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void SlaveFallback::set_has_before() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdRequest_Del::set_has_uuid() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline void SlaveFallback::clear_has_before() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest_Del::clear_has_uuid() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline void SlaveFallback::clear_before() {
-  if (before_ != NULL) before_->::client::SyncOffset::Clear();
-  clear_has_before();
+inline void CmdRequest_Del::clear_uuid() {
+  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+    uuid_->clear();
+  }
+  clear_has_uuid();
 }
-inline const ::client::SyncOffset& SlaveFallback::before() const {
-  return before_ != NULL ? *before_ : *default_instance_->before_;
+inline const ::std::string& CmdRequest_Del::uuid() const {
+  return *uuid_;
 }
-inline ::client::SyncOffset* SlaveFallback::mutable_before() {
-  set_has_before();
-  if (before_ == NULL) before_ = new ::client::SyncOffset;
-  return before_;
+inline void CmdRequest_Del::set_uuid(const ::std::string& value) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(value);
 }
-inline ::client::SyncOffset* SlaveFallback::release_before() {
-  clear_has_before();
-  ::client::SyncOffset* temp = before_;
-  before_ = NULL;
-  return temp;
+inline void CmdRequest_Del::set_uuid(const char* value) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(value);
 }
-inline void SlaveFallback::set_allocated_before(::client::SyncOffset* before) {
-  delete before_;
-  before_ = before;
-  if (before) {
-    set_has_before();
+inline void CmdRequest_Del::set_uuid(const char* value, size_t size) {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  uuid_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Del::mutable_uuid() {
+  set_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    uuid_ = new ::std::string;
+  }
+  return uuid_;
+}
+inline ::std::string* CmdRequest_Del::release_uuid() {
+  clear_has_uuid();
+  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = uuid_;
+    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Del::set_allocated_uuid(::std::string* uuid) {
+  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+    delete uuid_;
+  }
+  if (uuid) {
+    set_has_uuid();
+    uuid_ = uuid;
   } else {
-    clear_has_before();
+    clear_has_uuid();
+    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required .client.SyncOffset after = 3;
-inline bool SlaveFallback::has_after() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// CmdRequest_Info
+
+// optional string table_name = 1;
+inline bool CmdRequest_Info::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void SlaveFallback::set_has_after() {
-  _has_bits_[0] |= 0x00000004u;
+inline void CmdRequest_Info::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline void SlaveFallback::clear_has_after() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest_Info::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void SlaveFallback::clear_after() {
-  if (after_ != NULL) after_->::client::SyncOffset::Clear();
-  clear_has_after();
+inline void CmdRequest_Info::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
 }
-inline const ::client::SyncOffset& SlaveFallback::after() const {
-  return after_ != NULL ? *after_ : *default_instance_->after_;
+inline const ::std::string& CmdRequest_Info::table_name() const {
+  return *table_name_;
 }
-inline ::client::SyncOffset* SlaveFallback::mutable_after() {
-  set_has_after();
-  if (after_ == NULL) after_ = new ::client::SyncOffset;
-  return after_;
+inline void CmdRequest_Info::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline ::client::SyncOffset* SlaveFallback::release_after() {
-  clear_has_after();
-  ::client::SyncOffset* temp = after_;
-  after_ = NULL;
-  return temp;
+inline void CmdRequest_Info::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline void SlaveFallback::set_allocated_after(::client::SyncOffset* after) {
-  delete after_;
-  after_ = after;
-  if (after) {
-    set_has_after();
+inline void CmdRequest_Info::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Info::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
+}
+inline ::std::string* CmdRequest_Info::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
   } else {
-    clear_has_after();
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Info::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
 // -------------------------------------------------------------------
 
-// PartitionState
+// CmdRequest_Mget
 
-// required int32 partition_id = 1;
-inline bool PartitionState::has_partition_id() const {
+// required string table_name = 1;
+inline bool CmdRequest_Mget::has_table_name() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void PartitionState::set_has_partition_id() {
+inline void CmdRequest_Mget::set_has_table_name() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void PartitionState::clear_has_partition_id() {
+inline void CmdRequest_Mget::clear_has_table_name() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void PartitionState::clear_partition_id() {
-  partition_id_ = 0;
-  clear_has_partition_id();
-}
-inline ::google::protobuf::int32 PartitionState::partition_id() const {
-  return partition_id_;
-}
-inline void PartitionState::set_partition_id(::google::protobuf::int32 value) {
-  set_has_partition_id();
-  partition_id_ = value;
-}
-
-// required string role = 2;
-inline bool PartitionState::has_role() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void PartitionState::set_has_role() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void PartitionState::clear_has_role() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void PartitionState::clear_role() {
-  if (role_ != &::google::protobuf::internal::kEmptyString) {
-    role_->clear();
+inline void CmdRequest_Mget::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
   }
-  clear_has_role();
+  clear_has_table_name();
 }
-inline const ::std::string& PartitionState::role() const {
-  return *role_;
+inline const ::std::string& CmdRequest_Mget::table_name() const {
+  return *table_name_;
 }
-inline void PartitionState::set_role(const ::std::string& value) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
+inline void CmdRequest_Mget::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
-  role_->assign(value);
+  table_name_->assign(value);
 }
-inline void PartitionState::set_role(const char* value) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
+inline void CmdRequest_Mget::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
-  role_->assign(value);
+  table_name_->assign(value);
 }
-inline void PartitionState::set_role(const char* value, size_t size) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
+inline void CmdRequest_Mget::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
-  role_->assign(reinterpret_cast<const char*>(value), size);
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* PartitionState::mutable_role() {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
+inline ::std::string* CmdRequest_Mget::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
-  return role_;
+  return table_name_;
 }
-inline ::std::string* PartitionState::release_role() {
-  clear_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
+inline ::std::string* CmdRequest_Mget::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
   } else {
-    ::std::string* temp = role_;
-    role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
     return temp;
   }
 }
-inline void PartitionState::set_allocated_role(::std::string* role) {
-  if (role_ != &::google::protobuf::internal::kEmptyString) {
-    delete role_;
+inline void CmdRequest_Mget::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
   }
-  if (role) {
-    set_has_role();
-    role_ = role;
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
   } else {
-    clear_has_role();
-    role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required string repl_state = 3;
-inline bool PartitionState::has_repl_state() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// repeated string keys = 2;
+inline int CmdRequest_Mget::keys_size() const {
+  return keys_.size();
+}
+inline void CmdRequest_Mget::clear_keys() {
+  keys_.Clear();
+}
+inline const ::std::string& CmdRequest_Mget::keys(int index) const {
+  return keys_.Get(index);
+}
+inline ::std::string* CmdRequest_Mget::mutable_keys(int index) {
+  return keys_.Mutable(index);
+}
+inline void CmdRequest_Mget::set_keys(int index, const ::std::string& value) {
+  keys_.Mutable(index)->assign(value);
+}
+inline void CmdRequest_Mget::set_keys(int index, const char* value) {
+  keys_.Mutable(index)->assign(value);
+}
+inline void CmdRequest_Mget::set_keys(int index, const char* value, size_t size) {
+  keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Mget::add_keys() {
+  return keys_.Add();
+}
+inline void CmdRequest_Mget::add_keys(const ::std::string& value) {
+  keys_.Add()->assign(value);
+}
+inline void CmdRequest_Mget::add_keys(const char* value) {
+  keys_.Add()->assign(value);
+}
+inline void CmdRequest_Mget::add_keys(const char* value, size_t size) {
+  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+CmdRequest_Mget::keys() const {
+  return keys_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+CmdRequest_Mget::mutable_keys() {
+  return &keys_;
+}
+
+// -------------------------------------------------------------------
+
+// CmdRequest_FlushDB
+
+// required string table_name = 1;
+inline bool CmdRequest_FlushDB::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void PartitionState::set_has_repl_state() {
-  _has_bits_[0] |= 0x00000004u;
+inline void CmdRequest_FlushDB::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline void PartitionState::clear_has_repl_state() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest_FlushDB::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void PartitionState::clear_repl_state() {
-  if (repl_state_ != &::google::protobuf::internal::kEmptyString) {
-    repl_state_->clear();
+inline void CmdRequest_FlushDB::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
   }
-  clear_has_repl_state();
+  clear_has_table_name();
 }
-inline const ::std::string& PartitionState::repl_state() const {
-  return *repl_state_;
+inline const ::std::string& CmdRequest_FlushDB::table_name() const {
+  return *table_name_;
 }
-inline void PartitionState::set_repl_state(const ::std::string& value) {
-  set_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    repl_state_ = new ::std::string;
+inline void CmdRequest_FlushDB::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
-  repl_state_->assign(value);
+  table_name_->assign(value);
 }
-inline void PartitionState::set_repl_state(const char* value) {
-  set_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    repl_state_ = new ::std::string;
+inline void CmdRequest_FlushDB::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
-  repl_state_->assign(value);
+  table_name_->assign(value);
 }
-inline void PartitionState::set_repl_state(const char* value, size_t size) {
-  set_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    repl_state_ = new ::std::string;
+inline void CmdRequest_FlushDB::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
-  repl_state_->assign(reinterpret_cast<const char*>(value), size);
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* PartitionState::mutable_repl_state() {
-  set_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
-    repl_state_ = new ::std::string;
+inline ::std::string* CmdRequest_FlushDB::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
-  return repl_state_;
+  return table_name_;
 }
-inline ::std::string* PartitionState::release_repl_state() {
-  clear_has_repl_state();
-  if (repl_state_ == &::google::protobuf::internal::kEmptyString) {
+inline ::std::string* CmdRequest_FlushDB::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
   } else {
-    ::std::string* temp = repl_state_;
-    repl_state_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
     return temp;
   }
 }
-inline void PartitionState::set_allocated_repl_state(::std::string* repl_state) {
-  if (repl_state_ != &::google::protobuf::internal::kEmptyString) {
-    delete repl_state_;
+inline void CmdRequest_FlushDB::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
   }
-  if (repl_state) {
-    set_has_repl_state();
-    repl_state_ = repl_state;
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
   } else {
-    clear_has_repl_state();
-    repl_state_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required .client.Node master = 4;
-inline bool PartitionState::has_master() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void PartitionState::set_has_master() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void PartitionState::clear_has_master() {
-  _has_bits_[0] &= ~0x00000008u;
+// required int32 partition_id = 2;
+inline bool CmdRequest_FlushDB::has_partition_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void PartitionState::clear_master() {
-  if (master_ != NULL) master_->::client::Node::Clear();
-  clear_has_master();
+inline void CmdRequest_FlushDB::set_has_partition_id() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline const ::client::Node& PartitionState::master() const {
-  return master_ != NULL ? *master_ : *default_instance_->master_;
+inline void CmdRequest_FlushDB::clear_has_partition_id() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline ::client::Node* PartitionState::mutable_master() {
-  set_has_master();
-  if (master_ == NULL) master_ = new ::client::Node;
-  return master_;
+inline void CmdRequest_FlushDB::clear_partition_id() {
+  partition_id_ = 0;
+  clear_has_partition_id();
 }
-inline ::client::Node* PartitionState::release_master() {
-  clear_has_master();
-  ::client::Node* temp = master_;
-  master_ = NULL;
-  return temp;
+inline ::google::protobuf::int32 CmdRequest_FlushDB::partition_id() const {
+  return partition_id_;
 }
-inline void PartitionState::set_allocated_master(::client::Node* master) {
-  delete master_;
-  master_ = master;
-  if (master) {
-    set_has_master();
-  } else {
-    clear_has_master();
-  }
+inline void CmdRequest_FlushDB::set_partition_id(::google::protobuf::int32 value) {
+  set_has_partition_id();
+  partition_id_ = value;
 }
 
-// repeated .client.Node slaves = 5;
-inline int PartitionState::slaves_size() const {
-  return slaves_.size();
-}
-inline void PartitionState::clear_slaves() {
-  slaves_.Clear();
-}
-inline const ::client::Node& PartitionState::slaves(int index) const {
-  return slaves_.Get(index);
-}
-inline ::client::Node* PartitionState::mutable_slaves(int index) {
-  return slaves_.Mutable(index);
-}
-inline ::client::Node* PartitionState::add_slaves() {
-  return slaves_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::client::Node >&
-PartitionState::slaves() const {
-  return slaves_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::client::Node >*
-PartitionState::mutable_slaves() {
-  return &slaves_;
-}
+// -------------------------------------------------------------------
 
-// required .client.SyncOffset sync_offset = 6;
-inline bool PartitionState::has_sync_offset() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void PartitionState::set_has_sync_offset() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void PartitionState::clear_has_sync_offset() {
-  _has_bits_[0] &= ~0x00000020u;
-}
-inline void PartitionState::clear_sync_offset() {
-  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-  clear_has_sync_offset();
-}
-inline const ::client::SyncOffset& PartitionState::sync_offset() const {
-  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+// CmdRequest_Mset
+
+// required string table_name = 1;
+inline bool CmdRequest_Mset::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline ::client::SyncOffset* PartitionState::mutable_sync_offset() {
-  set_has_sync_offset();
-  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
-  return sync_offset_;
+inline void CmdRequest_Mset::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline ::client::SyncOffset* PartitionState::release_sync_offset() {
-  clear_has_sync_offset();
-  ::client::SyncOffset* temp = sync_offset_;
-  sync_offset_ = NULL;
-  return temp;
+inline void CmdRequest_Mset::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void PartitionState::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
-  delete sync_offset_;
-  sync_offset_ = sync_offset;
-  if (sync_offset) {
-    set_has_sync_offset();
-  } else {
-    clear_has_sync_offset();
+inline void CmdRequest_Mset::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
   }
+  clear_has_table_name();
 }
-
-// optional .client.SlaveFallback fallback = 7;
-inline bool PartitionState::has_fallback() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void PartitionState::set_has_fallback() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void PartitionState::clear_has_fallback() {
-  _has_bits_[0] &= ~0x00000040u;
+inline const ::std::string& CmdRequest_Mset::table_name() const {
+  return *table_name_;
 }
-inline void PartitionState::clear_fallback() {
-  if (fallback_ != NULL) fallback_->::client::SlaveFallback::Clear();
-  clear_has_fallback();
+inline void CmdRequest_Mset::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline const ::client::SlaveFallback& PartitionState::fallback() const {
-  return fallback_ != NULL ? *fallback_ : *default_instance_->fallback_;
+inline void CmdRequest_Mset::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline ::client::SlaveFallback* PartitionState::mutable_fallback() {
-  set_has_fallback();
-  if (fallback_ == NULL) fallback_ = new ::client::SlaveFallback;
-  return fallback_;
+inline void CmdRequest_Mset::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::client::SlaveFallback* PartitionState::release_fallback() {
-  clear_has_fallback();
-  ::client::SlaveFallback* temp = fallback_;
-  fallback_ = NULL;
-  return temp;
+inline ::std::string* CmdRequest_Mset::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
 }
-inline void PartitionState::set_allocated_fallback(::client::SlaveFallback* fallback) {
-  delete fallback_;
-  fallback_ = fallback;
-  if (fallback) {
-    set_has_fallback();
+inline ::std::string* CmdRequest_Mset::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Mset::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
   } else {
-    clear_has_fallback();
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// -------------------------------------------------------------------
-
-// CmdRequest_Sync
-
-// required .client.Node node = 1;
-inline bool CmdRequest_Sync::has_node() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CmdRequest_Sync::set_has_node() {
-  _has_bits_[0] |= 0x00000001u;
+// repeated .client.Kv kvs = 2;
+inline int CmdRequest_Mset::kvs_size() const {
+  return kvs_.size();
 }
-inline void CmdRequest_Sync::clear_has_node() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_Mset::clear_kvs() {
+  kvs_.Clear();
 }
-inline void CmdRequest_Sync::clear_node() {
-  if (node_ != NULL) node_->::client::Node::Clear();
-  clear_has_node();
+inline const ::client::Kv& CmdRequest_Mset::kvs(int index) const {
+  return kvs_.Get(index);
 }
-inline const ::client::Node& CmdRequest_Sync::node() const {
-  return node_ != NULL ? *node_ : *default_instance_->node_;
+inline ::client::Kv* CmdRequest_Mset::mutable_kvs(int index) {
+  return kvs_.Mutable(index);
 }
-inline ::client::Node* CmdRequest_Sync::mutable_node() {
-  set_has_node();
-  if (node_ == NULL) node_ = new ::client::Node;
-  return node_;
+inline ::client::Kv* CmdRequest_Mset::add_kvs() {
+  return kvs_.Add();
 }
-inline ::client::Node* CmdRequest_Sync::release_node() {
-  clear_has_node();
-  ::client::Node* temp = node_;
-  node_ = NULL;
-  return temp;
+inline const ::google::protobuf::RepeatedPtrField< ::client::Kv >&
+CmdRequest_Mset::kvs() const {
+  return kvs_;
 }
-inline void CmdRequest_Sync::set_allocated_node(::client::Node* node) {
-  delete node_;
-  node_ = node;
-  if (node) {
-    set_has_node();
-  } else {
-    clear_has_node();
-  }
+inline ::google::protobuf::RepeatedPtrField< ::client::Kv >*
+CmdRequest_Mset::mutable_kvs() {
+  return &kvs_;
 }
 
-// required string table_name = 2;
-inline bool CmdRequest_Sync::has_table_name() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// -------------------------------------------------------------------
+
+// CmdRequest_Scan
+
+// required string table_name = 1;
+inline bool CmdRequest_Scan::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdRequest_Sync::set_has_table_name() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdRequest_Scan::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdRequest_Sync::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest_Scan::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest_Sync::clear_table_name() {
+inline void CmdRequest_Scan::clear_table_name() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     table_name_->clear();
   }
   clear_has_table_name();
 }
-inline const ::std::string& CmdRequest_Sync::table_name() const {
+inline const ::std::string& CmdRequest_Scan::table_name() const {
   return *table_name_;
 }
-inline void CmdRequest_Sync::set_table_name(const ::std::string& value) {
+inline void CmdRequest_Scan::set_table_name(const ::std::string& value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdRequest_Sync::set_table_name(const char* value) {
+inline void CmdRequest_Scan::set_table_name(const char* value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdRequest_Sync::set_table_name(const char* value, size_t size) {
+inline void CmdRequest_Scan::set_table_name(const char* value, size_t size) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Sync::mutable_table_name() {
+inline ::std::string* CmdRequest_Scan::mutable_table_name() {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   return table_name_;
 }
-inline ::std::string* CmdRequest_Sync::release_table_name() {
+inline ::std::string* CmdRequest_Scan::release_table_name() {
   clear_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -3685,7 +6683,7 @@ inline ::std::string* CmdRequest_Sync::release_table_name() {
     return temp;
   }
 }
-inline void CmdRequest_Sync::set_allocated_table_name(::std::string* table_name) {
+inline void CmdRequest_Scan::set_allocated_table_name(::std::string* table_name) {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     delete table_name_;
   }
@@ -3698,118 +6696,194 @@ inline void CmdRequest_Sync::set_allocated_table_name(::std::string* table_name)
   }
 }
 
-// required .client.SyncOffset sync_offset = 3;
-inline bool CmdRequest_Sync::has_sync_offset() const {
+// required int32 partition_id = 2;
+inline bool CmdRequest_Scan::has_partition_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CmdRequest_Scan::set_has_partition_id() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CmdRequest_Scan::clear_has_partition_id() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CmdRequest_Scan::clear_partition_id() {
+  partition_id_ = 0;
+  clear_has_partition_id();
+}
+inline ::google::protobuf::int32 CmdRequest_Scan::partition_id() const {
+  return partition_id_;
+}
+inline void CmdRequest_Scan::set_partition_id(::google::protobuf::int32 value) {
+  set_has_partition_id();
+  partition_id_ = value;
+}
+
+// optional string key_start = 3;
+inline bool CmdRequest_Scan::has_key_start() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdRequest_Sync::set_has_sync_offset() {
+inline void CmdRequest_Scan::set_has_key_start() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void CmdRequest_Sync::clear_has_sync_offset() {
+inline void CmdRequest_Scan::clear_has_key_start() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest_Sync::clear_sync_offset() {
-  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-  clear_has_sync_offset();
+inline void CmdRequest_Scan::clear_key_start() {
+  if (key_start_ != &::google::protobuf::internal::kEmptyString) {
+    key_start_->clear();
+  }
+  clear_has_key_start();
 }
-inline const ::client::SyncOffset& CmdRequest_Sync::sync_offset() const {
-  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+inline const ::std::string& CmdRequest_Scan::key_start() const {
+  return *key_start_;
 }
-inline ::client::SyncOffset* CmdRequest_Sync::mutable_sync_offset() {
-  set_has_sync_offset();
-  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
-  return sync_offset_;
+inline void CmdRequest_Scan::set_key_start(const ::std::string& value) {
+  set_has_key_start();
+  if (key_start_ == &::google::protobuf::internal::kEmptyString) {
+    key_start_ = new ::std::string;
+  }
+  key_start_->assign(value);
 }
-inline ::client::SyncOffset* CmdRequest_Sync::release_sync_offset() {
-  clear_has_sync_offset();
-  ::client::SyncOffset* temp = sync_offset_;
-  sync_offset_ = NULL;
-  return temp;
+inline void CmdRequest_Scan::set_key_start(const char* value) {
+  set_has_key_start();
+  if (key_start_ == &::google::protobuf::internal::kEmptyString) {
+    key_start_ = new ::std::string;
+  }
+  key_start_->assign(value);
 }
-inline void CmdRequest_Sync::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
-  delete sync_offset_;
-  sync_offset_ = sync_offset;
-  if (sync_offset) {
-    set_has_sync_offset();
+inline void CmdRequest_Scan::set_key_start(const char* value, size_t size) {
+  set_has_key_start();
+  if (key_start_ == &::google::protobuf::internal::kEmptyString) {
+    key_start_ = new ::std::string;
+  }
+  key_start_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Scan::mutable_key_start() {
+  set_has_key_start();
+  if (key_start_ == &::google::protobuf::internal::kEmptyString) {
+    key_start_ = new ::std::string;
+  }
+  return key_start_;
+}
+inline ::std::string* CmdRequest_Scan::release_key_start() {
+  clear_has_key_start();
+  if (key_start_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
   } else {
-    clear_has_sync_offset();
+    ::std::string* temp = key_start_;
+    key_start_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Scan::set_allocated_key_start(::std::string* key_start) {
+  if (key_start_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_start_;
+  }
+  if (key_start) {
+    set_has_key_start();
+    key_start_ = key_start;
+  } else {
+    clear_has_key_start();
+    key_start_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required int64 epoch = 4;
-inline bool CmdRequest_Sync::has_epoch() const {
+// optional int32 limit = 4;
+inline bool CmdRequest_Scan::has_limit() const {
   return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void CmdRequest_Sync::set_has_epoch() {
+inline void CmdRequest_Scan::set_has_limit() {
   _has_bits_[0] |= 0x00000008u;
 }
-inline void CmdRequest_Sync::clear_has_epoch() {
+inline void CmdRequest_Scan::clear_has_limit() {
   _has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdRequest_Sync::clear_epoch() {
-  epoch_ = GOOGLE_LONGLONG(0);
-  clear_has_epoch();
+inline void CmdRequest_Scan::clear_limit() {
+  limit_ = 0;
+  clear_has_limit();
 }
-inline ::google::protobuf::int64 CmdRequest_Sync::epoch() const {
-  return epoch_;
+inline ::google::protobuf::int32 CmdRequest_Scan::limit() const {
+  return limit_;
 }
-inline void CmdRequest_Sync::set_epoch(::google::protobuf::int64 value) {
-  set_has_epoch();
-  epoch_ = value;
+inline void CmdRequest_Scan::set_limit(::google::protobuf::int32 value) {
+  set_has_limit();
+  limit_ = value;
+}
+
+// optional int64 max_bytes = 5;
+inline bool CmdRequest_Scan::has_max_bytes() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void CmdRequest_Scan::set_has_max_bytes() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void CmdRequest_Scan::clear_has_max_bytes() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void CmdRequest_Scan::clear_max_bytes() {
+  max_bytes_ = GOOGLE_LONGLONG(0);
+  clear_has_max_bytes();
+}
+inline ::google::protobuf::int64 CmdRequest_Scan::max_bytes() const {
+  return max_bytes_;
+}
+inline void CmdRequest_Scan::set_max_bytes(::google::protobuf::int64 value) {
+  set_has_max_bytes();
+  max_bytes_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest_Set
+// CmdRequest_Cas
 
 // required string table_name = 1;
-inline bool CmdRequest_Set::has_table_name() const {
+inline bool CmdRequest_Cas::has_table_name() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdRequest_Set::set_has_table_name() {
+inline void CmdRequest_Cas::set_has_table_name() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdRequest_Set::clear_has_table_name() {
+inline void CmdRequest_Cas::clear_has_table_name() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest_Set::clear_table_name() {
+inline void CmdRequest_Cas::clear_table_name() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     table_name_->clear();
   }
   clear_has_table_name();
 }
-inline const ::std::string& CmdRequest_Set::table_name() const {
+inline const ::std::string& CmdRequest_Cas::table_name() const {
   return *table_name_;
 }
-inline void CmdRequest_Set::set_table_name(const ::std::string& value) {
+inline void CmdRequest_Cas::set_table_name(const ::std::string& value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdRequest_Set::set_table_name(const char* value) {
+inline void CmdRequest_Cas::set_table_name(const char* value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdRequest_Set::set_table_name(const char* value, size_t size) {
+inline void CmdRequest_Cas::set_table_name(const char* value, size_t size) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Set::mutable_table_name() {
+inline ::std::string* CmdRequest_Cas::mutable_table_name() {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   return table_name_;
 }
-inline ::std::string* CmdRequest_Set::release_table_name() {
+inline ::std::string* CmdRequest_Cas::release_table_name() {
   clear_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -3819,7 +6893,7 @@ inline ::std::string* CmdRequest_Set::release_table_name() {
     return temp;
   }
 }
-inline void CmdRequest_Set::set_allocated_table_name(::std::string* table_name) {
+inline void CmdRequest_Cas::set_allocated_table_name(::std::string* table_name) {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     delete table_name_;
   }
@@ -3833,53 +6907,53 @@ inline void CmdRequest_Set::set_allocated_table_name(::std::string* table_name)
 }
 
 // required string key = 2;
-inline bool CmdRequest_Set::has_key() const {
+inline bool CmdRequest_Cas::has_key() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void CmdRequest_Set::set_has_key() {
+inline void CmdRequest_Cas::set_has_key() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void CmdRequest_Set::clear_has_key() {
+inline void CmdRequest_Cas::clear_has_key() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_Set::clear_key() {
+inline void CmdRequest_Cas::clear_key() {
   if (key_ != &::google::protobuf::internal::kEmptyString) {
     key_->clear();
   }
   clear_has_key();
 }
-inline const ::std::string& CmdRequest_Set::key() const {
+inline const ::std::string& CmdRequest_Cas::key() const {
   return *key_;
 }
-inline void CmdRequest_Set::set_key(const ::std::string& value) {
+inline void CmdRequest_Cas::set_key(const ::std::string& value) {
   set_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     key_ = new ::std::string;
   }
   key_->assign(value);
 }
-inline void CmdRequest_Set::set_key(const char* value) {
+inline void CmdRequest_Cas::set_key(const char* value) {
   set_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     key_ = new ::std::string;
   }
   key_->assign(value);
 }
-inline void CmdRequest_Set::set_key(const char* value, size_t size) {
+inline void CmdRequest_Cas::set_key(const char* value, size_t size) {
   set_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     key_ = new ::std::string;
   }
   key_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Set::mutable_key() {
+inline ::std::string* CmdRequest_Cas::mutable_key() {
   set_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     key_ = new ::std::string;
   }
   return key_;
 }
-inline ::std::string* CmdRequest_Set::release_key() {
+inline ::std::string* CmdRequest_Cas::release_key() {
   clear_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -3889,7 +6963,7 @@ inline ::std::string* CmdRequest_Set::release_key() {
     return temp;
   }
 }
-inline void CmdRequest_Set::set_allocated_key(::std::string* key) {
+inline void CmdRequest_Cas::set_allocated_key(::std::string* key) {
   if (key_ != &::google::protobuf::internal::kEmptyString) {
     delete key_;
   }
@@ -3903,53 +6977,53 @@ inline void CmdRequest_Set::set_allocated_key(::std::string* key) {
 }
 
 // required bytes value = 3;
-inline bool CmdRequest_Set::has_value() const {
+inline bool CmdRequest_Cas::has_value() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdRequest_Set::set_has_value() {
+inline void CmdRequest_Cas::set_has_value() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void CmdRequest_Set::clear_has_value() {
+inline void CmdRequest_Cas::clear_has_value() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest_Set::clear_value() {
+inline void CmdRequest_Cas::clear_value() {
   if (value_ != &::google::protobuf::internal::kEmptyString) {
     value_->clear();
   }
   clear_has_value();
 }
-inline const ::std::string& CmdRequest_Set::value() const {
+inline const ::std::string& CmdRequest_Cas::value() const {
   return *value_;
 }
-inline void CmdRequest_Set::set_value(const ::std::string& value) {
+inline void CmdRequest_Cas::set_value(const ::std::string& value) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(value);
 }
-inline void CmdRequest_Set::set_value(const char* value) {
+inline void CmdRequest_Cas::set_value(const char* value) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(value);
 }
-inline void CmdRequest_Set::set_value(const void* value, size_t size) {
+inline void CmdRequest_Cas::set_value(const void* value, size_t size) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Set::mutable_value() {
+inline ::std::string* CmdRequest_Cas::mutable_value() {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   return value_;
 }
-inline ::std::string* CmdRequest_Set::release_value() {
+inline ::std::string* CmdRequest_Cas::release_value() {
   clear_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -3959,7 +7033,7 @@ inline ::std::string* CmdRequest_Set::release_value() {
     return temp;
   }
 }
-inline void CmdRequest_Set::set_allocated_value(::std::string* value) {
+inline void CmdRequest_Cas::set_allocated_value(::std::string* value) {
   if (value_ != &::google::protobuf::internal::kEmptyString) {
     delete value_;
   }
@@ -3972,54 +7046,124 @@ inline void CmdRequest_Set::set_allocated_value(::std::string* value) {
   }
 }
 
-// optional string uuid = 4;
-inline bool CmdRequest_Set::has_uuid() const {
+// optional bytes expect = 4;
+inline bool CmdRequest_Cas::has_expect() const {
   return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void CmdRequest_Set::set_has_uuid() {
+inline void CmdRequest_Cas::set_has_expect() {
   _has_bits_[0] |= 0x00000008u;
 }
-inline void CmdRequest_Set::clear_has_uuid() {
+inline void CmdRequest_Cas::clear_has_expect() {
   _has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdRequest_Set::clear_uuid() {
+inline void CmdRequest_Cas::clear_expect() {
+  if (expect_ != &::google::protobuf::internal::kEmptyString) {
+    expect_->clear();
+  }
+  clear_has_expect();
+}
+inline const ::std::string& CmdRequest_Cas::expect() const {
+  return *expect_;
+}
+inline void CmdRequest_Cas::set_expect(const ::std::string& value) {
+  set_has_expect();
+  if (expect_ == &::google::protobuf::internal::kEmptyString) {
+    expect_ = new ::std::string;
+  }
+  expect_->assign(value);
+}
+inline void CmdRequest_Cas::set_expect(const char* value) {
+  set_has_expect();
+  if (expect_ == &::google::protobuf::internal::kEmptyString) {
+    expect_ = new ::std::string;
+  }
+  expect_->assign(value);
+}
+inline void CmdRequest_Cas::set_expect(const void* value, size_t size) {
+  set_has_expect();
+  if (expect_ == &::google::protobuf::internal::kEmptyString) {
+    expect_ = new ::std::string;
+  }
+  expect_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdRequest_Cas::mutable_expect() {
+  set_has_expect();
+  if (expect_ == &::google::protobuf::internal::kEmptyString) {
+    expect_ = new ::std::string;
+  }
+  return expect_;
+}
+inline ::std::string* CmdRequest_Cas::release_expect() {
+  clear_has_expect();
+  if (expect_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = expect_;
+    expect_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdRequest_Cas::set_allocated_expect(::std::string* expect) {
+  if (expect_ != &::google::protobuf::internal::kEmptyString) {
+    delete expect_;
+  }
+  if (expect) {
+    set_has_expect();
+    expect_ = expect;
+  } else {
+    clear_has_expect();
+    expect_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional string uuid = 5;
+inline bool CmdRequest_Cas::has_uuid() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void CmdRequest_Cas::set_has_uuid() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void CmdRequest_Cas::clear_has_uuid() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void CmdRequest_Cas::clear_uuid() {
   if (uuid_ != &::google::protobuf::internal::kEmptyString) {
     uuid_->clear();
   }
   clear_has_uuid();
 }
-inline const ::std::string& CmdRequest_Set::uuid() const {
+inline const ::std::string& CmdRequest_Cas::uuid() const {
   return *uuid_;
 }
-inline void CmdRequest_Set::set_uuid(const ::std::string& value) {
+inline void CmdRequest_Cas::set_uuid(const ::std::string& value) {
   set_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     uuid_ = new ::std::string;
   }
   uuid_->assign(value);
 }
-inline void CmdRequest_Set::set_uuid(const char* value) {
+inline void CmdRequest_Cas::set_uuid(const char* value) {
   set_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     uuid_ = new ::std::string;
   }
   uuid_->assign(value);
 }
-inline void CmdRequest_Set::set_uuid(const char* value, size_t size) {
+inline void CmdRequest_Cas::set_uuid(const char* value, size_t size) {
   set_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     uuid_ = new ::std::string;
   }
   uuid_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Set::mutable_uuid() {
+inline ::std::string* CmdRequest_Cas::mutable_uuid() {
   set_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     uuid_ = new ::std::string;
   }
   return uuid_;
 }
-inline ::std::string* CmdRequest_Set::release_uuid() {
+inline ::std::string* CmdRequest_Cas::release_uuid() {
   clear_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -4029,109 +7173,70 @@ inline ::std::string* CmdRequest_Set::release_uuid() {
     return temp;
   }
 }
-inline void CmdRequest_Set::set_allocated_uuid(::std::string* uuid) {
+inline void CmdRequest_Cas::set_allocated_uuid(::std::string* uuid) {
   if (uuid_ != &::google::protobuf::internal::kEmptyString) {
     delete uuid_;
   }
   if (uuid) {
     set_has_uuid();
-    uuid_ = uuid;
-  } else {
-    clear_has_uuid();
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
-}
-
-// optional .client.KeyExpire expire = 5;
-inline bool CmdRequest_Set::has_expire() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void CmdRequest_Set::set_has_expire() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void CmdRequest_Set::clear_has_expire() {
-  _has_bits_[0] &= ~0x00000010u;
-}
-inline void CmdRequest_Set::clear_expire() {
-  if (expire_ != NULL) expire_->::client::KeyExpire::Clear();
-  clear_has_expire();
-}
-inline const ::client::KeyExpire& CmdRequest_Set::expire() const {
-  return expire_ != NULL ? *expire_ : *default_instance_->expire_;
-}
-inline ::client::KeyExpire* CmdRequest_Set::mutable_expire() {
-  set_has_expire();
-  if (expire_ == NULL) expire_ = new ::client::KeyExpire;
-  return expire_;
-}
-inline ::client::KeyExpire* CmdRequest_Set::release_expire() {
-  clear_has_expire();
-  ::client::KeyExpire* temp = expire_;
-  expire_ = NULL;
-  return temp;
-}
-inline void CmdRequest_Set::set_allocated_expire(::client::KeyExpire* expire) {
-  delete expire_;
-  expire_ = expire;
-  if (expire) {
-    set_has_expire();
+    uuid_ = uuid;
   } else {
-    clear_has_expire();
+    clear_has_uuid();
+    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
-
 // -------------------------------------------------------------------
 
-// CmdRequest_Get
+// CmdRequest_Incrby
 
 // required string table_name = 1;
-inline bool CmdRequest_Get::has_table_name() const {
+inline bool CmdRequest_Incrby::has_table_name() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdRequest_Get::set_has_table_name() {
+inline void CmdRequest_Incrby::set_has_table_name() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdRequest_Get::clear_has_table_name() {
+inline void CmdRequest_Incrby::clear_has_table_name() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest_Get::clear_table_name() {
+inline void CmdRequest_Incrby::clear_table_name() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     table_name_->clear();
   }
   clear_has_table_name();
 }
-inline const ::std::string& CmdRequest_Get::table_name() const {
+inline const ::std::string& CmdRequest_Incrby::table_name() const {
   return *table_name_;
 }
-inline void CmdRequest_Get::set_table_name(const ::std::string& value) {
+inline void CmdRequest_Incrby::set_table_name(const ::std::string& value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdRequest_Get::set_table_name(const char* value) {
+inline void CmdRequest_Incrby::set_table_name(const char* value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdRequest_Get::set_table_name(const char* value, size_t size) {
+inline void CmdRequest_Incrby::set_table_name(const char* value, size_t size) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Get::mutable_table_name() {
+inline ::std::string* CmdRequest_Incrby::mutable_table_name() {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   return table_name_;
 }
-inline ::std::string* CmdRequest_Get::release_table_name() {
+inline ::std::string* CmdRequest_Incrby::release_table_name() {
   clear_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -4141,7 +7246,7 @@ inline ::std::string* CmdRequest_Get::release_table_name() {
     return temp;
   }
 }
-inline void CmdRequest_Get::set_allocated_table_name(::std::string* table_name) {
+inline void CmdRequest_Incrby::set_allocated_table_name(::std::string* table_name) {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     delete table_name_;
   }
@@ -4155,53 +7260,53 @@ inline void CmdRequest_Get::set_allocated_table_name(::std::string* table_name)
 }
 
 // required string key = 2;
-inline bool CmdRequest_Get::has_key() const {
+inline bool CmdRequest_Incrby::has_key() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void CmdRequest_Get::set_has_key() {
+inline void CmdRequest_Incrby::set_has_key() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void CmdRequest_Get::clear_has_key() {
+inline void CmdRequest_Incrby::clear_has_key() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_Get::clear_key() {
+inline void CmdRequest_Incrby::clear_key() {
   if (key_ != &::google::protobuf::internal::kEmptyString) {
     key_->clear();
   }
   clear_has_key();
 }
-inline const ::std::string& CmdRequest_Get::key() const {
+inline const ::std::string& CmdRequest_Incrby::key() const {
   return *key_;
 }
-inline void CmdRequest_Get::set_key(const ::std::string& value) {
+inline void CmdRequest_Incrby::set_key(const ::std::string& value) {
   set_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     key_ = new ::std::string;
   }
   key_->assign(value);
 }
-inline void CmdRequest_Get::set_key(const char* value) {
+inline void CmdRequest_Incrby::set_key(const char* value) {
   set_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     key_ = new ::std::string;
   }
   key_->assign(value);
 }
-inline void CmdRequest_Get::set_key(const char* value, size_t size) {
+inline void CmdRequest_Incrby::set_key(const char* value, size_t size) {
   set_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     key_ = new ::std::string;
   }
   key_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Get::mutable_key() {
+inline ::std::string* CmdRequest_Incrby::mutable_key() {
   set_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     key_ = new ::std::string;
   }
   return key_;
 }
-inline ::std::string* CmdRequest_Get::release_key() {
+inline ::std::string* CmdRequest_Incrby::release_key() {
   clear_has_key();
   if (key_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -4211,7 +7316,7 @@ inline ::std::string* CmdRequest_Get::release_key() {
     return temp;
   }
 }
-inline void CmdRequest_Get::set_allocated_key(::std::string* key) {
+inline void CmdRequest_Incrby::set_allocated_key(::std::string* key) {
   if (key_ != &::google::protobuf::internal::kEmptyString) {
     delete key_;
   }
@@ -4224,54 +7329,76 @@ inline void CmdRequest_Get::set_allocated_key(::std::string* key) {
   }
 }
 
-// optional string uuid = 3;
-inline bool CmdRequest_Get::has_uuid() const {
+// required int64 by = 3;
+inline bool CmdRequest_Incrby::has_by() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdRequest_Get::set_has_uuid() {
+inline void CmdRequest_Incrby::set_has_by() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void CmdRequest_Get::clear_has_uuid() {
+inline void CmdRequest_Incrby::clear_has_by() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest_Get::clear_uuid() {
+inline void CmdRequest_Incrby::clear_by() {
+  by_ = GOOGLE_LONGLONG(0);
+  clear_has_by();
+}
+inline ::google::protobuf::int64 CmdRequest_Incrby::by() const {
+  return by_;
+}
+inline void CmdRequest_Incrby::set_by(::google::protobuf::int64 value) {
+  set_has_by();
+  by_ = value;
+}
+
+// optional string uuid = 4;
+inline bool CmdRequest_Incrby::has_uuid() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void CmdRequest_Incrby::set_has_uuid() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void CmdRequest_Incrby::clear_has_uuid() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void CmdRequest_Incrby::clear_uuid() {
   if (uuid_ != &::google::protobuf::internal::kEmptyString) {
     uuid_->clear();
   }
   clear_has_uuid();
 }
-inline const ::std::string& CmdRequest_Get::uuid() const {
+inline const ::std::string& CmdRequest_Incrby::uuid() const {
   return *uuid_;
 }
-inline void CmdRequest_Get::set_uuid(const ::std::string& value) {
+inline void CmdRequest_Incrby::set_uuid(const ::std::string& value) {
   set_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     uuid_ = new ::std::string;
   }
   uuid_->assign(value);
 }
-inline void CmdRequest_Get::set_uuid(const char* value) {
+inline void CmdRequest_Incrby::set_uuid(const char* value) {
   set_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     uuid_ = new ::std::string;
   }
   uuid_->assign(value);
 }
-inline void CmdRequest_Get::set_uuid(const char* value, size_t size) {
+inline void CmdRequest_Incrby::set_uuid(const char* value, size_t size) {
   set_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     uuid_ = new ::std::string;
   }
   uuid_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Get::mutable_uuid() {
+inline ::std::string* CmdRequest_Incrby::mutable_uuid() {
   set_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     uuid_ = new ::std::string;
   }
   return uuid_;
 }
-inline ::std::string* CmdRequest_Get::release_uuid() {
+inline ::std::string* CmdRequest_Incrby::release_uuid() {
   clear_has_uuid();
   if (uuid_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -4281,7 +7408,7 @@ inline ::std::string* CmdRequest_Get::release_uuid() {
     return temp;
   }
 }
-inline void CmdRequest_Get::set_allocated_uuid(::std::string* uuid) {
+inline void CmdRequest_Incrby::set_allocated_uuid(::std::string* uuid) {
   if (uuid_ != &::google::protobuf::internal::kEmptyString) {
     delete uuid_;
   }
@@ -4293,465 +7420,503 @@ inline void CmdRequest_Get::set_allocated_uuid(::std::string* uuid) {
     uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
-
 // -------------------------------------------------------------------
 
-// CmdRequest_Del
+// CmdRequest
 
-// required string table_name = 1;
-inline bool CmdRequest_Del::has_table_name() const {
+// required .client.Type type = 1;
+inline bool CmdRequest::has_type() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdRequest_Del::set_has_table_name() {
+inline void CmdRequest::set_has_type() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdRequest_Del::clear_has_table_name() {
+inline void CmdRequest::clear_has_type() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest_Del::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline void CmdRequest::clear_type() {
+  type_ = 0;
+  clear_has_type();
 }
-inline const ::std::string& CmdRequest_Del::table_name() const {
-  return *table_name_;
+inline ::client::Type CmdRequest::type() const {
+  return static_cast< ::client::Type >(type_);
 }
-inline void CmdRequest_Del::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdRequest::set_type(::client::Type value) {
+  assert(::client::Type_IsValid(value));
+  set_has_type();
+  type_ = value;
 }
-inline void CmdRequest_Del::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+
+// optional .client.CmdRequest.Sync sync = 2;
+inline bool CmdRequest::has_sync() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void CmdRequest_Del::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline void CmdRequest::set_has_sync() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline ::std::string* CmdRequest_Del::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline void CmdRequest::clear_has_sync() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline ::std::string* CmdRequest_Del::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdRequest::clear_sync() {
+  if (sync_ != NULL) sync_->::client::CmdRequest_Sync::Clear();
+  clear_has_sync();
 }
-inline void CmdRequest_Del::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+inline const ::client::CmdRequest_Sync& CmdRequest::sync() const {
+  return sync_ != NULL ? *sync_ : *default_instance_->sync_;
+}
+inline ::client::CmdRequest_Sync* CmdRequest::mutable_sync() {
+  set_has_sync();
+  if (sync_ == NULL) sync_ = new ::client::CmdRequest_Sync;
+  return sync_;
+}
+inline ::client::CmdRequest_Sync* CmdRequest::release_sync() {
+  clear_has_sync();
+  ::client::CmdRequest_Sync* temp = sync_;
+  sync_ = NULL;
+  return temp;
+}
+inline void CmdRequest::set_allocated_sync(::client::CmdRequest_Sync* sync) {
+  delete sync_;
+  sync_ = sync;
+  if (sync) {
+    set_has_sync();
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_sync();
   }
 }
 
-// required string key = 2;
-inline bool CmdRequest_Del::has_key() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional .client.CmdRequest.Set set = 3;
+inline bool CmdRequest::has_set() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdRequest_Del::set_has_key() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdRequest::set_has_set() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline void CmdRequest_Del::clear_has_key() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest::clear_has_set() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest_Del::clear_key() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    key_->clear();
-  }
-  clear_has_key();
+inline void CmdRequest::clear_set() {
+  if (set_ != NULL) set_->::client::CmdRequest_Set::Clear();
+  clear_has_set();
 }
-inline const ::std::string& CmdRequest_Del::key() const {
-  return *key_;
+inline const ::client::CmdRequest_Set& CmdRequest::set() const {
+  return set_ != NULL ? *set_ : *default_instance_->set_;
 }
-inline void CmdRequest_Del::set_key(const ::std::string& value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline ::client::CmdRequest_Set* CmdRequest::mutable_set() {
+  set_has_set();
+  if (set_ == NULL) set_ = new ::client::CmdRequest_Set;
+  return set_;
 }
-inline void CmdRequest_Del::set_key(const char* value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline ::client::CmdRequest_Set* CmdRequest::release_set() {
+  clear_has_set();
+  ::client::CmdRequest_Set* temp = set_;
+  set_ = NULL;
+  return temp;
 }
-inline void CmdRequest_Del::set_key(const char* value, size_t size) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
+inline void CmdRequest::set_allocated_set(::client::CmdRequest_Set* set) {
+  delete set_;
+  set_ = set;
+  if (set) {
+    set_has_set();
+  } else {
+    clear_has_set();
   }
-  key_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Del::mutable_key() {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  return key_;
+
+// optional .client.CmdRequest.Get get = 4;
+inline bool CmdRequest::has_get() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline ::std::string* CmdRequest_Del::release_key() {
-  clear_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = key_;
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdRequest::set_has_get() {
+  _has_bits_[0] |= 0x00000008u;
 }
-inline void CmdRequest_Del::set_allocated_key(::std::string* key) {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (key) {
-    set_has_key();
-    key_ = key;
+inline void CmdRequest::clear_has_get() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void CmdRequest::clear_get() {
+  if (get_ != NULL) get_->::client::CmdRequest_Get::Clear();
+  clear_has_get();
+}
+inline const ::client::CmdRequest_Get& CmdRequest::get() const {
+  return get_ != NULL ? *get_ : *default_instance_->get_;
+}
+inline ::client::CmdRequest_Get* CmdRequest::mutable_get() {
+  set_has_get();
+  if (get_ == NULL) get_ = new ::client::CmdRequest_Get;
+  return get_;
+}
+inline ::client::CmdRequest_Get* CmdRequest::release_get() {
+  clear_has_get();
+  ::client::CmdRequest_Get* temp = get_;
+  get_ = NULL;
+  return temp;
+}
+inline void CmdRequest::set_allocated_get(::client::CmdRequest_Get* get) {
+  delete get_;
+  get_ = get;
+  if (get) {
+    set_has_get();
   } else {
-    clear_has_key();
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_get();
   }
 }
 
-// optional string uuid = 3;
-inline bool CmdRequest_Del::has_uuid() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional .client.CmdRequest.Del del = 5;
+inline bool CmdRequest::has_del() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
 }
-inline void CmdRequest_Del::set_has_uuid() {
-  _has_bits_[0] |= 0x00000004u;
+inline void CmdRequest::set_has_del() {
+  _has_bits_[0] |= 0x00000010u;
 }
-inline void CmdRequest_Del::clear_has_uuid() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest::clear_has_del() {
+  _has_bits_[0] &= ~0x00000010u;
 }
-inline void CmdRequest_Del::clear_uuid() {
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    uuid_->clear();
-  }
-  clear_has_uuid();
+inline void CmdRequest::clear_del() {
+  if (del_ != NULL) del_->::client::CmdRequest_Del::Clear();
+  clear_has_del();
 }
-inline const ::std::string& CmdRequest_Del::uuid() const {
-  return *uuid_;
+inline const ::client::CmdRequest_Del& CmdRequest::del() const {
+  return del_ != NULL ? *del_ : *default_instance_->del_;
 }
-inline void CmdRequest_Del::set_uuid(const ::std::string& value) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  uuid_->assign(value);
+inline ::client::CmdRequest_Del* CmdRequest::mutable_del() {
+  set_has_del();
+  if (del_ == NULL) del_ = new ::client::CmdRequest_Del;
+  return del_;
 }
-inline void CmdRequest_Del::set_uuid(const char* value) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  uuid_->assign(value);
+inline ::client::CmdRequest_Del* CmdRequest::release_del() {
+  clear_has_del();
+  ::client::CmdRequest_Del* temp = del_;
+  del_ = NULL;
+  return temp;
 }
-inline void CmdRequest_Del::set_uuid(const char* value, size_t size) {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
+inline void CmdRequest::set_allocated_del(::client::CmdRequest_Del* del) {
+  delete del_;
+  del_ = del;
+  if (del) {
+    set_has_del();
+  } else {
+    clear_has_del();
   }
-  uuid_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Del::mutable_uuid() {
-  set_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    uuid_ = new ::std::string;
-  }
-  return uuid_;
+
+// optional .client.CmdRequest.Info info = 6;
+inline bool CmdRequest::has_info() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
 }
-inline ::std::string* CmdRequest_Del::release_uuid() {
-  clear_has_uuid();
-  if (uuid_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = uuid_;
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdRequest::set_has_info() {
+  _has_bits_[0] |= 0x00000020u;
 }
-inline void CmdRequest_Del::set_allocated_uuid(::std::string* uuid) {
-  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
-    delete uuid_;
-  }
-  if (uuid) {
-    set_has_uuid();
-    uuid_ = uuid;
+inline void CmdRequest::clear_has_info() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void CmdRequest::clear_info() {
+  if (info_ != NULL) info_->::client::CmdRequest_Info::Clear();
+  clear_has_info();
+}
+inline const ::client::CmdRequest_Info& CmdRequest::info() const {
+  return info_ != NULL ? *info_ : *default_instance_->info_;
+}
+inline ::client::CmdRequest_Info* CmdRequest::mutable_info() {
+  set_has_info();
+  if (info_ == NULL) info_ = new ::client::CmdRequest_Info;
+  return info_;
+}
+inline ::client::CmdRequest_Info* CmdRequest::release_info() {
+  clear_has_info();
+  ::client::CmdRequest_Info* temp = info_;
+  info_ = NULL;
+  return temp;
+}
+inline void CmdRequest::set_allocated_info(::client::CmdRequest_Info* info) {
+  delete info_;
+  info_ = info;
+  if (info) {
+    set_has_info();
   } else {
-    clear_has_uuid();
-    uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_info();
   }
 }
 
-// -------------------------------------------------------------------
-
-// CmdRequest_Info
-
-// optional string table_name = 1;
-inline bool CmdRequest_Info::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .client.CmdRequest.Mget mget = 7;
+inline bool CmdRequest::has_mget() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
 }
-inline void CmdRequest_Info::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdRequest::set_has_mget() {
+  _has_bits_[0] |= 0x00000040u;
 }
-inline void CmdRequest_Info::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest::clear_has_mget() {
+  _has_bits_[0] &= ~0x00000040u;
 }
-inline void CmdRequest_Info::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline void CmdRequest::clear_mget() {
+  if (mget_ != NULL) mget_->::client::CmdRequest_Mget::Clear();
+  clear_has_mget();
 }
-inline const ::std::string& CmdRequest_Info::table_name() const {
-  return *table_name_;
+inline const ::client::CmdRequest_Mget& CmdRequest::mget() const {
+  return mget_ != NULL ? *mget_ : *default_instance_->mget_;
 }
-inline void CmdRequest_Info::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline ::client::CmdRequest_Mget* CmdRequest::mutable_mget() {
+  set_has_mget();
+  if (mget_ == NULL) mget_ = new ::client::CmdRequest_Mget;
+  return mget_;
 }
-inline void CmdRequest_Info::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline ::client::CmdRequest_Mget* CmdRequest::release_mget() {
+  clear_has_mget();
+  ::client::CmdRequest_Mget* temp = mget_;
+  mget_ = NULL;
+  return temp;
 }
-inline void CmdRequest_Info::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdRequest::set_allocated_mget(::client::CmdRequest_Mget* mget) {
+  delete mget_;
+  mget_ = mget;
+  if (mget) {
+    set_has_mget();
+  } else {
+    clear_has_mget();
   }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_Info::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+
+// optional .client.CmdRequest.FlushDB flushdb = 8;
+inline bool CmdRequest::has_flushdb() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
 }
-inline ::std::string* CmdRequest_Info::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdRequest::set_has_flushdb() {
+  _has_bits_[0] |= 0x00000080u;
 }
-inline void CmdRequest_Info::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+inline void CmdRequest::clear_has_flushdb() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void CmdRequest::clear_flushdb() {
+  if (flushdb_ != NULL) flushdb_->::client::CmdRequest_FlushDB::Clear();
+  clear_has_flushdb();
+}
+inline const ::client::CmdRequest_FlushDB& CmdRequest::flushdb() const {
+  return flushdb_ != NULL ? *flushdb_ : *default_instance_->flushdb_;
+}
+inline ::client::CmdRequest_FlushDB* CmdRequest::mutable_flushdb() {
+  set_has_flushdb();
+  if (flushdb_ == NULL) flushdb_ = new ::client::CmdRequest_FlushDB;
+  return flushdb_;
+}
+inline ::client::CmdRequest_FlushDB* CmdRequest::release_flushdb() {
+  clear_has_flushdb();
+  ::client::CmdRequest_FlushDB* temp = flushdb_;
+  flushdb_ = NULL;
+  return temp;
+}
+inline void CmdRequest::set_allocated_flushdb(::client::CmdRequest_FlushDB* flushdb) {
+  delete flushdb_;
+  flushdb_ = flushdb;
+  if (flushdb) {
+    set_has_flushdb();
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_flushdb();
   }
 }
 
-// -------------------------------------------------------------------
-
-// CmdRequest_Mget
-
-// required string table_name = 1;
-inline bool CmdRequest_Mget::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .client.CmdRequest.Mset mset = 9;
+inline bool CmdRequest::has_mset() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void CmdRequest::set_has_mset() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void CmdRequest::clear_has_mset() {
+  _has_bits_[0] &= ~0x00000100u;
 }
-inline void CmdRequest_Mget::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdRequest::clear_mset() {
+  if (mset_ != NULL) mset_->::client::CmdRequest_Mset::Clear();
+  clear_has_mset();
 }
-inline void CmdRequest_Mget::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline const ::client::CmdRequest_Mset& CmdRequest::mset() const {
+  return mset_ != NULL ? *mset_ : *default_instance_->mset_;
 }
-inline void CmdRequest_Mget::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline ::client::CmdRequest_Mset* CmdRequest::mutable_mset() {
+  set_has_mset();
+  if (mset_ == NULL) mset_ = new ::client::CmdRequest_Mset;
+  return mset_;
 }
-inline const ::std::string& CmdRequest_Mget::table_name() const {
-  return *table_name_;
+inline ::client::CmdRequest_Mset* CmdRequest::release_mset() {
+  clear_has_mset();
+  ::client::CmdRequest_Mset* temp = mset_;
+  mset_ = NULL;
+  return temp;
 }
-inline void CmdRequest_Mget::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdRequest::set_allocated_mset(::client::CmdRequest_Mset* mset) {
+  delete mset_;
+  mset_ = mset;
+  if (mset) {
+    set_has_mset();
+  } else {
+    clear_has_mset();
   }
-  table_name_->assign(value);
 }
-inline void CmdRequest_Mget::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+
+// optional .client.CmdRequest.Scan scan = 10;
+inline bool CmdRequest::has_scan() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
 }
-inline void CmdRequest_Mget::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline void CmdRequest::set_has_scan() {
+  _has_bits_[0] |= 0x00000200u;
 }
-inline ::std::string* CmdRequest_Mget::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline void CmdRequest::clear_has_scan() {
+  _has_bits_[0] &= ~0x00000200u;
 }
-inline ::std::string* CmdRequest_Mget::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdRequest::clear_scan() {
+  if (scan_ != NULL) scan_->::client::CmdRequest_Scan::Clear();
+  clear_has_scan();
 }
-inline void CmdRequest_Mget::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+inline const ::client::CmdRequest_Scan& CmdRequest::scan() const {
+  return scan_ != NULL ? *scan_ : *default_instance_->scan_;
+}
+inline ::client::CmdRequest_Scan* CmdRequest::mutable_scan() {
+  set_has_scan();
+  if (scan_ == NULL) scan_ = new ::client::CmdRequest_Scan;
+  return scan_;
+}
+inline ::client::CmdRequest_Scan* CmdRequest::release_scan() {
+  clear_has_scan();
+  ::client::CmdRequest_Scan* temp = scan_;
+  scan_ = NULL;
+  return temp;
+}
+inline void CmdRequest::set_allocated_scan(::client::CmdRequest_Scan* scan) {
+  delete scan_;
+  scan_ = scan;
+  if (scan) {
+    set_has_scan();
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_scan();
   }
 }
 
-// repeated string keys = 2;
-inline int CmdRequest_Mget::keys_size() const {
-  return keys_.size();
+// optional .client.CmdRequest.Cas cas = 11;
+inline bool CmdRequest::has_cas() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
 }
-inline void CmdRequest_Mget::clear_keys() {
-  keys_.Clear();
+inline void CmdRequest::set_has_cas() {
+  _has_bits_[0] |= 0x00000400u;
 }
-inline const ::std::string& CmdRequest_Mget::keys(int index) const {
-  return keys_.Get(index);
+inline void CmdRequest::clear_has_cas() {
+  _has_bits_[0] &= ~0x00000400u;
 }
-inline ::std::string* CmdRequest_Mget::mutable_keys(int index) {
-  return keys_.Mutable(index);
+inline void CmdRequest::clear_cas() {
+  if (cas_ != NULL) cas_->::client::CmdRequest_Cas::Clear();
+  clear_has_cas();
 }
-inline void CmdRequest_Mget::set_keys(int index, const ::std::string& value) {
-  keys_.Mutable(index)->assign(value);
+inline const ::client::CmdRequest_Cas& CmdRequest::cas() const {
+  return cas_ != NULL ? *cas_ : *default_instance_->cas_;
 }
-inline void CmdRequest_Mget::set_keys(int index, const char* value) {
-  keys_.Mutable(index)->assign(value);
+inline ::client::CmdRequest_Cas* CmdRequest::mutable_cas() {
+  set_has_cas();
+  if (cas_ == NULL) cas_ = new ::client::CmdRequest_Cas;
+  return cas_;
 }
-inline void CmdRequest_Mget::set_keys(int index, const char* value, size_t size) {
-  keys_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
+inline ::client::CmdRequest_Cas* CmdRequest::release_cas() {
+  clear_has_cas();
+  ::client::CmdRequest_Cas* temp = cas_;
+  cas_ = NULL;
+  return temp;
 }
-inline ::std::string* CmdRequest_Mget::add_keys() {
-  return keys_.Add();
+inline void CmdRequest::set_allocated_cas(::client::CmdRequest_Cas* cas) {
+  delete cas_;
+  cas_ = cas;
+  if (cas) {
+    set_has_cas();
+  } else {
+    clear_has_cas();
+  }
 }
-inline void CmdRequest_Mget::add_keys(const ::std::string& value) {
-  keys_.Add()->assign(value);
+
+// optional .client.CmdRequest.Incrby incrby = 12;
+inline bool CmdRequest::has_incrby() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
 }
-inline void CmdRequest_Mget::add_keys(const char* value) {
-  keys_.Add()->assign(value);
+inline void CmdRequest::set_has_incrby() {
+  _has_bits_[0] |= 0x00000800u;
 }
-inline void CmdRequest_Mget::add_keys(const char* value, size_t size) {
-  keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+inline void CmdRequest::clear_has_incrby() {
+  _has_bits_[0] &= ~0x00000800u;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-CmdRequest_Mget::keys() const {
-  return keys_;
+inline void CmdRequest::clear_incrby() {
+  if (incrby_ != NULL) incrby_->::client::CmdRequest_Incrby::Clear();
+  clear_has_incrby();
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-CmdRequest_Mget::mutable_keys() {
-  return &keys_;
+inline const ::client::CmdRequest_Incrby& CmdRequest::incrby() const {
+  return incrby_ != NULL ? *incrby_ : *default_instance_->incrby_;
+}
+inline ::client::CmdRequest_Incrby* CmdRequest::mutable_incrby() {
+  set_has_incrby();
+  if (incrby_ == NULL) incrby_ = new ::client::CmdRequest_Incrby;
+  return incrby_;
+}
+inline ::client::CmdRequest_Incrby* CmdRequest::release_incrby() {
+  clear_has_incrby();
+  ::client::CmdRequest_Incrby* temp = incrby_;
+  incrby_ = NULL;
+  return temp;
+}
+inline void CmdRequest::set_allocated_incrby(::client::CmdRequest_Incrby* incrby) {
+  delete incrby_;
+  incrby_ = incrby;
+  if (incrby) {
+    set_has_incrby();
+  } else {
+    clear_has_incrby();
+  }
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest_FlushDB
+// CmdResponse_Sync
 
 // required string table_name = 1;
-inline bool CmdRequest_FlushDB::has_table_name() const {
+inline bool CmdResponse_Sync::has_table_name() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdRequest_FlushDB::set_has_table_name() {
+inline void CmdResponse_Sync::set_has_table_name() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdRequest_FlushDB::clear_has_table_name() {
+inline void CmdResponse_Sync::clear_has_table_name() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest_FlushDB::clear_table_name() {
+inline void CmdResponse_Sync::clear_table_name() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     table_name_->clear();
   }
   clear_has_table_name();
 }
-inline const ::std::string& CmdRequest_FlushDB::table_name() const {
+inline const ::std::string& CmdResponse_Sync::table_name() const {
   return *table_name_;
 }
-inline void CmdRequest_FlushDB::set_table_name(const ::std::string& value) {
+inline void CmdResponse_Sync::set_table_name(const ::std::string& value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdRequest_FlushDB::set_table_name(const char* value) {
+inline void CmdResponse_Sync::set_table_name(const char* value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdRequest_FlushDB::set_table_name(const char* value, size_t size) {
+inline void CmdResponse_Sync::set_table_name(const char* value, size_t size) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdRequest_FlushDB::mutable_table_name() {
+inline ::std::string* CmdResponse_Sync::mutable_table_name() {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   return table_name_;
 }
-inline ::std::string* CmdRequest_FlushDB::release_table_name() {
+inline ::std::string* CmdResponse_Sync::release_table_name() {
   clear_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -4761,7 +7926,7 @@ inline ::std::string* CmdRequest_FlushDB::release_table_name() {
     return temp;
   }
 }
-inline void CmdRequest_FlushDB::set_allocated_table_name(::std::string* table_name) {
+inline void CmdResponse_Sync::set_allocated_table_name(::std::string* table_name) {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     delete table_name_;
   }
@@ -4774,485 +7939,597 @@ inline void CmdRequest_FlushDB::set_allocated_table_name(::std::string* table_na
   }
 }
 
-// required int32 partition_id = 2;
-inline bool CmdRequest_FlushDB::has_partition_id() const {
+// required .client.SyncOffset sync_offset = 2;
+inline bool CmdResponse_Sync::has_sync_offset() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void CmdRequest_FlushDB::set_has_partition_id() {
+inline void CmdResponse_Sync::set_has_sync_offset() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void CmdRequest_FlushDB::clear_has_partition_id() {
+inline void CmdResponse_Sync::clear_has_sync_offset() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_FlushDB::clear_partition_id() {
-  partition_id_ = 0;
-  clear_has_partition_id();
+inline void CmdResponse_Sync::clear_sync_offset() {
+  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+  clear_has_sync_offset();
 }
-inline ::google::protobuf::int32 CmdRequest_FlushDB::partition_id() const {
-  return partition_id_;
+inline const ::client::SyncOffset& CmdResponse_Sync::sync_offset() const {
+  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
 }
-inline void CmdRequest_FlushDB::set_partition_id(::google::protobuf::int32 value) {
-  set_has_partition_id();
-  partition_id_ = value;
+inline ::client::SyncOffset* CmdResponse_Sync::mutable_sync_offset() {
+  set_has_sync_offset();
+  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
+  return sync_offset_;
+}
+inline ::client::SyncOffset* CmdResponse_Sync::release_sync_offset() {
+  clear_has_sync_offset();
+  ::client::SyncOffset* temp = sync_offset_;
+  sync_offset_ = NULL;
+  return temp;
+}
+inline void CmdResponse_Sync::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+  delete sync_offset_;
+  sync_offset_ = sync_offset;
+  if (sync_offset) {
+    set_has_sync_offset();
+  } else {
+    clear_has_sync_offset();
+  }
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest
+// CmdResponse_Get
 
-// required .client.Type type = 1;
-inline bool CmdRequest::has_type() const {
+// optional bytes value = 1;
+inline bool CmdResponse_Get::has_value() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdRequest::set_has_type() {
+inline void CmdResponse_Get::set_has_value() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdRequest::clear_has_type() {
+inline void CmdResponse_Get::clear_has_value() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest::clear_type() {
-  type_ = 0;
-  clear_has_type();
-}
-inline ::client::Type CmdRequest::type() const {
-  return static_cast< ::client::Type >(type_);
-}
-inline void CmdRequest::set_type(::client::Type value) {
-  assert(::client::Type_IsValid(value));
-  set_has_type();
-  type_ = value;
-}
-
-// optional .client.CmdRequest.Sync sync = 2;
-inline bool CmdRequest::has_sync() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdRequest::set_has_sync() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdResponse_Get::clear_value() {
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    value_->clear();
+  }
+  clear_has_value();
 }
-inline void CmdRequest::clear_has_sync() {
-  _has_bits_[0] &= ~0x00000002u;
+inline const ::std::string& CmdResponse_Get::value() const {
+  return *value_;
 }
-inline void CmdRequest::clear_sync() {
-  if (sync_ != NULL) sync_->::client::CmdRequest_Sync::Clear();
-  clear_has_sync();
+inline void CmdResponse_Get::set_value(const ::std::string& value) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(value);
 }
-inline const ::client::CmdRequest_Sync& CmdRequest::sync() const {
-  return sync_ != NULL ? *sync_ : *default_instance_->sync_;
+inline void CmdResponse_Get::set_value(const char* value) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(value);
 }
-inline ::client::CmdRequest_Sync* CmdRequest::mutable_sync() {
-  set_has_sync();
-  if (sync_ == NULL) sync_ = new ::client::CmdRequest_Sync;
-  return sync_;
+inline void CmdResponse_Get::set_value(const void* value, size_t size) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::client::CmdRequest_Sync* CmdRequest::release_sync() {
-  clear_has_sync();
-  ::client::CmdRequest_Sync* temp = sync_;
-  sync_ = NULL;
-  return temp;
+inline ::std::string* CmdResponse_Get::mutable_value() {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  return value_;
 }
-inline void CmdRequest::set_allocated_sync(::client::CmdRequest_Sync* sync) {
-  delete sync_;
-  sync_ = sync;
-  if (sync) {
-    set_has_sync();
+inline ::std::string* CmdResponse_Get::release_value() {
+  clear_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = value_;
+    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdResponse_Get::set_allocated_value(::std::string* value) {
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    delete value_;
+  }
+  if (value) {
+    set_has_value();
+    value_ = value;
   } else {
-    clear_has_sync();
+    clear_has_value();
+    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// optional .client.CmdRequest.Set set = 3;
-inline bool CmdRequest::has_set() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// CmdResponse_InfoStats
+
+// required string table_name = 1;
+inline bool CmdResponse_InfoStats::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdRequest::set_has_set() {
-  _has_bits_[0] |= 0x00000004u;
+inline void CmdResponse_InfoStats::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdRequest::clear_has_set() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdResponse_InfoStats::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest::clear_set() {
-  if (set_ != NULL) set_->::client::CmdRequest_Set::Clear();
-  clear_has_set();
+inline void CmdResponse_InfoStats::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
 }
-inline const ::client::CmdRequest_Set& CmdRequest::set() const {
-  return set_ != NULL ? *set_ : *default_instance_->set_;
+inline const ::std::string& CmdResponse_InfoStats::table_name() const {
+  return *table_name_;
 }
-inline ::client::CmdRequest_Set* CmdRequest::mutable_set() {
-  set_has_set();
-  if (set_ == NULL) set_ = new ::client::CmdRequest_Set;
-  return set_;
+inline void CmdResponse_InfoStats::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline ::client::CmdRequest_Set* CmdRequest::release_set() {
-  clear_has_set();
-  ::client::CmdRequest_Set* temp = set_;
-  set_ = NULL;
-  return temp;
+inline void CmdResponse_InfoStats::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline void CmdRequest::set_allocated_set(::client::CmdRequest_Set* set) {
-  delete set_;
-  set_ = set;
-  if (set) {
-    set_has_set();
-  } else {
-    clear_has_set();
+inline void CmdResponse_InfoStats::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
   }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-
-// optional .client.CmdRequest.Get get = 4;
-inline bool CmdRequest::has_get() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline ::std::string* CmdResponse_InfoStats::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
 }
-inline void CmdRequest::set_has_get() {
-  _has_bits_[0] |= 0x00000008u;
+inline ::std::string* CmdResponse_InfoStats::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
 }
-inline void CmdRequest::clear_has_get() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdResponse_InfoStats::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
-inline void CmdRequest::clear_get() {
-  if (get_ != NULL) get_->::client::CmdRequest_Get::Clear();
-  clear_has_get();
+
+// required int64 total_querys = 2;
+inline bool CmdResponse_InfoStats::has_total_querys() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline const ::client::CmdRequest_Get& CmdRequest::get() const {
-  return get_ != NULL ? *get_ : *default_instance_->get_;
+inline void CmdResponse_InfoStats::set_has_total_querys() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline ::client::CmdRequest_Get* CmdRequest::mutable_get() {
-  set_has_get();
-  if (get_ == NULL) get_ = new ::client::CmdRequest_Get;
-  return get_;
+inline void CmdResponse_InfoStats::clear_has_total_querys() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline ::client::CmdRequest_Get* CmdRequest::release_get() {
-  clear_has_get();
-  ::client::CmdRequest_Get* temp = get_;
-  get_ = NULL;
-  return temp;
+inline void CmdResponse_InfoStats::clear_total_querys() {
+  total_querys_ = GOOGLE_LONGLONG(0);
+  clear_has_total_querys();
 }
-inline void CmdRequest::set_allocated_get(::client::CmdRequest_Get* get) {
-  delete get_;
-  get_ = get;
-  if (get) {
-    set_has_get();
-  } else {
-    clear_has_get();
-  }
+inline ::google::protobuf::int64 CmdResponse_InfoStats::total_querys() const {
+  return total_querys_;
+}
+inline void CmdResponse_InfoStats::set_total_querys(::google::protobuf::int64 value) {
+  set_has_total_querys();
+  total_querys_ = value;
 }
 
-// optional .client.CmdRequest.Del del = 5;
-inline bool CmdRequest::has_del() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// required int32 qps = 3;
+inline bool CmdResponse_InfoStats::has_qps() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdRequest::set_has_del() {
-  _has_bits_[0] |= 0x00000010u;
+inline void CmdResponse_InfoStats::set_has_qps() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline void CmdRequest::clear_has_del() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void CmdResponse_InfoStats::clear_has_qps() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest::clear_del() {
-  if (del_ != NULL) del_->::client::CmdRequest_Del::Clear();
-  clear_has_del();
+inline void CmdResponse_InfoStats::clear_qps() {
+  qps_ = 0;
+  clear_has_qps();
 }
-inline const ::client::CmdRequest_Del& CmdRequest::del() const {
-  return del_ != NULL ? *del_ : *default_instance_->del_;
+inline ::google::protobuf::int32 CmdResponse_InfoStats::qps() const {
+  return qps_;
 }
-inline ::client::CmdRequest_Del* CmdRequest::mutable_del() {
-  set_has_del();
-  if (del_ == NULL) del_ = new ::client::CmdRequest_Del;
-  return del_;
+inline void CmdResponse_InfoStats::set_qps(::google::protobuf::int32 value) {
+  set_has_qps();
+  qps_ = value;
 }
-inline ::client::CmdRequest_Del* CmdRequest::release_del() {
-  clear_has_del();
-  ::client::CmdRequest_Del* temp = del_;
-  del_ = NULL;
-  return temp;
+
+// -------------------------------------------------------------------
+
+// CmdResponse_InfoCapacity
+
+// required string table_name = 1;
+inline bool CmdResponse_InfoCapacity::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdRequest::set_allocated_del(::client::CmdRequest_Del* del) {
-  delete del_;
-  del_ = del;
-  if (del) {
-    set_has_del();
-  } else {
-    clear_has_del();
-  }
+inline void CmdResponse_InfoCapacity::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
 }
-
-// optional .client.CmdRequest.Info info = 6;
-inline bool CmdRequest::has_info() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline void CmdResponse_InfoCapacity::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdRequest::set_has_info() {
-  _has_bits_[0] |= 0x00000020u;
+inline void CmdResponse_InfoCapacity::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
 }
-inline void CmdRequest::clear_has_info() {
-  _has_bits_[0] &= ~0x00000020u;
+inline const ::std::string& CmdResponse_InfoCapacity::table_name() const {
+  return *table_name_;
 }
-inline void CmdRequest::clear_info() {
-  if (info_ != NULL) info_->::client::CmdRequest_Info::Clear();
-  clear_has_info();
+inline void CmdResponse_InfoCapacity::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline const ::client::CmdRequest_Info& CmdRequest::info() const {
-  return info_ != NULL ? *info_ : *default_instance_->info_;
+inline void CmdResponse_InfoCapacity::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline ::client::CmdRequest_Info* CmdRequest::mutable_info() {
-  set_has_info();
-  if (info_ == NULL) info_ = new ::client::CmdRequest_Info;
-  return info_;
+inline void CmdResponse_InfoCapacity::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::client::CmdRequest_Info* CmdRequest::release_info() {
-  clear_has_info();
-  ::client::CmdRequest_Info* temp = info_;
-  info_ = NULL;
-  return temp;
+inline ::std::string* CmdResponse_InfoCapacity::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
 }
-inline void CmdRequest::set_allocated_info(::client::CmdRequest_Info* info) {
-  delete info_;
-  info_ = info;
-  if (info) {
-    set_has_info();
+inline ::std::string* CmdResponse_InfoCapacity::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
   } else {
-    clear_has_info();
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
   }
 }
-
-// optional .client.CmdRequest.Mget mget = 7;
-inline bool CmdRequest::has_mget() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void CmdRequest::set_has_mget() {
-  _has_bits_[0] |= 0x00000040u;
+inline void CmdResponse_InfoCapacity::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
-inline void CmdRequest::clear_has_mget() {
-  _has_bits_[0] &= ~0x00000040u;
+
+// required int64 used = 2;
+inline bool CmdResponse_InfoCapacity::has_used() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void CmdRequest::clear_mget() {
-  if (mget_ != NULL) mget_->::client::CmdRequest_Mget::Clear();
-  clear_has_mget();
+inline void CmdResponse_InfoCapacity::set_has_used() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline const ::client::CmdRequest_Mget& CmdRequest::mget() const {
-  return mget_ != NULL ? *mget_ : *default_instance_->mget_;
+inline void CmdResponse_InfoCapacity::clear_has_used() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline ::client::CmdRequest_Mget* CmdRequest::mutable_mget() {
-  set_has_mget();
-  if (mget_ == NULL) mget_ = new ::client::CmdRequest_Mget;
-  return mget_;
+inline void CmdResponse_InfoCapacity::clear_used() {
+  used_ = GOOGLE_LONGLONG(0);
+  clear_has_used();
 }
-inline ::client::CmdRequest_Mget* CmdRequest::release_mget() {
-  clear_has_mget();
-  ::client::CmdRequest_Mget* temp = mget_;
-  mget_ = NULL;
-  return temp;
+inline ::google::protobuf::int64 CmdResponse_InfoCapacity::used() const {
+  return used_;
 }
-inline void CmdRequest::set_allocated_mget(::client::CmdRequest_Mget* mget) {
-  delete mget_;
-  mget_ = mget;
-  if (mget) {
-    set_has_mget();
-  } else {
-    clear_has_mget();
-  }
+inline void CmdResponse_InfoCapacity::set_used(::google::protobuf::int64 value) {
+  set_has_used();
+  used_ = value;
 }
 
-// optional .client.CmdRequest.FlushDB flushdb = 8;
-inline bool CmdRequest::has_flushdb() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void CmdRequest::set_has_flushdb() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void CmdRequest::clear_has_flushdb() {
-  _has_bits_[0] &= ~0x00000080u;
+// required int64 remain = 3;
+inline bool CmdResponse_InfoCapacity::has_remain() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdRequest::clear_flushdb() {
-  if (flushdb_ != NULL) flushdb_->::client::CmdRequest_FlushDB::Clear();
-  clear_has_flushdb();
+inline void CmdResponse_InfoCapacity::set_has_remain() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline const ::client::CmdRequest_FlushDB& CmdRequest::flushdb() const {
-  return flushdb_ != NULL ? *flushdb_ : *default_instance_->flushdb_;
+inline void CmdResponse_InfoCapacity::clear_has_remain() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline ::client::CmdRequest_FlushDB* CmdRequest::mutable_flushdb() {
-  set_has_flushdb();
-  if (flushdb_ == NULL) flushdb_ = new ::client::CmdRequest_FlushDB;
-  return flushdb_;
+inline void CmdResponse_InfoCapacity::clear_remain() {
+  remain_ = GOOGLE_LONGLONG(0);
+  clear_has_remain();
 }
-inline ::client::CmdRequest_FlushDB* CmdRequest::release_flushdb() {
-  clear_has_flushdb();
-  ::client::CmdRequest_FlushDB* temp = flushdb_;
-  flushdb_ = NULL;
-  return temp;
+inline ::google::protobuf::int64 CmdResponse_InfoCapacity::remain() const {
+  return remain_;
 }
-inline void CmdRequest::set_allocated_flushdb(::client::CmdRequest_FlushDB* flushdb) {
-  delete flushdb_;
-  flushdb_ = flushdb;
-  if (flushdb) {
-    set_has_flushdb();
-  } else {
-    clear_has_flushdb();
-  }
+inline void CmdResponse_InfoCapacity::set_remain(::google::protobuf::int64 value) {
+  set_has_remain();
+  remain_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// CmdResponse_Sync
+// CmdResponse_InfoRepl
 
 // required string table_name = 1;
-inline bool CmdResponse_Sync::has_table_name() const {
+inline bool CmdResponse_InfoRepl::has_table_name() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdResponse_Sync::set_has_table_name() {
+inline void CmdResponse_InfoRepl::set_has_table_name() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdResponse_Sync::clear_has_table_name() {
+inline void CmdResponse_InfoRepl::clear_has_table_name() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdResponse_Sync::clear_table_name() {
+inline void CmdResponse_InfoRepl::clear_table_name() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     table_name_->clear();
   }
   clear_has_table_name();
 }
-inline const ::std::string& CmdResponse_Sync::table_name() const {
+inline const ::std::string& CmdResponse_InfoRepl::table_name() const {
   return *table_name_;
 }
-inline void CmdResponse_Sync::set_table_name(const ::std::string& value) {
+inline void CmdResponse_InfoRepl::set_table_name(const ::std::string& value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdResponse_Sync::set_table_name(const char* value) {
+inline void CmdResponse_InfoRepl::set_table_name(const char* value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void CmdResponse_Sync::set_table_name(const char* value, size_t size) {
+inline void CmdResponse_InfoRepl::set_table_name(const char* value, size_t size) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdResponse_Sync::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline ::std::string* CmdResponse_InfoRepl::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
+}
+inline ::std::string* CmdResponse_InfoRepl::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdResponse_InfoRepl::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required int64 partition_cnt = 2;
+inline bool CmdResponse_InfoRepl::has_partition_cnt() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CmdResponse_InfoRepl::set_has_partition_cnt() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CmdResponse_InfoRepl::clear_has_partition_cnt() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CmdResponse_InfoRepl::clear_partition_cnt() {
+  partition_cnt_ = GOOGLE_LONGLONG(0);
+  clear_has_partition_cnt();
+}
+inline ::google::protobuf::int64 CmdResponse_InfoRepl::partition_cnt() const {
+  return partition_cnt_;
+}
+inline void CmdResponse_InfoRepl::set_partition_cnt(::google::protobuf::int64 value) {
+  set_has_partition_cnt();
+  partition_cnt_ = value;
+}
+
+// repeated .client.PartitionState partition_state = 3;
+inline int CmdResponse_InfoRepl::partition_state_size() const {
+  return partition_state_.size();
+}
+inline void CmdResponse_InfoRepl::clear_partition_state() {
+  partition_state_.Clear();
+}
+inline const ::client::PartitionState& CmdResponse_InfoRepl::partition_state(int index) const {
+  return partition_state_.Get(index);
+}
+inline ::client::PartitionState* CmdResponse_InfoRepl::mutable_partition_state(int index) {
+  return partition_state_.Mutable(index);
+}
+inline ::client::PartitionState* CmdResponse_InfoRepl::add_partition_state() {
+  return partition_state_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::PartitionState >&
+CmdResponse_InfoRepl::partition_state() const {
+  return partition_state_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::PartitionState >*
+CmdResponse_InfoRepl::mutable_partition_state() {
+  return &partition_state_;
+}
+
+// -------------------------------------------------------------------
+
+// CmdResponse_Mget
+
+// required string key = 1;
+inline bool CmdResponse_Mget::has_key() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void CmdResponse_Mget::set_has_key() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void CmdResponse_Mget::clear_has_key() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void CmdResponse_Mget::clear_key() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    key_->clear();
+  }
+  clear_has_key();
+}
+inline const ::std::string& CmdResponse_Mget::key() const {
+  return *key_;
+}
+inline void CmdResponse_Mget::set_key(const ::std::string& value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
+}
+inline void CmdResponse_Mget::set_key(const char* value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
+}
+inline void CmdResponse_Mget::set_key(const char* value, size_t size) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdResponse_Mget::mutable_key() {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
   }
-  return table_name_;
+  return key_;
 }
-inline ::std::string* CmdResponse_Sync::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+inline ::std::string* CmdResponse_Mget::release_key() {
+  clear_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
   } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    ::std::string* temp = key_;
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
     return temp;
   }
 }
-inline void CmdResponse_Sync::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+inline void CmdResponse_Mget::set_allocated_key(::std::string* key) {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+  if (key) {
+    set_has_key();
+    key_ = key;
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_key();
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required .client.SyncOffset sync_offset = 2;
-inline bool CmdResponse_Sync::has_sync_offset() const {
+// required bytes value = 2;
+inline bool CmdResponse_Mget::has_value() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void CmdResponse_Sync::set_has_sync_offset() {
+inline void CmdResponse_Mget::set_has_value() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void CmdResponse_Sync::clear_has_sync_offset() {
+inline void CmdResponse_Mget::clear_has_value() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdResponse_Sync::clear_sync_offset() {
-  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-  clear_has_sync_offset();
-}
-inline const ::client::SyncOffset& CmdResponse_Sync::sync_offset() const {
-  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
-}
-inline ::client::SyncOffset* CmdResponse_Sync::mutable_sync_offset() {
-  set_has_sync_offset();
-  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
-  return sync_offset_;
-}
-inline ::client::SyncOffset* CmdResponse_Sync::release_sync_offset() {
-  clear_has_sync_offset();
-  ::client::SyncOffset* temp = sync_offset_;
-  sync_offset_ = NULL;
-  return temp;
-}
-inline void CmdResponse_Sync::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
-  delete sync_offset_;
-  sync_offset_ = sync_offset;
-  if (sync_offset) {
-    set_has_sync_offset();
-  } else {
-    clear_has_sync_offset();
-  }
-}
-
-// -------------------------------------------------------------------
-
-// CmdResponse_Get
-
-// optional bytes value = 1;
-inline bool CmdResponse_Get::has_value() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CmdResponse_Get::set_has_value() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void CmdResponse_Get::clear_has_value() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void CmdResponse_Get::clear_value() {
+inline void CmdResponse_Mget::clear_value() {
   if (value_ != &::google::protobuf::internal::kEmptyString) {
     value_->clear();
   }
   clear_has_value();
 }
-inline const ::std::string& CmdResponse_Get::value() const {
+inline const ::std::string& CmdResponse_Mget::value() const {
   return *value_;
 }
-inline void CmdResponse_Get::set_value(const ::std::string& value) {
+inline void CmdResponse_Mget::set_value(const ::std::string& value) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(value);
 }
-inline void CmdResponse_Get::set_value(const char* value) {
+inline void CmdResponse_Mget::set_value(const char* value) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(value);
 }
-inline void CmdResponse_Get::set_value(const void* value, size_t size) {
+inline void CmdResponse_Mget::set_value(const void* value, size_t size) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdResponse_Get::mutable_value() {
+inline ::std::string* CmdResponse_Mget::mutable_value() {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   return value_;
 }
-inline ::std::string* CmdResponse_Get::release_value() {
+inline ::std::string* CmdResponse_Mget::release_value() {
   clear_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -5262,7 +8539,7 @@ inline ::std::string* CmdResponse_Get::release_value() {
     return temp;
   }
 }
-inline void CmdResponse_Get::set_allocated_value(::std::string* value) {
+inline void CmdResponse_Mget::set_allocated_value(::std::string* value) {
   if (value_ != &::google::protobuf::internal::kEmptyString) {
     delete value_;
   }
@@ -5277,483 +8554,399 @@ inline void CmdResponse_Get::set_allocated_value(::std::string* value) {
 
 // -------------------------------------------------------------------
 
-// CmdResponse_InfoStats
+// CmdResponse_InfoServer
 
-// required string table_name = 1;
-inline bool CmdResponse_InfoStats::has_table_name() const {
+// required int64 epoch = 1;
+inline bool CmdResponse_InfoServer::has_epoch() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdResponse_InfoStats::set_has_table_name() {
+inline void CmdResponse_InfoServer::set_has_epoch() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdResponse_InfoStats::clear_has_table_name() {
+inline void CmdResponse_InfoServer::clear_has_epoch() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdResponse_InfoStats::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
-}
-inline const ::std::string& CmdResponse_InfoStats::table_name() const {
-  return *table_name_;
-}
-inline void CmdResponse_InfoStats::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
-}
-inline void CmdResponse_InfoStats::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
-}
-inline void CmdResponse_InfoStats::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* CmdResponse_InfoStats::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline void CmdResponse_InfoServer::clear_epoch() {
+  epoch_ = GOOGLE_LONGLONG(0);
+  clear_has_epoch();
 }
-inline ::std::string* CmdResponse_InfoStats::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::google::protobuf::int64 CmdResponse_InfoServer::epoch() const {
+  return epoch_;
 }
-inline void CmdResponse_InfoStats::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
-  } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void CmdResponse_InfoServer::set_epoch(::google::protobuf::int64 value) {
+  set_has_epoch();
+  epoch_ = value;
 }
 
-// required int64 total_querys = 2;
-inline bool CmdResponse_InfoStats::has_total_querys() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdResponse_InfoStats::set_has_total_querys() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void CmdResponse_InfoStats::clear_has_total_querys() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void CmdResponse_InfoStats::clear_total_querys() {
-  total_querys_ = GOOGLE_LONGLONG(0);
-  clear_has_total_querys();
+// repeated string table_names = 2;
+inline int CmdResponse_InfoServer::table_names_size() const {
+  return table_names_.size();
 }
-inline ::google::protobuf::int64 CmdResponse_InfoStats::total_querys() const {
-  return total_querys_;
+inline void CmdResponse_InfoServer::clear_table_names() {
+  table_names_.Clear();
 }
-inline void CmdResponse_InfoStats::set_total_querys(::google::protobuf::int64 value) {
-  set_has_total_querys();
-  total_querys_ = value;
+inline const ::std::string& CmdResponse_InfoServer::table_names(int index) const {
+  return table_names_.Get(index);
 }
-
-// required int32 qps = 3;
-inline bool CmdResponse_InfoStats::has_qps() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline ::std::string* CmdResponse_InfoServer::mutable_table_names(int index) {
+  return table_names_.Mutable(index);
 }
-inline void CmdResponse_InfoStats::set_has_qps() {
-  _has_bits_[0] |= 0x00000004u;
+inline void CmdResponse_InfoServer::set_table_names(int index, const ::std::string& value) {
+  table_names_.Mutable(index)->assign(value);
 }
-inline void CmdResponse_InfoStats::clear_has_qps() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdResponse_InfoServer::set_table_names(int index, const char* value) {
+  table_names_.Mutable(index)->assign(value);
 }
-inline void CmdResponse_InfoStats::clear_qps() {
-  qps_ = 0;
-  clear_has_qps();
+inline void CmdResponse_InfoServer::set_table_names(int index, const char* value, size_t size) {
+  table_names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
 }
-inline ::google::protobuf::int32 CmdResponse_InfoStats::qps() const {
-  return qps_;
+inline ::std::string* CmdResponse_InfoServer::add_table_names() {
+  return table_names_.Add();
 }
-inline void CmdResponse_InfoStats::set_qps(::google::protobuf::int32 value) {
-  set_has_qps();
-  qps_ = value;
+inline void CmdResponse_InfoServer::add_table_names(const ::std::string& value) {
+  table_names_.Add()->assign(value);
 }
-
-// -------------------------------------------------------------------
-
-// CmdResponse_InfoCapacity
-
-// required string table_name = 1;
-inline bool CmdResponse_InfoCapacity::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline void CmdResponse_InfoServer::add_table_names(const char* value) {
+  table_names_.Add()->assign(value);
 }
-inline void CmdResponse_InfoCapacity::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdResponse_InfoServer::add_table_names(const char* value, size_t size) {
+  table_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
 }
-inline void CmdResponse_InfoCapacity::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+CmdResponse_InfoServer::table_names() const {
+  return table_names_;
 }
-inline void CmdResponse_InfoCapacity::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
-  }
-  clear_has_table_name();
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+CmdResponse_InfoServer::mutable_table_names() {
+  return &table_names_;
 }
-inline const ::std::string& CmdResponse_InfoCapacity::table_name() const {
-  return *table_name_;
+
+// required .client.Node cur_meta = 3;
+inline bool CmdResponse_InfoServer::has_cur_meta() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdResponse_InfoCapacity::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdResponse_InfoServer::set_has_cur_meta() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline void CmdResponse_InfoCapacity::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void CmdResponse_InfoServer::clear_has_cur_meta() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdResponse_InfoCapacity::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline void CmdResponse_InfoServer::clear_cur_meta() {
+  if (cur_meta_ != NULL) cur_meta_->::client::Node::Clear();
+  clear_has_cur_meta();
 }
-inline ::std::string* CmdResponse_InfoCapacity::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline const ::client::Node& CmdResponse_InfoServer::cur_meta() const {
+  return cur_meta_ != NULL ? *cur_meta_ : *default_instance_->cur_meta_;
 }
-inline ::std::string* CmdResponse_InfoCapacity::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::client::Node* CmdResponse_InfoServer::mutable_cur_meta() {
+  set_has_cur_meta();
+  if (cur_meta_ == NULL) cur_meta_ = new ::client::Node;
+  return cur_meta_;
 }
-inline void CmdResponse_InfoCapacity::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+inline ::client::Node* CmdResponse_InfoServer::release_cur_meta() {
+  clear_has_cur_meta();
+  ::client::Node* temp = cur_meta_;
+  cur_meta_ = NULL;
+  return temp;
+}
+inline void CmdResponse_InfoServer::set_allocated_cur_meta(::client::Node* cur_meta) {
+  delete cur_meta_;
+  cur_meta_ = cur_meta;
+  if (cur_meta) {
+    set_has_cur_meta();
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_cur_meta();
   }
 }
 
-// required int64 used = 2;
-inline bool CmdResponse_InfoCapacity::has_used() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// required bool meta_renewing = 4;
+inline bool CmdResponse_InfoServer::has_meta_renewing() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void CmdResponse_InfoCapacity::set_has_used() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdResponse_InfoServer::set_has_meta_renewing() {
+  _has_bits_[0] |= 0x00000008u;
 }
-inline void CmdResponse_InfoCapacity::clear_has_used() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdResponse_InfoServer::clear_has_meta_renewing() {
+  _has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdResponse_InfoCapacity::clear_used() {
-  used_ = GOOGLE_LONGLONG(0);
-  clear_has_used();
+inline void CmdResponse_InfoServer::clear_meta_renewing() {
+  meta_renewing_ = false;
+  clear_has_meta_renewing();
 }
-inline ::google::protobuf::int64 CmdResponse_InfoCapacity::used() const {
-  return used_;
+inline bool CmdResponse_InfoServer::meta_renewing() const {
+  return meta_renewing_;
 }
-inline void CmdResponse_InfoCapacity::set_used(::google::protobuf::int64 value) {
-  set_has_used();
-  used_ = value;
+inline void CmdResponse_InfoServer::set_meta_renewing(bool value) {
+  set_has_meta_renewing();
+  meta_renewing_ = value;
 }
 
-// required int64 remain = 3;
-inline bool CmdResponse_InfoCapacity::has_remain() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// CmdResponse_Scan
+
+// repeated .client.Kv kvs = 1;
+inline int CmdResponse_Scan::kvs_size() const {
+  return kvs_.size();
 }
-inline void CmdResponse_InfoCapacity::set_has_remain() {
-  _has_bits_[0] |= 0x00000004u;
+inline void CmdResponse_Scan::clear_kvs() {
+  kvs_.Clear();
 }
-inline void CmdResponse_InfoCapacity::clear_has_remain() {
-  _has_bits_[0] &= ~0x00000004u;
+inline const ::client::Kv& CmdResponse_Scan::kvs(int index) const {
+  return kvs_.Get(index);
 }
-inline void CmdResponse_InfoCapacity::clear_remain() {
-  remain_ = GOOGLE_LONGLONG(0);
-  clear_has_remain();
+inline ::client::Kv* CmdResponse_Scan::mutable_kvs(int index) {
+  return kvs_.Mutable(index);
 }
-inline ::google::protobuf::int64 CmdResponse_InfoCapacity::remain() const {
-  return remain_;
+inline ::client::Kv* CmdResponse_Scan::add_kvs() {
+  return kvs_.Add();
 }
-inline void CmdResponse_InfoCapacity::set_remain(::google::protobuf::int64 value) {
-  set_has_remain();
-  remain_ = value;
+inline const ::google::protobuf::RepeatedPtrField< ::client::Kv >&
+CmdResponse_Scan::kvs() const {
+  return kvs_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::Kv >*
+CmdResponse_Scan::mutable_kvs() {
+  return &kvs_;
 }
 
-// -------------------------------------------------------------------
-
-// CmdResponse_InfoRepl
-
-// required string table_name = 1;
-inline bool CmdResponse_InfoRepl::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional string next_key = 2;
+inline bool CmdResponse_Scan::has_next_key() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void CmdResponse_InfoRepl::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdResponse_Scan::set_has_next_key() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline void CmdResponse_InfoRepl::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdResponse_Scan::clear_has_next_key() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdResponse_InfoRepl::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
+inline void CmdResponse_Scan::clear_next_key() {
+  if (next_key_ != &::google::protobuf::internal::kEmptyString) {
+    next_key_->clear();
   }
-  clear_has_table_name();
+  clear_has_next_key();
 }
-inline const ::std::string& CmdResponse_InfoRepl::table_name() const {
-  return *table_name_;
+inline const ::std::string& CmdResponse_Scan::next_key() const {
+  return *next_key_;
 }
-inline void CmdResponse_InfoRepl::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdResponse_Scan::set_next_key(const ::std::string& value) {
+  set_has_next_key();
+  if (next_key_ == &::google::protobuf::internal::kEmptyString) {
+    next_key_ = new ::std::string;
   }
-  table_name_->assign(value);
+  next_key_->assign(value);
 }
-inline void CmdResponse_InfoRepl::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdResponse_Scan::set_next_key(const char* value) {
+  set_has_next_key();
+  if (next_key_ == &::google::protobuf::internal::kEmptyString) {
+    next_key_ = new ::std::string;
   }
-  table_name_->assign(value);
+  next_key_->assign(value);
 }
-inline void CmdResponse_InfoRepl::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline void CmdResponse_Scan::set_next_key(const char* value, size_t size) {
+  set_has_next_key();
+  if (next_key_ == &::google::protobuf::internal::kEmptyString) {
+    next_key_ = new ::std::string;
   }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+  next_key_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdResponse_InfoRepl::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
+inline ::std::string* CmdResponse_Scan::mutable_next_key() {
+  set_has_next_key();
+  if (next_key_ == &::google::protobuf::internal::kEmptyString) {
+    next_key_ = new ::std::string;
   }
-  return table_name_;
+  return next_key_;
 }
-inline ::std::string* CmdResponse_InfoRepl::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+inline ::std::string* CmdResponse_Scan::release_next_key() {
+  clear_has_next_key();
+  if (next_key_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
   } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    ::std::string* temp = next_key_;
+    next_key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
     return temp;
   }
 }
-inline void CmdResponse_InfoRepl::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+inline void CmdResponse_Scan::set_allocated_next_key(::std::string* next_key) {
+  if (next_key_ != &::google::protobuf::internal::kEmptyString) {
+    delete next_key_;
   }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+  if (next_key) {
+    set_has_next_key();
+    next_key_ = next_key;
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_next_key();
+    next_key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required int64 partition_cnt = 2;
-inline bool CmdResponse_InfoRepl::has_partition_cnt() const {
+// -------------------------------------------------------------------
+
+// CmdResponse_InfoLatency
+
+// required int32 cmd_type = 1;
+inline bool CmdResponse_InfoLatency::has_cmd_type() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void CmdResponse_InfoLatency::set_has_cmd_type() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void CmdResponse_InfoLatency::clear_has_cmd_type() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void CmdResponse_InfoLatency::clear_cmd_type() {
+  cmd_type_ = 0;
+  clear_has_cmd_type();
+}
+inline ::google::protobuf::int32 CmdResponse_InfoLatency::cmd_type() const {
+  return cmd_type_;
+}
+inline void CmdResponse_InfoLatency::set_cmd_type(::google::protobuf::int32 value) {
+  set_has_cmd_type();
+  cmd_type_ = value;
+}
+
+// required int64 count = 2;
+inline bool CmdResponse_InfoLatency::has_count() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void CmdResponse_InfoRepl::set_has_partition_cnt() {
+inline void CmdResponse_InfoLatency::set_has_count() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void CmdResponse_InfoRepl::clear_has_partition_cnt() {
+inline void CmdResponse_InfoLatency::clear_has_count() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdResponse_InfoRepl::clear_partition_cnt() {
-  partition_cnt_ = GOOGLE_LONGLONG(0);
-  clear_has_partition_cnt();
+inline void CmdResponse_InfoLatency::clear_count() {
+  count_ = GOOGLE_LONGLONG(0);
+  clear_has_count();
 }
-inline ::google::protobuf::int64 CmdResponse_InfoRepl::partition_cnt() const {
-  return partition_cnt_;
+inline ::google::protobuf::int64 CmdResponse_InfoLatency::count() const {
+  return count_;
 }
-inline void CmdResponse_InfoRepl::set_partition_cnt(::google::protobuf::int64 value) {
-  set_has_partition_cnt();
-  partition_cnt_ = value;
+inline void CmdResponse_InfoLatency::set_count(::google::protobuf::int64 value) {
+  set_has_count();
+  count_ = value;
 }
 
-// repeated .client.PartitionState partition_state = 3;
-inline int CmdResponse_InfoRepl::partition_state_size() const {
-  return partition_state_.size();
-}
-inline void CmdResponse_InfoRepl::clear_partition_state() {
-  partition_state_.Clear();
+// required int64 p50_us = 3;
+inline bool CmdResponse_InfoLatency::has_p50_us() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline const ::client::PartitionState& CmdResponse_InfoRepl::partition_state(int index) const {
-  return partition_state_.Get(index);
+inline void CmdResponse_InfoLatency::set_has_p50_us() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline ::client::PartitionState* CmdResponse_InfoRepl::mutable_partition_state(int index) {
-  return partition_state_.Mutable(index);
+inline void CmdResponse_InfoLatency::clear_has_p50_us() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline ::client::PartitionState* CmdResponse_InfoRepl::add_partition_state() {
-  return partition_state_.Add();
+inline void CmdResponse_InfoLatency::clear_p50_us() {
+  p50_us_ = GOOGLE_LONGLONG(0);
+  clear_has_p50_us();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::PartitionState >&
-CmdResponse_InfoRepl::partition_state() const {
-  return partition_state_;
+inline ::google::protobuf::int64 CmdResponse_InfoLatency::p50_us() const {
+  return p50_us_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::client::PartitionState >*
-CmdResponse_InfoRepl::mutable_partition_state() {
-  return &partition_state_;
+inline void CmdResponse_InfoLatency::set_p50_us(::google::protobuf::int64 value) {
+  set_has_p50_us();
+  p50_us_ = value;
 }
 
-// -------------------------------------------------------------------
-
-// CmdResponse_Mget
-
-// required string key = 1;
-inline bool CmdResponse_Mget::has_key() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CmdResponse_Mget::set_has_key() {
-  _has_bits_[0] |= 0x00000001u;
+// required int64 p99_us = 4;
+inline bool CmdResponse_InfoLatency::has_p99_us() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void CmdResponse_Mget::clear_has_key() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdResponse_InfoLatency::set_has_p99_us() {
+  _has_bits_[0] |= 0x00000008u;
 }
-inline void CmdResponse_Mget::clear_key() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    key_->clear();
-  }
-  clear_has_key();
+inline void CmdResponse_InfoLatency::clear_has_p99_us() {
+  _has_bits_[0] &= ~0x00000008u;
 }
-inline const ::std::string& CmdResponse_Mget::key() const {
-  return *key_;
+inline void CmdResponse_InfoLatency::clear_p99_us() {
+  p99_us_ = GOOGLE_LONGLONG(0);
+  clear_has_p99_us();
 }
-inline void CmdResponse_Mget::set_key(const ::std::string& value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline ::google::protobuf::int64 CmdResponse_InfoLatency::p99_us() const {
+  return p99_us_;
 }
-inline void CmdResponse_Mget::set_key(const char* value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline void CmdResponse_InfoLatency::set_p99_us(::google::protobuf::int64 value) {
+  set_has_p99_us();
+  p99_us_ = value;
 }
-inline void CmdResponse_Mget::set_key(const char* value, size_t size) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(reinterpret_cast<const char*>(value), size);
+
+// required int64 p999_us = 5;
+inline bool CmdResponse_InfoLatency::has_p999_us() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
 }
-inline ::std::string* CmdResponse_Mget::mutable_key() {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  return key_;
+inline void CmdResponse_InfoLatency::set_has_p999_us() {
+  _has_bits_[0] |= 0x00000010u;
 }
-inline ::std::string* CmdResponse_Mget::release_key() {
-  clear_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = key_;
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdResponse_InfoLatency::clear_has_p999_us() {
+  _has_bits_[0] &= ~0x00000010u;
 }
-inline void CmdResponse_Mget::set_allocated_key(::std::string* key) {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (key) {
-    set_has_key();
-    key_ = key;
-  } else {
-    clear_has_key();
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void CmdResponse_InfoLatency::clear_p999_us() {
+  p999_us_ = GOOGLE_LONGLONG(0);
+  clear_has_p999_us();
+}
+inline ::google::protobuf::int64 CmdResponse_InfoLatency::p999_us() const {
+  return p999_us_;
+}
+inline void CmdResponse_InfoLatency::set_p999_us(::google::protobuf::int64 value) {
+  set_has_p999_us();
+  p999_us_ = value;
 }
 
-// required bytes value = 2;
-inline bool CmdResponse_Mget::has_value() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// -------------------------------------------------------------------
+
+// CmdResponse_Cas
+
+// optional bytes value = 1;
+inline bool CmdResponse_Cas::has_value() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdResponse_Mget::set_has_value() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdResponse_Cas::set_has_value() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdResponse_Mget::clear_has_value() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdResponse_Cas::clear_has_value() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdResponse_Mget::clear_value() {
+inline void CmdResponse_Cas::clear_value() {
   if (value_ != &::google::protobuf::internal::kEmptyString) {
     value_->clear();
   }
   clear_has_value();
 }
-inline const ::std::string& CmdResponse_Mget::value() const {
+inline const ::std::string& CmdResponse_Cas::value() const {
   return *value_;
 }
-inline void CmdResponse_Mget::set_value(const ::std::string& value) {
+inline void CmdResponse_Cas::set_value(const ::std::string& value) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(value);
 }
-inline void CmdResponse_Mget::set_value(const char* value) {
+inline void CmdResponse_Cas::set_value(const char* value) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(value);
 }
-inline void CmdResponse_Mget::set_value(const void* value, size_t size) {
+inline void CmdResponse_Cas::set_value(const void* value, size_t size) {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   value_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* CmdResponse_Mget::mutable_value() {
+inline ::std::string* CmdResponse_Cas::mutable_value() {
   set_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     value_ = new ::std::string;
   }
   return value_;
 }
-inline ::std::string* CmdResponse_Mget::release_value() {
+inline ::std::string* CmdResponse_Cas::release_value() {
   clear_has_value();
   if (value_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -5763,7 +8956,7 @@ inline ::std::string* CmdResponse_Mget::release_value() {
     return temp;
   }
 }
-inline void CmdResponse_Mget::set_allocated_value(::std::string* value) {
+inline void CmdResponse_Cas::set_allocated_value(::std::string* value) {
   if (value_ != &::google::protobuf::internal::kEmptyString) {
     delete value_;
   }
@@ -5775,135 +8968,301 @@ inline void CmdResponse_Mget::set_allocated_value(::std::string* value) {
     value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
-
 // -------------------------------------------------------------------
 
-// CmdResponse_InfoServer
+// CmdResponse_Incrby
 
-// required int64 epoch = 1;
-inline bool CmdResponse_InfoServer::has_epoch() const {
+// required int64 value = 1;
+inline bool CmdResponse_Incrby::has_value() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdResponse_InfoServer::set_has_epoch() {
+inline void CmdResponse_Incrby::set_has_value() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void CmdResponse_InfoServer::clear_has_epoch() {
+inline void CmdResponse_Incrby::clear_has_value() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdResponse_InfoServer::clear_epoch() {
-  epoch_ = GOOGLE_LONGLONG(0);
-  clear_has_epoch();
+inline void CmdResponse_Incrby::clear_value() {
+  value_ = GOOGLE_LONGLONG(0);
+  clear_has_value();
 }
-inline ::google::protobuf::int64 CmdResponse_InfoServer::epoch() const {
-  return epoch_;
+inline ::google::protobuf::int64 CmdResponse_Incrby::value() const {
+  return value_;
 }
-inline void CmdResponse_InfoServer::set_epoch(::google::protobuf::int64 value) {
-  set_has_epoch();
-  epoch_ = value;
+inline void CmdResponse_Incrby::set_value(::google::protobuf::int64 value) {
+  set_has_value();
+  value_ = value;
 }
+// -------------------------------------------------------------------
 
-// repeated string table_names = 2;
-inline int CmdResponse_InfoServer::table_names_size() const {
-  return table_names_.size();
+// CmdResponse_InfoSlowlog
+
+// required int64 time = 1;
+inline bool CmdResponse_InfoSlowlog::has_time() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdResponse_InfoServer::clear_table_names() {
-  table_names_.Clear();
+inline void CmdResponse_InfoSlowlog::set_has_time() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline const ::std::string& CmdResponse_InfoServer::table_names(int index) const {
-  return table_names_.Get(index);
+inline void CmdResponse_InfoSlowlog::clear_has_time() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline ::std::string* CmdResponse_InfoServer::mutable_table_names(int index) {
-  return table_names_.Mutable(index);
+inline void CmdResponse_InfoSlowlog::clear_time() {
+  time_ = GOOGLE_LONGLONG(0);
+  clear_has_time();
 }
-inline void CmdResponse_InfoServer::set_table_names(int index, const ::std::string& value) {
-  table_names_.Mutable(index)->assign(value);
+inline ::google::protobuf::int64 CmdResponse_InfoSlowlog::time() const {
+  return time_;
 }
-inline void CmdResponse_InfoServer::set_table_names(int index, const char* value) {
-  table_names_.Mutable(index)->assign(value);
+inline void CmdResponse_InfoSlowlog::set_time(::google::protobuf::int64 value) {
+  set_has_time();
+  time_ = value;
 }
-inline void CmdResponse_InfoServer::set_table_names(int index, const char* value, size_t size) {
-  table_names_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
+
+// required string table_name = 2;
+inline bool CmdResponse_InfoSlowlog::has_table_name() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline ::std::string* CmdResponse_InfoServer::add_table_names() {
-  return table_names_.Add();
+inline void CmdResponse_InfoSlowlog::set_has_table_name() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline void CmdResponse_InfoServer::add_table_names(const ::std::string& value) {
-  table_names_.Add()->assign(value);
+inline void CmdResponse_InfoSlowlog::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdResponse_InfoServer::add_table_names(const char* value) {
-  table_names_.Add()->assign(value);
+inline void CmdResponse_InfoSlowlog::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
 }
-inline void CmdResponse_InfoServer::add_table_names(const char* value, size_t size) {
-  table_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+inline const ::std::string& CmdResponse_InfoSlowlog::table_name() const {
+  return *table_name_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-CmdResponse_InfoServer::table_names() const {
-  return table_names_;
+inline void CmdResponse_InfoSlowlog::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-CmdResponse_InfoServer::mutable_table_names() {
-  return &table_names_;
+inline void CmdResponse_InfoSlowlog::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void CmdResponse_InfoSlowlog::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CmdResponse_InfoSlowlog::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
+}
+inline ::std::string* CmdResponse_InfoSlowlog::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CmdResponse_InfoSlowlog::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
 
-// required .client.Node cur_meta = 3;
-inline bool CmdResponse_InfoServer::has_cur_meta() const {
+// required int32 partition = 3;
+inline bool CmdResponse_InfoSlowlog::has_partition() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdResponse_InfoServer::set_has_cur_meta() {
+inline void CmdResponse_InfoSlowlog::set_has_partition() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void CmdResponse_InfoServer::clear_has_cur_meta() {
+inline void CmdResponse_InfoSlowlog::clear_has_partition() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdResponse_InfoServer::clear_cur_meta() {
-  if (cur_meta_ != NULL) cur_meta_->::client::Node::Clear();
-  clear_has_cur_meta();
+inline void CmdResponse_InfoSlowlog::clear_partition() {
+  partition_ = 0;
+  clear_has_partition();
 }
-inline const ::client::Node& CmdResponse_InfoServer::cur_meta() const {
-  return cur_meta_ != NULL ? *cur_meta_ : *default_instance_->cur_meta_;
+inline ::google::protobuf::int32 CmdResponse_InfoSlowlog::partition() const {
+  return partition_;
 }
-inline ::client::Node* CmdResponse_InfoServer::mutable_cur_meta() {
-  set_has_cur_meta();
-  if (cur_meta_ == NULL) cur_meta_ = new ::client::Node;
-  return cur_meta_;
+inline void CmdResponse_InfoSlowlog::set_partition(::google::protobuf::int32 value) {
+  set_has_partition();
+  partition_ = value;
 }
-inline ::client::Node* CmdResponse_InfoServer::release_cur_meta() {
-  clear_has_cur_meta();
-  ::client::Node* temp = cur_meta_;
-  cur_meta_ = NULL;
-  return temp;
+
+// required int32 cmd_type = 4;
+inline bool CmdResponse_InfoSlowlog::has_cmd_type() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void CmdResponse_InfoServer::set_allocated_cur_meta(::client::Node* cur_meta) {
-  delete cur_meta_;
-  cur_meta_ = cur_meta;
-  if (cur_meta) {
-    set_has_cur_meta();
-  } else {
-    clear_has_cur_meta();
-  }
+inline void CmdResponse_InfoSlowlog::set_has_cmd_type() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void CmdResponse_InfoSlowlog::clear_has_cmd_type() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void CmdResponse_InfoSlowlog::clear_cmd_type() {
+  cmd_type_ = 0;
+  clear_has_cmd_type();
+}
+inline ::google::protobuf::int32 CmdResponse_InfoSlowlog::cmd_type() const {
+  return cmd_type_;
+}
+inline void CmdResponse_InfoSlowlog::set_cmd_type(::google::protobuf::int32 value) {
+  set_has_cmd_type();
+  cmd_type_ = value;
+}
+
+// required int64 total_us = 5;
+inline bool CmdResponse_InfoSlowlog::has_total_us() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void CmdResponse_InfoSlowlog::set_has_total_us() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void CmdResponse_InfoSlowlog::clear_has_total_us() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void CmdResponse_InfoSlowlog::clear_total_us() {
+  total_us_ = GOOGLE_LONGLONG(0);
+  clear_has_total_us();
+}
+inline ::google::protobuf::int64 CmdResponse_InfoSlowlog::total_us() const {
+  return total_us_;
+}
+inline void CmdResponse_InfoSlowlog::set_total_us(::google::protobuf::int64 value) {
+  set_has_total_us();
+  total_us_ = value;
+}
+
+// required int64 suspend_wait_us = 6;
+inline bool CmdResponse_InfoSlowlog::has_suspend_wait_us() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void CmdResponse_InfoSlowlog::set_has_suspend_wait_us() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void CmdResponse_InfoSlowlog::clear_has_suspend_wait_us() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void CmdResponse_InfoSlowlog::clear_suspend_wait_us() {
+  suspend_wait_us_ = GOOGLE_LONGLONG(0);
+  clear_has_suspend_wait_us();
+}
+inline ::google::protobuf::int64 CmdResponse_InfoSlowlog::suspend_wait_us() const {
+  return suspend_wait_us_;
+}
+inline void CmdResponse_InfoSlowlog::set_suspend_wait_us(::google::protobuf::int64 value) {
+  set_has_suspend_wait_us();
+  suspend_wait_us_ = value;
+}
+
+// required int64 lock_wait_us = 7;
+inline bool CmdResponse_InfoSlowlog::has_lock_wait_us() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void CmdResponse_InfoSlowlog::set_has_lock_wait_us() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void CmdResponse_InfoSlowlog::clear_has_lock_wait_us() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void CmdResponse_InfoSlowlog::clear_lock_wait_us() {
+  lock_wait_us_ = GOOGLE_LONGLONG(0);
+  clear_has_lock_wait_us();
+}
+inline ::google::protobuf::int64 CmdResponse_InfoSlowlog::lock_wait_us() const {
+  return lock_wait_us_;
+}
+inline void CmdResponse_InfoSlowlog::set_lock_wait_us(::google::protobuf::int64 value) {
+  set_has_lock_wait_us();
+  lock_wait_us_ = value;
+}
+
+// required int64 db_us = 8;
+inline bool CmdResponse_InfoSlowlog::has_db_us() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void CmdResponse_InfoSlowlog::set_has_db_us() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void CmdResponse_InfoSlowlog::clear_has_db_us() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void CmdResponse_InfoSlowlog::clear_db_us() {
+  db_us_ = GOOGLE_LONGLONG(0);
+  clear_has_db_us();
+}
+inline ::google::protobuf::int64 CmdResponse_InfoSlowlog::db_us() const {
+  return db_us_;
+}
+inline void CmdResponse_InfoSlowlog::set_db_us(::google::protobuf::int64 value) {
+  set_has_db_us();
+  db_us_ = value;
+}
+
+// required int64 binlog_us = 9;
+inline bool CmdResponse_InfoSlowlog::has_binlog_us() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void CmdResponse_InfoSlowlog::set_has_binlog_us() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void CmdResponse_InfoSlowlog::clear_has_binlog_us() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void CmdResponse_InfoSlowlog::clear_binlog_us() {
+  binlog_us_ = GOOGLE_LONGLONG(0);
+  clear_has_binlog_us();
+}
+inline ::google::protobuf::int64 CmdResponse_InfoSlowlog::binlog_us() const {
+  return binlog_us_;
+}
+inline void CmdResponse_InfoSlowlog::set_binlog_us(::google::protobuf::int64 value) {
+  set_has_binlog_us();
+  binlog_us_ = value;
 }
 
-// required bool meta_renewing = 4;
-inline bool CmdResponse_InfoServer::has_meta_renewing() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// required int64 ack_wait_us = 10;
+inline bool CmdResponse_InfoSlowlog::has_ack_wait_us() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
 }
-inline void CmdResponse_InfoServer::set_has_meta_renewing() {
-  _has_bits_[0] |= 0x00000008u;
+inline void CmdResponse_InfoSlowlog::set_has_ack_wait_us() {
+  _has_bits_[0] |= 0x00000200u;
 }
-inline void CmdResponse_InfoServer::clear_has_meta_renewing() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdResponse_InfoSlowlog::clear_has_ack_wait_us() {
+  _has_bits_[0] &= ~0x00000200u;
 }
-inline void CmdResponse_InfoServer::clear_meta_renewing() {
-  meta_renewing_ = false;
-  clear_has_meta_renewing();
+inline void CmdResponse_InfoSlowlog::clear_ack_wait_us() {
+  ack_wait_us_ = GOOGLE_LONGLONG(0);
+  clear_has_ack_wait_us();
 }
-inline bool CmdResponse_InfoServer::meta_renewing() const {
-  return meta_renewing_;
+inline ::google::protobuf::int64 CmdResponse_InfoSlowlog::ack_wait_us() const {
+  return ack_wait_us_;
 }
-inline void CmdResponse_InfoServer::set_meta_renewing(bool value) {
-  set_has_meta_renewing();
-  meta_renewing_ = value;
+inline void CmdResponse_InfoSlowlog::set_ack_wait_us(::google::protobuf::int64 value) {
+  set_has_ack_wait_us();
+  ack_wait_us_ = value;
 }
 
 // -------------------------------------------------------------------
@@ -6109,227 +9468,627 @@ inline bool CmdResponse::has_redirect() const {
 inline void CmdResponse::set_has_redirect() {
   _has_bits_[0] |= 0x00000020u;
 }
-inline void CmdResponse::clear_has_redirect() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void CmdResponse::clear_has_redirect() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void CmdResponse::clear_redirect() {
+  if (redirect_ != NULL) redirect_->::client::Node::Clear();
+  clear_has_redirect();
+}
+inline const ::client::Node& CmdResponse::redirect() const {
+  return redirect_ != NULL ? *redirect_ : *default_instance_->redirect_;
+}
+inline ::client::Node* CmdResponse::mutable_redirect() {
+  set_has_redirect();
+  if (redirect_ == NULL) redirect_ = new ::client::Node;
+  return redirect_;
+}
+inline ::client::Node* CmdResponse::release_redirect() {
+  clear_has_redirect();
+  ::client::Node* temp = redirect_;
+  redirect_ = NULL;
+  return temp;
+}
+inline void CmdResponse::set_allocated_redirect(::client::Node* redirect) {
+  delete redirect_;
+  redirect_ = redirect;
+  if (redirect) {
+    set_has_redirect();
+  } else {
+    clear_has_redirect();
+  }
+}
+
+// repeated .client.CmdResponse.InfoStats info_stats = 7;
+inline int CmdResponse::info_stats_size() const {
+  return info_stats_.size();
+}
+inline void CmdResponse::clear_info_stats() {
+  info_stats_.Clear();
+}
+inline const ::client::CmdResponse_InfoStats& CmdResponse::info_stats(int index) const {
+  return info_stats_.Get(index);
+}
+inline ::client::CmdResponse_InfoStats* CmdResponse::mutable_info_stats(int index) {
+  return info_stats_.Mutable(index);
+}
+inline ::client::CmdResponse_InfoStats* CmdResponse::add_info_stats() {
+  return info_stats_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >&
+CmdResponse::info_stats() const {
+  return info_stats_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >*
+CmdResponse::mutable_info_stats() {
+  return &info_stats_;
+}
+
+// repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+inline int CmdResponse::info_capacity_size() const {
+  return info_capacity_.size();
+}
+inline void CmdResponse::clear_info_capacity() {
+  info_capacity_.Clear();
+}
+inline const ::client::CmdResponse_InfoCapacity& CmdResponse::info_capacity(int index) const {
+  return info_capacity_.Get(index);
+}
+inline ::client::CmdResponse_InfoCapacity* CmdResponse::mutable_info_capacity(int index) {
+  return info_capacity_.Mutable(index);
+}
+inline ::client::CmdResponse_InfoCapacity* CmdResponse::add_info_capacity() {
+  return info_capacity_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >&
+CmdResponse::info_capacity() const {
+  return info_capacity_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >*
+CmdResponse::mutable_info_capacity() {
+  return &info_capacity_;
+}
+
+// repeated .client.CmdResponse.InfoRepl info_repl = 9;
+inline int CmdResponse::info_repl_size() const {
+  return info_repl_.size();
+}
+inline void CmdResponse::clear_info_repl() {
+  info_repl_.Clear();
+}
+inline const ::client::CmdResponse_InfoRepl& CmdResponse::info_repl(int index) const {
+  return info_repl_.Get(index);
+}
+inline ::client::CmdResponse_InfoRepl* CmdResponse::mutable_info_repl(int index) {
+  return info_repl_.Mutable(index);
+}
+inline ::client::CmdResponse_InfoRepl* CmdResponse::add_info_repl() {
+  return info_repl_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >&
+CmdResponse::info_repl() const {
+  return info_repl_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >*
+CmdResponse::mutable_info_repl() {
+  return &info_repl_;
+}
+
+// repeated .client.CmdResponse.Mget mget = 10;
+inline int CmdResponse::mget_size() const {
+  return mget_.size();
+}
+inline void CmdResponse::clear_mget() {
+  mget_.Clear();
+}
+inline const ::client::CmdResponse_Mget& CmdResponse::mget(int index) const {
+  return mget_.Get(index);
+}
+inline ::client::CmdResponse_Mget* CmdResponse::mutable_mget(int index) {
+  return mget_.Mutable(index);
+}
+inline ::client::CmdResponse_Mget* CmdResponse::add_mget() {
+  return mget_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >&
+CmdResponse::mget() const {
+  return mget_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >*
+CmdResponse::mutable_mget() {
+  return &mget_;
+}
+
+// optional .client.CmdResponse.InfoServer info_server = 11;
+inline bool CmdResponse::has_info_server() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void CmdResponse::set_has_info_server() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void CmdResponse::clear_has_info_server() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void CmdResponse::clear_info_server() {
+  if (info_server_ != NULL) info_server_->::client::CmdResponse_InfoServer::Clear();
+  clear_has_info_server();
+}
+inline const ::client::CmdResponse_InfoServer& CmdResponse::info_server() const {
+  return info_server_ != NULL ? *info_server_ : *default_instance_->info_server_;
+}
+inline ::client::CmdResponse_InfoServer* CmdResponse::mutable_info_server() {
+  set_has_info_server();
+  if (info_server_ == NULL) info_server_ = new ::client::CmdResponse_InfoServer;
+  return info_server_;
+}
+inline ::client::CmdResponse_InfoServer* CmdResponse::release_info_server() {
+  clear_has_info_server();
+  ::client::CmdResponse_InfoServer* temp = info_server_;
+  info_server_ = NULL;
+  return temp;
+}
+inline void CmdResponse::set_allocated_info_server(::client::CmdResponse_InfoServer* info_server) {
+  delete info_server_;
+  info_server_ = info_server;
+  if (info_server) {
+    set_has_info_server();
+  } else {
+    clear_has_info_server();
+  }
+}
+
+// optional .client.CmdResponse.Scan scan = 12;
+inline bool CmdResponse::has_scan() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void CmdResponse::set_has_scan() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void CmdResponse::clear_has_scan() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void CmdResponse::clear_scan() {
+  if (scan_ != NULL) scan_->::client::CmdResponse_Scan::Clear();
+  clear_has_scan();
+}
+inline const ::client::CmdResponse_Scan& CmdResponse::scan() const {
+  return scan_ != NULL ? *scan_ : *default_instance_->scan_;
+}
+inline ::client::CmdResponse_Scan* CmdResponse::mutable_scan() {
+  set_has_scan();
+  if (scan_ == NULL) scan_ = new ::client::CmdResponse_Scan;
+  return scan_;
+}
+inline ::client::CmdResponse_Scan* CmdResponse::release_scan() {
+  clear_has_scan();
+  ::client::CmdResponse_Scan* temp = scan_;
+  scan_ = NULL;
+  return temp;
+}
+inline void CmdResponse::set_allocated_scan(::client::CmdResponse_Scan* scan) {
+  delete scan_;
+  scan_ = scan;
+  if (scan) {
+    set_has_scan();
+  } else {
+    clear_has_scan();
+  }
+}
+
+// repeated .client.CmdResponse.InfoLatency info_latency = 13;
+inline int CmdResponse::info_latency_size() const {
+  return info_latency_.size();
+}
+inline void CmdResponse::clear_info_latency() {
+  info_latency_.Clear();
+}
+inline const ::client::CmdResponse_InfoLatency& CmdResponse::info_latency(int index) const {
+  return info_latency_.Get(index);
+}
+inline ::client::CmdResponse_InfoLatency* CmdResponse::mutable_info_latency(int index) {
+  return info_latency_.Mutable(index);
+}
+inline ::client::CmdResponse_InfoLatency* CmdResponse::add_info_latency() {
+  return info_latency_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoLatency >&
+CmdResponse::info_latency() const {
+  return info_latency_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoLatency >*
+CmdResponse::mutable_info_latency() {
+  return &info_latency_;
+}
+
+// optional .client.CmdResponse.Cas cas = 14;
+inline bool CmdResponse::has_cas() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+inline void CmdResponse::set_has_cas() {
+  _has_bits_[0] |= 0x00002000u;
+}
+inline void CmdResponse::clear_has_cas() {
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline void CmdResponse::clear_cas() {
+  if (cas_ != NULL) cas_->::client::CmdResponse_Cas::Clear();
+  clear_has_cas();
+}
+inline const ::client::CmdResponse_Cas& CmdResponse::cas() const {
+  return cas_ != NULL ? *cas_ : *default_instance_->cas_;
+}
+inline ::client::CmdResponse_Cas* CmdResponse::mutable_cas() {
+  set_has_cas();
+  if (cas_ == NULL) cas_ = new ::client::CmdResponse_Cas;
+  return cas_;
+}
+inline ::client::CmdResponse_Cas* CmdResponse::release_cas() {
+  clear_has_cas();
+  ::client::CmdResponse_Cas* temp = cas_;
+  cas_ = NULL;
+  return temp;
+}
+inline void CmdResponse::set_allocated_cas(::client::CmdResponse_Cas* cas) {
+  delete cas_;
+  cas_ = cas;
+  if (cas) {
+    set_has_cas();
+  } else {
+    clear_has_cas();
+  }
+}
+
+// optional .client.CmdResponse.Incrby incrby = 15;
+inline bool CmdResponse::has_incrby() const {
+  return (_has_bits_[0] & 0x00004000u) != 0;
+}
+inline void CmdResponse::set_has_incrby() {
+  _has_bits_[0] |= 0x00004000u;
+}
+inline void CmdResponse::clear_has_incrby() {
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline void CmdResponse::clear_incrby() {
+  if (incrby_ != NULL) incrby_->::client::CmdResponse_Incrby::Clear();
+  clear_has_incrby();
+}
+inline const ::client::CmdResponse_Incrby& CmdResponse::incrby() const {
+  return incrby_ != NULL ? *incrby_ : *default_instance_->incrby_;
+}
+inline ::client::CmdResponse_Incrby* CmdResponse::mutable_incrby() {
+  set_has_incrby();
+  if (incrby_ == NULL) incrby_ = new ::client::CmdResponse_Incrby;
+  return incrby_;
+}
+inline ::client::CmdResponse_Incrby* CmdResponse::release_incrby() {
+  clear_has_incrby();
+  ::client::CmdResponse_Incrby* temp = incrby_;
+  incrby_ = NULL;
+  return temp;
+}
+inline void CmdResponse::set_allocated_incrby(::client::CmdResponse_Incrby* incrby) {
+  delete incrby_;
+  incrby_ = incrby;
+  if (incrby) {
+    set_has_incrby();
+  } else {
+    clear_has_incrby();
+  }
+}
+
+// repeated .client.CmdResponse.InfoSlowlog info_slowlog = 16;
+inline int CmdResponse::info_slowlog_size() const {
+  return info_slowlog_.size();
+}
+inline void CmdResponse::clear_info_slowlog() {
+  info_slowlog_.Clear();
+}
+inline const ::client::CmdResponse_InfoSlowlog& CmdResponse::info_slowlog(int index) const {
+  return info_slowlog_.Get(index);
+}
+inline ::client::CmdResponse_InfoSlowlog* CmdResponse::mutable_info_slowlog(int index) {
+  return info_slowlog_.Mutable(index);
+}
+inline ::client::CmdResponse_InfoSlowlog* CmdResponse::add_info_slowlog() {
+  return info_slowlog_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoSlowlog >&
+CmdResponse::info_slowlog() const {
+  return info_slowlog_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoSlowlog >*
+CmdResponse::mutable_info_slowlog() {
+  return &info_slowlog_;
+}
+
+// -------------------------------------------------------------------
+
+// BinlogSkip
+
+// required string table_name = 1;
+inline bool BinlogSkip::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void BinlogSkip::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void BinlogSkip::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void BinlogSkip::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
+}
+inline const ::std::string& BinlogSkip::table_name() const {
+  return *table_name_;
 }
-inline void CmdResponse::clear_redirect() {
-  if (redirect_ != NULL) redirect_->::client::Node::Clear();
-  clear_has_redirect();
+inline void BinlogSkip::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline const ::client::Node& CmdResponse::redirect() const {
-  return redirect_ != NULL ? *redirect_ : *default_instance_->redirect_;
+inline void BinlogSkip::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline ::client::Node* CmdResponse::mutable_redirect() {
-  set_has_redirect();
-  if (redirect_ == NULL) redirect_ = new ::client::Node;
-  return redirect_;
+inline void BinlogSkip::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::client::Node* CmdResponse::release_redirect() {
-  clear_has_redirect();
-  ::client::Node* temp = redirect_;
-  redirect_ = NULL;
-  return temp;
+inline ::std::string* BinlogSkip::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
 }
-inline void CmdResponse::set_allocated_redirect(::client::Node* redirect) {
-  delete redirect_;
-  redirect_ = redirect;
-  if (redirect) {
-    set_has_redirect();
+inline ::std::string* BinlogSkip::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
   } else {
-    clear_has_redirect();
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
   }
 }
-
-// repeated .client.CmdResponse.InfoStats info_stats = 7;
-inline int CmdResponse::info_stats_size() const {
-  return info_stats_.size();
+inline void BinlogSkip::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
-inline void CmdResponse::clear_info_stats() {
-  info_stats_.Clear();
+
+// required int32 partition_id = 2;
+inline bool BinlogSkip::has_partition_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline const ::client::CmdResponse_InfoStats& CmdResponse::info_stats(int index) const {
-  return info_stats_.Get(index);
+inline void BinlogSkip::set_has_partition_id() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline ::client::CmdResponse_InfoStats* CmdResponse::mutable_info_stats(int index) {
-  return info_stats_.Mutable(index);
+inline void BinlogSkip::clear_has_partition_id() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline ::client::CmdResponse_InfoStats* CmdResponse::add_info_stats() {
-  return info_stats_.Add();
+inline void BinlogSkip::clear_partition_id() {
+  partition_id_ = 0;
+  clear_has_partition_id();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >&
-CmdResponse::info_stats() const {
-  return info_stats_;
+inline ::google::protobuf::int32 BinlogSkip::partition_id() const {
+  return partition_id_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoStats >*
-CmdResponse::mutable_info_stats() {
-  return &info_stats_;
+inline void BinlogSkip::set_partition_id(::google::protobuf::int32 value) {
+  set_has_partition_id();
+  partition_id_ = value;
 }
 
-// repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-inline int CmdResponse::info_capacity_size() const {
-  return info_capacity_.size();
-}
-inline void CmdResponse::clear_info_capacity() {
-  info_capacity_.Clear();
+// required int64 gap = 3;
+inline bool BinlogSkip::has_gap() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline const ::client::CmdResponse_InfoCapacity& CmdResponse::info_capacity(int index) const {
-  return info_capacity_.Get(index);
+inline void BinlogSkip::set_has_gap() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline ::client::CmdResponse_InfoCapacity* CmdResponse::mutable_info_capacity(int index) {
-  return info_capacity_.Mutable(index);
+inline void BinlogSkip::clear_has_gap() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline ::client::CmdResponse_InfoCapacity* CmdResponse::add_info_capacity() {
-  return info_capacity_.Add();
+inline void BinlogSkip::clear_gap() {
+  gap_ = GOOGLE_LONGLONG(0);
+  clear_has_gap();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >&
-CmdResponse::info_capacity() const {
-  return info_capacity_;
+inline ::google::protobuf::int64 BinlogSkip::gap() const {
+  return gap_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoCapacity >*
-CmdResponse::mutable_info_capacity() {
-  return &info_capacity_;
+inline void BinlogSkip::set_gap(::google::protobuf::int64 value) {
+  set_has_gap();
+  gap_ = value;
 }
 
-// repeated .client.CmdResponse.InfoRepl info_repl = 9;
-inline int CmdResponse::info_repl_size() const {
-  return info_repl_.size();
+// -------------------------------------------------------------------
+
+// SyncLease
+
+// required string table_name = 1;
+inline bool SyncLease::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void CmdResponse::clear_info_repl() {
-  info_repl_.Clear();
+inline void SyncLease::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline const ::client::CmdResponse_InfoRepl& CmdResponse::info_repl(int index) const {
-  return info_repl_.Get(index);
+inline void SyncLease::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline ::client::CmdResponse_InfoRepl* CmdResponse::mutable_info_repl(int index) {
-  return info_repl_.Mutable(index);
+inline void SyncLease::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
 }
-inline ::client::CmdResponse_InfoRepl* CmdResponse::add_info_repl() {
-  return info_repl_.Add();
+inline const ::std::string& SyncLease::table_name() const {
+  return *table_name_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >&
-CmdResponse::info_repl() const {
-  return info_repl_;
+inline void SyncLease::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_InfoRepl >*
-CmdResponse::mutable_info_repl() {
-  return &info_repl_;
+inline void SyncLease::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
 }
-
-// repeated .client.CmdResponse.Mget mget = 10;
-inline int CmdResponse::mget_size() const {
-  return mget_.size();
+inline void SyncLease::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline void CmdResponse::clear_mget() {
-  mget_.Clear();
+inline ::std::string* SyncLease::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
 }
-inline const ::client::CmdResponse_Mget& CmdResponse::mget(int index) const {
-  return mget_.Get(index);
+inline ::std::string* SyncLease::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
 }
-inline ::client::CmdResponse_Mget* CmdResponse::mutable_mget(int index) {
-  return mget_.Mutable(index);
+inline void SyncLease::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
-inline ::client::CmdResponse_Mget* CmdResponse::add_mget() {
-  return mget_.Add();
+
+// required int32 partition_id = 2;
+inline bool SyncLease::has_partition_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >&
-CmdResponse::mget() const {
-  return mget_;
+inline void SyncLease::set_has_partition_id() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline ::google::protobuf::RepeatedPtrField< ::client::CmdResponse_Mget >*
-CmdResponse::mutable_mget() {
-  return &mget_;
+inline void SyncLease::clear_has_partition_id() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-
-// optional .client.CmdResponse.InfoServer info_server = 11;
-inline bool CmdResponse::has_info_server() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+inline void SyncLease::clear_partition_id() {
+  partition_id_ = 0;
+  clear_has_partition_id();
 }
-inline void CmdResponse::set_has_info_server() {
-  _has_bits_[0] |= 0x00000400u;
+inline ::google::protobuf::int32 SyncLease::partition_id() const {
+  return partition_id_;
 }
-inline void CmdResponse::clear_has_info_server() {
-  _has_bits_[0] &= ~0x00000400u;
+inline void SyncLease::set_partition_id(::google::protobuf::int32 value) {
+  set_has_partition_id();
+  partition_id_ = value;
+}
+
+// required int64 lease = 3;
+inline bool SyncLease::has_lease() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void CmdResponse::clear_info_server() {
-  if (info_server_ != NULL) info_server_->::client::CmdResponse_InfoServer::Clear();
-  clear_has_info_server();
+inline void SyncLease::set_has_lease() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline const ::client::CmdResponse_InfoServer& CmdResponse::info_server() const {
-  return info_server_ != NULL ? *info_server_ : *default_instance_->info_server_;
+inline void SyncLease::clear_has_lease() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline ::client::CmdResponse_InfoServer* CmdResponse::mutable_info_server() {
-  set_has_info_server();
-  if (info_server_ == NULL) info_server_ = new ::client::CmdResponse_InfoServer;
-  return info_server_;
+inline void SyncLease::clear_lease() {
+  lease_ = GOOGLE_LONGLONG(0);
+  clear_has_lease();
 }
-inline ::client::CmdResponse_InfoServer* CmdResponse::release_info_server() {
-  clear_has_info_server();
-  ::client::CmdResponse_InfoServer* temp = info_server_;
-  info_server_ = NULL;
-  return temp;
+inline ::google::protobuf::int64 SyncLease::lease() const {
+  return lease_;
 }
-inline void CmdResponse::set_allocated_info_server(::client::CmdResponse_InfoServer* info_server) {
-  delete info_server_;
-  info_server_ = info_server;
-  if (info_server) {
-    set_has_info_server();
-  } else {
-    clear_has_info_server();
-  }
+inline void SyncLease::set_lease(::google::protobuf::int64 value) {
+  set_has_lease();
+  lease_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// BinlogSkip
+// SyncAck
 
 // required string table_name = 1;
-inline bool BinlogSkip::has_table_name() const {
+inline bool SyncAck::has_table_name() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void BinlogSkip::set_has_table_name() {
+inline void SyncAck::set_has_table_name() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void BinlogSkip::clear_has_table_name() {
+inline void SyncAck::clear_has_table_name() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void BinlogSkip::clear_table_name() {
+inline void SyncAck::clear_table_name() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     table_name_->clear();
   }
   clear_has_table_name();
 }
-inline const ::std::string& BinlogSkip::table_name() const {
+inline const ::std::string& SyncAck::table_name() const {
   return *table_name_;
 }
-inline void BinlogSkip::set_table_name(const ::std::string& value) {
+inline void SyncAck::set_table_name(const ::std::string& value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void BinlogSkip::set_table_name(const char* value) {
+inline void SyncAck::set_table_name(const char* value) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(value);
 }
-inline void BinlogSkip::set_table_name(const char* value, size_t size) {
+inline void SyncAck::set_table_name(const char* value, size_t size) {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   table_name_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* BinlogSkip::mutable_table_name() {
+inline ::std::string* SyncAck::mutable_table_name() {
   set_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     table_name_ = new ::std::string;
   }
   return table_name_;
 }
-inline ::std::string* BinlogSkip::release_table_name() {
+inline ::std::string* SyncAck::release_table_name() {
   clear_has_table_name();
   if (table_name_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
@@ -6339,7 +10098,7 @@ inline ::std::string* BinlogSkip::release_table_name() {
     return temp;
   }
 }
-inline void BinlogSkip::set_allocated_table_name(::std::string* table_name) {
+inline void SyncAck::set_allocated_table_name(::std::string* table_name) {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     delete table_name_;
   }
@@ -6347,289 +10106,563 @@ inline void BinlogSkip::set_allocated_table_name(::std::string* table_name) {
     set_has_table_name();
     table_name_ = table_name;
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required int32 partition_id = 2;
+inline bool SyncAck::has_partition_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void SyncAck::set_has_partition_id() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void SyncAck::clear_has_partition_id() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void SyncAck::clear_partition_id() {
+  partition_id_ = 0;
+  clear_has_partition_id();
+}
+inline ::google::protobuf::int32 SyncAck::partition_id() const {
+  return partition_id_;
+}
+inline void SyncAck::set_partition_id(::google::protobuf::int32 value) {
+  set_has_partition_id();
+  partition_id_ = value;
+}
+
+// required .client.SyncOffset sync_offset = 3;
+inline bool SyncAck::has_sync_offset() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void SyncAck::set_has_sync_offset() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void SyncAck::clear_has_sync_offset() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void SyncAck::clear_sync_offset() {
+  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+  clear_has_sync_offset();
+}
+inline const ::client::SyncOffset& SyncAck::sync_offset() const {
+  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+}
+inline ::client::SyncOffset* SyncAck::mutable_sync_offset() {
+  set_has_sync_offset();
+  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
+  return sync_offset_;
+}
+inline ::client::SyncOffset* SyncAck::release_sync_offset() {
+  clear_has_sync_offset();
+  ::client::SyncOffset* temp = sync_offset_;
+  sync_offset_ = NULL;
+  return temp;
+}
+inline void SyncAck::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+  delete sync_offset_;
+  sync_offset_ = sync_offset;
+  if (sync_offset) {
+    set_has_sync_offset();
+  } else {
+    clear_has_sync_offset();
+  }
+}
+
+// -------------------------------------------------------------------
+
+// SyncRequest
+
+// required .client.SyncType sync_type = 1;
+inline bool SyncRequest::has_sync_type() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void SyncRequest::set_has_sync_type() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void SyncRequest::clear_has_sync_type() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void SyncRequest::clear_sync_type() {
+  sync_type_ = 0;
+  clear_has_sync_type();
+}
+inline ::client::SyncType SyncRequest::sync_type() const {
+  return static_cast< ::client::SyncType >(sync_type_);
+}
+inline void SyncRequest::set_sync_type(::client::SyncType value) {
+  assert(::client::SyncType_IsValid(value));
+  set_has_sync_type();
+  sync_type_ = value;
+}
+
+// required int64 epoch = 2;
+inline bool SyncRequest::has_epoch() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void SyncRequest::set_has_epoch() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void SyncRequest::clear_has_epoch() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void SyncRequest::clear_epoch() {
+  epoch_ = GOOGLE_LONGLONG(0);
+  clear_has_epoch();
+}
+inline ::google::protobuf::int64 SyncRequest::epoch() const {
+  return epoch_;
+}
+inline void SyncRequest::set_epoch(::google::protobuf::int64 value) {
+  set_has_epoch();
+  epoch_ = value;
+}
+
+// required .client.Node from = 3;
+inline bool SyncRequest::has_from() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void SyncRequest::set_has_from() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void SyncRequest::clear_has_from() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void SyncRequest::clear_from() {
+  if (from_ != NULL) from_->::client::Node::Clear();
+  clear_has_from();
+}
+inline const ::client::Node& SyncRequest::from() const {
+  return from_ != NULL ? *from_ : *default_instance_->from_;
+}
+inline ::client::Node* SyncRequest::mutable_from() {
+  set_has_from();
+  if (from_ == NULL) from_ = new ::client::Node;
+  return from_;
+}
+inline ::client::Node* SyncRequest::release_from() {
+  clear_has_from();
+  ::client::Node* temp = from_;
+  from_ = NULL;
+  return temp;
+}
+inline void SyncRequest::set_allocated_from(::client::Node* from) {
+  delete from_;
+  from_ = from;
+  if (from) {
+    set_has_from();
+  } else {
+    clear_has_from();
+  }
+}
+
+// optional .client.SyncOffset sync_offset = 4;
+inline bool SyncRequest::has_sync_offset() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void SyncRequest::set_has_sync_offset() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void SyncRequest::clear_has_sync_offset() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void SyncRequest::clear_sync_offset() {
+  if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+  clear_has_sync_offset();
+}
+inline const ::client::SyncOffset& SyncRequest::sync_offset() const {
+  return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
+}
+inline ::client::SyncOffset* SyncRequest::mutable_sync_offset() {
+  set_has_sync_offset();
+  if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
+  return sync_offset_;
+}
+inline ::client::SyncOffset* SyncRequest::release_sync_offset() {
+  clear_has_sync_offset();
+  ::client::SyncOffset* temp = sync_offset_;
+  sync_offset_ = NULL;
+  return temp;
+}
+inline void SyncRequest::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+  delete sync_offset_;
+  sync_offset_ = sync_offset;
+  if (sync_offset) {
+    set_has_sync_offset();
+  } else {
+    clear_has_sync_offset();
+  }
+}
+
+// optional .client.CmdRequest request = 5;
+inline bool SyncRequest::has_request() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void SyncRequest::set_has_request() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void SyncRequest::clear_has_request() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void SyncRequest::clear_request() {
+  if (request_ != NULL) request_->::client::CmdRequest::Clear();
+  clear_has_request();
+}
+inline const ::client::CmdRequest& SyncRequest::request() const {
+  return request_ != NULL ? *request_ : *default_instance_->request_;
+}
+inline ::client::CmdRequest* SyncRequest::mutable_request() {
+  set_has_request();
+  if (request_ == NULL) request_ = new ::client::CmdRequest;
+  return request_;
+}
+inline ::client::CmdRequest* SyncRequest::release_request() {
+  clear_has_request();
+  ::client::CmdRequest* temp = request_;
+  request_ = NULL;
+  return temp;
+}
+inline void SyncRequest::set_allocated_request(::client::CmdRequest* request) {
+  delete request_;
+  request_ = request;
+  if (request) {
+    set_has_request();
+  } else {
+    clear_has_request();
   }
 }
 
-// required int32 partition_id = 2;
-inline bool BinlogSkip::has_partition_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional .client.BinlogSkip binlog_skip = 6;
+inline bool SyncRequest::has_binlog_skip() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
 }
-inline void BinlogSkip::set_has_partition_id() {
-  _has_bits_[0] |= 0x00000002u;
+inline void SyncRequest::set_has_binlog_skip() {
+  _has_bits_[0] |= 0x00000020u;
 }
-inline void BinlogSkip::clear_has_partition_id() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void SyncRequest::clear_has_binlog_skip() {
+  _has_bits_[0] &= ~0x00000020u;
 }
-inline void BinlogSkip::clear_partition_id() {
-  partition_id_ = 0;
-  clear_has_partition_id();
+inline void SyncRequest::clear_binlog_skip() {
+  if (binlog_skip_ != NULL) binlog_skip_->::client::BinlogSkip::Clear();
+  clear_has_binlog_skip();
 }
-inline ::google::protobuf::int32 BinlogSkip::partition_id() const {
-  return partition_id_;
+inline const ::client::BinlogSkip& SyncRequest::binlog_skip() const {
+  return binlog_skip_ != NULL ? *binlog_skip_ : *default_instance_->binlog_skip_;
 }
-inline void BinlogSkip::set_partition_id(::google::protobuf::int32 value) {
-  set_has_partition_id();
-  partition_id_ = value;
+inline ::client::BinlogSkip* SyncRequest::mutable_binlog_skip() {
+  set_has_binlog_skip();
+  if (binlog_skip_ == NULL) binlog_skip_ = new ::client::BinlogSkip;
+  return binlog_skip_;
 }
-
-// required int64 gap = 3;
-inline bool BinlogSkip::has_gap() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline ::client::BinlogSkip* SyncRequest::release_binlog_skip() {
+  clear_has_binlog_skip();
+  ::client::BinlogSkip* temp = binlog_skip_;
+  binlog_skip_ = NULL;
+  return temp;
 }
-inline void BinlogSkip::set_has_gap() {
-  _has_bits_[0] |= 0x00000004u;
+inline void SyncRequest::set_allocated_binlog_skip(::client::BinlogSkip* binlog_skip) {
+  delete binlog_skip_;
+  binlog_skip_ = binlog_skip;
+  if (binlog_skip) {
+    set_has_binlog_skip();
+  } else {
+    clear_has_binlog_skip();
+  }
 }
-inline void BinlogSkip::clear_has_gap() {
-  _has_bits_[0] &= ~0x00000004u;
+
+// optional .client.SyncLease sync_lease = 7;
+inline bool SyncRequest::has_sync_lease() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
 }
-inline void BinlogSkip::clear_gap() {
-  gap_ = GOOGLE_LONGLONG(0);
-  clear_has_gap();
+inline void SyncRequest::set_has_sync_lease() {
+  _has_bits_[0] |= 0x00000040u;
 }
-inline ::google::protobuf::int64 BinlogSkip::gap() const {
-  return gap_;
+inline void SyncRequest::clear_has_sync_lease() {
+  _has_bits_[0] &= ~0x00000040u;
 }
-inline void BinlogSkip::set_gap(::google::protobuf::int64 value) {
-  set_has_gap();
-  gap_ = value;
+inline void SyncRequest::clear_sync_lease() {
+  if (sync_lease_ != NULL) sync_lease_->::client::SyncLease::Clear();
+  clear_has_sync_lease();
 }
-
-// -------------------------------------------------------------------
-
-// SyncLease
-
-// required string table_name = 1;
-inline bool SyncLease::has_table_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline const ::client::SyncLease& SyncRequest::sync_lease() const {
+  return sync_lease_ != NULL ? *sync_lease_ : *default_instance_->sync_lease_;
 }
-inline void SyncLease::set_has_table_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline ::client::SyncLease* SyncRequest::mutable_sync_lease() {
+  set_has_sync_lease();
+  if (sync_lease_ == NULL) sync_lease_ = new ::client::SyncLease;
+  return sync_lease_;
 }
-inline void SyncLease::clear_has_table_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline ::client::SyncLease* SyncRequest::release_sync_lease() {
+  clear_has_sync_lease();
+  ::client::SyncLease* temp = sync_lease_;
+  sync_lease_ = NULL;
+  return temp;
 }
-inline void SyncLease::clear_table_name() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    table_name_->clear();
+inline void SyncRequest::set_allocated_sync_lease(::client::SyncLease* sync_lease) {
+  delete sync_lease_;
+  sync_lease_ = sync_lease;
+  if (sync_lease) {
+    set_has_sync_lease();
+  } else {
+    clear_has_sync_lease();
   }
-  clear_has_table_name();
 }
-inline const ::std::string& SyncLease::table_name() const {
-  return *table_name_;
+
+// optional .client.BinlogBatch binlog_batch = 8;
+inline bool SyncRequest::has_binlog_batch() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
 }
-inline void SyncLease::set_table_name(const ::std::string& value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void SyncRequest::set_has_binlog_batch() {
+  _has_bits_[0] |= 0x00000080u;
 }
-inline void SyncLease::set_table_name(const char* value) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(value);
+inline void SyncRequest::clear_has_binlog_batch() {
+  _has_bits_[0] &= ~0x00000080u;
 }
-inline void SyncLease::set_table_name(const char* value, size_t size) {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  table_name_->assign(reinterpret_cast<const char*>(value), size);
+inline void SyncRequest::clear_binlog_batch() {
+  if (binlog_batch_ != NULL) binlog_batch_->::client::BinlogBatch::Clear();
+  clear_has_binlog_batch();
 }
-inline ::std::string* SyncLease::mutable_table_name() {
-  set_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    table_name_ = new ::std::string;
-  }
-  return table_name_;
+inline const ::client::BinlogBatch& SyncRequest::binlog_batch() const {
+  return binlog_batch_ != NULL ? *binlog_batch_ : *default_instance_->binlog_batch_;
 }
-inline ::std::string* SyncLease::release_table_name() {
-  clear_has_table_name();
-  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = table_name_;
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::client::BinlogBatch* SyncRequest::mutable_binlog_batch() {
+  set_has_binlog_batch();
+  if (binlog_batch_ == NULL) binlog_batch_ = new ::client::BinlogBatch;
+  return binlog_batch_;
 }
-inline void SyncLease::set_allocated_table_name(::std::string* table_name) {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
-  if (table_name) {
-    set_has_table_name();
-    table_name_ = table_name;
+inline ::client::BinlogBatch* SyncRequest::release_binlog_batch() {
+  clear_has_binlog_batch();
+  ::client::BinlogBatch* temp = binlog_batch_;
+  binlog_batch_ = NULL;
+  return temp;
+}
+inline void SyncRequest::set_allocated_binlog_batch(::client::BinlogBatch* binlog_batch) {
+  delete binlog_batch_;
+  binlog_batch_ = binlog_batch;
+  if (binlog_batch) {
+    set_has_binlog_batch();
   } else {
-    clear_has_table_name();
-    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_binlog_batch();
   }
 }
 
-// required int32 partition_id = 2;
-inline bool SyncLease::has_partition_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SyncLease::set_has_partition_id() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SyncLease::clear_has_partition_id() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void SyncLease::clear_partition_id() {
-  partition_id_ = 0;
-  clear_has_partition_id();
-}
-inline ::google::protobuf::int32 SyncLease::partition_id() const {
-  return partition_id_;
+// optional .client.SyncAck sync_ack = 9;
+inline bool SyncRequest::has_sync_ack() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
 }
-inline void SyncLease::set_partition_id(::google::protobuf::int32 value) {
-  set_has_partition_id();
-  partition_id_ = value;
+inline void SyncRequest::set_has_sync_ack() {
+  _has_bits_[0] |= 0x00000100u;
 }
-
-// required int64 lease = 3;
-inline bool SyncLease::has_lease() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline void SyncRequest::clear_has_sync_ack() {
+  _has_bits_[0] &= ~0x00000100u;
 }
-inline void SyncLease::set_has_lease() {
-  _has_bits_[0] |= 0x00000004u;
+inline void SyncRequest::clear_sync_ack() {
+  if (sync_ack_ != NULL) sync_ack_->::client::SyncAck::Clear();
+  clear_has_sync_ack();
 }
-inline void SyncLease::clear_has_lease() {
-  _has_bits_[0] &= ~0x00000004u;
+inline const ::client::SyncAck& SyncRequest::sync_ack() const {
+  return sync_ack_ != NULL ? *sync_ack_ : *default_instance_->sync_ack_;
 }
-inline void SyncLease::clear_lease() {
-  lease_ = GOOGLE_LONGLONG(0);
-  clear_has_lease();
+inline ::client::SyncAck* SyncRequest::mutable_sync_ack() {
+  set_has_sync_ack();
+  if (sync_ack_ == NULL) sync_ack_ = new ::client::SyncAck;
+  return sync_ack_;
 }
-inline ::google::protobuf::int64 SyncLease::lease() const {
-  return lease_;
+inline ::client::SyncAck* SyncRequest::release_sync_ack() {
+  clear_has_sync_ack();
+  ::client::SyncAck* temp = sync_ack_;
+  sync_ack_ = NULL;
+  return temp;
 }
-inline void SyncLease::set_lease(::google::protobuf::int64 value) {
-  set_has_lease();
-  lease_ = value;
+inline void SyncRequest::set_allocated_sync_ack(::client::SyncAck* sync_ack) {
+  delete sync_ack_;
+  sync_ack_ = sync_ack;
+  if (sync_ack) {
+    set_has_sync_ack();
+  } else {
+    clear_has_sync_ack();
+  }
 }
 
 // -------------------------------------------------------------------
 
-// SyncRequest
+// Kv
 
-// required .client.SyncType sync_type = 1;
-inline bool SyncRequest::has_sync_type() const {
+// required string key = 1;
+inline bool Kv::has_key() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void SyncRequest::set_has_sync_type() {
+inline void Kv::set_has_key() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void SyncRequest::clear_has_sync_type() {
+inline void Kv::clear_has_key() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void SyncRequest::clear_sync_type() {
-  sync_type_ = 0;
-  clear_has_sync_type();
+inline void Kv::clear_key() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    key_->clear();
+  }
+  clear_has_key();
 }
-inline ::client::SyncType SyncRequest::sync_type() const {
-  return static_cast< ::client::SyncType >(sync_type_);
+inline const ::std::string& Kv::key() const {
+  return *key_;
 }
-inline void SyncRequest::set_sync_type(::client::SyncType value) {
-  assert(::client::SyncType_IsValid(value));
-  set_has_sync_type();
-  sync_type_ = value;
+inline void Kv::set_key(const ::std::string& value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
+}
+inline void Kv::set_key(const char* value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
+}
+inline void Kv::set_key(const char* value, size_t size) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* Kv::mutable_key() {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  return key_;
+}
+inline ::std::string* Kv::release_key() {
+  clear_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = key_;
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void Kv::set_allocated_key(::std::string* key) {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (key) {
+    set_has_key();
+    key_ = key;
+  } else {
+    clear_has_key();
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
 
-// required int64 epoch = 2;
-inline bool SyncRequest::has_epoch() const {
+// required bytes value = 2;
+inline bool Kv::has_value() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void SyncRequest::set_has_epoch() {
+inline void Kv::set_has_value() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void SyncRequest::clear_has_epoch() {
+inline void Kv::clear_has_value() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void SyncRequest::clear_epoch() {
-  epoch_ = GOOGLE_LONGLONG(0);
-  clear_has_epoch();
-}
-inline ::google::protobuf::int64 SyncRequest::epoch() const {
-  return epoch_;
-}
-inline void SyncRequest::set_epoch(::google::protobuf::int64 value) {
-  set_has_epoch();
-  epoch_ = value;
-}
-
-// required .client.Node from = 3;
-inline bool SyncRequest::has_from() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline void Kv::clear_value() {
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    value_->clear();
+  }
+  clear_has_value();
 }
-inline void SyncRequest::set_has_from() {
-  _has_bits_[0] |= 0x00000004u;
+inline const ::std::string& Kv::value() const {
+  return *value_;
 }
-inline void SyncRequest::clear_has_from() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void Kv::set_value(const ::std::string& value) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(value);
 }
-inline void SyncRequest::clear_from() {
-  if (from_ != NULL) from_->::client::Node::Clear();
-  clear_has_from();
+inline void Kv::set_value(const char* value) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(value);
 }
-inline const ::client::Node& SyncRequest::from() const {
-  return from_ != NULL ? *from_ : *default_instance_->from_;
+inline void Kv::set_value(const void* value, size_t size) {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  value_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::client::Node* SyncRequest::mutable_from() {
-  set_has_from();
-  if (from_ == NULL) from_ = new ::client::Node;
-  return from_;
+inline ::std::string* Kv::mutable_value() {
+  set_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    value_ = new ::std::string;
+  }
+  return value_;
 }
-inline ::client::Node* SyncRequest::release_from() {
-  clear_has_from();
-  ::client::Node* temp = from_;
-  from_ = NULL;
-  return temp;
+inline ::std::string* Kv::release_value() {
+  clear_has_value();
+  if (value_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = value_;
+    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
 }
-inline void SyncRequest::set_allocated_from(::client::Node* from) {
-  delete from_;
-  from_ = from;
-  if (from) {
-    set_has_from();
+inline void Kv::set_allocated_value(::std::string* value) {
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    delete value_;
+  }
+  if (value) {
+    set_has_value();
+    value_ = value;
   } else {
-    clear_has_from();
+    clear_has_value();
+    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// optional .client.SyncOffset sync_offset = 4;
-inline bool SyncRequest::has_sync_offset() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// -------------------------------------------------------------------
+
+// SyncItem
+
+// required .client.SyncOffset sync_offset = 1;
+inline bool SyncItem::has_sync_offset() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void SyncRequest::set_has_sync_offset() {
-  _has_bits_[0] |= 0x00000008u;
+inline void SyncItem::set_has_sync_offset() {
+  _has_bits_[0] |= 0x00000001u;
 }
-inline void SyncRequest::clear_has_sync_offset() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void SyncItem::clear_has_sync_offset() {
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void SyncRequest::clear_sync_offset() {
+inline void SyncItem::clear_sync_offset() {
   if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
   clear_has_sync_offset();
 }
-inline const ::client::SyncOffset& SyncRequest::sync_offset() const {
+inline const ::client::SyncOffset& SyncItem::sync_offset() const {
   return sync_offset_ != NULL ? *sync_offset_ : *default_instance_->sync_offset_;
 }
-inline ::client::SyncOffset* SyncRequest::mutable_sync_offset() {
+inline ::client::SyncOffset* SyncItem::mutable_sync_offset() {
   set_has_sync_offset();
   if (sync_offset_ == NULL) sync_offset_ = new ::client::SyncOffset;
   return sync_offset_;
 }
-inline ::client::SyncOffset* SyncRequest::release_sync_offset() {
+inline ::client::SyncOffset* SyncItem::release_sync_offset() {
   clear_has_sync_offset();
   ::client::SyncOffset* temp = sync_offset_;
   sync_offset_ = NULL;
   return temp;
 }
-inline void SyncRequest::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
+inline void SyncItem::set_allocated_sync_offset(::client::SyncOffset* sync_offset) {
   delete sync_offset_;
   sync_offset_ = sync_offset;
   if (sync_offset) {
@@ -6639,35 +10672,35 @@ inline void SyncRequest::set_allocated_sync_offset(::client::SyncOffset* sync_of
   }
 }
 
-// optional .client.CmdRequest request = 5;
-inline bool SyncRequest::has_request() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional .client.CmdRequest request = 2;
+inline bool SyncItem::has_request() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void SyncRequest::set_has_request() {
-  _has_bits_[0] |= 0x00000010u;
+inline void SyncItem::set_has_request() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline void SyncRequest::clear_has_request() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void SyncItem::clear_has_request() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void SyncRequest::clear_request() {
+inline void SyncItem::clear_request() {
   if (request_ != NULL) request_->::client::CmdRequest::Clear();
   clear_has_request();
 }
-inline const ::client::CmdRequest& SyncRequest::request() const {
+inline const ::client::CmdRequest& SyncItem::request() const {
   return request_ != NULL ? *request_ : *default_instance_->request_;
 }
-inline ::client::CmdRequest* SyncRequest::mutable_request() {
+inline ::client::CmdRequest* SyncItem::mutable_request() {
   set_has_request();
   if (request_ == NULL) request_ = new ::client::CmdRequest;
   return request_;
 }
-inline ::client::CmdRequest* SyncRequest::release_request() {
+inline ::client::CmdRequest* SyncItem::release_request() {
   clear_has_request();
   ::client::CmdRequest* temp = request_;
   request_ = NULL;
   return temp;
 }
-inline void SyncRequest::set_allocated_request(::client::CmdRequest* request) {
+inline void SyncItem::set_allocated_request(::client::CmdRequest* request) {
   delete request_;
   request_ = request;
   if (request) {
@@ -6677,80 +10710,147 @@ inline void SyncRequest::set_allocated_request(::client::CmdRequest* request) {
   }
 }
 
-// optional .client.BinlogSkip binlog_skip = 6;
-inline bool SyncRequest::has_binlog_skip() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// optional int64 skip_gap = 3;
+inline bool SyncItem::has_skip_gap() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void SyncRequest::set_has_binlog_skip() {
-  _has_bits_[0] |= 0x00000020u;
+inline void SyncItem::set_has_skip_gap() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline void SyncRequest::clear_has_binlog_skip() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void SyncItem::clear_has_skip_gap() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline void SyncRequest::clear_binlog_skip() {
-  if (binlog_skip_ != NULL) binlog_skip_->::client::BinlogSkip::Clear();
-  clear_has_binlog_skip();
+inline void SyncItem::clear_skip_gap() {
+  skip_gap_ = GOOGLE_LONGLONG(0);
+  clear_has_skip_gap();
 }
-inline const ::client::BinlogSkip& SyncRequest::binlog_skip() const {
-  return binlog_skip_ != NULL ? *binlog_skip_ : *default_instance_->binlog_skip_;
+inline ::google::protobuf::int64 SyncItem::skip_gap() const {
+  return skip_gap_;
 }
-inline ::client::BinlogSkip* SyncRequest::mutable_binlog_skip() {
-  set_has_binlog_skip();
-  if (binlog_skip_ == NULL) binlog_skip_ = new ::client::BinlogSkip;
-  return binlog_skip_;
+inline void SyncItem::set_skip_gap(::google::protobuf::int64 value) {
+  set_has_skip_gap();
+  skip_gap_ = value;
 }
-inline ::client::BinlogSkip* SyncRequest::release_binlog_skip() {
-  clear_has_binlog_skip();
-  ::client::BinlogSkip* temp = binlog_skip_;
-  binlog_skip_ = NULL;
-  return temp;
+
+// -------------------------------------------------------------------
+
+// BinlogBatch
+
+// required string table_name = 1;
+inline bool BinlogBatch::has_table_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void SyncRequest::set_allocated_binlog_skip(::client::BinlogSkip* binlog_skip) {
-  delete binlog_skip_;
-  binlog_skip_ = binlog_skip;
-  if (binlog_skip) {
-    set_has_binlog_skip();
+inline void BinlogBatch::set_has_table_name() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void BinlogBatch::clear_has_table_name() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void BinlogBatch::clear_table_name() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    table_name_->clear();
+  }
+  clear_has_table_name();
+}
+inline const ::std::string& BinlogBatch::table_name() const {
+  return *table_name_;
+}
+inline void BinlogBatch::set_table_name(const ::std::string& value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void BinlogBatch::set_table_name(const char* value) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(value);
+}
+inline void BinlogBatch::set_table_name(const char* value, size_t size) {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  table_name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* BinlogBatch::mutable_table_name() {
+  set_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    table_name_ = new ::std::string;
+  }
+  return table_name_;
+}
+inline ::std::string* BinlogBatch::release_table_name() {
+  clear_has_table_name();
+  if (table_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
   } else {
-    clear_has_binlog_skip();
+    ::std::string* temp = table_name_;
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void BinlogBatch::set_allocated_table_name(::std::string* table_name) {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (table_name) {
+    set_has_table_name();
+    table_name_ = table_name;
+  } else {
+    clear_has_table_name();
+    table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// optional .client.SyncLease sync_lease = 7;
-inline bool SyncRequest::has_sync_lease() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+// required int32 partition_id = 2;
+inline bool BinlogBatch::has_partition_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void SyncRequest::set_has_sync_lease() {
-  _has_bits_[0] |= 0x00000040u;
+inline void BinlogBatch::set_has_partition_id() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline void SyncRequest::clear_has_sync_lease() {
-  _has_bits_[0] &= ~0x00000040u;
+inline void BinlogBatch::clear_has_partition_id() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void SyncRequest::clear_sync_lease() {
-  if (sync_lease_ != NULL) sync_lease_->::client::SyncLease::Clear();
-  clear_has_sync_lease();
+inline void BinlogBatch::clear_partition_id() {
+  partition_id_ = 0;
+  clear_has_partition_id();
 }
-inline const ::client::SyncLease& SyncRequest::sync_lease() const {
-  return sync_lease_ != NULL ? *sync_lease_ : *default_instance_->sync_lease_;
+inline ::google::protobuf::int32 BinlogBatch::partition_id() const {
+  return partition_id_;
 }
-inline ::client::SyncLease* SyncRequest::mutable_sync_lease() {
-  set_has_sync_lease();
-  if (sync_lease_ == NULL) sync_lease_ = new ::client::SyncLease;
-  return sync_lease_;
+inline void BinlogBatch::set_partition_id(::google::protobuf::int32 value) {
+  set_has_partition_id();
+  partition_id_ = value;
 }
-inline ::client::SyncLease* SyncRequest::release_sync_lease() {
-  clear_has_sync_lease();
-  ::client::SyncLease* temp = sync_lease_;
-  sync_lease_ = NULL;
-  return temp;
+
+// repeated .client.SyncItem items = 3;
+inline int BinlogBatch::items_size() const {
+  return items_.size();
 }
-inline void SyncRequest::set_allocated_sync_lease(::client::SyncLease* sync_lease) {
-  delete sync_lease_;
-  sync_lease_ = sync_lease;
-  if (sync_lease) {
-    set_has_sync_lease();
-  } else {
-    clear_has_sync_lease();
-  }
+inline void BinlogBatch::clear_items() {
+  items_.Clear();
+}
+inline const ::client::SyncItem& BinlogBatch::items(int index) const {
+  return items_.Get(index);
+}
+inline ::client::SyncItem* BinlogBatch::mutable_items(int index) {
+  return items_.Mutable(index);
+}
+inline ::client::SyncItem* BinlogBatch::add_items() {
+  return items_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::client::SyncItem >&
+BinlogBatch::items() const {
+  return items_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::client::SyncItem >*
+BinlogBatch::mutable_items() {
+  return &items_;
 }
 
 
@@ -5,6 +5,7 @@
 #include <list>
 #include <string>
 #include <deque>
+#include <vector>
 #include <pthread.h>
 
 #ifndef __STDC_FORMAT_MACROS
@@ -64,6 +65,20 @@ class Version {
 
   slash::RWFile *save_;
 
+  // Batched manifest persistence, an Inc dirties the in-memory
+  // version only and StableSave follows every
+  // kVersionSaveBatchCount batches, or from a delayed flush task
+  // at the latest once the writes pause
+  // Binlog::Init recovers from a stale manifest by scanning the
+  // file forward to the last crc-intact record
+  uint64_t unsaved_batches_;
+  bool flush_pending_;
+  int flush_outstanding_;
+  slash::Mutex flush_mutex_;
+  slash::CondVar flush_cv_;
+  void ScheduleFlush();
+  static void DoFlush(void* arg);
+
   // StableSave and StableLoad Should hold write lock on rwlock_
   void StableSave();
   Status StableLoad();
@@ -77,27 +92,84 @@ class Version {
 
 /**
  * BinlogWriter
+ *
+ * Frame records into blocks and append them through a buffered
+ * WritableFile that grows the file as it goes
+ * Subclasses override the raw file operations only,
+ * the record framing above them is shared
  */
 class BinlogWriter {
 public:
-  BinlogWriter(slash::WritableFile *queue);
-  ~BinlogWriter(); 
+  explicit BinlogWriter(slash::WritableFile *queue);
+  virtual ~BinlogWriter();
   Status Fallback(uint64_t offset);
   Status Produce(const Slice &item, int64_t *write_size);
   Status AppendBlank(uint64_t len, int64_t* write_size);
+  virtual uint64_t Filesize();
+
+protected:
+  // For subclasses not writing through a WritableFile
+  BinlogWriter();
+  virtual Status Append(const Slice& data);
+  virtual Status Flush();
+  virtual Status Trim(uint64_t offset);
+  void Load();
 
 private:
   slash::WritableFile *queue_;
   int block_offset_;
   Status EmitPhysicalRecord(RecordType t,
       const char *ptr, size_t n, int64_t *write_size);
-  void Load();
 
   // No copying allowed
   BinlogWriter(const BinlogWriter&);
   void operator=(const BinlogWriter&);
 };
 
+/**
+ * BinlogMmapWriter
+ *
+ * Append through a writable mapping of a binlog file fallocated
+ * to its full size at creation, so a Produce never waits for the
+ * filesystem growing the file, and rolling to a file created by
+ * Prealloc ahead of time costs an open and a map only
+ * The fallocated tail reads back as zero headers,
+ * which every reader takes as the end of the written part
+ */
+class BinlogMmapWriter : public BinlogWriter {
+public:
+  // pre_created promises a file fresh from Prealloc holding zeros
+  // only, whose content then does not need to be dropped
+  static Status Create(const std::string& filename, uint64_t file_size,
+      uint64_t offset, bool pre_created, BinlogMmapWriter** wptr);
+
+  // Create and fallocate filename before it is ever written
+  static Status Prealloc(const std::string& filename, uint64_t file_size);
+
+  BinlogMmapWriter(const std::string& filename, uint64_t file_size);
+  virtual ~BinlogMmapWriter();
+  virtual uint64_t Filesize();
+
+protected:
+  virtual Status Append(const Slice& data);
+  virtual Status Flush();
+  virtual Status Trim(uint64_t offset);
+
+private:
+  std::string filename_;
+  uint64_t file_size_;
+  int fd_;
+  char* base_;
+  uint64_t map_size_;
+  uint64_t write_pos_;
+  Status Open(uint64_t offset, bool pre_created);
+  Status EnsureSpace(uint64_t len);
+
+  // No copying allowed
+  BinlogMmapWriter(const BinlogMmapWriter&);
+  void operator=(const BinlogMmapWriter&);
+};
+
 
 
 /**
@@ -124,6 +196,40 @@ private:
   void operator=(const BinlogReader&);
 };
 
+/**
+ * BinlogMmapReader
+ *
+ * Read records straight from a mapped binlog file,
+ * a record held by one block is yielded as a Slice over the mapping
+ * without any copy, spanning records are assembled into scratch
+ * The mapping is extended on demand while the writer keeps appending,
+ * so a returned Slice is only valid until the next Consume
+ */
+class BinlogMmapReader {
+public:
+  static Status Create(const std::string& filename, BinlogMmapReader** rptr);
+  explicit BinlogMmapReader(const std::string& filename);
+  ~BinlogMmapReader();
+  Status Seek(uint64_t offset);
+  Status Consume(uint64_t *size, Slice *item, std::string *scratch);
+  void SkipNextBlock(uint64_t* size);
+
+private:
+  std::string filename_;
+  int fd_;
+  char* base_;
+  uint64_t map_size_;
+  uint64_t pos_;
+  int last_record_offset_;
+  Status Open();
+  Status Remap();
+  uint32_t ReadPhysicalRecord(uint64_t *size, slash::Slice *result);
+
+  // No copying allowed
+  BinlogMmapReader(const BinlogMmapReader&);
+  void operator=(const BinlogMmapReader&);
+};
+
 
 /**
  * Binlog
@@ -145,8 +251,21 @@ public:
   }
 
   Status Put(const std::string &item);
+  // Zero-copy variant, the bytes are read in place by the group
+  // commit leader; Put blocks until the flush, so the buffer only
+  // has to stay alive across the call
+  Status Put(const Slice &item);
+  // Append multiple records in one batch,
+  // keeping every record framed as if it was put alone
+  Status Put(const std::vector<std::string> &items);
   Status PutBlank(uint64_t len);
 
+  // Lookup the record begin at (filenum, offset) in the tail cache
+  // Return NotFound on cache miss,
+  // then the caller should fall back to binlog file read
+  Status GetCached(uint32_t filenum, uint64_t offset,
+      std::string* item, uint64_t* length);
+
   void GetProducerStatus(uint32_t* filenum, uint64_t* pro_offset) {
     slash::MutexLock l(&mutex_);
     version_->Fetch(filenum, pro_offset);
@@ -155,17 +274,62 @@ public:
       uint64_t* actual_offset, uint32_t* cur_num, uint64_t* cur_offset);
 
 private:
+  struct Writer;
+
   slash::Mutex mutex_;
   std::string binlog_path_;
   uint64_t file_size_;
   std::string filename_;
 
+  // Group commit queue, whose front writer is the leader
+  // Protected by writers_mutex_ instead of mutex_,
+  // so that new writers could join while the leader is flushing
+  slash::Mutex writers_mutex_;
+  std::deque<Writer*> writers_;
+  Status PutWriter(Writer* w);
+
+  // In memory cache of the binlog tail
+  // Ordered by (filenum, offset) and bounded by kBinlogTailCacheSize
+  struct CacheEntry {
+    uint32_t filenum;
+    uint64_t offset;
+    uint64_t length;
+    std::string item;
+  };
+  slash::Mutex cache_mutex_;
+  std::deque<CacheEntry> tail_cache_;
+  uint64_t cache_bytes_;
+  void PushCache(uint32_t filenum, uint64_t offset,
+      uint64_t length, const Slice& item);
+  void ClearCache();
+
   slash::RWFile *manifest_;
   Version* version_;
   slash::WritableFile *queue_;
   BinlogWriter* writer_;
+  // Write through fallocated mapped files instead of the buffered
+  // queue_, see conf binlog_prealloc
+  bool prealloc_;
+
+  // State of the pre-creation of the next binlog file,
+  // filled in by a task on the shared background thread so that
+  // MaybeRoll finds the file of the next number ready on disk
+  slash::Mutex prealloc_mutex_;
+  slash::CondVar prealloc_cv_;
+  int64_t prealloc_num_;  // filenum done or underway, -1 for none
+  bool prealloc_done_;
+  int prealloc_outstanding_;
+  static void DoPrealloc(void* arg);
+  void PreallocAhead(uint32_t filenum);
+  bool TakePrealloc(uint32_t filenum);
 
   Status Init();
+  // Walk binlog file filenum forward from offset to the end of its
+  // last intact record, the true tail when the manifest lags
+  bool RecoverTail(uint32_t filenum, uint64_t offset, uint64_t* tail);
+  // Open binlog file filenum for appending at offset in the
+  // configured writer mode, replacing the writer in hand
+  Status NewWriter(uint32_t filenum, uint64_t offset, bool append);
   void MaybeRoll();
   Status RemoveBetween(int lbound, int rbound);
   
@@ -5,6 +5,7 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "client.pb.h"
 #include "zp_meta.pb.h"
@@ -14,6 +15,10 @@
 
 //Constant for command name
 
+namespace rocksdb {
+class WriteBatch;
+}
+
 using slash::Status;
 
 enum CmdFlagsMask {
@@ -55,6 +60,20 @@ class Cmd {
       std::string* log_raw) const {
     return request->SerializeToString(log_raw);
   }
+  // Whether GenerateLog would emit exactly the serialized request;
+  // then a caller still holding the wire bytes it parsed the request
+  // from may log them in place instead of serializing again
+  virtual bool LogReusesRequest(
+      const google::protobuf::Message *request) const {
+    return true;
+  }
+  // Append the writes of the command into a shared write batch
+  // Return false if the command could not join a batch,
+  // then the caller should fall back to Do
+  virtual bool BatchDo(const google::protobuf::Message *request,
+      rocksdb::WriteBatch* batch) const {
+    return false;
+  }
   virtual std::string name() const = 0;
   virtual std::string ExtractTable(const google::protobuf::Message *request) const {
     return "";
@@ -65,6 +84,16 @@ class Cmd {
   virtual std::string ExtractKey(const google::protobuf::Message *request) const {
     return "";
   }
+  // Every key the command writes; a multi key write must guard all of
+  // them, not only the routing key ExtractKey answers with
+  virtual void ExtractAllKeys(const google::protobuf::Message *request,
+      std::vector<std::string>* keys) const {
+    keys->push_back(ExtractKey(request));
+  }
+  // Whether the request opted in to be served by a slave partition
+  virtual bool AllowStaleRead(const google::protobuf::Message *request) const {
+    return false;
+  }
 
   bool is_write() const {
     return ((flag_ & kCmdFlagsMaskRW) == kCmdFlagsWrite);
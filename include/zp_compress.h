@@ -0,0 +1,49 @@
+// Copyright 2017 Qihoo
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http:// www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef ZP_COMPRESS_H
+#define ZP_COMPRESS_H
+
+#include <string>
+
+// Transparent value compression in front of the DB and the binlog.
+// A compressed value carries a 4 byte magic envelope naming its codec,
+// so readers and slaves decode by inspection and no codec negotiation
+// is needed between peers, mixed codecs in one DB are fine
+enum CompressCodec {
+  kCompressNone = 0,
+  kCompressSnappy = 1,
+  kCompressZlib = 2,
+};
+
+// Codec name from conf, unknown names fall back to kCompressNone
+int CompressCodecFromString(const std::string& name);
+
+const char* CompressCodecName(int codec);
+
+bool IsCompressedValue(const std::string& stored);
+
+// Envelope raw with codec, return raw untouched when the codec is none,
+// raw is below the worthwhile size or compression would not shrink it.
+// A raw value colliding with the envelope magic is escaped into a raw
+// envelope whatever the codec, so reads can always unwrap by
+// inspection; only ingest paths may call this, the sync replay paths
+// store the bytes the master shipped verbatim
+std::string CompressValue(int codec, const std::string& raw);
+
+// Unwrap stored into raw, values without an envelope pass through as-is,
+// escaped plaintext loses its raw envelope again,
+// return false only on a corrupt envelope
+bool DecompressValue(const std::string& stored, std::string* raw);
+
+#endif  // ZP_COMPRESS_H
@@ -21,6 +21,11 @@ class ZpConf {
 
   int Load(const std::string& path);
 
+  // Re-read the safely-mutable settings from the loaded conf file,
+  // everything fixing the process topology at startup (paths, ports,
+  // dispatcher thread counts) keeps its running value
+  int Reload();
+
   std::string seed_ip() {
     RWLock l(&rwlock_, false);
     return seed_ip_;
@@ -98,10 +103,26 @@ class ZpConf {
     RWLock l(&rwlock_, false);
     return sync_recv_thread_num_;
   }
+  int sync_apply_thread_num() {
+    RWLock l(&rwlock_, false);
+    return sync_apply_thread_num_;
+  }
   int sync_send_thread_num() {
     RWLock l(&rwlock_, false);
     return sync_send_thread_num_;
   }
+  std::string data_thread_cpuset() {
+    RWLock l(&rwlock_, false);
+    return data_thread_cpuset_;
+  }
+  std::string sync_thread_cpuset() {
+    RWLock l(&rwlock_, false);
+    return sync_thread_cpuset_;
+  }
+  std::string background_thread_cpuset() {
+    RWLock l(&rwlock_, false);
+    return background_thread_cpuset_;
+  }
   int max_background_flushes() {
     RWLock l(&rwlock_, false);
     return max_background_flushes_;
@@ -110,6 +131,10 @@ class ZpConf {
     RWLock l(&rwlock_, false);
     return max_background_compactions_;
   }
+  int db_rate_limit() {
+    RWLock l(&rwlock_, false);
+    return db_rate_limit_;
+  }
   int slowlog_slower_than() {
     RWLock l(&rwlock_, false);
     return slowlog_slower_than_;
@@ -134,6 +159,70 @@ class ZpConf {
     RWLock l(&rwlock_, false);
     return db_block_size_;
   }
+  int db_block_cache_size() {
+    RWLock l(&rwlock_, false);
+    return db_block_cache_size_;
+  }
+  int partition_open_thread_num() {
+    RWLock l(&rwlock_, false);
+    return partition_open_thread_num_;
+  }
+  int db_sync_stream_num() {
+    RWLock l(&rwlock_, false);
+    return db_sync_stream_num_;
+  }
+  int db_sync_speed() {
+    RWLock l(&rwlock_, false);
+    return db_sync_speed_;
+  }
+  int sync_lease_min() {
+    RWLock l(&rwlock_, false);
+    return sync_lease_min_;
+  }
+  int sync_lease_max() {
+    RWLock l(&rwlock_, false);
+    return sync_lease_max_;
+  }
+  int recover_sync_delay() {
+    RWLock l(&rwlock_, false);
+    return recover_sync_delay_;
+  }
+  int stuck_recover_sync_delay() {
+    RWLock l(&rwlock_, false);
+    return stuck_recover_sync_delay_;
+  }
+  int bgsave_thread_num() {
+    RWLock l(&rwlock_, false);
+    return bgsave_thread_num_;
+  }
+  int bgpurge_thread_num() {
+    RWLock l(&rwlock_, false);
+    return bgpurge_thread_num_;
+  }
+  int purge_files_per_sec() {
+    RWLock l(&rwlock_, false);
+    return purge_files_per_sec_;
+  }
+  int purge_mb_per_sec() {
+    RWLock l(&rwlock_, false);
+    return purge_mb_per_sec_;
+  }
+  int purge_defer_qps() {
+    RWLock l(&rwlock_, false);
+    return purge_defer_qps_;
+  }
+  int binlog_archive_mb() {
+    RWLock l(&rwlock_, false);
+    return binlog_archive_mb_;
+  }
+  int compress_value() {
+    RWLock l(&rwlock_, false);
+    return compress_value_;
+  }
+  bool binlog_prealloc() {
+    RWLock l(&rwlock_, false);
+    return binlog_prealloc_;
+  }
 
  private:
   // copy disallowded
@@ -153,14 +242,28 @@ class ZpConf {
   std::string pid_file_;
   std::string lock_file_;
   int max_file_descriptor_num_;
+  // Path Load read from, kept for Reload
+  std::string conf_path_;
 
   // Thread Num
   int meta_thread_num_;
   int data_thread_num_;
   int sync_recv_thread_num_;
+  // Lanes applying one replicated batch in parallel by key hash,
+  // 1 keeps the serial apply
+  int sync_apply_thread_num_;
   int sync_send_thread_num_;
+  // Core lists like "0-7,16-23" pinning a thread group to one NUMA
+  // node, so its memory stays node local by first touch; empty
+  // leaves the group unpinned. Startup only, as the thread nums
+  std::string data_thread_cpuset_;
+  std::string sync_thread_cpuset_;
+  std::string background_thread_cpuset_;
   int max_background_flushes_;
   int max_background_compactions_;
+  // MB/s, flush+compaction write budget shared by all partition DBs,
+  // 0 leaves background writes unthrottled
+  int db_rate_limit_;
 
   // DB
   int db_write_buffer_size_; //KB
@@ -168,9 +271,41 @@ class ZpConf {
   int db_target_file_size_base_; //KB
   int db_max_open_files_;
   int db_block_size_; //KB
+  int db_block_cache_size_; //KB, shared by all partition DBs
+  int partition_open_thread_num_;
+
+  // DBSync
+  int db_sync_stream_num_;
+  int db_sync_speed_; //MB/s, shared by all streams of one DBSync
+
+  // Sync lease and recovery, all in seconds
+  // Floor and ceiling of the binlog sync lease a master grants
+  int sync_lease_min_;
+  int sync_lease_max_;
+  // Base patience before a slave redoes trysync, the effective
+  // delays adapt to the measured master RTT between these two
+  int recover_sync_delay_;
+  int stuck_recover_sync_delay_;
+
+  // Background worker pools, the per-disk concurrency limits
+  int bgsave_thread_num_;
+  int bgpurge_thread_num_;
+
+  // Binlog purge trickle caps, deletion defers above purge_defer_qps
+  int purge_files_per_sec_;
+  int purge_mb_per_sec_;
+  int purge_defer_qps_; // -1 means never defer
+
+  // Per partition budget (MB) for the compressed sealed-binlog
+  // archive that purge feeds, 0 turns the archive tier off
+  int binlog_archive_mb_;
 
   // Feature
   int slowlog_slower_than_;
+  int compress_value_; // a CompressCodec value, applied to new writes only
+  // Fallocated mmap binlog writing with pre-created next files,
+  // removes the write stalls at binlog roll boundaries
+  bool binlog_prealloc_;
 
   pthread_rwlock_t rwlock_;
 };
@@ -50,16 +50,43 @@ const int kMetaPortShiftCmd = 0;
 const int kMetaPortShiftFY = 100;
 
 
-// TrySync Delay time := kRecoverSyncDelayCronCount * (kNodeCronInterval * kNodeCronWaitCount)
-const int kRecoverSyncDelayCronCount = 7;
-const int kStuckRecoverSyncDelayCronCount = 450; // for slave stuck out of kConnected
+// Recover sync delays live in conf (recover_sync_delay and
+// stuck_recover_sync_delay) and adapt to the measured master RTT,
+// see Partition::RecoverSyncDelayCrons
+// Every such slice of master RTT buys one more cron of recover-sync
+// patience, a WAN replica backs off further than a LAN one
+const uint64_t kRecoverSyncRttStepUs = 10 * 1000;
+// A recovery within this window of the previous one doubles the
+// delay, flapping into repeated DBSync is the case to avoid most
+const int kRecoverSyncBackoffWindow = 1800;  // seconds
+// Slack on the sync lease deadline in RTTs, a renewal crossing the
+// wire is about one RTT stale when it lands
+const int kSyncLeaseRttFactor = 4;
 const int kTrySyncInterval = 3000;  // mili seconds
+// First retry delay of a failed trysync,
+// doubled per failure up to kTrySyncInterval
+const int kTrySyncBaseInterval = 100;  // mili seconds
 const int kBinlogSendInterval = 1;
 const int kBinlogRedundantLease = 10;  // some more lease time for redundance
-const int kBinlogMinLease = 20;
 const int kBinlogDefaultLease = 20;
 const int kBinlogTimeSlice = 3;    // should larger than kBinlogSendInterval
+// A task lagging n binlog files behind gets (1 + n) time slices in a row,
+// bounded by this factor to keep the other tasks of the shard scheduled
+const int kBinlogMaxLagSliceFactor = 8;
+// Coalesce binlog items per BATCH SyncRequest frame,
+// up to kBinlogBatchMaxCount items or kBinlogBatchMaxBytes bytes
+const int kBinlogBatchMaxCount = 100;
+const uint64_t kBinlogBatchMaxBytes = 1024 * 1024;
+// Max wait for slave acks of a write carrying ack_replicas,
+// on expiry the client gets kWait though the write applied locally
+const int kWriteAckTimeout = 1000;  // mili seconds
+
+// Values shorter than this are never worth a compression envelope
+const size_t kCompressValueMinBytes = 128;
 const int kPingInterval = 3;
+// Delta pings between two full offset snapshots, the snapshot
+// resyncs whatever a lost ack or meta failover left stale there
+const int kPingFullSnapshotCount = 20;
 const int kMetacmdInterval = 3;
 const int kDispatchCronInterval = 5000;
 const int kDispatchQueueSize = 1000;
@@ -72,6 +99,10 @@ const int kBinlogReceiverCronInterval = 6000;
 // Server cron wait kNodeCronInterval * kNodeCronWaitCount every time
 const int kNodeCronInterval = 1000;
 const int kNodeCronWaitCount = 2;
+// Workers the per-partition timing tasks are sharded over,
+// a slow purge check of one partition then cannot delay the lease
+// and recovery checks of the others
+const int kPartitionCronWorkerNum = 4;
 //const int kBinlogReceiverCronInterval = 1000;
 const int kBinlogReceiveBgWorkerFull = 100;
 
@@ -82,8 +113,17 @@ const int kBinlogReceiveBgWorkerFull = 100;
 // the default size is 64KB
 const size_t kBlockSize = 64 * 1024;
 
-// Header is Type(1 byte), length (2 bytes)
-const size_t kHeaderSize = 1 + 3;
+// Header is length (3 bytes), Type (1 byte), crc32c of payload (4 bytes)
+// Format version 2: version 1 headers carried no checksum,
+// nodes with version 1 binlog files must resync from scratch
+const uint32_t kBinlogFormatVersion = 2;
+const size_t kHeaderSize = 3 + 1 + 4;
+
+// Stripes of the per-partition write-path key lock
+const size_t kRecordLockStripes = 64;
+
+// Slow requests kept in memory for INFOSLOWLOG, oldest overwritten first
+const size_t kSlowlogMaxLen = 128;
 
 const std::string kBinlogPrefix = "binlog";
 const size_t kBinlogPrefixLen = 6;
@@ -96,10 +136,28 @@ const std::string kManifest = "manifest";
 //
 // The size of Binlogfile
 //
-//const uint64_t kBinlogSize = 128; 
+//const uint64_t kBinlogSize = 128;
 //const uint64_t kBinlogSize = 1024 * 100;
 const uint64_t kBinlogSize = 1024 * 1024 * 100;
 
+// Batched persistence of the binlog version, the put path dirties
+// the in-memory version only and the manifest follows every this
+// many batches, or this late from a delayed flush once the writes
+// pause, roll and fallback points persist immediately either way
+const uint64_t kVersionSaveBatchCount = 100;
+const int kVersionSaveIntervalMs = 100;
+
+// A binlog file is fallocated this much beyond its roll size when
+// binlog_prealloc is on, so the batch crossing the roll boundary
+// rarely needs a foreground extend
+const uint64_t kBinlogMmapExtendStep = 4 * 1024 * 1024;
+
+//
+// The size of in memory binlog tail cache
+// which serve the binlog sender without read I/O
+//
+const uint64_t kBinlogTailCacheSize = 4 * 1024 * 1024;
+
 
 //
 // define reply between master and slave
@@ -116,7 +174,12 @@ const uint32_t kDBSyncMaxGap = 1000;
 const std::string kDBSyncModule = "document";
 const uint32_t kDBSyncSpeedLimit = 126; //MBPS
 const int kDBSyncRetryTime = 5;    // retry time to send single file for DBSync
+// Pace of the background trash reclaimer, so erasing a flushed 100GB
+// partition does not saturate the disk the serving DBs live on
+const uint64_t kTrashReclaimSpeedLimit = 64;  // MBPS
 const std::string kBgsaveInfoFile = "info";
+// Names of the files a dump inherited from the previous one as hard links
+const std::string kBgsaveInheritedFile = "inherited_files";
 
 // Purge binlog
 const uint32_t kBinlogRemainMinCount = 10;
@@ -130,6 +193,13 @@ const uint32_t kBinlogRemainMaxDay = 30;
 const std::string kMetaTables = "##tables";
 const std::string kMetaNodes = "##nodes";
 const std::string kMetaVersion = "##version";
+// Versions of table changes the meta leader keeps in memory,
+// a Pull whose epoch falls out of it gets the full snapshot
+const size_t kMetaVersionDiffCount = 128;
+// Shards of the per-table node offset map on the meta leader
+const size_t kMetaOffsetShardNum = 16;
+// Threads committing changed tables of one update batch to floyd
+const size_t kMetaTableWriterNum = 8;
 
 // timeout between node and meta server
 // the one for meta should large than for node
@@ -137,4 +207,9 @@ const std::string kMetaVersion = "##version";
 const int kNodeMetaTimeoutN = 6;
 const int kNodeMetaTimeoutM= 18;
 
+// Liveness timer wheel on the meta leader, one bucket per second,
+// must cover more than kNodeMetaTimeoutM seconds
+const size_t kMetaAliveWheelSize = 64;
+const size_t kMetaAliveShardNum = 16;
+
 #endif
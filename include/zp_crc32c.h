@@ -0,0 +1,25 @@
+// Copyright 2017 Qihoo
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http:// www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef ZP_CRC32C_H
+#define ZP_CRC32C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// crc32c checksum of the Castagnoli polynomial
+// Use the SSE4.2 crc32 instruction when the cpu provides it,
+// detected once at runtime, fall back to a table otherwise
+uint32_t Crc32c(const char* data, size_t n);
+
+#endif  // ZP_CRC32C_H
@@ -40,6 +40,7 @@ class Nodes;
 class MetaNodes;
 class Partitions;
 class TableName;
+class TableOptions;
 class Table;
 class BasicCmdUnit;
 class SyncOffset;
@@ -706,6 +707,115 @@ class TableName : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class TableOptions : public ::google::protobuf::Message {
+ public:
+  TableOptions();
+  virtual ~TableOptions();
+
+  TableOptions(const TableOptions& from);
+
+  inline TableOptions& operator=(const TableOptions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TableOptions& default_instance();
+
+  void Swap(TableOptions* other);
+
+  // implements Message ----------------------------------------------
+
+  TableOptions* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TableOptions& from);
+  void MergeFrom(const TableOptions& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 bloom_filter_bits = 1;
+  inline bool has_bloom_filter_bits() const;
+  inline void clear_bloom_filter_bits();
+  static const int kBloomFilterBitsFieldNumber = 1;
+  inline ::google::protobuf::int32 bloom_filter_bits() const;
+  inline void set_bloom_filter_bits(::google::protobuf::int32 value);
+
+  // optional int32 block_size = 2;
+  inline bool has_block_size() const;
+  inline void clear_block_size();
+  static const int kBlockSizeFieldNumber = 2;
+  inline ::google::protobuf::int32 block_size() const;
+  inline void set_block_size(::google::protobuf::int32 value);
+
+  // repeated string compression_per_level = 3;
+  inline int compression_per_level_size() const;
+  inline void clear_compression_per_level();
+  static const int kCompressionPerLevelFieldNumber = 3;
+  inline const ::std::string& compression_per_level(int index) const;
+  inline ::std::string* mutable_compression_per_level(int index);
+  inline void set_compression_per_level(int index, const ::std::string& value);
+  inline void set_compression_per_level(int index, const char* value);
+  inline void set_compression_per_level(int index, const char* value, size_t size);
+  inline ::std::string* add_compression_per_level();
+  inline void add_compression_per_level(const ::std::string& value);
+  inline void add_compression_per_level(const char* value);
+  inline void add_compression_per_level(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& compression_per_level() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_compression_per_level();
+
+  // @@protoc_insertion_point(class_scope:ZPMeta.TableOptions)
+ private:
+  inline void set_has_bloom_filter_bits();
+  inline void clear_has_bloom_filter_bits();
+  inline void set_has_block_size();
+  inline void clear_has_block_size();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::RepeatedPtrField< ::std::string> compression_per_level_;
+  ::google::protobuf::int32 bloom_filter_bits_;
+  ::google::protobuf::int32 block_size_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+
+  friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
+  friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
+  friend void protobuf_ShutdownFile_zp_5fmeta_2eproto();
+
+  void InitAsDefaultInstance();
+  static TableOptions* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class Table : public ::google::protobuf::Message {
  public:
   Table();
@@ -784,18 +894,30 @@ class Table : public ::google::protobuf::Message {
   inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Partitions >*
       mutable_partitions();
 
+  // optional .ZPMeta.TableOptions options = 3;
+  inline bool has_options() const;
+  inline void clear_options();
+  static const int kOptionsFieldNumber = 3;
+  inline const ::ZPMeta::TableOptions& options() const;
+  inline ::ZPMeta::TableOptions* mutable_options();
+  inline ::ZPMeta::TableOptions* release_options();
+  inline void set_allocated_options(::ZPMeta::TableOptions* options);
+
   // @@protoc_insertion_point(class_scope:ZPMeta.Table)
  private:
   inline void set_has_name();
   inline void clear_has_name();
+  inline void set_has_options();
+  inline void clear_has_options();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* name_;
   ::google::protobuf::RepeatedPtrField< ::ZPMeta::Partitions > partitions_;
+  ::ZPMeta::TableOptions* options_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
   friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
@@ -1214,20 +1336,30 @@ class MetaCmd_Pull : public ::google::protobuf::Message {
   inline ::std::string* release_name();
   inline void set_allocated_name(::std::string* name);
 
+  // optional int32 epoch = 3;
+  inline bool has_epoch() const;
+  inline void clear_epoch();
+  static const int kEpochFieldNumber = 3;
+  inline ::google::protobuf::int32 epoch() const;
+  inline void set_epoch(::google::protobuf::int32 value);
+
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.Pull)
  private:
   inline void set_has_node();
   inline void clear_has_node();
   inline void set_has_name();
   inline void clear_has_name();
+  inline void set_has_epoch();
+  inline void clear_has_epoch();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::ZPMeta::Node* node_;
   ::std::string* name_;
+  ::google::protobuf::int32 epoch_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
   friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
@@ -1311,20 +1443,32 @@ class MetaCmd_Init : public ::google::protobuf::Message {
   inline ::google::protobuf::int32 num() const;
   inline void set_num(::google::protobuf::int32 value);
 
+  // optional .ZPMeta.TableOptions options = 3;
+  inline bool has_options() const;
+  inline void clear_options();
+  static const int kOptionsFieldNumber = 3;
+  inline const ::ZPMeta::TableOptions& options() const;
+  inline ::ZPMeta::TableOptions* mutable_options();
+  inline ::ZPMeta::TableOptions* release_options();
+  inline void set_allocated_options(::ZPMeta::TableOptions* options);
+
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.Init)
  private:
   inline void set_has_name();
   inline void clear_has_name();
   inline void set_has_num();
   inline void clear_has_num();
+  inline void set_has_options();
+  inline void clear_has_options();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* name_;
+  ::ZPMeta::TableOptions* options_;
   ::google::protobuf::int32 num_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
   friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
@@ -1909,17 +2053,27 @@ class MetaCmdResponse_Ping : public ::google::protobuf::Message {
   inline ::google::protobuf::int32 version() const;
   inline void set_version(::google::protobuf::int32 value);
 
+  // optional int64 incarnation = 2;
+  inline bool has_incarnation() const;
+  inline void clear_incarnation();
+  static const int kIncarnationFieldNumber = 2;
+  inline ::google::protobuf::int64 incarnation() const;
+  inline void set_incarnation(::google::protobuf::int64 value);
+
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse.Ping)
  private:
   inline void set_has_version();
   inline void clear_has_version();
+  inline void set_has_incarnation();
+  inline void clear_has_incarnation();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::int32 version_;
+  ::google::protobuf::int64 incarnation_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
 
   friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
   friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
@@ -2003,18 +2157,28 @@ class MetaCmdResponse_Pull : public ::google::protobuf::Message {
   inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table >*
       mutable_info();
 
+  // optional int32 base = 3;
+  inline bool has_base() const;
+  inline void clear_base();
+  static const int kBaseFieldNumber = 3;
+  inline ::google::protobuf::int32 base() const;
+  inline void set_base(::google::protobuf::int32 value);
+
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse.Pull)
  private:
   inline void set_has_version();
   inline void clear_has_version();
+  inline void set_has_base();
+  inline void clear_has_base();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table > info_;
   ::google::protobuf::int32 version_;
+  ::google::protobuf::int32 base_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
   friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
@@ -2869,6 +3033,98 @@ TableName::mutable_name() {
 
 // -------------------------------------------------------------------
 
+// TableOptions
+
+// optional int32 bloom_filter_bits = 1;
+inline bool TableOptions::has_bloom_filter_bits() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TableOptions::set_has_bloom_filter_bits() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TableOptions::clear_has_bloom_filter_bits() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TableOptions::clear_bloom_filter_bits() {
+  bloom_filter_bits_ = 0;
+  clear_has_bloom_filter_bits();
+}
+inline ::google::protobuf::int32 TableOptions::bloom_filter_bits() const {
+  return bloom_filter_bits_;
+}
+inline void TableOptions::set_bloom_filter_bits(::google::protobuf::int32 value) {
+  set_has_bloom_filter_bits();
+  bloom_filter_bits_ = value;
+}
+
+// optional int32 block_size = 2;
+inline bool TableOptions::has_block_size() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TableOptions::set_has_block_size() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TableOptions::clear_has_block_size() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TableOptions::clear_block_size() {
+  block_size_ = 0;
+  clear_has_block_size();
+}
+inline ::google::protobuf::int32 TableOptions::block_size() const {
+  return block_size_;
+}
+inline void TableOptions::set_block_size(::google::protobuf::int32 value) {
+  set_has_block_size();
+  block_size_ = value;
+}
+
+// repeated string compression_per_level = 3;
+inline int TableOptions::compression_per_level_size() const {
+  return compression_per_level_.size();
+}
+inline void TableOptions::clear_compression_per_level() {
+  compression_per_level_.Clear();
+}
+inline const ::std::string& TableOptions::compression_per_level(int index) const {
+  return compression_per_level_.Get(index);
+}
+inline ::std::string* TableOptions::mutable_compression_per_level(int index) {
+  return compression_per_level_.Mutable(index);
+}
+inline void TableOptions::set_compression_per_level(int index, const ::std::string& value) {
+  compression_per_level_.Mutable(index)->assign(value);
+}
+inline void TableOptions::set_compression_per_level(int index, const char* value) {
+  compression_per_level_.Mutable(index)->assign(value);
+}
+inline void TableOptions::set_compression_per_level(int index, const char* value, size_t size) {
+  compression_per_level_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TableOptions::add_compression_per_level() {
+  return compression_per_level_.Add();
+}
+inline void TableOptions::add_compression_per_level(const ::std::string& value) {
+  compression_per_level_.Add()->assign(value);
+}
+inline void TableOptions::add_compression_per_level(const char* value) {
+  compression_per_level_.Add()->assign(value);
+}
+inline void TableOptions::add_compression_per_level(const char* value, size_t size) {
+  compression_per_level_.Add()->assign(reinterpret_cast<const char*>(value), size);
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TableOptions::compression_per_level() const {
+  return compression_per_level_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TableOptions::mutable_compression_per_level() {
+  return &compression_per_level_;
+}
+
+// -------------------------------------------------------------------
+
 // Table
 
 // required string name = 1;
@@ -2966,6 +3222,44 @@ Table::mutable_partitions() {
   return &partitions_;
 }
 
+// optional .ZPMeta.TableOptions options = 3;
+inline bool Table::has_options() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Table::set_has_options() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Table::clear_has_options() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Table::clear_options() {
+  if (options_ != NULL) options_->::ZPMeta::TableOptions::Clear();
+  clear_has_options();
+}
+inline const ::ZPMeta::TableOptions& Table::options() const {
+  return options_ != NULL ? *options_ : *default_instance_->options_;
+}
+inline ::ZPMeta::TableOptions* Table::mutable_options() {
+  set_has_options();
+  if (options_ == NULL) options_ = new ::ZPMeta::TableOptions;
+  return options_;
+}
+inline ::ZPMeta::TableOptions* Table::release_options() {
+  clear_has_options();
+  ::ZPMeta::TableOptions* temp = options_;
+  options_ = NULL;
+  return temp;
+}
+inline void Table::set_allocated_options(::ZPMeta::TableOptions* options) {
+  delete options_;
+  options_ = options;
+  if (options) {
+    set_has_options();
+  } else {
+    clear_has_options();
+  }
+}
+
 // -------------------------------------------------------------------
 
 // BasicCmdUnit
@@ -3441,6 +3735,28 @@ inline void MetaCmd_Pull::set_allocated_name(::std::string* name) {
   }
 }
 
+// optional int32 epoch = 3;
+inline bool MetaCmd_Pull::has_epoch() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void MetaCmd_Pull::set_has_epoch() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void MetaCmd_Pull::clear_has_epoch() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void MetaCmd_Pull::clear_epoch() {
+  epoch_ = 0;
+  clear_has_epoch();
+}
+inline ::google::protobuf::int32 MetaCmd_Pull::epoch() const {
+  return epoch_;
+}
+inline void MetaCmd_Pull::set_epoch(::google::protobuf::int32 value) {
+  set_has_epoch();
+  epoch_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // MetaCmd_Init
@@ -3537,6 +3853,44 @@ inline void MetaCmd_Init::set_num(::google::protobuf::int32 value) {
   num_ = value;
 }
 
+// optional .ZPMeta.TableOptions options = 3;
+inline bool MetaCmd_Init::has_options() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void MetaCmd_Init::set_has_options() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void MetaCmd_Init::clear_has_options() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void MetaCmd_Init::clear_options() {
+  if (options_ != NULL) options_->::ZPMeta::TableOptions::Clear();
+  clear_has_options();
+}
+inline const ::ZPMeta::TableOptions& MetaCmd_Init::options() const {
+  return options_ != NULL ? *options_ : *default_instance_->options_;
+}
+inline ::ZPMeta::TableOptions* MetaCmd_Init::mutable_options() {
+  set_has_options();
+  if (options_ == NULL) options_ = new ::ZPMeta::TableOptions;
+  return options_;
+}
+inline ::ZPMeta::TableOptions* MetaCmd_Init::release_options() {
+  clear_has_options();
+  ::ZPMeta::TableOptions* temp = options_;
+  options_ = NULL;
+  return temp;
+}
+inline void MetaCmd_Init::set_allocated_options(::ZPMeta::TableOptions* options) {
+  delete options_;
+  options_ = options;
+  if (options) {
+    set_has_options();
+  } else {
+    clear_has_options();
+  }
+}
+
 // -------------------------------------------------------------------
 
 // MetaCmd_SetMaster
@@ -4056,6 +4410,28 @@ inline void MetaCmdResponse_Ping::set_version(::google::protobuf::int32 value) {
   version_ = value;
 }
 
+// optional int64 incarnation = 2;
+inline bool MetaCmdResponse_Ping::has_incarnation() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void MetaCmdResponse_Ping::set_has_incarnation() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void MetaCmdResponse_Ping::clear_has_incarnation() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void MetaCmdResponse_Ping::clear_incarnation() {
+  incarnation_ = GOOGLE_LONGLONG(0);
+  clear_has_incarnation();
+}
+inline ::google::protobuf::int64 MetaCmdResponse_Ping::incarnation() const {
+  return incarnation_;
+}
+inline void MetaCmdResponse_Ping::set_incarnation(::google::protobuf::int64 value) {
+  set_has_incarnation();
+  incarnation_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // MetaCmdResponse_Pull
@@ -4107,6 +4483,28 @@ MetaCmdResponse_Pull::mutable_info() {
   return &info_;
 }
 
+// optional int32 base = 3;
+inline bool MetaCmdResponse_Pull::has_base() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void MetaCmdResponse_Pull::set_has_base() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void MetaCmdResponse_Pull::clear_has_base() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void MetaCmdResponse_Pull::clear_base() {
+  base_ = 0;
+  clear_has_base();
+}
+inline ::google::protobuf::int32 MetaCmdResponse_Pull::base() const {
+  return base_;
+}
+inline void MetaCmdResponse_Pull::set_base(::google::protobuf::int32 value) {
+  set_has_base();
+  base_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // MetaCmdResponse_ListTable
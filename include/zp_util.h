@@ -1,6 +1,10 @@
 #ifndef INCLUDE_ZP_UTIL_H_
 #define INCLUDE_ZP_UTIL_H_
 
+#include <sched.h>
+#include <pthread.h>
+
+#include <atomic>
 #include <string>
 #include <glog/logging.h>
 
@@ -25,6 +29,27 @@ struct WorkerCronTask {
 void daemonize();
 void close_std();
 void create_pid_file();
+
+// Parses a conf core list like "0-7,16-23" into a cpu mask,
+// false on an empty or malformed list
+bool ParseCpuSet(const std::string& cpuset, cpu_set_t* mask);
+
+// Pins the calling thread to a conf core list for the current scope
+// and restores the previous mask on exit. Threads inherit the mask
+// of their creator, so holding this around a group's StartThread
+// calls pins the whole group; an empty list is a no-op
+class ScopedCpuSet {
+ public:
+  explicit ScopedCpuSet(const std::string& cpuset);
+  ~ScopedCpuSet();
+
+ private:
+  bool applied_;
+  cpu_set_t saved_;
+
+  ScopedCpuSet(const ScopedCpuSet&);
+  void operator=(const ScopedCpuSet&);
+};
 class FileLocker {
  public:
   explicit FileLocker(const std::string& file);
@@ -36,6 +61,32 @@ class FileLocker {
   const std::string file_;
 };
 
+// Node-wide coarse clock refreshed every millisecond by a ticker
+// thread, reading it is one relaxed atomic load. The data path uses
+// it instead of a clock syscall per request, vDSO does not cover
+// gettimeofday on every kernel we run
+class CoarseClock {
+ public:
+  static void Start();
+  static void Stop();
+
+  static uint64_t NowMicros() {
+    uint64_t us = now_us_.load(std::memory_order_relaxed);
+    // Fall back to the real clock when the ticker is not running,
+    // such as in the tools linking this file
+    return (us != 0) ? us : slash::NowMicros();
+  }
+  static time_t NowSeconds() {
+    return static_cast<time_t>(NowMicros() / 1000000);
+  }
+
+ private:
+  static void* Ticker(void* arg);
+  static std::atomic<uint64_t> now_us_;
+  static std::atomic<bool> running_;
+  static pthread_t tid_;
+};
+
 struct Statistic {
   std::string table_name;
   uint64_t last_querys;
@@ -52,4 +103,22 @@ struct Statistic {
   void Dump();
 };
 
+// Latency histogram with power-of-two buckets in us
+// Lock-free, cheap enough to record every command
+class LatencyHistogram {
+ public:
+  LatencyHistogram();
+
+  void Add(uint64_t duration_us);
+  uint64_t Count() const;
+  // Upper bound (us) of the bucket holding the given quantile,
+  // precise enough for percentile monitoring
+  uint64_t Quantile(double q) const;
+
+ private:
+  static const int kBucketNum = 32;
+  std::atomic<uint64_t> buckets_[kBucketNum];
+  std::atomic<uint64_t> count_;
+};
+
 #endif
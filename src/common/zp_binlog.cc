@@ -1,11 +1,32 @@
 #include "include/zp_binlog.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include <iostream>
 #include <string>
+#include <vector>
 #include <glog/logging.h>
 
+#include "include/zp_conf.h"
+#include "include/zp_crc32c.h"
+#include "pink/include/bg_thread.h"
+
 using slash::RWLock;
 
+extern ZpConf* g_zp_conf;
+
+// All binlogs share one background thread for their deferred
+// chores, pre-creating the next files and flushing manifests,
+// both rare enough per binlog to keep it mostly idle
+static pink::BGThread* BinlogBGThread() {
+  static pink::BGThread* thread = new pink::BGThread();
+  thread->StartThread();
+  return thread;
+}
+
 std::string NewFileName(const std::string& name, uint32_t current) {
   char buf[256];
   snprintf(buf, sizeof(buf), "%s%u", name.c_str(), current);
@@ -22,14 +43,29 @@ uint64_t BinlogBlockStart(uint64_t offset) {
 Version::Version(slash::RWFile *save)
   : pro_num_(0),
     pro_offset_(0),
-    save_(save) {
+    save_(save),
+    unsaved_batches_(0),
+    flush_pending_(false),
+    flush_outstanding_(0),
+    flush_cv_(&flush_mutex_) {
   pthread_rwlock_init(&rwlock_, NULL);
   assert(save_ != NULL);
   StableLoad();
 }
 
 Version::~Version() {
+  {
+    // A delayed flush task refers to this version, wait it out
+    slash::MutexLock l(&flush_mutex_);
+    flush_pending_ = false;
+    while (flush_outstanding_ > 0) {
+      flush_cv_.Wait();
+    }
+  }
   StableSave();
+  // The version must survive a clean shutdown even if the machine
+  // goes down before the kernel writes the mapping back
+  msync(save_->GetData(), sizeof(uint32_t) + sizeof(uint64_t), MS_SYNC);
   pthread_rwlock_destroy(&rwlock_);
 }
 
@@ -46,10 +82,50 @@ void Version::Fetch(uint32_t *num, uint64_t *offset) {
   *offset = pro_offset_;
 }
 
-inline void Version::Inc(uint64_t go_head) {
-  slash::RWLock(&rwlock_, true);
-  pro_offset_ += go_head;
-  StableSave();
+void Version::Inc(uint64_t go_head) {
+  bool schedule = false;
+  {
+    slash::RWLock l(&rwlock_, true);
+    pro_offset_ += go_head;
+    unsaved_batches_++;
+    if (unsaved_batches_ >= kVersionSaveBatchCount) {
+      StableSave();
+    } else {
+      schedule = true;
+    }
+  }
+  if (schedule) {
+    // Deadline for what is dirty in memory only,
+    // scheduled outside rwlock_ since DoFlush takes the locks
+    // the other way around
+    ScheduleFlush();
+  }
+}
+
+// Make sure a delayed flush is on its way, so a version becoming
+// dirty right before the writes pause still reaches the manifest
+void Version::ScheduleFlush() {
+  slash::MutexLock l(&flush_mutex_);
+  if (flush_pending_) {
+    return;
+  }
+  flush_pending_ = true;
+  flush_outstanding_++;
+  BinlogBGThread()->DelaySchedule(kVersionSaveIntervalMs, &DoFlush, this);
+}
+
+void Version::DoFlush(void* arg) {
+  Version* version = static_cast<Version*>(arg);
+  slash::MutexLock l(&version->flush_mutex_);
+  if (version->flush_pending_) {
+    version->flush_pending_ = false;
+    slash::RWLock lr(&version->rwlock_, true);
+    if (version->unsaved_batches_ > 0) {
+      version->StableSave();
+    }
+  }
+  version->flush_outstanding_--;
+  version->flush_cv_.Signal();
 }
 
 Status Version::StableLoad() {
@@ -65,6 +141,7 @@ Status Version::StableLoad() {
 }
 
 void Version::StableSave() {
+  unsaved_batches_ = 0;
   char *p = save_->GetData();
   memcpy(p, &pro_num_, sizeof(uint32_t));
   p += sizeof(uint32_t);
@@ -88,20 +165,41 @@ BinlogWriter::BinlogWriter(slash::WritableFile *queue)
     Load();
   }
 
+BinlogWriter::BinlogWriter()
+  :queue_(NULL),
+  block_offset_(0) {
+  }
+
 BinlogWriter::~BinlogWriter() {
 }
 
-void BinlogWriter::Load() {
+uint64_t BinlogWriter::Filesize() {
   assert(queue_ != NULL);
-  uint64_t filesize = queue_->Filesize();
+  return queue_->Filesize();
+}
+
+Status BinlogWriter::Append(const Slice& data) {
+  return queue_->Append(data);
+}
+
+Status BinlogWriter::Flush() {
+  return queue_->Flush();
+}
+
+Status BinlogWriter::Trim(uint64_t offset) {
+  return queue_->Trim(offset);
+}
+
+void BinlogWriter::Load() {
+  uint64_t filesize = Filesize();
   block_offset_ = filesize % kBlockSize;
 }
 
 Status BinlogWriter::Fallback(uint64_t offset) {
-  if (offset > queue_->Filesize()) {
+  if (offset > Filesize()) {
     return Status::EndFile("offset beyond file size");
   }
-  Status s = queue_->Trim(offset);
+  Status s = Trim(offset);
   if (s.ok()) {
     Load();
   }
@@ -120,7 +218,7 @@ Status BinlogWriter::Produce(const Slice &item, int64_t *write_size) {
     assert(leftover >= 0);
     if (static_cast<size_t>(leftover) <= kHeaderSize) {
       if (leftover > 0) {
-        queue_->Append(Slice("\x00\x00\x00\x00\x00\x00\x00", leftover));
+        Append(Slice("\x00\x00\x00\x00\x00\x00\x00\x00", leftover));
         *write_size += leftover;
       }
       block_offset_ = 0;
@@ -161,11 +259,17 @@ Status BinlogWriter::EmitPhysicalRecord(RecordType t, const char *ptr, size_t n,
     buf[2] = static_cast<char>(n >> 16);
     buf[3] = static_cast<char>(t);
 
-    s = queue_->Append(Slice(buf, kHeaderSize));
+    const uint32_t crc = Crc32c(ptr, n);
+    buf[4] = static_cast<char>(crc & 0xff);
+    buf[5] = static_cast<char>((crc >> 8) & 0xff);
+    buf[6] = static_cast<char>((crc >> 16) & 0xff);
+    buf[7] = static_cast<char>((crc >> 24) & 0xff);
+
+    s = Append(Slice(buf, kHeaderSize));
     if (s.ok()) {
-        s = queue_->Append(Slice(ptr, n));
+        s = Append(Slice(ptr, n));
         if (s.ok()) {
-            s = queue_->Flush();
+            s = Flush();
         }
     }
     block_offset_ += static_cast<int>(kHeaderSize + n);
@@ -189,7 +293,7 @@ Status BinlogWriter::AppendBlank(uint64_t len, int64_t* write_size) {
     assert(leftover >= 0);
     if (static_cast<size_t>(leftover) <= kHeaderSize) {
       if (leftover > 0) {
-        queue_->Append(Slice("\x00\x00\x00\x00\x00\x00\x00", leftover));
+        Append(Slice("\x00\x00\x00\x00\x00\x00\x00\x00", leftover));
         *write_size += leftover;
       }
       block_offset_ = 0;
@@ -206,6 +310,163 @@ Status BinlogWriter::AppendBlank(uint64_t len, int64_t* write_size) {
 }
 
 
+/**
+ * BinlogMmapWriter
+ */
+Status BinlogMmapWriter::Create(const std::string& filename,
+    uint64_t file_size, uint64_t offset, bool pre_created,
+    BinlogMmapWriter** wptr) {
+  *wptr = NULL;
+  BinlogMmapWriter* writer = new BinlogMmapWriter(filename, file_size);
+  Status s = writer->Open(offset, pre_created);
+  if (s.ok()) {
+    *wptr = writer;
+  } else {
+    delete writer;
+  }
+  return s;
+}
+
+// Reserve the blocks of a binlog file before it is ever written,
+// so the Open at roll time finds everything allocated already
+Status BinlogMmapWriter::Prealloc(const std::string& filename,
+    uint64_t file_size) {
+  // A stale file of the same name must not shine through,
+  // the pre-created file promises zero content
+  if (slash::FileExists(filename)) {
+    slash::DeleteFile(filename);
+  }
+  int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+  if (fd < 0) {
+    return Status::IOError("Failed to create binlog file " + filename);
+  }
+  int ret = posix_fallocate(fd, 0, file_size + kBinlogMmapExtendStep);
+  close(fd);
+  if (ret != 0) {
+    return Status::IOError("Failed to fallocate binlog file " + filename);
+  }
+  return Status::OK();
+}
+
+BinlogMmapWriter::BinlogMmapWriter(const std::string& filename,
+    uint64_t file_size)
+  : filename_(filename),
+  file_size_(file_size),
+  fd_(-1),
+  base_(NULL),
+  map_size_(0),
+  write_pos_(0) {
+  }
+
+BinlogMmapWriter::~BinlogMmapWriter() {
+  if (base_ != NULL) {
+    munmap(base_, map_size_);
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+}
+
+// Open the file for appending at offset through a writable mapping,
+// fallocated to full size upfront so no append waits on the
+// filesystem growing the file
+// Content beyond offset is dropped, it would read back as records
+// otherwise, except that a pre-created file holds zeros only and
+// none of its pages needs to be touched for that; on a crash
+// recovery Init has already walked offset forward to the last
+// intact record, so only a torn tail ever goes here
+Status BinlogMmapWriter::Open(uint64_t offset, bool pre_created) {
+  fd_ = open(filename_.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd_ < 0) {
+    return Status::IOError("Failed to open binlog file " + filename_);
+  }
+  struct stat sb;
+  if (fstat(fd_, &sb) != 0) {
+    return Status::IOError("Failed to stat binlog file " + filename_);
+  }
+  uint64_t old_size = sb.st_size;
+  if (!pre_created && old_size > offset) {
+    // The dropped tail comes back as unwritten extents with the
+    // fallocate below, reading as zeros without a page written
+    if (ftruncate(fd_, offset) != 0) {
+      return Status::IOError("Failed to truncate binlog file " + filename_);
+    }
+  }
+  uint64_t target = file_size_ + kBinlogMmapExtendStep;
+  if (target < offset) {
+    target = offset + kBinlogMmapExtendStep;
+  }
+  int ret = posix_fallocate(fd_, 0, target);
+  if (ret != 0) {
+    return Status::IOError("Failed to fallocate binlog file " + filename_);
+  }
+  void* ptr = mmap(NULL, target, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (ptr == MAP_FAILED) {
+    return Status::IOError("Failed to mmap binlog file " + filename_);
+  }
+  base_ = static_cast<char*>(ptr);
+  map_size_ = target;
+  write_pos_ = offset;
+  Load();
+  return Status::OK();
+}
+
+uint64_t BinlogMmapWriter::Filesize() {
+  return write_pos_;
+}
+
+Status BinlogMmapWriter::Append(const Slice& data) {
+  Status s = EnsureSpace(data.size());
+  if (!s.ok()) {
+    return s;
+  }
+  memcpy(base_ + write_pos_, data.data(), data.size());
+  write_pos_ += data.size();
+  return Status::OK();
+}
+
+// A write through the shared mapping is visible to the mapped
+// readers at once, there is no writer side buffer to empty
+Status BinlogMmapWriter::Flush() {
+  return Status::OK();
+}
+
+Status BinlogMmapWriter::Trim(uint64_t offset) {
+  // The dropped tail has to read back as zeros,
+  // readers would take it for records otherwise
+  memset(base_ + offset, 0, write_pos_ - offset);
+  write_pos_ = offset;
+  return Status::OK();
+}
+
+// Grow the file and the mapping for a batch overshooting the
+// fallocated size, only the one crossing the roll boundary
+// may ever need this
+Status BinlogMmapWriter::EnsureSpace(uint64_t len) {
+  if (write_pos_ + len <= map_size_) {
+    return Status::OK();
+  }
+  uint64_t target = map_size_;
+  while (target < write_pos_ + len) {
+    target += kBinlogMmapExtendStep;
+  }
+  int ret = posix_fallocate(fd_, 0, target);
+  if (ret != 0) {
+    return Status::IOError("Failed to extend binlog file " + filename_);
+  }
+  munmap(base_, map_size_);
+  base_ = NULL;
+  void* ptr = mmap(NULL, target, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (ptr == MAP_FAILED) {
+    map_size_ = 0;
+    return Status::IOError("Failed to mmap binlog file " + filename_);
+  }
+  base_ = static_cast<char*>(ptr);
+  map_size_ = target;
+  return Status::OK();
+}
+
+
 /**
  * BinlogReader
  */
@@ -292,20 +553,34 @@ Status BinlogReader::Seek(uint64_t offset) {
   }
   int64_t block_offset = offset % kBlockSize;
 
+  // Walk raw fragments instead of assembling whole records,
+  // the seek only needs the distance covered, not the payloads
+  bool inside_record = false;
   while (block_offset > 0) {
     uint64_t size = 0;
-    std::string tmp;
-    s = Consume(&size, &tmp);
-    if (s.ok() || s.IsIncomplete()) {
-      // Do nothing
-    } else if (s.IsEndFile()) {
-      return Status::InvalidArgument("Binlog offset beyond enf of file");
-    } else {
-      SkipNextBlock(&size);
+    slash::Slice fragment;
+    const uint32_t record_type = ReadPhysicalRecord(&size, &fragment);
+    switch (record_type) {
+      case kFullType:
+      case kLastType:
+        inside_record = false;
+        break;
+      case kFirstType:
+        inside_record = true;
+        break;
+      case kMiddleType:
+      case kEmptyType:
+        break;
+      case kEof:
+        return Status::InvalidArgument("Binlog offset beyond enf of file");
+      case kBadRecord:
+      default:
+        SkipNextBlock(&size);
+        inside_record = false;
     }
     block_offset -= size;
   }
-  if (block_offset != 0) {
+  if (block_offset != 0 || inside_record) {
     // offset not availible
     return Status::InvalidArgument("Binlog offset not available");
   }
@@ -342,6 +617,17 @@ unsigned int BinlogReader::ReadPhysicalRecord(uint64_t *size, slash::Slice *resu
   const uint32_t c = static_cast<uint32_t>(header[2]) & 0xff;
   const unsigned int type = header[3];
   const uint32_t length = a | (b << 8) | (c << 16);
+  // Pick the expected crc out before the payload read
+  // reuses the backing store
+  const uint32_t expected_crc = (static_cast<uint32_t>(header[4]) & 0xff)
+    | ((static_cast<uint32_t>(header[5]) & 0xff) << 8)
+    | ((static_cast<uint32_t>(header[6]) & 0xff) << 16)
+    | ((static_cast<uint32_t>(header[7]) & 0xff) << 24);
+
+  if (type == kZeroType && length == 0) {
+    // Fallocated tail of the file, nothing written here yet
+    return kEof;
+  }
 
   buffer_.clear();
   //s = queue_->Read(length, &buffer_, backing_store_, &actual_read);
@@ -353,6 +639,10 @@ unsigned int BinlogReader::ReadPhysicalRecord(uint64_t *size, slash::Slice *resu
   } else if (!s.ok()) {
     return kBadRecord;
   }
+  if (Crc32c(buffer_.data(), buffer_.size()) != expected_crc) {
+    LOG(WARNING) << "Binlog record crc mismatch, length: " << length;
+    return kBadRecord;
+  }
   *size += length;
   last_record_offset_ += length;
 
@@ -360,9 +650,264 @@ unsigned int BinlogReader::ReadPhysicalRecord(uint64_t *size, slash::Slice *resu
 }
 
 
+/**
+ * BinlogMmapReader
+ */
+Status BinlogMmapReader::Create(const std::string& filename,
+    BinlogMmapReader** rptr) {
+  *rptr = NULL;
+  BinlogMmapReader* reader = new BinlogMmapReader(filename);
+  Status s = reader->Open();
+  if (s.ok()) {
+    *rptr = reader;
+  } else {
+    delete reader;
+  }
+  return s;
+}
+
+BinlogMmapReader::BinlogMmapReader(const std::string& filename)
+  : filename_(filename),
+  fd_(-1),
+  base_(NULL),
+  map_size_(0),
+  pos_(0),
+  last_record_offset_(0) {
+  }
+
+BinlogMmapReader::~BinlogMmapReader() {
+  if (base_ != NULL) {
+    munmap(base_, map_size_);
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+}
+
+Status BinlogMmapReader::Open() {
+  fd_ = open(filename_.c_str(), O_RDONLY);
+  if (fd_ < 0) {
+    return Status::IOError("Failed to open binlog file " + filename_);
+  }
+  return Remap();
+}
+
+// Extend the mapping to the current file size,
+// required when the read position went beyond the mapped part
+// Invalidate the Slices handed out before
+Status BinlogMmapReader::Remap() {
+  struct stat sb;
+  if (fstat(fd_, &sb) != 0) {
+    return Status::IOError("Failed to stat binlog file " + filename_);
+  }
+  uint64_t new_size = sb.st_size;
+  if (new_size <= map_size_) {
+    // Not grown
+    return Status::OK();
+  }
+  if (base_ != NULL) {
+    munmap(base_, map_size_);
+    base_ = NULL;
+    map_size_ = 0;
+  }
+  void* ptr = mmap(NULL, new_size, PROT_READ, MAP_SHARED, fd_, 0);
+  if (ptr == MAP_FAILED) {
+    return Status::IOError("Failed to mmap binlog file " + filename_);
+  }
+  base_ = static_cast<char*>(ptr);
+  map_size_ = new_size;
+  // Binlog is consumed from head to tail
+  madvise(base_, map_size_, MADV_SEQUENTIAL);
+  return Status::OK();
+}
+
+void BinlogMmapReader::SkipNextBlock(uint64_t* size) {
+  int leftover = kBlockSize - last_record_offset_;
+  pos_ += leftover;
+  *size += leftover;
+  last_record_offset_ = 0;
+}
+
+// Same as BinlogReader::Consume, except that a record
+// held by one block is returned without copy
+Status BinlogMmapReader::Consume(uint64_t* size, Slice* item,
+    std::string* scratch) {
+  assert(size != NULL);
+
+  bool inside_record = false;
+  slash::Slice fragment;
+  while (true) {
+    const uint32_t record_type = ReadPhysicalRecord(size, &fragment);
+
+    switch (record_type) {
+      case kFullType:
+        if (inside_record) {
+          return Status::Incomplete("Not found end item");
+        }
+        *item = fragment;
+        return Status::OK();
+      case kFirstType:
+        if (inside_record) {
+          return Status::Incomplete("Not found end item");
+        }
+        inside_record = true;
+        scratch->assign(fragment.data(), fragment.size());
+        break;
+      case kMiddleType:
+        if (!inside_record) {
+          return Status::Incomplete("Not found first item");
+        }
+        scratch->append(fragment.data(), fragment.size());
+        break;
+      case kLastType:
+        if (!inside_record) {
+          return Status::Incomplete("Not found first item");
+        }
+        scratch->append(fragment.data(), fragment.size());
+        *item = Slice(scratch->data(), scratch->size());
+        return Status::OK();
+      case kEof:
+        return Status::EndFile("Eof");
+      case kBadRecord:
+        return Status::IOError("Data Corruption");
+      case kEmptyType:
+        return Status::Incomplete("Not found whole item");
+      default:
+        return Status::IOError("Unknow reason");
+    }
+  }
+  return Status::OK();
+}
+
+// Seek to the nearest item begin before offset
+// Same semantics as BinlogReader::Seek
+Status BinlogMmapReader::Seek(uint64_t offset) {
+  Status s = Remap();
+  if (!s.ok()) {
+    return s;
+  }
+  uint64_t start_block = BinlogBlockStart(offset);
+  if (start_block > map_size_) {
+    return Status::EndFile("Eof");
+  }
+  pos_ = start_block;
+  last_record_offset_ = 0;
+  int64_t block_offset = offset % kBlockSize;
+
+  // Walk raw fragments over the mapping without assembling records,
+  // so a reconnect storm of seeks costs header parsing only
+  bool inside_record = false;
+  while (block_offset > 0) {
+    uint64_t size = 0;
+    slash::Slice fragment;
+    const uint32_t record_type = ReadPhysicalRecord(&size, &fragment);
+    switch (record_type) {
+      case kFullType:
+      case kLastType:
+        inside_record = false;
+        break;
+      case kFirstType:
+        inside_record = true;
+        break;
+      case kMiddleType:
+      case kEmptyType:
+        break;
+      case kEof:
+        return Status::InvalidArgument("Binlog offset beyond enf of file");
+      case kBadRecord:
+      default:
+        SkipNextBlock(&size);
+        inside_record = false;
+    }
+    block_offset -= size;
+  }
+  if (block_offset != 0 || inside_record) {
+    // offset not availible
+    return Status::InvalidArgument("Binlog offset not available");
+  }
+  return Status::OK();
+}
+
+unsigned int BinlogMmapReader::ReadPhysicalRecord(uint64_t *size,
+    slash::Slice *result) {
+  int leftover = kBlockSize - last_record_offset_;
+  if (leftover <= static_cast<int>(kHeaderSize)) {
+    pos_ += leftover;
+    *size += leftover;
+    last_record_offset_ = 0;
+  }
+
+  if (pos_ + kHeaderSize > map_size_) {
+    // The writer may have gone ahead of the mapped part
+    Remap();
+    if (pos_ + kHeaderSize > map_size_) {
+      return kEof;
+    }
+  }
+
+  const char* header = base_ + pos_;
+  const uint32_t a = static_cast<uint32_t>(header[0]) & 0xff;
+  const uint32_t b = static_cast<uint32_t>(header[1]) & 0xff;
+  const uint32_t c = static_cast<uint32_t>(header[2]) & 0xff;
+  const unsigned int type = header[3];
+  const uint32_t length = a | (b << 8) | (c << 16);
+  const uint32_t expected_crc = (static_cast<uint32_t>(header[4]) & 0xff)
+    | ((static_cast<uint32_t>(header[5]) & 0xff) << 8)
+    | ((static_cast<uint32_t>(header[6]) & 0xff) << 16)
+    | ((static_cast<uint32_t>(header[7]) & 0xff) << 24);
+
+  if (type == kZeroType && length == 0) {
+    // Fallocated tail of the file, nothing written here yet,
+    // the position holds so a retry sees what the writer adds
+    return kEof;
+  }
+
+  if (pos_ + kHeaderSize + length > map_size_) {
+    // Record body is not completely written yet
+    Remap();
+    if (pos_ + kHeaderSize + length > map_size_) {
+      return kEof;
+    }
+  }
+
+  if (Crc32c(base_ + pos_ + kHeaderSize, length) != expected_crc) {
+    LOG(WARNING) << "Binlog record crc mismatch, length: " << length;
+    return kBadRecord;
+  }
+
+  *result = slash::Slice(base_ + pos_ + kHeaderSize, length);
+  pos_ += kHeaderSize + length;
+  *size += kHeaderSize + length;
+  last_record_offset_ += kHeaderSize + length;
+
+  return type;
+}
+
 /*
  * Binlog
  */
+
+// Argument of the pre-creation task on the shared thread
+struct BinlogPreallocArg {
+  Binlog* binlog;
+  uint32_t filenum;
+};
+
+// Record waiting in the group commit queue
+// The writer in the front of the queue is the leader,
+// who flushes all the records pending so far as one batch
+struct Binlog::Writer {
+  std::vector<Slice> items;
+  Status status;
+  bool done;
+  slash::CondVar cv;
+
+  explicit Writer(slash::Mutex* mu)
+    : done(false),
+    cv(mu) {
+  }
+};
+
 Status Binlog::Create(const std::string& binlog_path,
     int file_size, Binlog** bptr) {
   *bptr = NULL;
@@ -381,7 +926,6 @@ Status Binlog::Init() {
   slash::CreateDir(binlog_path_);
   
   Status s;
-  std::string binlog_name;
   const std::string manifest = binlog_path_ + kManifest;
   if (!slash::FileExists(manifest)) {
     // No Manifest file exist, may be the first time
@@ -396,14 +940,10 @@ Status Binlog::Init() {
     version_ = new Version(manifest_);
 
     // Create Binlog
-    binlog_name = NewFileName(filename_, 0);
-    s = slash::NewWritableFile(binlog_name, &queue_);
+    s = NewWriter(0, 0, false);
     if (!s.ok()) {
-      LOG(WARNING) << "Failed to create new binlog file: "
-        << binlog_name << " " << s.ToString();
       return s;
     }
-    writer_ = new BinlogWriter(queue_);
 
   } else {
     // Manifest exist
@@ -422,14 +962,27 @@ Status Binlog::Init() {
     uint32_t file_num = 0;
     uint64_t file_offset = 0;
     version_->Fetch(&file_num, &file_offset);
-    binlog_name = NewFileName(filename_, file_num);
-    s = slash::AppendWritableFile(binlog_name, &queue_, file_offset);
+
+    // The manifest is persisted in batches and may lag the file by up
+    // to kVersionSaveBatchCount records after a crash; every record
+    // carries a crc frame, so walk forward to the end of the last
+    // intact record and adopt that as the tail, instead of letting
+    // the writer truncate committed and possibly replica-acked
+    // records back to the stale offset
+    uint64_t recovered_offset = file_offset;
+    if (RecoverTail(file_num, file_offset, &recovered_offset)
+        && recovered_offset > file_offset) {
+      LOG(INFO) << "Binlog manifest lags binlog " << file_num
+        << ", recovered offset " << recovered_offset
+        << " from " << file_offset;
+      version_->Save(file_num, recovered_offset);
+      file_offset = recovered_offset;
+    }
+
+    s = NewWriter(file_num, file_offset, true);
     if (!s.ok()) {
-      LOG(WARNING) << "Failed to open binlog file: "
-        << binlog_name << " " << s.ToString();
       return s;
     }
-    writer_ = new BinlogWriter(queue_);
   }
   return Status::OK();
 }
@@ -437,50 +990,317 @@ Status Binlog::Init() {
 Binlog::Binlog(const std::string& binlog_path, const int file_size)
   : binlog_path_(binlog_path),
   file_size_(file_size),
+  cache_bytes_(0),
   manifest_(NULL),
   version_(NULL),
   queue_(NULL),
-  writer_(NULL) {
+  writer_(NULL),
+  prealloc_(g_zp_conf->binlog_prealloc()),
+  prealloc_cv_(&prealloc_mutex_),
+  prealloc_num_(-1),
+  prealloc_done_(false),
+  prealloc_outstanding_(0) {
     if (binlog_path_.back() != '/') {
       binlog_path_.append(1, '/');
     }
     filename_ = binlog_path_ + kBinlogPrefix;
 }
 
+// Scan binlog file filenum forward from offset, a record boundary by
+// construction, and report the end of its last intact record
+// Only whole crc-verified records advance the tail, so a write torn
+// by the crash stays cut off; rolls persist the manifest in place,
+// the lag never spans into another file
+bool Binlog::RecoverTail(uint32_t filenum, uint64_t offset,
+    uint64_t* tail) {
+  std::string profile = NewFileName(filename_, filenum);
+  if (!slash::FileExists(profile)) {
+    return false;
+  }
+  BinlogMmapReader* reader = NULL;
+  Status s = BinlogMmapReader::Create(profile, &reader);
+  if (!s.ok()) {
+    LOG(WARNING) << "Failed to open binlog " << profile
+      << " for tail recovery: " << s.ToString();
+    return false;
+  }
+  s = reader->Seek(offset);
+  if (!s.ok()) {
+    delete reader;
+    return false;
+  }
+  *tail = offset;
+  Slice item;
+  std::string scratch;
+  while (true) {
+    uint64_t size = 0;
+    s = reader->Consume(&size, &item, &scratch);
+    if (!s.ok()) {
+      break;
+    }
+    *tail += size;
+  }
+  delete reader;
+  return true;
+}
+
 Binlog::~Binlog() {
+  {
+    // A queued pre-creation task refers to this binlog, wait it out
+    slash::MutexLock l(&prealloc_mutex_);
+    prealloc_num_ = -1;
+    while (prealloc_outstanding_ > 0) {
+      prealloc_cv_.Wait();
+    }
+  }
   delete writer_;
   delete queue_;
   delete version_;
   delete manifest_;
 }
 
+// Open binlog file filenum for appending at offset in the
+// configured writer mode, replacing the writer in hand
+// append matters for the buffered mode only, the mapped writer
+// always resumes in place
+// Required hold mutex_
+Status Binlog::NewWriter(uint32_t filenum, uint64_t offset, bool append) {
+  delete writer_;
+  writer_ = NULL;
+  delete queue_;
+  queue_ = NULL;
+
+  Status s;
+  std::string profile = NewFileName(filename_, filenum);
+  if (prealloc_) {
+    BinlogMmapWriter* writer = NULL;
+    s = BinlogMmapWriter::Create(profile, file_size_, offset,
+        TakePrealloc(filenum), &writer);
+    writer_ = writer;
+  } else if (append) {
+    s = slash::AppendWritableFile(profile, &queue_, offset);
+    if (s.ok()) {
+      writer_ = new BinlogWriter(queue_);
+    }
+  } else {
+    s = slash::NewWritableFile(profile, &queue_);
+    if (s.ok()) {
+      writer_ = new BinlogWriter(queue_);
+    }
+  }
+  if (s.ok()) {
+    // Get the file after the next roll ready in the background
+    PreallocAhead(filenum + 1);
+  } else {
+    LOG(WARNING) << "Failed to open binlog file: "
+      << profile << " " << s.ToString();
+  }
+  return s;
+}
+
+// Pre-create binlog file filenum on the shared background thread,
+// the roll into it then creates nothing in the foreground
+void Binlog::PreallocAhead(uint32_t filenum) {
+  if (!prealloc_) {
+    return;
+  }
+  slash::MutexLock l(&prealloc_mutex_);
+  if (prealloc_num_ == static_cast<int64_t>(filenum)) {
+    // Done or underway already
+    return;
+  }
+  prealloc_num_ = filenum;
+  prealloc_done_ = false;
+  prealloc_outstanding_++;
+  BinlogPreallocArg* arg = new BinlogPreallocArg();
+  arg->binlog = this;
+  arg->filenum = filenum;
+  BinlogBGThread()->Schedule(&DoPrealloc, arg);
+}
+
+void Binlog::DoPrealloc(void* arg) {
+  BinlogPreallocArg* parg = static_cast<BinlogPreallocArg*>(arg);
+  Binlog* binlog = parg->binlog;
+  slash::MutexLock l(&binlog->prealloc_mutex_);
+  if (binlog->prealloc_num_ == static_cast<int64_t>(parg->filenum)
+      && !binlog->prealloc_done_) {
+    // Holding prealloc_mutex_ across the file creation,
+    // a roll taking the file meanwhile waits for it to be complete
+    // instead of racing on the same name
+    Status s = BinlogMmapWriter::Prealloc(
+        NewFileName(binlog->filename_, parg->filenum), binlog->file_size_);
+    if (s.ok()) {
+      binlog->prealloc_done_ = true;
+    } else {
+      LOG(WARNING) << "Failed to prealloc binlog file: " << s.ToString();
+      binlog->prealloc_num_ = -1;
+    }
+  }
+  binlog->prealloc_outstanding_--;
+  binlog->prealloc_cv_.Signal();
+  delete parg;
+}
+
+// Whether filenum was pre-created by the background task,
+// consuming the slot either way so a task still queued for it
+// leaves the file alone
+bool Binlog::TakePrealloc(uint32_t filenum) {
+  if (!prealloc_) {
+    return false;
+  }
+  slash::MutexLock l(&prealloc_mutex_);
+  if (prealloc_num_ != static_cast<int64_t>(filenum)) {
+    return false;
+  }
+  bool done = prealloc_done_;
+  prealloc_num_ = -1;
+  prealloc_done_ = false;
+  return done;
+}
+
 // Required hold mutex_
 void Binlog::MaybeRoll() {
   /* Check to roll log file */
-  uint64_t filesize = queue_->Filesize();
+  uint64_t filesize = writer_->Filesize();
   if (filesize > file_size_) {
-    delete queue_;
-    delete writer_;
-
     uint32_t pro_num = version_->pro_num() + 1;
-    std::string profile = NewFileName(filename_, pro_num);
-    slash::NewWritableFile(profile, &queue_);
-    writer_ = new BinlogWriter(queue_);
+    NewWriter(pro_num, 0, false);
     version_->Save(pro_num, 0);
   }
 }
 
 Status Binlog::Put(const std::string &item) {
-  slash::MutexLock l(&mutex_);
+  Writer w(&writers_mutex_);
+  w.items.push_back(Slice(item.data(), item.size()));
+  return PutWriter(&w);
+}
 
-  int64_t go_ahead = 0;
-  Status s = writer_->Produce(Slice(item.data(), item.size()), &go_ahead);
-  version_->Inc(go_ahead);
-  MaybeRoll();
-  if (!s.ok()) {
-    LOG(WARNING) << "Binlog write failed: " << s.ToString();
+Status Binlog::Put(const Slice &item) {
+  Writer w(&writers_mutex_);
+  w.items.push_back(item);
+  return PutWriter(&w);
+}
+
+// Put multiple records as one batch,
+// they share one flush and one version update,
+// while each record keeps its own frame and thus its own offset
+Status Binlog::Put(const std::vector<std::string> &items) {
+  Writer w(&writers_mutex_);
+  w.items.reserve(items.size());
+  for (size_t i = 0; i < items.size(); i++) {
+    w.items.push_back(Slice(items[i].data(), items[i].size()));
   }
-  return s;
+  return PutWriter(&w);
+}
+
+Status Binlog::PutWriter(Writer* w) {
+  writers_mutex_.Lock();
+  writers_.push_back(w);
+  while (!w->done && w != writers_.front()) {
+    w->cv.Wait();
+  }
+  if (w->done) {
+    // Already flushed by a former leader
+    writers_mutex_.Unlock();
+    return w->status;
+  }
+
+  // Became the leader, snapshot the records pending so far,
+  // new writers could still join the queue during the flush
+  std::vector<Writer*> batch(writers_.begin(), writers_.end());
+  writers_mutex_.Unlock();
+
+  {
+    slash::MutexLock l(&mutex_);
+    uint32_t cache_filenum = 0;
+    uint64_t cache_offset = 0;
+    version_->Fetch(&cache_filenum, &cache_offset);
+    int64_t batch_ahead = 0;
+    for (size_t i = 0; i < batch.size(); i++) {
+      batch[i]->status = Status::OK();
+      for (size_t j = 0; j < batch[i]->items.size(); j++) {
+        int64_t go_ahead = 0;
+        Status ps = writer_->Produce(batch[i]->items[j], &go_ahead);
+        if (ps.ok()) {
+          // Keep the fresh written record in the tail cache
+          PushCache(cache_filenum, cache_offset, go_ahead,
+              batch[i]->items[j]);
+        } else {
+          LOG(WARNING) << "Binlog write failed: " << ps.ToString();
+          batch[i]->status = ps;
+        }
+        cache_offset += go_ahead;
+        batch_ahead += go_ahead;
+      }
+    }
+    // One version update for the whole batch
+    version_->Inc(batch_ahead);
+    MaybeRoll();
+  }
+
+  writers_mutex_.Lock();
+  for (size_t i = 0; i < batch.size(); i++) {
+    writers_.pop_front();
+    if (batch[i] != w) {
+      batch[i]->done = true;
+      batch[i]->cv.Signal();
+    }
+  }
+  if (!writers_.empty()) {
+    // Wake up the next leader
+    writers_.front()->cv.Signal();
+  }
+  writers_mutex_.Unlock();
+
+  return w->status;
+}
+
+Status Binlog::GetCached(uint32_t filenum, uint64_t offset,
+    std::string* item, uint64_t* length) {
+  slash::MutexLock l(&cache_mutex_);
+  // Binary search since entries are ordered by (filenum, offset)
+  size_t left = 0, right = tail_cache_.size();
+  while (left < right) {
+    size_t mid = left + (right - left) / 2;
+    const CacheEntry& entry = tail_cache_[mid];
+    if (entry.filenum < filenum
+        || (entry.filenum == filenum && entry.offset < offset)) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+  if (left == tail_cache_.size()
+      || tail_cache_[left].filenum != filenum
+      || tail_cache_[left].offset != offset) {
+    return Status::NotFound("Not in binlog tail cache");
+  }
+  *item = tail_cache_[left].item;
+  *length = tail_cache_[left].length;
+  return Status::OK();
+}
+
+void Binlog::PushCache(uint32_t filenum, uint64_t offset,
+    uint64_t length, const Slice& item) {
+  slash::MutexLock l(&cache_mutex_);
+  tail_cache_.push_back(CacheEntry());
+  CacheEntry& entry = tail_cache_.back();
+  entry.filenum = filenum;
+  entry.offset = offset;
+  entry.length = length;
+  entry.item.assign(item.data(), item.size());
+  cache_bytes_ += item.size();
+  // Evict from the head to keep only the tail part
+  while (cache_bytes_ > kBinlogTailCacheSize && !tail_cache_.empty()) {
+    cache_bytes_ -= tail_cache_.front().item.size();
+    tail_cache_.pop_front();
+  }
+}
+
+void Binlog::ClearCache() {
+  slash::MutexLock l(&cache_mutex_);
+  tail_cache_.clear();
+  cache_bytes_ = 0;
 }
 
 // Fill binlog with emtpy record whose length is len
@@ -531,12 +1351,7 @@ Status Binlog::SetProducerStatus(uint32_t pro_num, uint64_t pro_offset,
   // Create binlog file if needed
   version_->Fetch(cur_num, cur_offset);
   if (*cur_num != pro_num) {
-    delete queue_;
-    delete writer_;
-
-    std::string profile = NewFileName(filename_, pro_num);
-    slash::NewWritableFile(profile, &queue_);
-    writer_ = new BinlogWriter(queue_);
+    NewWriter(pro_num, 0, false);
     *cur_offset = 0;
   }
 
@@ -560,5 +1375,8 @@ Status Binlog::SetProducerStatus(uint32_t pro_num, uint64_t pro_offset,
   }
   *actual_offset = pro_offset;
 
+  // Cached records beyond the new point become invalid
+  ClearCache();
+
   return s;
 }
@@ -1,5 +1,7 @@
 #include "include/zp_conf.h"
 
+#include "include/zp_compress.h"
+
 //TODO wangkang-xy add int64 after update slash
 //#define READCONFINT64(reader, attr, value) 
 //  reader.GetConfInt64(std::string(#attr), &value)
@@ -41,15 +43,36 @@ ZpConf::ZpConf() {
   meta_thread_num_ = 4;
   data_thread_num_ = 6;
   sync_recv_thread_num_ = 4;
+  sync_apply_thread_num_ = 1;
   sync_send_thread_num_ = 4;
   max_background_flushes_ = 24;
   max_background_compactions_ = 24;
+  db_rate_limit_ = 0; // MB/s, 0 means unlimited
   db_write_buffer_size_ = 256 * 1024; // 256M
   db_max_write_buffer_ = 20 * 1024 * 1024; // 20G
   db_target_file_size_base_ = 256 * 1024; // 256M
   db_max_open_files_ = 4096;
   db_block_size_ = 16; // 16K
+  db_block_cache_size_ = 8 * 1024 * 1024; // 8G
+  partition_open_thread_num_ = 8;
+  db_sync_stream_num_ = 4;
+  db_sync_speed_ = 126; // MB/s
+  sync_lease_min_ = 20;
+  sync_lease_max_ = 300;
+  recover_sync_delay_ = 14;
+  stuck_recover_sync_delay_ = 900;
+  bgsave_thread_num_ = 4;
+  bgpurge_thread_num_ = 2;
+  purge_files_per_sec_ = 5;
+  purge_mb_per_sec_ = 500;
+  purge_defer_qps_ = 100000;
+  binlog_archive_mb_ = 0;
   slowlog_slower_than_ = -1;
+  compress_value_ = kCompressNone;
+  binlog_prealloc_ = true;
+  data_thread_cpuset_ = std::string();
+  sync_thread_cpuset_ = std::string();
+  background_thread_cpuset_ = std::string();
 }
 
 ZpConf::~ZpConf() {
@@ -74,15 +97,36 @@ void ZpConf::Dump() const {
   fprintf (stderr, "    Config.meta_thread_num    : %d\n", meta_thread_num_);
   fprintf (stderr, "    Config.data_thread_num    : %d\n", data_thread_num_);
   fprintf (stderr, "    Config.sync_recv_thread_num   : %d\n", sync_recv_thread_num_);
+  fprintf (stderr, "    Config.sync_apply_thread_num   : %d\n", sync_apply_thread_num_);
   fprintf (stderr, "    Config.sync_send_thread_num   : %d\n", sync_send_thread_num_);
+  fprintf (stderr, "    Config.data_thread_cpuset   : %s\n", data_thread_cpuset_.c_str());
+  fprintf (stderr, "    Config.sync_thread_cpuset   : %s\n", sync_thread_cpuset_.c_str());
+  fprintf (stderr, "    Config.background_thread_cpuset   : %s\n", background_thread_cpuset_.c_str());
   fprintf (stderr, "    Config.max_background_flushes    : %d\n", max_background_flushes_);
   fprintf (stderr, "    Config.max_background_compactions   : %d\n", max_background_compactions_);
+  fprintf (stderr, "    Config.db_rate_limit   : %dMB/s\n", db_rate_limit_);
   fprintf (stderr, "    Config.db_write_buffer_size   : %dKB\n", db_write_buffer_size_);
   fprintf (stderr, "    Config.db_max_write_buffer   : %dKB\n", db_max_write_buffer_);
   fprintf (stderr, "    Config.db_target_file_size_base   : %dKB\n", db_target_file_size_base_);
   fprintf (stderr, "    Config.db_max_open_files   : %d\n", db_max_open_files_);
   fprintf (stderr, "    Config.db_block_size   : %dKB\n", db_block_size_);
+  fprintf (stderr, "    Config.db_block_cache_size   : %dKB\n", db_block_cache_size_);
+  fprintf (stderr, "    Config.partition_open_thread_num   : %d\n", partition_open_thread_num_);
+  fprintf (stderr, "    Config.db_sync_stream_num   : %d\n", db_sync_stream_num_);
+  fprintf (stderr, "    Config.db_sync_speed   : %dMB/s\n", db_sync_speed_);
+  fprintf (stderr, "    Config.sync_lease_min   : %ds\n", sync_lease_min_);
+  fprintf (stderr, "    Config.sync_lease_max   : %ds\n", sync_lease_max_);
+  fprintf (stderr, "    Config.recover_sync_delay   : %ds\n", recover_sync_delay_);
+  fprintf (stderr, "    Config.stuck_recover_sync_delay   : %ds\n", stuck_recover_sync_delay_);
+  fprintf (stderr, "    Config.bgsave_thread_num   : %d\n", bgsave_thread_num_);
+  fprintf (stderr, "    Config.bgpurge_thread_num   : %d\n", bgpurge_thread_num_);
+  fprintf (stderr, "    Config.purge_files_per_sec   : %d\n", purge_files_per_sec_);
+  fprintf (stderr, "    Config.purge_mb_per_sec   : %dMB/s\n", purge_mb_per_sec_);
+  fprintf (stderr, "    Config.purge_defer_qps   : %d\n", purge_defer_qps_);
+  fprintf (stderr, "    Config.binlog_archive_mb   : %dMB\n", binlog_archive_mb_);
   fprintf (stderr, "    Config.slowlog_slower_than   : %d\n", slowlog_slower_than_);
+  fprintf (stderr, "    Config.compress_value   : %s\n", CompressCodecName(compress_value_));
+  fprintf (stderr, "    Config.binlog_prealloc   : %s\n", binlog_prealloc_? "true":"false");
 }
 
 int ZpConf::Load(const std::string& path) {
@@ -91,6 +135,7 @@ int ZpConf::Load(const std::string& path) {
   if (res != 0) {
     return res;
   }
+  conf_path_ = path;
 
   bool ret = false;
   READCONF(conf_reader, local_ip, local_ip_, STR);
@@ -104,15 +149,38 @@ int ZpConf::Load(const std::string& path) {
   READCONF(conf_reader, meta_thread_num, meta_thread_num_, INT);
   READCONF(conf_reader, data_thread_num, data_thread_num_, INT);
   READCONF(conf_reader, sync_recv_thread_num, sync_recv_thread_num_, INT);
+  READCONF(conf_reader, sync_apply_thread_num, sync_apply_thread_num_, INT);
   READCONF(conf_reader, sync_send_thread_num, sync_send_thread_num_, INT);
+  READCONF(conf_reader, data_thread_cpuset, data_thread_cpuset_, STR);
+  READCONF(conf_reader, sync_thread_cpuset, sync_thread_cpuset_, STR);
+  READCONF(conf_reader, background_thread_cpuset, background_thread_cpuset_, STR);
   READCONF(conf_reader, max_background_flushes, max_background_flushes_, INT);
   READCONF(conf_reader, max_background_compactions, max_background_compactions_, INT);
+  READCONF(conf_reader, db_rate_limit, db_rate_limit_, INT);
   READCONF(conf_reader, db_write_buffer_size, db_write_buffer_size_, INT);
   READCONF(conf_reader, db_max_write_buffer, db_max_write_buffer_, INT);
   READCONF(conf_reader, db_target_file_size_base, db_target_file_size_base_, INT);
   READCONF(conf_reader, db_max_open_files, db_max_open_files_, INT);
   READCONF(conf_reader, db_block_size, db_block_size_, INT);
+  READCONF(conf_reader, db_block_cache_size, db_block_cache_size_, INT);
+  READCONF(conf_reader, partition_open_thread_num, partition_open_thread_num_, INT);
+  READCONF(conf_reader, db_sync_stream_num, db_sync_stream_num_, INT);
+  READCONF(conf_reader, db_sync_speed, db_sync_speed_, INT);
+  READCONF(conf_reader, sync_lease_min, sync_lease_min_, INT);
+  READCONF(conf_reader, sync_lease_max, sync_lease_max_, INT);
+  READCONF(conf_reader, recover_sync_delay, recover_sync_delay_, INT);
+  READCONF(conf_reader, stuck_recover_sync_delay, stuck_recover_sync_delay_, INT);
+  READCONF(conf_reader, bgsave_thread_num, bgsave_thread_num_, INT);
+  READCONF(conf_reader, bgpurge_thread_num, bgpurge_thread_num_, INT);
+  READCONF(conf_reader, purge_files_per_sec, purge_files_per_sec_, INT);
+  READCONF(conf_reader, purge_mb_per_sec, purge_mb_per_sec_, INT);
+  READCONF(conf_reader, purge_defer_qps, purge_defer_qps_, INT);
+  READCONF(conf_reader, binlog_archive_mb, binlog_archive_mb_, INT);
   READCONF(conf_reader, slowlog_slower_than, slowlog_slower_than_, INT);
+  std::string compress_value_str;
+  READCONF(conf_reader, compress_value, compress_value_str, STR);
+  compress_value_ = CompressCodecFromString(compress_value_str);
+  READCONF(conf_reader, binlog_prealloc, binlog_prealloc_, BOOL);
   if (data_path_.back() != '/') {
     data_path_.append("/");
   }
@@ -130,13 +198,82 @@ int ZpConf::Load(const std::string& path) {
   meta_thread_num_ = BoundaryLimit(meta_thread_num_, 1, 100);
   data_thread_num_ = BoundaryLimit(data_thread_num_, 1, 100);
   sync_recv_thread_num_ = BoundaryLimit(sync_recv_thread_num_, 1, 100);
+  sync_apply_thread_num_ = BoundaryLimit(sync_apply_thread_num_, 1, 16);
   sync_send_thread_num_ = BoundaryLimit(sync_send_thread_num_, 1, 100);
   max_background_flushes_ = BoundaryLimit(max_background_flushes_, 10, 100);
   max_background_compactions_ = BoundaryLimit(max_background_compactions_, 10, 100);
+  db_rate_limit_ = BoundaryLimit(db_rate_limit_, 0, 10240); // 0 means unlimited
   slowlog_slower_than_ = BoundaryLimit(slowlog_slower_than_, -1, 10000000);
   db_write_buffer_size_ = BoundaryLimit(db_write_buffer_size_, 4 * 1024, 10 * 1024 * 1024); // 4M ~ 10G
   db_max_write_buffer_ = BoundaryLimit(db_max_write_buffer_, 1024 * 1024, 500 * 1024 * 1024); // 1G ~ 500G
   db_target_file_size_base_ = BoundaryLimit(db_target_file_size_base_, 4 * 1024, 10 * 1024 * 1024); // 4M ~ 10G
   db_block_size_ = BoundaryLimit(db_block_size_, 4, 1024 * 1024); // 14K ~ 1G
+  db_block_cache_size_ = BoundaryLimit(db_block_cache_size_, 64 * 1024, 200 * 1024 * 1024); // 64M ~ 200G
+  partition_open_thread_num_ = BoundaryLimit(partition_open_thread_num_, 1, 100);
+  db_sync_stream_num_ = BoundaryLimit(db_sync_stream_num_, 1, 16);
+  db_sync_speed_ = BoundaryLimit(db_sync_speed_, 1, 1024); // 1M/s ~ 1G/s
+  sync_lease_min_ = BoundaryLimit(sync_lease_min_, 1, 3600);
+  sync_lease_max_ = BoundaryLimit(sync_lease_max_, sync_lease_min_, 3600);
+  recover_sync_delay_ = BoundaryLimit(recover_sync_delay_, 2, 3600);
+  stuck_recover_sync_delay_ = BoundaryLimit(stuck_recover_sync_delay_, recover_sync_delay_, 36000);
+  bgsave_thread_num_ = BoundaryLimit(bgsave_thread_num_, 1, 16);
+  bgpurge_thread_num_ = BoundaryLimit(bgpurge_thread_num_, 1, 16);
+  purge_files_per_sec_ = BoundaryLimit(purge_files_per_sec_, 1, 1000);
+  purge_mb_per_sec_ = BoundaryLimit(purge_mb_per_sec_, 1, 10240);
+  purge_defer_qps_ = BoundaryLimit(purge_defer_qps_, -1, 10000000);
+  binlog_archive_mb_ = BoundaryLimit(binlog_archive_mb_, 0, 10 * 1024 * 1024); // up to 10T
+  return res;
+}
+
+int ZpConf::Reload() {
+  slash::BaseConf conf_reader(conf_path_);
+  int res = conf_reader.LoadConf();
+  if (res != 0) {
+    return res;
+  }
+
+  bool ret = false;
+  RWLock l(&rwlock_, true);
+  READCONF(conf_reader, max_background_flushes, max_background_flushes_, INT);
+  READCONF(conf_reader, max_background_compactions, max_background_compactions_, INT);
+  READCONF(conf_reader, db_rate_limit, db_rate_limit_, INT);
+  READCONF(conf_reader, db_write_buffer_size, db_write_buffer_size_, INT);
+  READCONF(conf_reader, db_target_file_size_base, db_target_file_size_base_, INT);
+  READCONF(conf_reader, db_sync_stream_num, db_sync_stream_num_, INT);
+  READCONF(conf_reader, db_sync_speed, db_sync_speed_, INT);
+  READCONF(conf_reader, sync_lease_min, sync_lease_min_, INT);
+  READCONF(conf_reader, sync_lease_max, sync_lease_max_, INT);
+  READCONF(conf_reader, recover_sync_delay, recover_sync_delay_, INT);
+  READCONF(conf_reader, stuck_recover_sync_delay, stuck_recover_sync_delay_, INT);
+  READCONF(conf_reader, bgsave_thread_num, bgsave_thread_num_, INT);
+  READCONF(conf_reader, bgpurge_thread_num, bgpurge_thread_num_, INT);
+  READCONF(conf_reader, purge_files_per_sec, purge_files_per_sec_, INT);
+  READCONF(conf_reader, purge_mb_per_sec, purge_mb_per_sec_, INT);
+  READCONF(conf_reader, purge_defer_qps, purge_defer_qps_, INT);
+  READCONF(conf_reader, binlog_archive_mb, binlog_archive_mb_, INT);
+  READCONF(conf_reader, slowlog_slower_than, slowlog_slower_than_, INT);
+  std::string compress_value_str;
+  READCONF(conf_reader, compress_value, compress_value_str, STR);
+  compress_value_ = CompressCodecFromString(compress_value_str);
+  READCONF(conf_reader, binlog_prealloc, binlog_prealloc_, BOOL);
+
+  max_background_flushes_ = BoundaryLimit(max_background_flushes_, 10, 100);
+  max_background_compactions_ = BoundaryLimit(max_background_compactions_, 10, 100);
+  db_rate_limit_ = BoundaryLimit(db_rate_limit_, 0, 10240); // 0 means unlimited
+  slowlog_slower_than_ = BoundaryLimit(slowlog_slower_than_, -1, 10000000);
+  db_write_buffer_size_ = BoundaryLimit(db_write_buffer_size_, 4 * 1024, 10 * 1024 * 1024); // 4M ~ 10G
+  db_target_file_size_base_ = BoundaryLimit(db_target_file_size_base_, 4 * 1024, 10 * 1024 * 1024); // 4M ~ 10G
+  db_sync_stream_num_ = BoundaryLimit(db_sync_stream_num_, 1, 16);
+  db_sync_speed_ = BoundaryLimit(db_sync_speed_, 1, 1024); // 1M/s ~ 1G/s
+  sync_lease_min_ = BoundaryLimit(sync_lease_min_, 1, 3600);
+  sync_lease_max_ = BoundaryLimit(sync_lease_max_, sync_lease_min_, 3600);
+  recover_sync_delay_ = BoundaryLimit(recover_sync_delay_, 2, 3600);
+  stuck_recover_sync_delay_ = BoundaryLimit(stuck_recover_sync_delay_, recover_sync_delay_, 36000);
+  bgsave_thread_num_ = BoundaryLimit(bgsave_thread_num_, 1, 16);
+  bgpurge_thread_num_ = BoundaryLimit(bgpurge_thread_num_, 1, 16);
+  purge_files_per_sec_ = BoundaryLimit(purge_files_per_sec_, 1, 1000);
+  purge_mb_per_sec_ = BoundaryLimit(purge_mb_per_sec_, 1, 10240);
+  purge_defer_qps_ = BoundaryLimit(purge_defer_qps_, -1, 10000000);
+  binlog_archive_mb_ = BoundaryLimit(binlog_archive_mb_, 0, 10 * 1024 * 1024); // up to 10T
   return res;
 }
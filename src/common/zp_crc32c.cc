@@ -0,0 +1,85 @@
+// Copyright 2017 Qihoo
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http:// www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "include/zp_crc32c.h"
+
+#include <string.h>
+
+#if defined(__x86_64__)
+# include <nmmintrin.h>
+#endif
+
+// Castagnoli polynomial, reflected
+static const uint32_t kCrc32cPoly = 0x82f63b78;
+
+static uint32_t crc_table[256];
+static bool table_inited = false;
+
+static void InitTable() {
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t crc = i;
+    for (int j = 0; j < 8; j++) {
+      crc = (crc >> 1) ^ ((crc & 1) ? kCrc32cPoly : 0);
+    }
+    crc_table[i] = crc;
+  }
+  table_inited = true;
+}
+
+static uint32_t ExtendSoft(uint32_t crc, const char* data, size_t n) {
+  if (!table_inited) {
+    InitTable();
+  }
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < n; i++) {
+    crc = (crc >> 8) ^ crc_table[(crc ^ p[i]) & 0xff];
+  }
+  return crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2")))
+static uint32_t ExtendHard(uint32_t crc, const char* data, size_t n) {
+  const char* p = data;
+  uint64_t crc64 = crc;
+  while (n >= 8) {
+    uint64_t chunk;
+    memcpy(&chunk, p, 8);
+    crc64 = _mm_crc32_u64(crc64, chunk);
+    p += 8;
+    n -= 8;
+  }
+  crc = static_cast<uint32_t>(crc64);
+  while (n > 0) {
+    crc = _mm_crc32_u8(crc, static_cast<uint8_t>(*p));
+    p++;
+    n--;
+  }
+  return crc;
+}
+
+static bool CanUseHard() {
+  return __builtin_cpu_supports("sse4.2");
+}
+#endif  // __x86_64__
+
+uint32_t Crc32c(const char* data, size_t n) {
+#if defined(__x86_64__)
+  // Detected once, the cpu does not change under us
+  static const bool use_hard = CanUseHard();
+  if (use_hard) {
+    return ExtendHard(0xffffffff, data, n) ^ 0xffffffff;
+  }
+#endif
+  return ExtendSoft(0xffffffff, data, n) ^ 0xffffffff;
+}
@@ -38,6 +38,9 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* TableName_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   TableName_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TableOptions_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TableOptions_reflection_ = NULL;
 const ::google::protobuf::Descriptor* Table_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Table_reflection_ = NULL;
@@ -198,10 +201,28 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(TableName));
-  Table_descriptor_ = file->message_type(6);
-  static const int Table_offsets_[2] = {
+  TableOptions_descriptor_ = file->message_type(6);
+  static const int TableOptions_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TableOptions, bloom_filter_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TableOptions, block_size_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TableOptions, compression_per_level_),
+  };
+  TableOptions_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TableOptions_descriptor_,
+      TableOptions::default_instance_,
+      TableOptions_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TableOptions, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TableOptions, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TableOptions));
+  Table_descriptor_ = file->message_type(7);
+  static const int Table_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Table, name_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Table, partitions_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Table, options_),
   };
   Table_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -214,7 +235,7 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Table));
-  BasicCmdUnit_descriptor_ = file->message_type(7);
+  BasicCmdUnit_descriptor_ = file->message_type(8);
   static const int BasicCmdUnit_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BasicCmdUnit, name_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BasicCmdUnit, partition_),
@@ -231,7 +252,7 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(BasicCmdUnit));
-  SyncOffset_descriptor_ = file->message_type(8);
+  SyncOffset_descriptor_ = file->message_type(9);
   static const int SyncOffset_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, table_name_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncOffset, partition_),
@@ -249,7 +270,7 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SyncOffset));
-  MetaCmd_descriptor_ = file->message_type(9);
+  MetaCmd_descriptor_ = file->message_type(10);
   static const int MetaCmd_offsets_[8] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd, ping_),
@@ -289,9 +310,10 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MetaCmd_Ping));
   MetaCmd_Pull_descriptor_ = MetaCmd_descriptor_->nested_type(1);
-  static const int MetaCmd_Pull_offsets_[2] = {
+  static const int MetaCmd_Pull_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Pull, node_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Pull, name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Pull, epoch_),
   };
   MetaCmd_Pull_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -305,9 +327,10 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MetaCmd_Pull));
   MetaCmd_Init_descriptor_ = MetaCmd_descriptor_->nested_type(2);
-  static const int MetaCmd_Init_offsets_[2] = {
+  static const int MetaCmd_Init_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Init, name_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Init, num_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmd_Init, options_),
   };
   MetaCmd_Init_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -380,7 +403,7 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MetaCmd_DropTable));
-  MetaCmdResponse_descriptor_ = file->message_type(10);
+  MetaCmdResponse_descriptor_ = file->message_type(11);
   static const int MetaCmdResponse_offsets_[8] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse, code_),
@@ -403,8 +426,9 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MetaCmdResponse));
   MetaCmdResponse_Ping_descriptor_ = MetaCmdResponse_descriptor_->nested_type(0);
-  static const int MetaCmdResponse_Ping_offsets_[1] = {
+  static const int MetaCmdResponse_Ping_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Ping, version_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Ping, incarnation_),
   };
   MetaCmdResponse_Ping_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -418,9 +442,10 @@ void protobuf_AssignDesc_zp_5fmeta_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(MetaCmdResponse_Ping));
   MetaCmdResponse_Pull_descriptor_ = MetaCmdResponse_descriptor_->nested_type(1);
-  static const int MetaCmdResponse_Pull_offsets_[2] = {
+  static const int MetaCmdResponse_Pull_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Pull, version_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Pull, info_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MetaCmdResponse_Pull, base_),
   };
   MetaCmdResponse_Pull_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -505,6 +530,8 @@ void protobuf_RegisterTypes(const ::std::string&) {
     Partitions_descriptor_, &Partitions::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     TableName_descriptor_, &TableName::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TableOptions_descriptor_, &TableOptions::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Table_descriptor_, &Table::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -556,6 +583,8 @@ void protobuf_ShutdownFile_zp_5fmeta_2eproto() {
   delete Partitions_reflection_;
   delete TableName::default_instance_;
   delete TableName_reflection_;
+  delete TableOptions::default_instance_;
+  delete TableOptions_reflection_;
   delete Table::default_instance_;
   delete Table_reflection_;
   delete BasicCmdUnit::default_instance_;
@@ -608,50 +637,56 @@ void protobuf_AddDesc_zp_5fmeta_2eproto() {
     "artitions\022\n\n\002id\030\001 \002(\005\022\035\n\005state\030\002 \002(\0162\016.Z"
     "PMeta.PState\022\034\n\006master\030\003 \002(\0132\014.ZPMeta.No"
     "de\022\034\n\006slaves\030\004 \003(\0132\014.ZPMeta.Node\"\031\n\tTabl"
-    "eName\022\014\n\004name\030\001 \003(\t\"=\n\005Table\022\014\n\004name\030\001 \002"
-    "(\t\022&\n\npartitions\030\002 \003(\0132\022.ZPMeta.Partitio"
-    "ns\"K\n\014BasicCmdUnit\022\014\n\004name\030\001 \002(\t\022\021\n\tpart"
-    "ition\030\002 \002(\005\022\032\n\004node\030\003 \002(\0132\014.ZPMeta.Node\""
-    "T\n\nSyncOffset\022\022\n\ntable_name\030\001 \002(\t\022\021\n\tpar"
-    "tition\030\002 \002(\005\022\017\n\007filenum\030\003 \001(\005\022\016\n\006offset\030"
-    "\004 \001(\003\"\257\005\n\007MetaCmd\022\032\n\004type\030\001 \002(\0162\014.ZPMeta"
-    ".Type\022\"\n\004ping\030\002 \001(\0132\024.ZPMeta.MetaCmd.Pin"
-    "g\022\"\n\004pull\030\003 \001(\0132\024.ZPMeta.MetaCmd.Pull\022\"\n"
-    "\004init\030\004 \001(\0132\024.ZPMeta.MetaCmd.Init\022-\n\nset"
-    "_master\030\005 \001(\0132\031.ZPMeta.MetaCmd.SetMaster"
-    "\022+\n\tadd_slave\030\006 \001(\0132\030.ZPMeta.MetaCmd.Add"
-    "Slave\0221\n\014remove_slave\030\007 \001(\0132\033.ZPMeta.Met"
-    "aCmd.RemoveSlave\022-\n\ndrop_table\030\010 \001(\0132\031.Z"
-    "PMeta.MetaCmd.DropTable\032W\n\004Ping\022\017\n\007versi"
-    "on\030\001 \002(\005\022\032\n\004node\030\002 \002(\0132\014.ZPMeta.Node\022\"\n\006"
-    "offset\030\003 \003(\0132\022.ZPMeta.SyncOffset\0320\n\004Pull"
-    "\022\032\n\004node\030\001 \001(\0132\014.ZPMeta.Node\022\014\n\004name\030\002 \001"
-    "(\t\032!\n\004Init\022\014\n\004name\030\001 \002(\t\022\013\n\003num\030\002 \002(\005\0320\n"
-    "\tSetMaster\022#\n\005basic\030\001 \002(\0132\024.ZPMeta.Basic"
-    "CmdUnit\032/\n\010AddSlave\022#\n\005basic\030\001 \002(\0132\024.ZPM"
-    "eta.BasicCmdUnit\0322\n\013RemoveSlave\022#\n\005basic"
-    "\030\001 \002(\0132\024.ZPMeta.BasicCmdUnit\032\031\n\tDropTabl"
-    "e\022\014\n\004name\030\001 \002(\t\"\254\004\n\017MetaCmdResponse\022\032\n\004t"
-    "ype\030\001 \002(\0162\014.ZPMeta.Type\022 \n\004code\030\002 \002(\0162\022."
-    "ZPMeta.StatusCode\022\013\n\003msg\030\003 \001(\t\022*\n\004ping\030\004"
-    " \001(\0132\034.ZPMeta.MetaCmdResponse.Ping\022*\n\004pu"
-    "ll\030\005 \001(\0132\034.ZPMeta.MetaCmdResponse.Pull\0225"
-    "\n\nlist_table\030\006 \001(\0132!.ZPMeta.MetaCmdRespo"
-    "nse.ListTable\0223\n\tlist_node\030\007 \001(\0132 .ZPMet"
-    "a.MetaCmdResponse.ListNode\0223\n\tlist_meta\030"
-    "\010 \001(\0132 .ZPMeta.MetaCmdResponse.ListMeta\032"
-    "\027\n\004Ping\022\017\n\007version\030\001 \002(\005\0324\n\004Pull\022\017\n\007vers"
-    "ion\030\001 \002(\005\022\033\n\004info\030\002 \003(\0132\r.ZPMeta.Table\032."
-    "\n\tListTable\022!\n\006tables\030\001 \001(\0132\021.ZPMeta.Tab"
-    "leName\032(\n\010ListNode\022\034\n\005nodes\030\001 \001(\0132\r.ZPMe"
-    "ta.Nodes\032,\n\010ListMeta\022 \n\005nodes\030\001 \002(\0132\021.ZP"
-    "Meta.MetaNodes*-\n\nStatusCode\022\006\n\002OK\020\000\022\014\n\010"
-    "NOTFOUND\020\001\022\t\n\005ERROR\020\002*\234\001\n\004Type\022\010\n\004PING\020\001"
-    "\022\010\n\004PULL\020\002\022\010\n\004INIT\020\003\022\r\n\tSETMASTER\020\004\022\014\n\010A"
-    "DDSLAVE\020\005\022\017\n\013REMOVESLAVE\020\006\022\r\n\tLISTTABLE\020"
-    "\007\022\014\n\010LISTNODE\020\010\022\014\n\010LISTMETA\020\t\022\r\n\tDROPTAB"
-    "LE\020\n\022\016\n\nMETASTATUS\020\013*\037\n\006PState\022\n\n\006ACTIVE"
-    "\020\001\022\t\n\005STUCK\020\002", 2093);
+    "eName\022\014\n\004name\030\001 \003(\t\"\\\n\014TableOptions\022\031\n\021b"
+    "loom_filter_bits\030\001 \001(\005\022\022\n\nblock_size\030\002 \001"
+    "(\005\022\035\n\025compression_per_level\030\003 \003(\t\"d\n\005Tab"
+    "le\022\014\n\004name\030\001 \002(\t\022&\n\npartitions\030\002 \003(\0132\022.Z"
+    "PMeta.Partitions\022%\n\007options\030\003 \001(\0132\024.ZPMe"
+    "ta.TableOptions\"K\n\014BasicCmdUnit\022\014\n\004name\030"
+    "\001 \002(\t\022\021\n\tpartition\030\002 \002(\005\022\032\n\004node\030\003 \002(\0132\014"
+    ".ZPMeta.Node\"T\n\nSyncOffset\022\022\n\ntable_name"
+    "\030\001 \002(\t\022\021\n\tpartition\030\002 \002(\005\022\017\n\007filenum\030\003 \001"
+    "(\005\022\016\n\006offset\030\004 \001(\003\"\345\005\n\007MetaCmd\022\032\n\004type\030\001"
+    " \002(\0162\014.ZPMeta.Type\022\"\n\004ping\030\002 \001(\0132\024.ZPMet"
+    "a.MetaCmd.Ping\022\"\n\004pull\030\003 \001(\0132\024.ZPMeta.Me"
+    "taCmd.Pull\022\"\n\004init\030\004 \001(\0132\024.ZPMeta.MetaCm"
+    "d.Init\022-\n\nset_master\030\005 \001(\0132\031.ZPMeta.Meta"
+    "Cmd.SetMaster\022+\n\tadd_slave\030\006 \001(\0132\030.ZPMet"
+    "a.MetaCmd.AddSlave\0221\n\014remove_slave\030\007 \001(\013"
+    "2\033.ZPMeta.MetaCmd.RemoveSlave\022-\n\ndrop_ta"
+    "ble\030\010 \001(\0132\031.ZPMeta.MetaCmd.DropTable\032W\n\004"
+    "Ping\022\017\n\007version\030\001 \002(\005\022\032\n\004node\030\002 \002(\0132\014.ZP"
+    "Meta.Node\022\"\n\006offset\030\003 \003(\0132\022.ZPMeta.SyncO"
+    "ffset\032?\n\004Pull\022\032\n\004node\030\001 \001(\0132\014.ZPMeta.Nod"
+    "e\022\014\n\004name\030\002 \001(\t\022\r\n\005epoch\030\003 \001(\005\032H\n\004Init\022\014"
+    "\n\004name\030\001 \002(\t\022\013\n\003num\030\002 \002(\005\022%\n\007options\030\003 \001"
+    "(\0132\024.ZPMeta.TableOptions\0320\n\tSetMaster\022#\n"
+    "\005basic\030\001 \002(\0132\024.ZPMeta.BasicCmdUnit\032/\n\010Ad"
+    "dSlave\022#\n\005basic\030\001 \002(\0132\024.ZPMeta.BasicCmdU"
+    "nit\0322\n\013RemoveSlave\022#\n\005basic\030\001 \002(\0132\024.ZPMe"
+    "ta.BasicCmdUnit\032\031\n\tDropTable\022\014\n\004name\030\001 \002"
+    "(\t\"\317\004\n\017MetaCmdResponse\022\032\n\004type\030\001 \002(\0162\014.Z"
+    "PMeta.Type\022 \n\004code\030\002 \002(\0162\022.ZPMeta.Status"
+    "Code\022\013\n\003msg\030\003 \001(\t\022*\n\004ping\030\004 \001(\0132\034.ZPMeta"
+    ".MetaCmdResponse.Ping\022*\n\004pull\030\005 \001(\0132\034.ZP"
+    "Meta.MetaCmdResponse.Pull\0225\n\nlist_table\030"
+    "\006 \001(\0132!.ZPMeta.MetaCmdResponse.ListTable"
+    "\0223\n\tlist_node\030\007 \001(\0132 .ZPMeta.MetaCmdResp"
+    "onse.ListNode\0223\n\tlist_meta\030\010 \001(\0132 .ZPMet"
+    "a.MetaCmdResponse.ListMeta\032,\n\004Ping\022\017\n\007ve"
+    "rsion\030\001 \002(\005\022\023\n\013incarnation\030\002 \001(\003\032B\n\004Pull"
+    "\022\017\n\007version\030\001 \002(\005\022\033\n\004"
+    "info\030\002 \003(\0132\r.ZPMeta.Table\022\014\n\004base\030\003 \001(\005\032"
+    ".\n\tListTable\022!\n\006tables\030\001 \001(\0132\021.ZPMeta.Ta"
+    "bleName\032(\n\010ListNode\022\034\n\005nodes\030\001 \001(\0132\r.ZPM"
+    "eta.Nodes\032,\n\010ListMeta\022 \n\005nodes\030\001 \002(\0132\021.Z"
+    "PMeta.MetaNodes*-\n\nStatusCode\022\006\n\002OK\020\000\022\014\n"
+    "\010NOTFOUND\020\001\022\t\n\005ERROR\020\002*\234\001\n\004Type\022\010\n\004PING\020"
+    "\001\022\010\n\004PULL\020\002\022\010\n\004INIT\020\003\022\r\n\tSETMASTER\020\004\022\014\n\010"
+    "ADDSLAVE\020\005\022\017\n\013REMOVESLAVE\020\006\022\r\n\tLISTTABLE"
+    "\020\007\022\014\n\010LISTNODE\020\010\022\014\n\010LISTMETA\020\t\022\r\n\tDROPTA"
+    "BLE\020\n\022\016\n\nMETASTATUS\020\013*\037\n\006PState\022\n\n\006ACTIV"
+    "E\020\001\022\t\n\005STUCK\020\002", 2315);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "zp_meta.proto", &protobuf_RegisterTypes);
   Node::default_instance_ = new Node();
@@ -660,6 +695,7 @@ void protobuf_AddDesc_zp_5fmeta_2eproto() {
   MetaNodes::default_instance_ = new MetaNodes();
   Partitions::default_instance_ = new Partitions();
   TableName::default_instance_ = new TableName();
+  TableOptions::default_instance_ = new TableOptions();
   Table::default_instance_ = new Table();
   BasicCmdUnit::default_instance_ = new BasicCmdUnit();
   SyncOffset::default_instance_ = new SyncOffset();
@@ -683,6 +719,7 @@ void protobuf_AddDesc_zp_5fmeta_2eproto() {
   MetaNodes::default_instance_->InitAsDefaultInstance();
   Partitions::default_instance_->InitAsDefaultInstance();
   TableName::default_instance_->InitAsDefaultInstance();
+  TableOptions::default_instance_->InitAsDefaultInstance();
   Table::default_instance_->InitAsDefaultInstance();
   BasicCmdUnit::default_instance_->InitAsDefaultInstance();
   SyncOffset::default_instance_->InitAsDefaultInstance();
@@ -2308,11 +2345,308 @@ void TableName::Swap(TableName* other) {
 }
 
 
+// ===================================================================
+
+#ifndef _MSC_VER
+const int TableOptions::kBloomFilterBitsFieldNumber;
+const int TableOptions::kBlockSizeFieldNumber;
+const int TableOptions::kCompressionPerLevelFieldNumber;
+#endif  // !_MSC_VER
+
+TableOptions::TableOptions()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void TableOptions::InitAsDefaultInstance() {
+}
+
+TableOptions::TableOptions(const TableOptions& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TableOptions::SharedCtor() {
+  _cached_size_ = 0;
+  bloom_filter_bits_ = 0;
+  block_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TableOptions::~TableOptions() {
+  SharedDtor();
+}
+
+void TableOptions::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void TableOptions::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* TableOptions::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TableOptions_descriptor_;
+}
+
+const TableOptions& TableOptions::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_zp_5fmeta_2eproto();
+  return *default_instance_;
+}
+
+TableOptions* TableOptions::default_instance_ = NULL;
+
+TableOptions* TableOptions::New() const {
+  return new TableOptions;
+}
+
+void TableOptions::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    bloom_filter_bits_ = 0;
+    block_size_ = 0;
+  }
+  compression_per_level_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TableOptions::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 bloom_filter_bits = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &bloom_filter_bits_)));
+          set_has_bloom_filter_bits();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_block_size;
+        break;
+      }
+
+      // optional int32 block_size = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_block_size:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &block_size_)));
+          set_has_block_size();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_compression_per_level;
+        break;
+      }
+
+      // repeated string compression_per_level = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_compression_per_level:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_compression_per_level()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->compression_per_level(this->compression_per_level_size() - 1).data(),
+            this->compression_per_level(this->compression_per_level_size() - 1).length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_compression_per_level;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void TableOptions::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional int32 bloom_filter_bits = 1;
+  if (has_bloom_filter_bits()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->bloom_filter_bits(), output);
+  }
+
+  // optional int32 block_size = 2;
+  if (has_block_size()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->block_size(), output);
+  }
+
+  // repeated string compression_per_level = 3;
+  for (int i = 0; i < this->compression_per_level_size(); i++) {
+  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+    this->compression_per_level(i).data(), this->compression_per_level(i).length(),
+    ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      3, this->compression_per_level(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TableOptions::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional int32 bloom_filter_bits = 1;
+  if (has_bloom_filter_bits()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->bloom_filter_bits(), target);
+  }
+
+  // optional int32 block_size = 2;
+  if (has_block_size()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->block_size(), target);
+  }
+
+  // repeated string compression_per_level = 3;
+  for (int i = 0; i < this->compression_per_level_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->compression_per_level(i).data(), this->compression_per_level(i).length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(3, this->compression_per_level(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TableOptions::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 bloom_filter_bits = 1;
+    if (has_bloom_filter_bits()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->bloom_filter_bits());
+    }
+
+    // optional int32 block_size = 2;
+    if (has_block_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->block_size());
+    }
+
+  }
+  // repeated string compression_per_level = 3;
+  total_size += 1 * this->compression_per_level_size();
+  for (int i = 0; i < this->compression_per_level_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->compression_per_level(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TableOptions::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TableOptions* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TableOptions*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TableOptions::MergeFrom(const TableOptions& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  compression_per_level_.MergeFrom(from.compression_per_level_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_bloom_filter_bits()) {
+      set_bloom_filter_bits(from.bloom_filter_bits());
+    }
+    if (from.has_block_size()) {
+      set_block_size(from.block_size());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TableOptions::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TableOptions::CopyFrom(const TableOptions& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TableOptions::IsInitialized() const {
+
+  return true;
+}
+
+void TableOptions::Swap(TableOptions* other) {
+  if (other != this) {
+    std::swap(bloom_filter_bits_, other->bloom_filter_bits_);
+    std::swap(block_size_, other->block_size_);
+    compression_per_level_.Swap(&other->compression_per_level_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TableOptions::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TableOptions_descriptor_;
+  metadata.reflection = TableOptions_reflection_;
+  return metadata;
+}
+
+
 // ===================================================================
 
 #ifndef _MSC_VER
 const int Table::kNameFieldNumber;
 const int Table::kPartitionsFieldNumber;
+const int Table::kOptionsFieldNumber;
 #endif  // !_MSC_VER
 
 Table::Table()
@@ -2321,6 +2655,7 @@ Table::Table()
 }
 
 void Table::InitAsDefaultInstance() {
+  options_ = const_cast< ::ZPMeta::TableOptions*>(&::ZPMeta::TableOptions::default_instance());
 }
 
 Table::Table(const Table& from)
@@ -2332,6 +2667,7 @@ Table::Table(const Table& from)
 void Table::SharedCtor() {
   _cached_size_ = 0;
   name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  options_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -2344,6 +2680,7 @@ void Table::SharedDtor() {
     delete name_;
   }
   if (this != default_instance_) {
+    delete options_;
   }
 }
 
@@ -2375,6 +2712,9 @@ void Table::Clear() {
         name_->clear();
       }
     }
+    if (has_options()) {
+      if (options_ != NULL) options_->::ZPMeta::TableOptions::Clear();
+    }
   }
   partitions_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
@@ -2414,6 +2754,20 @@ bool Table::MergePartialFromCodedStream(
           goto handle_uninterpreted;
         }
         if (input->ExpectTag(18)) goto parse_partitions;
+        if (input->ExpectTag(26)) goto parse_options;
+        break;
+      }
+
+      // optional .ZPMeta.TableOptions options = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_options:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_options()));
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -2451,6 +2805,12 @@ void Table::SerializeWithCachedSizes(
       2, this->partitions(i), output);
   }
 
+  // optional .ZPMeta.TableOptions options = 3;
+  if (has_options()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->options(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -2476,6 +2836,13 @@ void Table::SerializeWithCachedSizes(
         2, this->partitions(i), target);
   }
 
+  // optional .ZPMeta.TableOptions options = 3;
+  if (has_options()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->options(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -2494,6 +2861,13 @@ int Table::ByteSize() const {
           this->name());
     }
 
+    // optional .ZPMeta.TableOptions options = 3;
+    if (has_options()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->options());
+    }
+
   }
   // repeated .ZPMeta.Partitions partitions = 2;
   total_size += 1 * this->partitions_size();
@@ -2533,6 +2907,9 @@ void Table::MergeFrom(const Table& from) {
     if (from.has_name()) {
       set_name(from.name());
     }
+    if (from.has_options()) {
+      mutable_options()->::ZPMeta::TableOptions::MergeFrom(from.options());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -2562,6 +2939,7 @@ void Table::Swap(Table* other) {
   if (other != this) {
     std::swap(name_, other->name_);
     partitions_.Swap(&other->partitions_);
+    std::swap(options_, other->options_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -3542,6 +3920,7 @@ void MetaCmd_Ping::Swap(MetaCmd_Ping* other) {
 #ifndef _MSC_VER
 const int MetaCmd_Pull::kNodeFieldNumber;
 const int MetaCmd_Pull::kNameFieldNumber;
+const int MetaCmd_Pull::kEpochFieldNumber;
 #endif  // !_MSC_VER
 
 MetaCmd_Pull::MetaCmd_Pull()
@@ -3563,6 +3942,7 @@ void MetaCmd_Pull::SharedCtor() {
   _cached_size_ = 0;
   node_ = NULL;
   name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  epoch_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -3610,6 +3990,7 @@ void MetaCmd_Pull::Clear() {
         name_->clear();
       }
     }
+    epoch_ = 0;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -3647,6 +4028,22 @@ bool MetaCmd_Pull::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(24)) goto parse_epoch;
+        break;
+      }
+
+      // optional int32 epoch = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_epoch:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &epoch_)));
+          set_has_epoch();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -3684,6 +4081,11 @@ void MetaCmd_Pull::SerializeWithCachedSizes(
       2, this->name(), output);
   }
 
+  // optional int32 epoch = 3;
+  if (has_epoch()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->epoch(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -3709,6 +4111,11 @@ void MetaCmd_Pull::SerializeWithCachedSizes(
         2, this->name(), target);
   }
 
+  // optional int32 epoch = 3;
+  if (has_epoch()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->epoch(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -3734,6 +4141,13 @@ int MetaCmd_Pull::ByteSize() const {
           this->name());
     }
 
+    // optional int32 epoch = 3;
+    if (has_epoch()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->epoch());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -3767,6 +4181,9 @@ void MetaCmd_Pull::MergeFrom(const MetaCmd_Pull& from) {
     if (from.has_name()) {
       set_name(from.name());
     }
+    if (from.has_epoch()) {
+      set_epoch(from.epoch());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -3795,6 +4212,7 @@ void MetaCmd_Pull::Swap(MetaCmd_Pull* other) {
   if (other != this) {
     std::swap(node_, other->node_);
     std::swap(name_, other->name_);
+    std::swap(epoch_, other->epoch_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -3815,6 +4233,7 @@ void MetaCmd_Pull::Swap(MetaCmd_Pull* other) {
 #ifndef _MSC_VER
 const int MetaCmd_Init::kNameFieldNumber;
 const int MetaCmd_Init::kNumFieldNumber;
+const int MetaCmd_Init::kOptionsFieldNumber;
 #endif  // !_MSC_VER
 
 MetaCmd_Init::MetaCmd_Init()
@@ -3823,6 +4242,7 @@ MetaCmd_Init::MetaCmd_Init()
 }
 
 void MetaCmd_Init::InitAsDefaultInstance() {
+  options_ = const_cast< ::ZPMeta::TableOptions*>(&::ZPMeta::TableOptions::default_instance());
 }
 
 MetaCmd_Init::MetaCmd_Init(const MetaCmd_Init& from)
@@ -3834,6 +4254,7 @@ MetaCmd_Init::MetaCmd_Init(const MetaCmd_Init& from)
 void MetaCmd_Init::SharedCtor() {
   _cached_size_ = 0;
   name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  options_ = NULL;
   num_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
@@ -3847,6 +4268,7 @@ void MetaCmd_Init::SharedDtor() {
     delete name_;
   }
   if (this != default_instance_) {
+    delete options_;
   }
 }
 
@@ -3879,6 +4301,9 @@ void MetaCmd_Init::Clear() {
       }
     }
     num_ = 0;
+    if (has_options()) {
+      if (options_ != NULL) options_->::ZPMeta::TableOptions::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -3918,6 +4343,20 @@ bool MetaCmd_Init::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(26)) goto parse_options;
+        break;
+      }
+
+      // optional .ZPMeta.TableOptions options = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_options:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_options()));
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -3954,6 +4393,12 @@ void MetaCmd_Init::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->num(), output);
   }
 
+  // optional .ZPMeta.TableOptions options = 3;
+  if (has_options()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->options(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -3977,6 +4422,13 @@ void MetaCmd_Init::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->num(), target);
   }
 
+  // optional .ZPMeta.TableOptions options = 3;
+  if (has_options()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->options(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -4002,6 +4454,13 @@ int MetaCmd_Init::ByteSize() const {
           this->num());
     }
 
+    // optional .ZPMeta.TableOptions options = 3;
+    if (has_options()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->options());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -4035,6 +4494,9 @@ void MetaCmd_Init::MergeFrom(const MetaCmd_Init& from) {
     if (from.has_num()) {
       set_num(from.num());
     }
+    if (from.has_options()) {
+      mutable_options()->::ZPMeta::TableOptions::MergeFrom(from.options());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -4060,6 +4522,7 @@ bool MetaCmd_Init::IsInitialized() const {
 void MetaCmd_Init::Swap(MetaCmd_Init* other) {
   if (other != this) {
     std::swap(name_, other->name_);
+    std::swap(options_, other->options_);
     std::swap(num_, other->num_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
@@ -5508,6 +5971,7 @@ void MetaCmd::Swap(MetaCmd* other) {
 
 #ifndef _MSC_VER
 const int MetaCmdResponse_Ping::kVersionFieldNumber;
+const int MetaCmdResponse_Ping::kIncarnationFieldNumber;
 #endif  // !_MSC_VER
 
 MetaCmdResponse_Ping::MetaCmdResponse_Ping()
@@ -5527,6 +5991,7 @@ MetaCmdResponse_Ping::MetaCmdResponse_Ping(const MetaCmdResponse_Ping& from)
 void MetaCmdResponse_Ping::SharedCtor() {
   _cached_size_ = 0;
   version_ = 0;
+  incarnation_ = GOOGLE_LONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -5563,6 +6028,7 @@ MetaCmdResponse_Ping* MetaCmdResponse_Ping::New() const {
 void MetaCmdResponse_Ping::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     version_ = 0;
+    incarnation_ = GOOGLE_LONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -5585,6 +6051,22 @@ bool MetaCmdResponse_Ping::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(16)) goto parse_incarnation;
+        break;
+      }
+
+      // optional int64 incarnation = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_incarnation:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &incarnation_)));
+          set_has_incarnation();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -5612,6 +6094,11 @@ void MetaCmdResponse_Ping::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->version(), output);
   }
 
+  // optional int64 incarnation = 2;
+  if (has_incarnation()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->incarnation(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -5625,6 +6112,11 @@ void MetaCmdResponse_Ping::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->version(), target);
   }
 
+  // optional int64 incarnation = 2;
+  if (has_incarnation()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->incarnation(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -5643,6 +6135,13 @@ int MetaCmdResponse_Ping::ByteSize() const {
           this->version());
     }
 
+    // optional int64 incarnation = 2;
+    if (has_incarnation()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->incarnation());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -5673,6 +6172,9 @@ void MetaCmdResponse_Ping::MergeFrom(const MetaCmdResponse_Ping& from) {
     if (from.has_version()) {
       set_version(from.version());
     }
+    if (from.has_incarnation()) {
+      set_incarnation(from.incarnation());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -5698,6 +6200,7 @@ bool MetaCmdResponse_Ping::IsInitialized() const {
 void MetaCmdResponse_Ping::Swap(MetaCmdResponse_Ping* other) {
   if (other != this) {
     std::swap(version_, other->version_);
+    std::swap(incarnation_, other->incarnation_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -5718,6 +6221,7 @@ void MetaCmdResponse_Ping::Swap(MetaCmdResponse_Ping* other) {
 #ifndef _MSC_VER
 const int MetaCmdResponse_Pull::kVersionFieldNumber;
 const int MetaCmdResponse_Pull::kInfoFieldNumber;
+const int MetaCmdResponse_Pull::kBaseFieldNumber;
 #endif  // !_MSC_VER
 
 MetaCmdResponse_Pull::MetaCmdResponse_Pull()
@@ -5737,6 +6241,7 @@ MetaCmdResponse_Pull::MetaCmdResponse_Pull(const MetaCmdResponse_Pull& from)
 void MetaCmdResponse_Pull::SharedCtor() {
   _cached_size_ = 0;
   version_ = 0;
+  base_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -5773,6 +6278,7 @@ MetaCmdResponse_Pull* MetaCmdResponse_Pull::New() const {
 void MetaCmdResponse_Pull::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     version_ = 0;
+    base_ = 0;
   }
   info_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
@@ -5811,6 +6317,22 @@ bool MetaCmdResponse_Pull::MergePartialFromCodedStream(
           goto handle_uninterpreted;
         }
         if (input->ExpectTag(18)) goto parse_info;
+        if (input->ExpectTag(24)) goto parse_base;
+        break;
+      }
+
+      // optional int32 base = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_base:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &base_)));
+          set_has_base();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -5844,6 +6366,11 @@ void MetaCmdResponse_Pull::SerializeWithCachedSizes(
       2, this->info(i), output);
   }
 
+  // optional int32 base = 3;
+  if (has_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->base(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -5864,6 +6391,11 @@ void MetaCmdResponse_Pull::SerializeWithCachedSizes(
         2, this->info(i), target);
   }
 
+  // optional int32 base = 3;
+  if (has_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->base(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -5882,6 +6414,13 @@ int MetaCmdResponse_Pull::ByteSize() const {
           this->version());
     }
 
+    // optional int32 base = 3;
+    if (has_base()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->base());
+    }
+
   }
   // repeated .ZPMeta.Table info = 2;
   total_size += 1 * this->info_size();
@@ -5921,6 +6460,9 @@ void MetaCmdResponse_Pull::MergeFrom(const MetaCmdResponse_Pull& from) {
     if (from.has_version()) {
       set_version(from.version());
     }
+    if (from.has_base()) {
+      set_base(from.base());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -5950,6 +6492,7 @@ void MetaCmdResponse_Pull::Swap(MetaCmdResponse_Pull* other) {
   if (other != this) {
     std::swap(version_, other->version_);
     info_.Swap(&other->info_);
+    std::swap(base_, other->base_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -60,6 +60,93 @@ FileLocker::~FileLocker() {
   }
 }
 
+bool ParseCpuSet(const std::string& cpuset, cpu_set_t* mask) {
+  CPU_ZERO(mask);
+  std::string::size_type begin = 0;
+  while (begin < cpuset.size()) {
+    std::string::size_type end = cpuset.find(',', begin);
+    if (end == std::string::npos) {
+      end = cpuset.size();
+    }
+    std::string item = cpuset.substr(begin, end - begin);
+    begin = end + 1;
+    int low = -1, high = -1;
+    if (sscanf(item.c_str(), "%d-%d", &low, &high) == 2) {
+      // keep the parsed range
+    } else if (sscanf(item.c_str(), "%d", &low) == 1) {
+      high = low;
+    } else {
+      return false;
+    }
+    if (low < 0 || high < low || high >= CPU_SETSIZE) {
+      return false;
+    }
+    for (int cpu = low; cpu <= high; cpu++) {
+      CPU_SET(cpu, mask);
+    }
+  }
+  return CPU_COUNT(mask) > 0;
+}
+
+ScopedCpuSet::ScopedCpuSet(const std::string& cpuset)
+  : applied_(false) {
+  if (cpuset.empty()) {
+    return;
+  }
+  cpu_set_t mask;
+  if (!ParseCpuSet(cpuset, &mask)) {
+    LOG(WARNING) << "Malformed cpuset ignored: " << cpuset;
+    return;
+  }
+  if (pthread_getaffinity_np(pthread_self(), sizeof(saved_), &saved_) != 0
+      || pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) != 0) {
+    LOG(WARNING) << "Pin to cpuset failed: " << cpuset;
+    return;
+  }
+  applied_ = true;
+}
+
+ScopedCpuSet::~ScopedCpuSet() {
+  if (applied_) {
+    pthread_setaffinity_np(pthread_self(), sizeof(saved_), &saved_);
+  }
+}
+
+std::atomic<uint64_t> CoarseClock::now_us_(0);
+std::atomic<bool> CoarseClock::running_(false);
+pthread_t CoarseClock::tid_;
+
+void CoarseClock::Start() {
+  if (running_) {
+    return;
+  }
+  now_us_ = slash::NowMicros();
+  running_ = true;
+  if (pthread_create(&tid_, NULL, &CoarseClock::Ticker, NULL) != 0) {
+    // Not fatal, readers fall back to the real clock
+    LOG(WARNING) << "CoarseClock ticker create failed";
+    running_ = false;
+    now_us_ = 0;
+  }
+}
+
+void CoarseClock::Stop() {
+  if (!running_) {
+    return;
+  }
+  running_ = false;
+  pthread_join(tid_, NULL);
+  now_us_ = 0;
+}
+
+void* CoarseClock::Ticker(void* arg) {
+  while (running_) {
+    now_us_.store(slash::NowMicros(), std::memory_order_relaxed);
+    usleep(1000);
+  }
+  return NULL;
+}
+
 Statistic::Statistic()
   : last_querys(0), querys(0), last_qps(0), used_disk(0), free_disk(0) {}
 
@@ -101,3 +188,42 @@ void Statistic::Dump() {
       << "\n   used_disk  : " << used_disk
       << "\n   free_disk  : " << free_disk << "\n";
 }
+
+LatencyHistogram::LatencyHistogram()
+  : count_(0) {
+  for (int i = 0; i < kBucketNum; i++) {
+    buckets_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void LatencyHistogram::Add(uint64_t duration_us) {
+  int index = 0;
+  while (index < kBucketNum - 1 && (1ULL << index) < duration_us) {
+    index++;
+  }
+  buckets_[index].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::Count() const {
+  return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::Quantile(double q) const {
+  uint64_t total = count_.load(std::memory_order_relaxed);
+  if (total == 0) {
+    return 0;
+  }
+  uint64_t target = static_cast<uint64_t>(total * q);
+  if (target < 1) {
+    target = 1;
+  }
+  uint64_t acc = 0;
+  for (int i = 0; i < kBucketNum; i++) {
+    acc += buckets_[i].load(std::memory_order_relaxed);
+    if (acc >= target) {
+      return 1ULL << i;
+    }
+  }
+  return 1ULL << (kBucketNum - 1);
+}
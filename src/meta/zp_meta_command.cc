@@ -35,6 +35,7 @@ void PingCmd::Do(const google::protobuf::Message *req, google::protobuf::Message
 
   ZPMeta::MetaCmdResponse_Ping* ping = response->mutable_ping();
   ping->set_version(g_meta_server->version());
+  ping->set_incarnation(g_meta_server->leader_incarnation());
 
   DLOG(INFO) << "Receive ping from node: " << request->ping().node().ip()
              << ":" << request->ping().node().port() << ", version=" << request->ping().version()
@@ -58,7 +59,13 @@ void PullCmd::Do(const google::protobuf::Message *req, google::protobuf::Message
   response->set_type(ZPMeta::Type::PULL);
 
   ZPMeta::MetaCmdResponse_Pull ms_info;
-  Status s = g_meta_server->GetMSInfo(tables, &ms_info);
+  Status s;
+  if (request->pull().has_epoch()) {
+    // The puller told us what it holds, ship only what changed since
+    s = g_meta_server->GetMSInfoDiff(request->pull().epoch(), tables, &ms_info);
+  } else {
+    s = g_meta_server->GetMSInfo(tables, &ms_info);
+  }
   LOG(INFO) << "Pull result to " << request->pull().node().ip()
     << ":" << request->pull().node().port()
     << ", response table num: " << tables.size()
@@ -96,7 +103,8 @@ void InitCmd::Do(const google::protobuf::Message *req, google::protobuf::Message
     return;
   }
 
-  Status s = g_meta_server->Distribute(table, request->init().num());
+  Status s = g_meta_server->Distribute(table, request->init().num(),
+      request->init().has_options() ? &request->init().options() : NULL);
 
   if (s.ok()) {
     response->set_code(ZPMeta::StatusCode::OK);
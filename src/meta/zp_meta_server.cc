@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 #include <ctime>
+#include <thread>
 #include <sys/resource.h>
 #include <glog/logging.h>
 #include <google/protobuf/text_format.h>
@@ -14,7 +15,7 @@
 #include "slash/include/env.h"
 
 ZPMetaServer::ZPMetaServer()
-  : should_exit_(false), started_(false), version_(-1), leader_cli_(NULL), leader_first_time_(true), leader_ip_(""), leader_cmd_port_(0) {
+  : should_exit_(false), started_(false), version_(-1), leader_incarnation_(0), pull_cache_version_(-1), wheel_checked_(0), leader_cli_(NULL), leader_first_time_(true), leader_ip_(""), leader_cmd_port_(0) {
   LOG(INFO) << "ZPMetaServer start initialization";
 
   // Try to raise the file descriptor
@@ -183,6 +184,8 @@ Status ZPMetaServer::DoUpdate(ZPMetaUpdateTaskDeque task_deque) {
   bool should_update_version = false;
 //  bool should_update_table_set = false;
 
+  std::set<std::string> changed_tables;
+  std::vector<ZPMeta::Table> changed_infos;
   for (auto it = tables.begin(); it != tables.end(); it++) {
     table_info.Clear();
     s = GetTableInfo(*it, &table_info);
@@ -191,10 +194,51 @@ Status ZPMetaServer::DoUpdate(ZPMetaUpdateTaskDeque task_deque) {
       sth_wrong = true;
       continue;
     }
-    if (!ProcessUpdateTableInfo(task_deque, nodes, &table_info, &should_update_version)) {
+    bool table_updated = false;
+    if (!ProcessUpdateTableInfo(task_deque, nodes, &table_info, &table_updated)) {
       sth_wrong = true;
       continue;
     }
+    if (table_updated) {
+      changed_infos.push_back(table_info);
+    }
+  }
+
+/*
+ * Step 2.5 Commit every changed table in one parallel wave, so a failure
+ * event touching many tables pays one consensus round-trip of latency
+ * instead of one sequential raft commit per table
+ */
+  if (!changed_infos.empty()) {
+    std::vector<char> write_ok(changed_infos.size(), 0);
+    size_t writer_num = kMetaTableWriterNum;
+    if (writer_num > changed_infos.size()) {
+      writer_num = changed_infos.size();
+    }
+    std::vector<std::thread> writers;
+    for (size_t t = 0; t < writer_num; t++) {
+      writers.push_back(std::thread([this, t, writer_num, &changed_infos, &write_ok]() {
+        for (size_t j = t; j < changed_infos.size(); j += writer_num) {
+          Status ws = SetTable(changed_infos[j]);
+          if (ws.ok()) {
+            write_ok[j] = 1;
+          } else {
+            LOG(ERROR) << "SetTable error in DoUpdate, table: " << changed_infos[j].name() << " error: " << ws.ToString();
+          }
+        }
+      }));
+    }
+    for (size_t t = 0; t < writers.size(); t++) {
+      writers[t].join();
+    }
+    for (size_t j = 0; j < changed_infos.size(); j++) {
+      if (write_ok[j]) {
+        changed_tables.insert(changed_infos[j].name());
+        should_update_version = true;
+      } else {
+        sth_wrong = true;
+      }
+    }
   }
 
 /*
@@ -214,6 +258,7 @@ Status ZPMetaServer::DoUpdate(ZPMetaUpdateTaskDeque task_deque) {
     if (!s.ok()) {
       return s;
     }
+    RecordVersionChange(changed_tables);
   }
 
   if (sth_wrong) {
@@ -233,14 +278,21 @@ Status ZPMetaServer::AddNodeAlive(const std::string& ip_port) {
   }
 
   bool should_add = false;
-  {
   struct timeval now;
-  slash::MutexLock l(&alive_mutex_);
-  if (node_alive_.find(ip_port) == node_alive_.end()) {
-    should_add = true;
-  }
   gettimeofday(&now, NULL);
-  node_alive_[ip_port] = now;
+  AliveShard *shard = &alive_shards_[AliveShardIndex(ip_port)];
+  {
+    slash::MutexLock l(&shard->mutex);
+    if (shard->node_alive.find(ip_port) == shard->node_alive.end()) {
+      should_add = true;
+    }
+    shard->node_alive[ip_port] = now;
+  }
+  {
+    AliveWheelBucket *bucket =
+      &alive_wheel_[(now.tv_sec + kNodeMetaTimeoutM + 1) % kMetaAliveWheelSize];
+    slash::MutexLock l(&bucket->mutex);
+    bucket->nodes.insert(ip_port);
   }
 
   if (!should_add) {
@@ -260,30 +312,104 @@ void ZPMetaServer::AddMetaUpdateTask(const UpdateTask &task) {
 
 void ZPMetaServer::CheckNodeAlive() {
   struct timeval now;
-  slash::MutexLock l(&alive_mutex_);
-
   gettimeofday(&now, NULL);
-  auto it = node_alive_.begin();
-  while (it != node_alive_.end()) {
-    if (now.tv_sec - (it->second).tv_sec > kNodeMetaTimeoutM) {
-      UpdateTask task = {ZPMetaUpdateOP::kOpRemove, it->first, "", -1};
-      AddMetaUpdateTask(task);
-      it = node_alive_.erase(it);
-    } else {
-      it++;
+  time_t checked = wheel_checked_;
+  if (now.tv_sec <= checked) {
+    return;
+  }
+  time_t begin = checked + 1;
+  if (now.tv_sec - begin >= static_cast<time_t>(kMetaAliveWheelSize)) {
+    // Stalled longer than one wheel turn, drain every bucket once
+    begin = now.tv_sec - kMetaAliveWheelSize + 1;
+  }
+  for (time_t sec = begin; sec <= now.tv_sec; sec++) {
+    AliveWheelBucket *bucket = &alive_wheel_[sec % kMetaAliveWheelSize];
+    std::set<std::string> due;
+    {
+      slash::MutexLock l(&bucket->mutex);
+      due.swap(bucket->nodes);
+    }
+    for (auto it = due.begin(); it != due.end(); it++) {
+      AliveShard *shard = &alive_shards_[AliveShardIndex(*it)];
+      slash::MutexLock l(&shard->mutex);
+      auto iter = shard->node_alive.find(*it);
+      if (iter == shard->node_alive.end()) {
+        continue;
+      }
+      if (now.tv_sec - iter->second.tv_sec > kNodeMetaTimeoutM) {
+        UpdateTask task = {ZPMetaUpdateOP::kOpRemove, *it, "", -1};
+        AddMetaUpdateTask(task);
+        shard->node_alive.erase(iter);
+      }
+      // Otherwise a fresher ping moved the node to a later bucket
     }
   }
+  wheel_checked_ = now.tv_sec;
 }
 
 void ZPMetaServer::ScheduleUpdate() {
   slash::MutexLock l(&task_mutex_);
   if (!task_deque_.empty()) {
+    CoalesceMetaUpdateTasks(&task_deque_);
     update_thread_->ScheduleUpdate(task_deque_);
     task_deque_.clear();
   }
 }
 
+void ZPMetaServer::CoalesceMetaUpdateTasks(ZPMetaUpdateTaskDeque *task_deque) {
+  // A flapping node enqueues the same up/down transition over and over,
+  // and replaying every copy just burns raft rounds; only the last state
+  // of a node matters. Keep the last occurrence of every task, letting
+  // node up and down supersede each other, before the batch is handed to
+  // the update thread. DoUpdate then folds the batch into one SetTable
+  // write per touched table as before.
+  ZPMetaUpdateTaskDeque coalesced;
+  std::set<std::string> seen;
+  std::string key;
+  for (auto iter = task_deque->rbegin(); iter != task_deque->rend(); iter++) {
+    if (iter->op == ZPMetaUpdateOP::kOpAdd
+        || iter->op == ZPMetaUpdateOP::kOpRemove) {
+      // Up and down of one node supersede each other, the last wins
+      key = "node:" + iter->ip_port;
+    } else if (iter->op == ZPMetaUpdateOP::kOpAddVersion) {
+      key = "version";
+    } else {
+      key = std::to_string(static_cast<int>(iter->op)) + ":" + iter->ip_port
+        + ":" + iter->table + ":" + std::to_string(iter->partition);
+    }
+    if (seen.find(key) != seen.end()) {
+      continue;
+    }
+    seen.insert(key);
+    coalesced.push_front(*iter);
+  }
+  if (coalesced.size() != task_deque->size()) {
+    LOG(INFO) << "Coalesce meta update tasks: " << task_deque->size()
+      << " -> " << coalesced.size();
+  }
+  task_deque->swap(coalesced);
+}
+
 Status ZPMetaServer::GetMSInfo(const std::set<std::string> &tables, ZPMeta::MetaCmdResponse_Pull *ms_info) {
+  // Nodes hosting the same tables pull identical payloads, and an epoch
+  // bump makes every node pull at once; build each payload once per
+  // version and serve the rest from the cache
+  std::string cache_key;
+  for (auto it = tables.begin(); it != tables.end(); it++) {
+    cache_key.append(*it);
+    cache_key.append(1, ',');
+  }
+  {
+    slash::MutexLock l(&pull_cache_mutex_);
+    if (pull_cache_version_ == version_) {
+      auto iter = pull_cache_.find(cache_key);
+      if (iter != pull_cache_.end()) {
+        ms_info->CopyFrom(iter->second);
+        return Status::OK();
+      }
+    }
+  }
+
   ms_info->Clear();
   ZPMeta::Table table_info;
   ZPMeta::Table *t;
@@ -302,9 +428,62 @@ Status ZPMetaServer::GetMSInfo(const std::set<std::string> &tables, ZPMeta::Meta
       return s;
     }
   }
+
+  {
+    slash::MutexLock l(&pull_cache_mutex_);
+    if (pull_cache_version_ != ms_info->version()) {
+      pull_cache_.clear();
+      pull_cache_version_ = ms_info->version();
+    }
+    pull_cache_[cache_key] = *ms_info;
+  }
   return s;
 }
 
+Status ZPMetaServer::GetMSInfoDiff(int epoch, const std::set<std::string> &tables, ZPMeta::MetaCmdResponse_Pull *ms_info) {
+  int version;
+  std::set<std::string> changed;
+  {
+    slash::MutexLock l(&node_mutex_);
+    version = version_;
+    if (epoch != version
+        && (epoch > version
+          || version_changes_.empty()
+          || version_changes_.front().first > epoch + 1
+          || version_changes_.back().first != version)) {
+      // The journal cannot bridge the gap, serve the full snapshot
+      return GetMSInfo(tables, ms_info);
+    }
+    for (auto it = version_changes_.begin(); it != version_changes_.end(); it++) {
+      if (it->first > epoch) {
+        changed.insert(it->second.begin(), it->second.end());
+      }
+    }
+  }
+
+  ms_info->Clear();
+  ms_info->set_version(version);
+  ms_info->set_base(epoch);
+  ZPMeta::Table table_info;
+  Status s;
+  for (auto it = changed.begin(); it != changed.end(); it++) {
+    s = GetTableInfo(*it, &table_info);
+    if (s.ok()) {
+      if (tables.find(*it) == tables.end()) {
+        continue;  // changed, but the puller never hosted it
+      }
+      ms_info->add_info()->CopyFrom(table_info);
+    } else if (s.IsNotFound()) {
+      // Dropped since the puller epoch, a bare name tells it to remove
+      ms_info->add_info()->set_name(*it);
+    } else {
+      LOG(WARNING) << "GetMSInfoDiff error, table: " << *it << " error: " << s.ToString();
+      return s;
+    }
+  }
+  return Status::OK();
+}
+
 Status ZPMetaServer::GetTableListForNode(const std::string &ip_port, std::set<std::string> *tables) {
   tables->clear();
   slash::MutexLock l(&node_mutex_);
@@ -542,7 +721,8 @@ Status ZPMetaServer::GetAllNodes(ZPMeta::MetaCmdResponse_ListNode *nodes) {
   return s;
 }
 
-Status ZPMetaServer::Distribute(const std::string &name, int num) {
+Status ZPMetaServer::Distribute(const std::string &name, int num,
+    const ZPMeta::TableOptions* options) {
   slash::MutexLock l(&node_mutex_);
   std::string value;
   Status s;
@@ -577,6 +757,11 @@ Status ZPMetaServer::Distribute(const std::string &name, int num) {
   ZPMeta::Table table;
 
   table.set_name(name);
+  if (options != NULL) {
+    // Stored with the table meta, nodes receive it through Pull
+    // and overlay it over their node-wide rocksdb options
+    table.mutable_options()->CopyFrom(*options);
+  }
 
   std::srand(std::time(0));
   int rand_pos = (std::rand() % an_num);
@@ -611,6 +796,9 @@ Status ZPMetaServer::Distribute(const std::string &name, int num) {
   if (s.ok()) {
     version_++; 
     LOG(INFO) << "Set version in Distribute : " << version_;
+    std::set<std::string> changed;
+    changed.insert(name);
+    RecordVersionChange(changed);
   } else {
     LOG(ERROR) << "Set version error in Distribute, error: " << s.ToString();
     return s;
@@ -641,23 +829,23 @@ Status ZPMetaServer::Distribute(const std::string &name, int num) {
 }
 
 void ZPMetaServer::UpdateOffset(const ZPMeta::MetaCmd_Ping &ping) {
-  slash::MutexLock l(&offset_mutex_);
-  std::string ip_port;
+  std::string ip_port = slash::IpPortString(ping.node().ip(), ping.node().port());
   std::string p;
 //  LOG(INFO) << "Size: " << ping.offset_size();
   for (int i = 0; i < ping.offset_size(); i++) {
 //    LOG(INFO) << "process " << i;
-    auto iter = offset_.find(ping.offset(i).table_name());
-    if (iter == offset_.end()) {
-      LOG(INFO) << "Table: Not Found " << ping.offset(i).table_name() << ", insert!";
+    const std::string &table = ping.offset(i).table_name();
+    OffsetShard *shard = &offset_shards_[OffsetShardIndex(table)];
+    slash::MutexLock l(&shard->mutex);
+    auto iter = shard->offset.find(table);
+    if (iter == shard->offset.end()) {
+      LOG(INFO) << "Table: Not Found " << table << ", insert!";
       std::unordered_map<std::string, std::unordered_map<std::string, NodeOffset> > partition2node;
-      offset_.insert(std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::string, NodeOffset> > >::value_type(ping.offset(i).table_name(), partition2node));
-      iter = offset_.find(ping.offset(i).table_name());
+      shard->offset.insert(std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::string, NodeOffset> > >::value_type(table, partition2node));
+      iter = shard->offset.find(table);
     }
     p = std::to_string(ping.offset(i).partition());
 
-    ip_port = slash::IpPortString(ping.node().ip(), ping.node().port()); 
-
     NodeOffset node_offset = {ping.offset(i).filenum(), ping.offset(i).offset()};
     auto it = iter->second.find(p);
     if (it == iter->second.end()) {
@@ -668,7 +856,7 @@ void ZPMetaServer::UpdateOffset(const ZPMeta::MetaCmd_Ping &ping) {
     } else {
       it->second[ip_port] = node_offset;
     }
-//    LOG(INFO) << "Insert " << ping.offset(i).table_name() << ", " << p << " : " << ip_port << " -> " << node_offset.filenum << ":" << node_offset.offset;
+//    LOG(INFO) << "Insert " << table << ", " << p << " : " << ip_port << " -> " << node_offset.filenum << ":" << node_offset.offset;
   }
 }
 
@@ -693,6 +881,9 @@ Status ZPMetaServer::DropTable(const std::string &name) {
   if (s.ok()) {
     version_++; 
     LOG(INFO) << "Set version in DropTable : " << version_;
+    std::set<std::string> changed;
+    changed.insert(name);
+    RecordVersionChange(changed);
   } else {
     LOG(ERROR) << "Set version error in DropTable, error: " << s.ToString();
     return s;
@@ -773,6 +964,9 @@ bool ZPMetaServer::IsLeader() {
     if (leader_first_time_) {
       leader_first_time_ = false;
       CleanLeader();
+      // New incarnation, pinging nodes notice and resend their full
+      // offset snapshots into the empty offset map
+      leader_incarnation_ = slash::NowMicros();
       LOG(INFO) << "Become to leader";
       BecomeLeader(); // Just become leader
       LOG(INFO) << "Become to leader success";
@@ -809,17 +1003,19 @@ void ZPMetaServer::DebugNodes() {
 }
 
 void ZPMetaServer::DebugOffset() {
-  slash::MutexLock l(&offset_mutex_);
-  for (auto iter = offset_.begin(); iter != offset_.end(); iter++) {
-    std::string str = iter->first + " :\n";
-    for (auto ite = iter->second.begin(); ite != iter->second.end(); ite++) {
-      str += ("    " + ite->first + " : ");
-      for (auto it = ite->second.begin(); it != ite->second.end(); it++) {
-        str += (it->first + " -> " + std::to_string(it->second.filenum) + ":" + std::to_string(it->second.offset) + "; ");
+  for (size_t s = 0; s < kMetaOffsetShardNum; s++) {
+    slash::MutexLock l(&offset_shards_[s].mutex);
+    for (auto iter = offset_shards_[s].offset.begin(); iter != offset_shards_[s].offset.end(); iter++) {
+      std::string str = iter->first + " :\n";
+      for (auto ite = iter->second.begin(); ite != iter->second.end(); ite++) {
+        str += ("    " + ite->first + " : ");
+        for (auto it = ite->second.begin(); it != ite->second.end(); it++) {
+          str += (it->first + " -> " + std::to_string(it->second.filenum) + ":" + std::to_string(it->second.offset) + "; ");
+        }
+        str += "\n";
       }
-      str += "\n";
+      LOG(INFO) << str;
     }
-    LOG(INFO) << str;
   } 
 }
 
@@ -896,13 +1092,7 @@ bool ZPMetaServer::ProcessUpdateTableInfo(const ZPMetaUpdateTaskDeque task_deque
   }
 
   if (should_update_table_info) {
-    Status s = SetTable(*table_info);
-    if (!s.ok()) {
-      LOG(ERROR) << "SetTable in ProcessUpdateTableInfo error: " << s.ToString();
-      return false;
-    } else {
-     *should_update_version = true;
-    }
+    *should_update_version = true;
     std::string text_format;
     google::protobuf::TextFormat::PrintToString(*table_info, &text_format);
     LOG(INFO) << "table_info : [" << text_format << "]";
@@ -1212,9 +1402,10 @@ bool ZPMetaServer::ShouldRetryAddVersion(const ZPMetaUpdateTaskDeque task_deque)
 bool ZPMetaServer::GetSlaveOffset(const std::string &table,
     const std::string &ip_port, const int partition,
     int32_t *filenum, int64_t *offset) {
-  slash::MutexLock l(&offset_mutex_);
-  auto iter = offset_.find(table);
-  if (iter == offset_.end()) {
+  OffsetShard *shard = &offset_shards_[OffsetShardIndex(table)];
+  slash::MutexLock l(&shard->mutex);
+  auto iter = shard->offset.find(table);
+  if (iter == shard->offset.end()) {
     return false;
   }
   auto ite = iter->second.find(std::to_string(partition));
@@ -1289,6 +1480,14 @@ void ZPMetaServer::GetAllAliveNode(const ZPMeta::Nodes &nodes, std::vector<ZPMet
 }
 
 Status ZPMetaServer::GetTableInfo(const std::string &table, ZPMeta::Table *table_info) {
+  {
+    slash::MutexLock l(&info_cache_mutex_);
+    auto iter = table_info_cache_.find(table);
+    if (iter != table_info_cache_.end()) {
+      table_info->CopyFrom(*(iter->second));
+      return Status::OK();
+    }
+  }
   std::string value;
   Status fs = floyd_->DirtyRead(table, value);
   if (fs.ok()) {
@@ -1320,11 +1519,28 @@ void ZPMetaServer::RestoreNodeAlive(const std::vector<ZPMeta::NodeStatus> &alive
   struct timeval now;
   gettimeofday(&now, NULL);
 
-  slash::MutexLock l(&alive_mutex_);
-  node_alive_.clear();
+  for (size_t i = 0; i < kMetaAliveShardNum; i++) {
+    slash::MutexLock l(&alive_shards_[i].mutex);
+    alive_shards_[i].node_alive.clear();
+  }
+  for (size_t i = 0; i < kMetaAliveWheelSize; i++) {
+    slash::MutexLock l(&alive_wheel_[i].mutex);
+    alive_wheel_[i].nodes.clear();
+  }
+  wheel_checked_ = now.tv_sec;
+
   auto iter = alive_nodes.begin();
   while (iter != alive_nodes.end()) {
-    node_alive_[slash::IpPortString(iter->node().ip(), iter->node().port())] = now;
+    std::string ip_port = slash::IpPortString(iter->node().ip(), iter->node().port());
+    AliveShard *shard = &alive_shards_[AliveShardIndex(ip_port)];
+    {
+      slash::MutexLock l(&shard->mutex);
+      shard->node_alive[ip_port] = now;
+    }
+    AliveWheelBucket *bucket =
+      &alive_wheel_[(now.tv_sec + kNodeMetaTimeoutM + 1) % kMetaAliveWheelSize];
+    slash::MutexLock l(&bucket->mutex);
+    bucket->nodes.insert(ip_port);
     iter++;
   }
 }
@@ -1427,11 +1643,20 @@ Status ZPMetaServer::SetTable(const ZPMeta::Table &table) {
     LOG(ERROR) << "Serialization table failed, new value: " <<  new_value;
     return Status::Corruption("Serialize error");
   }
-  return Set(table.name(), new_value);
+  Status s = Set(table.name(), new_value);
+  if (s.ok()) {
+    CacheTableInfo(table);
+  }
+  return s;
 }
 
 Status ZPMetaServer::DeleteTable(const std::string &name) {
-  return Delete(name);
+  Status s = Delete(name);
+  if (s.ok()) {
+    slash::MutexLock l(&info_cache_mutex_);
+    table_info_cache_.erase(name);
+  }
+  return s;
 }
 
 Status ZPMetaServer::SetNodes(const ZPMeta::Nodes &nodes) {
@@ -1441,10 +1666,21 @@ Status ZPMetaServer::SetNodes(const ZPMeta::Nodes &nodes) {
     return Status::Corruption("Serialize error");
   }
 
-  return Set(kMetaNodes, new_value);
+  Status s = Set(kMetaNodes, new_value);
+  if (s.ok()) {
+    CacheNodes(nodes);
+  }
+  return s;
 }
 
 Status ZPMetaServer::GetAllNodes(ZPMeta::Nodes *nodes) {
+  {
+    slash::MutexLock l(&info_cache_mutex_);
+    if (nodes_cache_) {
+      nodes->CopyFrom(*nodes_cache_);
+      return Status::OK();
+    }
+  }
   // Load from Floyd
   std::string value;
   Status fs = floyd_->DirtyRead(kMetaNodes, value);
@@ -1497,6 +1733,16 @@ Status ZPMetaServer::InitVersion() {
       
       //node_mutex_ have already been hold in InitVersionIfNeeded
       nodes_.clear();
+      // The cache restarts with the freshly read table list: a version
+      // change may carry a table drop, and a lingering entry would keep
+      // serving the dropped table's routing forever. Followers come
+      // through here too, via Start and InitVersionIfNeeded. The nodes
+      // cache stays, only leader write paths fill it and CleanLeader
+      // already drops it on a leadership move
+      {
+        slash::MutexLock l(&info_cache_mutex_);
+        table_info_cache_.clear();
+      }
       for (int i = 0; i < tables.name_size(); i++) {
         fs = floyd_->Read(tables.name(i), value);
         if (!fs.ok()) {
@@ -1507,6 +1753,8 @@ Status ZPMetaServer::InitVersion() {
           LOG(ERROR) << "Deserialization table_info failed, table: " << tables.name(i) << " value: " << value;
           return Status::Corruption("Parse failed");
         }
+        // Parsed once here, served from memory onwards
+        CacheTableInfo(table_info);
 
         for (int j = 0; j < table_info.partitions_size(); j++) {
           partition = table_info.partitions(j);
@@ -1539,6 +1787,11 @@ Status ZPMetaServer::InitVersion() {
       DebugNodes();
   } else if (fs.IsNotFound()) {
     LOG(INFO) << "Read floyd tables in InitVersion, not found";
+    // No tables left at all, whatever was cached is gone with them
+    {
+      slash::MutexLock l(&info_cache_mutex_);
+      table_info_cache_.clear();
+    }
   } else {
     LOG(ERROR) << "Read floyd tables failed in InitVersion: " << fs.ToString() << ", try again";
     return Status::Corruption("Read tables error");
@@ -1547,6 +1800,9 @@ Status ZPMetaServer::InitVersion() {
   // Update Version
   version_ = tmp_version;
   LOG(INFO) << "Got version " << version_;
+
+  // Journal restarts empty, pullers with an old epoch get a full snapshot
+  version_changes_.clear();
   
   return Status::OK();
 }
@@ -1563,6 +1819,33 @@ Status ZPMetaServer::AddVersion() {
   return Status::OK();
 }
 
+void ZPMetaServer::RecordVersionChange(const std::set<std::string> &tables) {
+  // Every caller bumps version_ with node_mutex_ held
+  int version = version_;
+  version_changes_.push_back(std::make_pair(version, tables));
+  while (version_changes_.size() > kMetaVersionDiffCount) {
+    version_changes_.pop_front();
+  }
+}
+
+void ZPMetaServer::CacheTableInfo(const ZPMeta::Table &table) {
+  std::shared_ptr<const ZPMeta::Table> copy(new ZPMeta::Table(table));
+  slash::MutexLock l(&info_cache_mutex_);
+  table_info_cache_[table.name()] = copy;
+}
+
+void ZPMetaServer::CacheNodes(const ZPMeta::Nodes &nodes) {
+  std::shared_ptr<const ZPMeta::Nodes> copy(new ZPMeta::Nodes(nodes));
+  slash::MutexLock l(&info_cache_mutex_);
+  nodes_cache_ = copy;
+}
+
+void ZPMetaServer::DropInfoCache() {
+  slash::MutexLock l(&info_cache_mutex_);
+  table_info_cache_.clear();
+  nodes_cache_.reset();
+}
+
 Status ZPMetaServer::Set(const std::string &key, const std::string &value) {
   Status fs = floyd_->Write(key, value);
   if (fs.ok()) {
@@ -1611,6 +1894,9 @@ Status ZPMetaServer::BecomeLeader() {
     LOG(ERROR) << "GetAllNodes error in BecomeLeader, error: " << s.ToString();
     return s;
   }
+  if (s.ok()) {
+    CacheNodes(nodes);
+  }
   std::vector<ZPMeta::NodeStatus> alive_nodes;
   GetAllAliveNode(nodes, &alive_nodes);
   RestoreNodeAlive(alive_nodes);
@@ -1626,6 +1912,8 @@ Status ZPMetaServer::BecomeLeader() {
 }
 
 void ZPMetaServer::CleanLeader() {
+  // Whatever we cached as leader is no longer ours to serve
+  DropInfoCache();
   if (leader_cli_) {
     leader_cli_->Close();
     delete leader_cli_;
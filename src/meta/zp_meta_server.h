@@ -5,7 +5,9 @@
 #include <string>
 #include <unordered_map>
 #include <set>
+#include <deque>
 #include <atomic>
+#include <memory>
 
 #include "include/zp_conf.h"
 #include "include/zp_const.h"
@@ -72,6 +74,11 @@ class ZPMetaServer {
   int version() {
     return version_;
   }
+  // Changes every time this meta becomes leader; shipped in the ping
+  // response so nodes resend a full offset snapshot to a new leader
+  int64_t leader_incarnation() {
+    return leader_incarnation_;
+  }
 
   //Cmd related
   Cmd* GetCmd(const int op);
@@ -86,6 +93,7 @@ class ZPMetaServer {
   
   // Meta related
   Status GetMSInfo(const std::set<std::string> &tables, ZPMeta::MetaCmdResponse_Pull *ms_info);
+  Status GetMSInfoDiff(int epoch, const std::set<std::string> &tables, ZPMeta::MetaCmdResponse_Pull *ms_info);
   Status GetTableListForNode(const std::string &ip_port, std::set<std::string> *tables);
   Status RemoveSlave(const std::string &table, int partition, const ZPMeta::Node &node);
   Status SetMaster(const std::string &table, int partition, const ZPMeta::Node &node);
@@ -94,7 +102,8 @@ class ZPMetaServer {
   Status GetMetaStatus(std::string *result);
   Status GetTableList(ZPMeta::MetaCmdResponse_ListTable *tables);
   Status GetAllNodes(ZPMeta::MetaCmdResponse_ListNode *nodes);
-  Status Distribute(const std::string &table, int num);
+  Status Distribute(const std::string &table, int num,
+      const ZPMeta::TableOptions* options = NULL);
   void UpdateOffset(const ZPMeta::MetaCmd_Ping &ping);
   Status DropTable(const std::string &table);
   Status InitVersionIfNeeded();
@@ -129,6 +138,7 @@ private:
   slash::Mutex server_mutex_;
   std::atomic<bool> started_;
   std::atomic<int> version_;
+  std::atomic<int64_t> leader_incarnation_;
 
   // Cmd related
   void InitClientCmdTable();
@@ -145,14 +155,30 @@ private:
   void DoUpNodeForTableInfo(ZPMeta::Table *table_info, const std::string ip, int port, bool *should_update_table_info);
   void DoClearStuckForTableInfo(ZPMeta::Table *table_info, const std::string& table, int partition, bool *should_update_table_info);
   bool ProcessUpdateNodes(const ZPMetaUpdateTaskDeque task_deque, ZPMeta::Nodes *nodes);
+  void CoalesceMetaUpdateTasks(ZPMetaUpdateTaskDeque *task_deque);
   void AddClearStuckTaskIfNeeded(const ZPMetaUpdateTaskDeque &task_deque);
   bool ShouldRetryAddVersion(const ZPMetaUpdateTaskDeque task_deque);
 
   ZPMetaUpdateThread* update_thread_;
   ZPMetaUpdateTaskDeque task_deque_;
-  slash::Mutex alive_mutex_;
   slash::Mutex task_mutex_;
-  NodeAliveMap node_alive_;
+  // Liveness as a hashed timer wheel: a ping touches one shard lock and
+  // one wheel bucket, the cron drains only buckets due since its last
+  // turn and re-checks the shard deadline to drop stale wheel entries
+  struct AliveShard {
+    slash::Mutex mutex;
+    NodeAliveMap node_alive;
+  };
+  struct AliveWheelBucket {
+    slash::Mutex mutex;
+    std::set<std::string> nodes;
+  };
+  static size_t AliveShardIndex(const std::string &ip_port) {
+    return std::hash<std::string>()(ip_port) % kMetaAliveShardNum;
+  }
+  AliveShard alive_shards_[kMetaAliveShardNum];
+  AliveWheelBucket alive_wheel_[kMetaAliveWheelSize];
+  std::atomic<time_t> wheel_checked_;
 
   // Meta related
   bool GetSlaveOffset(const std::string &table, const std::string &ip_port, const int partition, int32_t *filenum, int64_t *offset);
@@ -172,14 +198,46 @@ private:
   Status GetAllNodes(ZPMeta::Nodes *nodes);
   Status InitVersion();
   Status AddVersion();
+  void RecordVersionChange(const std::set<std::string> &tables);
 
 
-  std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::string, NodeOffset> > > offset_;
+  // Node offsets sharded by table with a lock per shard, so pings
+  // reporting different tables no longer serialize on one mutex
+  struct OffsetShard {
+    slash::Mutex mutex;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::string, NodeOffset> > > offset;
+  };
+  static size_t OffsetShardIndex(const std::string &table) {
+    return std::hash<std::string>()(table) % kMetaOffsetShardNum;
+  }
+  OffsetShard offset_shards_[kMetaOffsetShardNum];
   std::unordered_map<std::string, std::set<std::string> > nodes_;
+  // Recent version bumps with the tables each one changed, in version order,
+  // serves the epoch-diff Pull; protected by node_mutex_ like nodes_
+  std::deque<std::pair<int, std::set<std::string> > > version_changes_;
+  // Built Pull payloads of the current version keyed by the requested
+  // table set, a version bump invalidates the cache wholesale
+  slash::Mutex pull_cache_mutex_;
+  int pull_cache_version_;
+  std::unordered_map<std::string, ZPMeta::MetaCmdResponse_Pull> pull_cache_;
   std::vector<StuckState> stuck_;
-  slash::Mutex offset_mutex_; //protect offset_ & stuck_
   slash::Mutex node_mutex_;
 
+  // Write-through copy of the table infos and the node list kept in
+  // floyd, so the hot read paths skip the raft round-trip and the
+  // reparse of bytes this process just serialized. Every meta warms
+  // the table side: InitVersion runs on Start and on each version
+  // change seen by InitVersionIfNeeded, restarting the cache with the
+  // freshly read table list so dropped tables cannot linger. The
+  // leader additionally keeps it current from the floyd write paths
+  // and drops it wholesale when leadership moves
+  slash::Mutex info_cache_mutex_;
+  std::unordered_map<std::string, std::shared_ptr<const ZPMeta::Table> > table_info_cache_;
+  std::shared_ptr<const ZPMeta::Nodes> nodes_cache_;
+  void CacheTableInfo(const ZPMeta::Table &table);
+  void CacheNodes(const ZPMeta::Nodes &nodes);
+  void DropInfoCache();
+
   // Floyd related
   Status Set(const std::string &key, const std::string &value);
   Status Get(const std::string &key, std::string &value);
@@ -59,6 +59,18 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* CmdRequest_FlushDB_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   CmdRequest_FlushDB_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdRequest_Mset_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdRequest_Mset_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdRequest_Scan_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdRequest_Scan_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdRequest_Cas_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdRequest_Cas_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdRequest_Incrby_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdRequest_Incrby_reflection_ = NULL;
 const ::google::protobuf::Descriptor* CmdResponse_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   CmdResponse_reflection_ = NULL;
@@ -83,15 +95,42 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* CmdResponse_InfoServer_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   CmdResponse_InfoServer_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdResponse_Scan_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdResponse_Scan_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdResponse_InfoLatency_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdResponse_InfoLatency_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdResponse_Cas_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdResponse_Cas_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdResponse_Incrby_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdResponse_Incrby_reflection_ = NULL;
+const ::google::protobuf::Descriptor* CmdResponse_InfoSlowlog_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  CmdResponse_InfoSlowlog_reflection_ = NULL;
 const ::google::protobuf::Descriptor* BinlogSkip_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   BinlogSkip_reflection_ = NULL;
 const ::google::protobuf::Descriptor* SyncLease_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   SyncLease_reflection_ = NULL;
+const ::google::protobuf::Descriptor* SyncAck_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  SyncAck_reflection_ = NULL;
 const ::google::protobuf::Descriptor* SyncRequest_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   SyncRequest_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Kv_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Kv_reflection_ = NULL;
+const ::google::protobuf::Descriptor* SyncItem_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  SyncItem_reflection_ = NULL;
+const ::google::protobuf::Descriptor* BinlogBatch_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  BinlogBatch_reflection_ = NULL;
 const ::google::protobuf::EnumDescriptor* Type_descriptor_ = NULL;
 const ::google::protobuf::EnumDescriptor* SyncType_descriptor_ = NULL;
 const ::google::protobuf::EnumDescriptor* StatusCode_descriptor_ = NULL;
@@ -193,7 +232,7 @@ void protobuf_AssignDesc_client_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(PartitionState));
   CmdRequest_descriptor_ = file->message_type(5);
-  static const int CmdRequest_offsets_[8] = {
+  static const int CmdRequest_offsets_[12] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, sync_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, set_),
@@ -202,6 +241,10 @@ void protobuf_AssignDesc_client_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, info_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, mget_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, flushdb_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, mset_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, scan_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, cas_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, incrby_),
   };
   CmdRequest_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -233,12 +276,13 @@ void protobuf_AssignDesc_client_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CmdRequest_Sync));
   CmdRequest_Set_descriptor_ = CmdRequest_descriptor_->nested_type(1);
-  static const int CmdRequest_Set_offsets_[5] = {
+  static const int CmdRequest_Set_offsets_[6] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, table_name_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, key_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, value_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, uuid_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, expire_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Set, ack_replicas_),
   };
   CmdRequest_Set_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -252,10 +296,11 @@ void protobuf_AssignDesc_client_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CmdRequest_Set));
   CmdRequest_Get_descriptor_ = CmdRequest_descriptor_->nested_type(2);
-  static const int CmdRequest_Get_offsets_[3] = {
+  static const int CmdRequest_Get_offsets_[4] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, table_name_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, key_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, uuid_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Get, allow_stale_),
   };
   CmdRequest_Get_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -332,8 +377,80 @@ void protobuf_AssignDesc_client_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CmdRequest_FlushDB));
+  CmdRequest_Mset_descriptor_ = CmdRequest_descriptor_->nested_type(7);
+  static const int CmdRequest_Mset_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Mset, table_name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Mset, kvs_),
+  };
+  CmdRequest_Mset_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdRequest_Mset_descriptor_,
+      CmdRequest_Mset::default_instance_,
+      CmdRequest_Mset_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Mset, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Mset, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdRequest_Mset));
+  CmdRequest_Scan_descriptor_ = CmdRequest_descriptor_->nested_type(8);
+  static const int CmdRequest_Scan_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Scan, table_name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Scan, partition_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Scan, key_start_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Scan, limit_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Scan, max_bytes_),
+  };
+  CmdRequest_Scan_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdRequest_Scan_descriptor_,
+      CmdRequest_Scan::default_instance_,
+      CmdRequest_Scan_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Scan, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Scan, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdRequest_Scan));
+  CmdRequest_Cas_descriptor_ = CmdRequest_descriptor_->nested_type(9);
+  static const int CmdRequest_Cas_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Cas, table_name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Cas, key_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Cas, value_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Cas, expect_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Cas, uuid_),
+  };
+  CmdRequest_Cas_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdRequest_Cas_descriptor_,
+      CmdRequest_Cas::default_instance_,
+      CmdRequest_Cas_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Cas, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Cas, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdRequest_Cas));
+  CmdRequest_Incrby_descriptor_ = CmdRequest_descriptor_->nested_type(10);
+  static const int CmdRequest_Incrby_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Incrby, table_name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Incrby, key_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Incrby, by_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Incrby, uuid_),
+  };
+  CmdRequest_Incrby_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdRequest_Incrby_descriptor_,
+      CmdRequest_Incrby::default_instance_,
+      CmdRequest_Incrby_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Incrby, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Incrby, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdRequest_Incrby));
   CmdResponse_descriptor_ = file->message_type(6);
-  static const int CmdResponse_offsets_[11] = {
+  static const int CmdResponse_offsets_[16] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, code_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, msg_),
@@ -345,6 +462,11 @@ void protobuf_AssignDesc_client_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, info_repl_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, mget_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, info_server_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, scan_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, info_latency_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, cas_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, incrby_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, info_slowlog_),
   };
   CmdResponse_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -473,6 +595,95 @@ void protobuf_AssignDesc_client_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(CmdResponse_InfoServer));
+  CmdResponse_Scan_descriptor_ = CmdResponse_descriptor_->nested_type(7);
+  static const int CmdResponse_Scan_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Scan, kvs_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Scan, next_key_),
+  };
+  CmdResponse_Scan_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdResponse_Scan_descriptor_,
+      CmdResponse_Scan::default_instance_,
+      CmdResponse_Scan_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Scan, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Scan, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdResponse_Scan));
+  CmdResponse_InfoLatency_descriptor_ = CmdResponse_descriptor_->nested_type(8);
+  static const int CmdResponse_InfoLatency_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoLatency, cmd_type_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoLatency, count_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoLatency, p50_us_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoLatency, p99_us_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoLatency, p999_us_),
+  };
+  CmdResponse_InfoLatency_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdResponse_InfoLatency_descriptor_,
+      CmdResponse_InfoLatency::default_instance_,
+      CmdResponse_InfoLatency_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoLatency, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoLatency, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdResponse_InfoLatency));
+  CmdResponse_Cas_descriptor_ = CmdResponse_descriptor_->nested_type(9);
+  static const int CmdResponse_Cas_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Cas, value_),
+  };
+  CmdResponse_Cas_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdResponse_Cas_descriptor_,
+      CmdResponse_Cas::default_instance_,
+      CmdResponse_Cas_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Cas, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Cas, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdResponse_Cas));
+  CmdResponse_Incrby_descriptor_ = CmdResponse_descriptor_->nested_type(10);
+  static const int CmdResponse_Incrby_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Incrby, value_),
+  };
+  CmdResponse_Incrby_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdResponse_Incrby_descriptor_,
+      CmdResponse_Incrby::default_instance_,
+      CmdResponse_Incrby_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Incrby, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Incrby, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdResponse_Incrby));
+  CmdResponse_InfoSlowlog_descriptor_ = CmdResponse_descriptor_->nested_type(11);
+  static const int CmdResponse_InfoSlowlog_offsets_[10] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, time_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, table_name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, partition_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, cmd_type_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, total_us_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, suspend_wait_us_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, lock_wait_us_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, db_us_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, binlog_us_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, ack_wait_us_),
+  };
+  CmdResponse_InfoSlowlog_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      CmdResponse_InfoSlowlog_descriptor_,
+      CmdResponse_InfoSlowlog::default_instance_,
+      CmdResponse_InfoSlowlog_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_InfoSlowlog, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(CmdResponse_InfoSlowlog));
   BinlogSkip_descriptor_ = file->message_type(7);
   static const int BinlogSkip_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogSkip, table_name_),
@@ -507,8 +718,25 @@ void protobuf_AssignDesc_client_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SyncLease));
-  SyncRequest_descriptor_ = file->message_type(9);
-  static const int SyncRequest_offsets_[7] = {
+  SyncAck_descriptor_ = file->message_type(9);
+  static const int SyncAck_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncAck, table_name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncAck, partition_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncAck, sync_offset_),
+  };
+  SyncAck_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      SyncAck_descriptor_,
+      SyncAck::default_instance_,
+      SyncAck_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncAck, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncAck, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(SyncAck));
+  SyncRequest_descriptor_ = file->message_type(10);
+  static const int SyncRequest_offsets_[9] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, sync_type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, epoch_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, from_),
@@ -516,6 +744,8 @@ void protobuf_AssignDesc_client_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, request_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, binlog_skip_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, sync_lease_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, binlog_batch_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncRequest, sync_ack_),
   };
   SyncRequest_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -528,6 +758,56 @@ void protobuf_AssignDesc_client_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(SyncRequest));
+  Kv_descriptor_ = file->message_type(11);
+  static const int Kv_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Kv, key_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Kv, value_),
+  };
+  Kv_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Kv_descriptor_,
+      Kv::default_instance_,
+      Kv_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Kv, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Kv, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Kv));
+  SyncItem_descriptor_ = file->message_type(12);
+  static const int SyncItem_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncItem, sync_offset_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncItem, request_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncItem, skip_gap_),
+  };
+  SyncItem_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      SyncItem_descriptor_,
+      SyncItem::default_instance_,
+      SyncItem_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncItem, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncItem, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(SyncItem));
+  BinlogBatch_descriptor_ = file->message_type(13);
+  static const int BinlogBatch_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogBatch, table_name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogBatch, partition_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogBatch, items_),
+  };
+  BinlogBatch_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      BinlogBatch_descriptor_,
+      BinlogBatch::default_instance_,
+      BinlogBatch_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogBatch, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinlogBatch, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(BinlogBatch));
   Type_descriptor_ = file->enum_type(0);
   SyncType_descriptor_ = file->enum_type(1);
   StatusCode_descriptor_ = file->enum_type(2);
@@ -569,6 +849,14 @@ void protobuf_RegisterTypes(const ::std::string&) {
     CmdRequest_Mget_descriptor_, &CmdRequest_Mget::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     CmdRequest_FlushDB_descriptor_, &CmdRequest_FlushDB::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdRequest_Mset_descriptor_, &CmdRequest_Mset::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdRequest_Scan_descriptor_, &CmdRequest_Scan::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdRequest_Cas_descriptor_, &CmdRequest_Cas::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdRequest_Incrby_descriptor_, &CmdRequest_Incrby::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     CmdResponse_descriptor_, &CmdResponse::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -585,12 +873,30 @@ void protobuf_RegisterTypes(const ::std::string&) {
     CmdResponse_Mget_descriptor_, &CmdResponse_Mget::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     CmdResponse_InfoServer_descriptor_, &CmdResponse_InfoServer::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdResponse_Scan_descriptor_, &CmdResponse_Scan::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdResponse_InfoLatency_descriptor_, &CmdResponse_InfoLatency::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdResponse_Cas_descriptor_, &CmdResponse_Cas::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdResponse_Incrby_descriptor_, &CmdResponse_Incrby::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    CmdResponse_InfoSlowlog_descriptor_, &CmdResponse_InfoSlowlog::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     BinlogSkip_descriptor_, &BinlogSkip::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     SyncLease_descriptor_, &SyncLease::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    SyncAck_descriptor_, &SyncAck::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     SyncRequest_descriptor_, &SyncRequest::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Kv_descriptor_, &Kv::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    SyncItem_descriptor_, &SyncItem::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    BinlogBatch_descriptor_, &BinlogBatch::default_instance());
 }
 
 }  // namespace
@@ -622,6 +928,14 @@ void protobuf_ShutdownFile_client_2eproto() {
   delete CmdRequest_Mget_reflection_;
   delete CmdRequest_FlushDB::default_instance_;
   delete CmdRequest_FlushDB_reflection_;
+  delete CmdRequest_Mset::default_instance_;
+  delete CmdRequest_Mset_reflection_;
+  delete CmdRequest_Scan::default_instance_;
+  delete CmdRequest_Scan_reflection_;
+  delete CmdRequest_Cas::default_instance_;
+  delete CmdRequest_Cas_reflection_;
+  delete CmdRequest_Incrby::default_instance_;
+  delete CmdRequest_Incrby_reflection_;
   delete CmdResponse::default_instance_;
   delete CmdResponse_reflection_;
   delete CmdResponse_Sync::default_instance_;
@@ -638,12 +952,30 @@ void protobuf_ShutdownFile_client_2eproto() {
   delete CmdResponse_Mget_reflection_;
   delete CmdResponse_InfoServer::default_instance_;
   delete CmdResponse_InfoServer_reflection_;
+  delete CmdResponse_Scan::default_instance_;
+  delete CmdResponse_Scan_reflection_;
+  delete CmdResponse_InfoLatency::default_instance_;
+  delete CmdResponse_InfoLatency_reflection_;
+  delete CmdResponse_Cas::default_instance_;
+  delete CmdResponse_Cas_reflection_;
+  delete CmdResponse_Incrby::default_instance_;
+  delete CmdResponse_Incrby_reflection_;
+  delete CmdResponse_InfoSlowlog::default_instance_;
+  delete CmdResponse_InfoSlowlog_reflection_;
   delete BinlogSkip::default_instance_;
   delete BinlogSkip_reflection_;
   delete SyncLease::default_instance_;
   delete SyncLease_reflection_;
+  delete SyncAck::default_instance_;
+  delete SyncAck_reflection_;
   delete SyncRequest::default_instance_;
   delete SyncRequest_reflection_;
+  delete Kv::default_instance_;
+  delete Kv_reflection_;
+  delete SyncItem::default_instance_;
+  delete SyncItem_reflection_;
+  delete BinlogBatch::default_instance_;
+  delete BinlogBatch_reflection_;
 }
 
 void protobuf_AddDesc_client_2eproto() {
@@ -665,65 +997,107 @@ void protobuf_AddDesc_client_2eproto() {
     "ient.Node\022\034\n\006slaves\030\005 \003(\0132\014.client.Node\022"
     "\'\n\013sync_offset\030\006 \002(\0132\022.client.SyncOffset"
     "\022\'\n\010fallback\030\007 \001(\0132\025.client.SlaveFallbac"
-    "k\"\370\005\n\nCmdRequest\022\032\n\004type\030\001 \002(\0162\014.client."
+    "k\"\367\t\n\nCmdRequest\022\032\n\004type\030\001 \002(\0162\014.client."
     "Type\022%\n\004sync\030\002 \001(\0132\027.client.CmdRequest.S"
     "ync\022#\n\003set\030\003 \001(\0132\026.client.CmdRequest.Set"
     "\022#\n\003get\030\004 \001(\0132\026.client.CmdRequest.Get\022#\n"
     "\003del\030\005 \001(\0132\026.client.CmdRequest.Del\022%\n\004in"
     "fo\030\006 \001(\0132\027.client.CmdRequest.Info\022%\n\004mge"
     "t\030\007 \001(\0132\027.client.CmdRequest.Mget\022+\n\007flus"
-    "hdb\030\010 \001(\0132\032.client.CmdRequest.FlushDB\032n\n"
-    "\004Sync\022\032\n\004node\030\001 \002(\0132\014.client.Node\022\022\n\ntab"
-    "le_name\030\002 \002(\t\022\'\n\013sync_offset\030\003 \002(\0132\022.cli"
-    "ent.SyncOffset\022\r\n\005epoch\030\004 \002(\003\032f\n\003Set\022\022\n\n"
-    "table_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\r\n\005value\030\003"
-    " \002(\014\022\014\n\004uuid\030\004 \001(\t\022!\n\006expire\030\005 \001(\0132\021.cli"
-    "ent.KeyExpire\0324\n\003Get\022\022\n\ntable_name\030\001 \002(\t"
-    "\022\013\n\003key\030\002 \002(\t\022\014\n\004uuid\030\003 \001(\t\0324\n\003Del\022\022\n\nta"
-    "ble_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\014\n\004uuid\030\003 \001("
-    "\t\032\032\n\004Info\022\022\n\ntable_name\030\001 \001(\t\032(\n\004Mget\022\022\n"
-    "\ntable_name\030\001 \002(\t\022\014\n\004keys\030\002 \003(\t\0323\n\007Flush"
-    "DB\022\022\n\ntable_name\030\001 \002(\t\022\024\n\014partition_id\030\002"
-    " \002(\005\"\226\007\n\013CmdResponse\022\032\n\004type\030\001 \002(\0162\014.cli"
-    "ent.Type\022 \n\004code\030\002 \002(\0162\022.client.StatusCo"
-    "de\022\013\n\003msg\030\003 \001(\t\022&\n\004sync\030\004 \001(\0132\030.client.C"
-    "mdResponse.Sync\022$\n\003get\030\005 \001(\0132\027.client.Cm"
-    "dResponse.Get\022\036\n\010redirect\030\006 \001(\0132\014.client"
-    ".Node\0221\n\ninfo_stats\030\007 \003(\0132\035.client.CmdRe"
-    "sponse.InfoStats\0227\n\rinfo_capacity\030\010 \003(\0132"
-    " .client.CmdResponse.InfoCapacity\022/\n\tinf"
-    "o_repl\030\t \003(\0132\034.client.CmdResponse.InfoRe"
-    "pl\022&\n\004mget\030\n \003(\0132\030.client.CmdResponse.Mg"
-    "et\0223\n\013info_server\030\013 \001(\0132\036.client.CmdResp"
-    "onse.InfoServer\032C\n\004Sync\022\022\n\ntable_name\030\001 "
-    "\002(\t\022\'\n\013sync_offset\030\002 \002(\0132\022.client.SyncOf"
-    "fset\032\024\n\003Get\022\r\n\005value\030\001 \001(\014\032B\n\tInfoStats\022"
-    "\022\n\ntable_name\030\001 \002(\t\022\024\n\014total_querys\030\002 \002("
-    "\003\022\013\n\003qps\030\003 \002(\005\032@\n\014InfoCapacity\022\022\n\ntable_"
-    "name\030\001 \002(\t\022\014\n\004used\030\002 \002(\003\022\016\n\006remain\030\003 \002(\003"
-    "\032f\n\010InfoRepl\022\022\n\ntable_name\030\001 \002(\t\022\025\n\rpart"
-    "ition_cnt\030\002 \002(\003\022/\n\017partition_state\030\003 \003(\013"
-    "2\026.client.PartitionState\032\"\n\004Mget\022\013\n\003key\030"
-    "\001 \002(\t\022\r\n\005value\030\002 \002(\014\032g\n\nInfoServer\022\r\n\005ep"
-    "och\030\001 \002(\003\022\023\n\013table_names\030\002 \003(\t\022\036\n\010cur_me"
-    "ta\030\003 \002(\0132\014.client.Node\022\025\n\rmeta_renewing\030"
-    "\004 \002(\010\"C\n\nBinlogSkip\022\022\n\ntable_name\030\001 \002(\t\022"
-    "\024\n\014partition_id\030\002 \002(\005\022\013\n\003gap\030\003 \002(\003\"D\n\tSy"
-    "ncLease\022\022\n\ntable_name\030\001 \002(\t\022\024\n\014partition"
-    "_id\030\002 \002(\005\022\r\n\005lease\030\003 \002(\003\"\373\001\n\013SyncRequest"
-    "\022#\n\tsync_type\030\001 \002(\0162\020.client.SyncType\022\r\n"
-    "\005epoch\030\002 \002(\003\022\032\n\004from\030\003 \002(\0132\014.client.Node"
-    "\022\'\n\013sync_offset\030\004 \001(\0132\022.client.SyncOffse"
-    "t\022#\n\007request\030\005 \001(\0132\022.client.CmdRequest\022\'"
-    "\n\013binlog_skip\030\006 \001(\0132\022.client.BinlogSkip\022"
-    "%\n\nsync_lease\030\007 \001(\0132\021.client.SyncLease*\201"
-    "\001\n\004Type\022\010\n\004SYNC\020\000\022\007\n\003SET\020\001\022\007\n\003GET\020\002\022\007\n\003D"
-    "EL\020\003\022\r\n\tINFOSTATS\020\004\022\020\n\014INFOCAPACITY\020\005\022\014\n"
-    "\010INFOREPL\020\006\022\010\n\004MGET\020\007\022\016\n\nINFOSERVER\020\010\022\013\n"
-    "\007FLUSHDB\020\t*(\n\010SyncType\022\007\n\003CMD\020\000\022\010\n\004SKIP\020"
-    "\001\022\t\n\005LEASE\020\002*U\n\nStatusCode\022\007\n\003kOk\020\000\022\r\n\tk"
-    "NotFound\020\001\022\t\n\005kWait\020\002\022\n\n\006kError\020\003\022\r\n\tkFa"
-    "llback\020\004\022\t\n\005kMove\020\005", 2819);
+    "hdb\030\010 \001(\0132\032.client.CmdRequest.FlushDB\022%\n"
+    "\004mset\030\t \001(\0132\027.client.CmdRequest.Mset\022%\n\004"
+    "scan\030\n \001(\0132\027.client.CmdRequest.Scan\022#\n\003c"
+    "as\030\013 \001(\0132\026.client.CmdRequest.Cas\022)\n\006incr"
+    "by\030\014 \001(\0132\031.client.CmdRequest.Incrby\032n\n\004S"
+    "ync\022\032\n\004node\030\001 \002(\0132\014.client.Node\022\022\n\ntable"
+    "_name\030\002 \002(\t\022\'\n\013sync_offset\030\003 \002(\0132\022.clien"
+    "t.SyncOffset\022\r\n\005epoch\030\004 \002(\003\032|\n\003Set\022\022\n\nta"
+    "ble_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\r\n\005value\030\003 \002"
+    "(\014\022\014\n\004uuid\030\004 \001(\t\022!\n\006expire\030\005 \001(\0132\021.clien"
+    "t.KeyExpire\022\024\n\014ack_replicas\030\006 \001(\005\032I\n\003Get"
+    "\022\022\n\ntable_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\014\n\004uui"
+    "d\030\003 \001(\t\022\023\n\013allow_stale\030\004 \001(\010\0324\n\003Del\022\022\n\nt"
+    "able_name\030\001 \002(\t\022\013\n\003key\030\002 \002(\t\022\014\n\004uuid\030\003 \001"
+    "(\t\032\032\n\004Info\022\022\n\ntable_name\030\001 \001(\t\032(\n\004Mget\022\022"
+    "\n\ntable_name\030\001 \002(\t\022\014\n\004keys\030\002 \003(\t\0323\n\007Flus"
+    "hDB\022\022\n\ntable_name\030\001 \002(\t\022\024\n\014partition_id\030"
+    "\002 \002(\005\0323\n\004Mset\022\022\n\ntable_name\030\001 \002(\t\022\027\n\003kvs"
+    "\030\002 \003(\0132\n.client.Kv\032e\n\004Scan\022\022\n\ntable_name"
+    "\030\001 \002(\t\022\024\n\014partition_id\030\002 \002(\005\022\021\n\tkey_star"
+    "t\030\003 \001(\t\022\r\n\005limit\030\004 \001(\005\022\021\n\tmax_bytes\030\005 \001("
+    "\003\032S\n\003Cas\022\022\n\ntable_name\030\001 \002(\t\022\013\n\003key\030\002 \002("
+    "\t\022\r\n\005value\030\003 \002(\014\022\016\n\006expect\030\004 \001(\014\022\014\n\004uuid"
+    "\030\005 \001(\t\032C\n\006Incrby\022\022\n\ntable_name\030\001 \002(\t\022\013\n\003"
+    "key\030\002 \002(\t\022\n\n\002by\030\003 \002(\003\022\014\n\004uuid\030\004 \001(\t\"\220\014\n\013"
+    "CmdResponse\022\032\n\004type\030\001 \002(\0162\014.client.Type\022"
+    " \n\004code\030\002 \002(\0162\022.client.StatusCode\022\013\n\003msg"
+    "\030\003 \001(\t\022&\n\004sync\030\004 \001(\0132\030.client.CmdRespons"
+    "e.Sync\022$\n\003get\030\005 \001(\0132\027.client.CmdResponse"
+    ".Get\022\036\n\010redirect\030\006 \001(\0132\014.client.Node\0221\n\n"
+    "info_stats\030\007 \003(\0132\035.client.CmdResponse.In"
+    "foStats\0227\n\rinfo_capacity\030\010 \003(\0132 .client."
+    "CmdResponse.InfoCapacity\022/\n\tinfo_repl\030\t "
+    "\003(\0132\034.client.CmdResponse.InfoRepl\022&\n\004mge"
+    "t\030\n \003(\0132\030.client.CmdResponse.Mget\0223\n\013inf"
+    "o_server\030\013 \001(\0132\036.client.CmdResponse.Info"
+    "Server\022&\n\004scan\030\014 \001(\0132\030.client.CmdRespons"
+    "e.Scan\0225\n\014info_latency\030\r \003(\0132\037.client.Cm"
+    "dResponse.InfoLatency\022$\n\003cas\030\016 \001(\0132\027.cli"
+    "ent.CmdResponse.Cas\022*\n\006incrby\030\017 \001(\0132\032.cl"
+    "ient.CmdResponse.Incrby\0225\n\014info_slowlog\030"
+    "\020 \003(\0132\037.client.CmdResponse.InfoSlowlog\032C"
+    "\n\004Sync\022\022\n\ntable_name\030\001 \002(\t\022\'\n\013sync_offse"
+    "t\030\002 \002(\0132\022.client.SyncOffset\032\024\n\003Get\022\r\n\005va"
+    "lue\030\001 \001(\014\032B\n\tInfoStats\022\022\n\ntable_name\030\001 \002"
+    "(\t\022\024\n\014total_querys\030\002 \002(\003\022\013\n\003qps\030\003 \002(\005\032@\n"
+    "\014InfoCapacity\022\022\n\ntable_name\030\001 \002(\t\022\014\n\004use"
+    "d\030\002 \002(\003\022\016\n\006remain\030\003 \002(\003\032f\n\010InfoRepl\022\022\n\nt"
+    "able_name\030\001 \002(\t\022\025\n\rpartition_cnt\030\002 \002(\003\022/"
+    "\n\017partition_state\030\003 \003(\0132\026.client.Partiti"
+    "onState\032\"\n\004Mget\022\013\n\003key\030\001 \002(\t\022\r\n\005value\030\002 "
+    "\002(\014\032g\n\nInfoServer\022\r\n\005epoch\030\001 \002(\003\022\023\n\013tabl"
+    "e_names\030\002 \003(\t\022\036\n\010cur_meta\030\003 \002(\0132\014.client"
+    ".Node\022\025\n\rmeta_renewing\030\004 \002(\010\0321\n\004Scan\022\027\n\003"
+    "kvs\030\001 \003(\0132\n.client.Kv\022\020\n\010next_key\030\002 \001(\t\032"
+    "_\n\013InfoLatency\022\020\n\010cmd_type\030\001 \002(\005\022\r\n\005coun"
+    "t\030\002 \002(\003\022\016\n\006p50_us\030\003 \002(\003\022\016\n\006p99_us\030\004 \002(\003\022"
+    "\017\n\007p999_us\030\005 \002(\003\032\024\n\003Cas\022\r\n\005value\030\001 \001(\014\032\027"
+    "\n\006Incrby\022\r\n\005value\030\001 \002(\003\032\314\001\n\013InfoSlowlog\022"
+    "\014\n\004time\030\001 \002(\003\022\022\n\ntable_name\030\002 \002(\t\022\021\n\tpar"
+    "tition\030\003 \002(\005\022\020\n\010cmd_type\030\004 \002(\005\022\020\n\010total_"
+    "us\030\005 \002(\003\022\027\n\017suspend_wait_us\030\006 \002(\003\022\024\n\014loc"
+    "k_wait_us\030\007 \002(\003\022\r\n\005db_us\030\010 \002(\003\022\021\n\tbinlog"
+    "_us\030\t \002(\003\022\023\n\013ack_wait_us\030\n \002(\003\"C\n\nBinlog"
+    "Skip\022\022\n\ntable_name\030\001 \002(\t\022\024\n\014partition_id"
+    "\030\002 \002(\005\022\013\n\003gap\030\003 \002(\003\"D\n\tSyncLease\022\022\n\ntabl"
+    "e_name\030\001 \002(\t\022\024\n\014partition_id\030\002 \002(\005\022\r\n\005le"
+    "ase\030\003 \002(\003\"\\\n\007SyncAck\022\022\n\ntable_name\030\001 \002(\t"
+    "\022\024\n\014partition_id\030\002 \002(\005\022\'\n\013sync_offset\030\003 "
+    "\002(\0132\022.client.SyncOffset\"\311\002\n\013SyncRequest\022"
+    "#\n\tsync_type\030\001 \002(\0162\020.client.SyncType\022\r\n\005"
+    "epoch\030\002 \002(\003\022\032\n\004from\030\003 \002(\0132\014.client.Node\022"
+    "\'\n\013sync_offset\030\004 \001(\0132\022.client.SyncOffset"
+    "\022#\n\007request\030\005 \001(\0132\022.client.CmdRequest\022\'\n"
+    "\013binlog_skip\030\006 \001(\0132\022.client.BinlogSkip\022%"
+    "\n\nsync_lease\030\007 \001(\0132\021.client.SyncLease\022)\n"
+    "\014binlog_batch\030\010 \001(\0132\023.client.BinlogBatch"
+    "\022!\n\010sync_ack\030\t \001(\0132\017.client.SyncAck\" \n\002K"
+    "v\022\013\n\003key\030\001 \002(\t\022\r\n\005value\030\002 \002(\014\"j\n\010SyncIte"
+    "m\022\'\n\013sync_offset\030\001 \002(\0132\022.client.SyncOffs"
+    "et\022#\n\007request\030\002 \001(\0132\022.client.CmdRequest\022"
+    "\020\n\010skip_gap\030\003 \001(\003\"X\n\013BinlogBatch\022\022\n\ntabl"
+    "e_name\030\001 \002(\t\022\024\n\014partition_id\030\002 \002(\005\022\037\n\005it"
+    "ems\030\003 \003(\0132\020.client.SyncItem*\314\001\n\004Type\022\010\n\004"
+    "SYNC\020\000\022\007\n\003SET\020\001\022\007\n\003GET\020\002\022\007\n\003DEL\020\003\022\r\n\tINF"
+    "OSTATS\020\004\022\020\n\014INFOCAPACITY\020\005\022\014\n\010INFOREPL\020\006"
+    "\022\010\n\004MGET\020\007\022\016\n\nINFOSERVER\020\010\022\013\n\007FLUSHDB\020\t\022"
+    "\010\n\004MSET\020\n\022\010\n\004SCAN\020\013\022\017\n\013INFOLATENCY\020\014\022\007\n\003"
+    "CAS\020\r\022\n\n\006INCRBY\020\016\022\017\n\013INFOSLOWLOG\020\017*<\n\010Sy"
+    "ncType\022\007\n\003CMD\020\000\022\010\n\004SKIP\020\001\022\t\n\005LEASE\020\002\022\t\n\005"
+    "BATCH\020\003\022\007\n\003ACK\020\004*U\n\nStatusCode\022\007\n\003kOk\020\000\022"
+    "\r\n\tkNotFound\020\001\022\t\n\005kWait\020\002\022\n\n\006kError\020\003\022\r\n"
+    "\tkFallback\020\004\022\t\n\005kMove\020\005", 4463);
+
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "client.proto", &protobuf_RegisterTypes);
   Node::default_instance_ = new Node();
@@ -739,6 +1113,10 @@ void protobuf_AddDesc_client_2eproto() {
   CmdRequest_Info::default_instance_ = new CmdRequest_Info();
   CmdRequest_Mget::default_instance_ = new CmdRequest_Mget();
   CmdRequest_FlushDB::default_instance_ = new CmdRequest_FlushDB();
+  CmdRequest_Mset::default_instance_ = new CmdRequest_Mset();
+  CmdRequest_Scan::default_instance_ = new CmdRequest_Scan();
+  CmdRequest_Cas::default_instance_ = new CmdRequest_Cas();
+  CmdRequest_Incrby::default_instance_ = new CmdRequest_Incrby();
   CmdResponse::default_instance_ = new CmdResponse();
   CmdResponse_Sync::default_instance_ = new CmdResponse_Sync();
   CmdResponse_Get::default_instance_ = new CmdResponse_Get();
@@ -747,9 +1125,18 @@ void protobuf_AddDesc_client_2eproto() {
   CmdResponse_InfoRepl::default_instance_ = new CmdResponse_InfoRepl();
   CmdResponse_Mget::default_instance_ = new CmdResponse_Mget();
   CmdResponse_InfoServer::default_instance_ = new CmdResponse_InfoServer();
+  CmdResponse_Scan::default_instance_ = new CmdResponse_Scan();
+  CmdResponse_InfoLatency::default_instance_ = new CmdResponse_InfoLatency();
+  CmdResponse_Cas::default_instance_ = new CmdResponse_Cas();
+  CmdResponse_Incrby::default_instance_ = new CmdResponse_Incrby();
+  CmdResponse_InfoSlowlog::default_instance_ = new CmdResponse_InfoSlowlog();
   BinlogSkip::default_instance_ = new BinlogSkip();
   SyncLease::default_instance_ = new SyncLease();
+  SyncAck::default_instance_ = new SyncAck();
   SyncRequest::default_instance_ = new SyncRequest();
+  Kv::default_instance_ = new Kv();
+  SyncItem::default_instance_ = new SyncItem();
+  BinlogBatch::default_instance_ = new BinlogBatch();
   Node::default_instance_->InitAsDefaultInstance();
   SyncOffset::default_instance_->InitAsDefaultInstance();
   KeyExpire::default_instance_->InitAsDefaultInstance();
@@ -763,6 +1150,10 @@ void protobuf_AddDesc_client_2eproto() {
   CmdRequest_Info::default_instance_->InitAsDefaultInstance();
   CmdRequest_Mget::default_instance_->InitAsDefaultInstance();
   CmdRequest_FlushDB::default_instance_->InitAsDefaultInstance();
+  CmdRequest_Mset::default_instance_->InitAsDefaultInstance();
+  CmdRequest_Scan::default_instance_->InitAsDefaultInstance();
+  CmdRequest_Cas::default_instance_->InitAsDefaultInstance();
+  CmdRequest_Incrby::default_instance_->InitAsDefaultInstance();
   CmdResponse::default_instance_->InitAsDefaultInstance();
   CmdResponse_Sync::default_instance_->InitAsDefaultInstance();
   CmdResponse_Get::default_instance_->InitAsDefaultInstance();
@@ -771,9 +1162,18 @@ void protobuf_AddDesc_client_2eproto() {
   CmdResponse_InfoRepl::default_instance_->InitAsDefaultInstance();
   CmdResponse_Mget::default_instance_->InitAsDefaultInstance();
   CmdResponse_InfoServer::default_instance_->InitAsDefaultInstance();
+  CmdResponse_Scan::default_instance_->InitAsDefaultInstance();
+  CmdResponse_InfoLatency::default_instance_->InitAsDefaultInstance();
+  CmdResponse_Cas::default_instance_->InitAsDefaultInstance();
+  CmdResponse_Incrby::default_instance_->InitAsDefaultInstance();
+  CmdResponse_InfoSlowlog::default_instance_->InitAsDefaultInstance();
   BinlogSkip::default_instance_->InitAsDefaultInstance();
   SyncLease::default_instance_->InitAsDefaultInstance();
+  SyncAck::default_instance_->InitAsDefaultInstance();
   SyncRequest::default_instance_->InitAsDefaultInstance();
+  Kv::default_instance_->InitAsDefaultInstance();
+  SyncItem::default_instance_->InitAsDefaultInstance();
+  BinlogBatch::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_client_2eproto);
 }
 
@@ -799,6 +1199,11 @@ bool Type_IsValid(int value) {
     case 7:
     case 8:
     case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
       return true;
     default:
       return false;
@@ -814,6 +1219,8 @@ bool SyncType_IsValid(int value) {
     case 0:
     case 1:
     case 2:
+    case 3:
+    case 4:
       return true;
     default:
       return false;
@@ -2828,6 +3235,7 @@ const int CmdRequest_Set::kKeyFieldNumber;
 const int CmdRequest_Set::kValueFieldNumber;
 const int CmdRequest_Set::kUuidFieldNumber;
 const int CmdRequest_Set::kExpireFieldNumber;
+const int CmdRequest_Set::kAckReplicasFieldNumber;
 #endif  // !_MSC_VER
 
 CmdRequest_Set::CmdRequest_Set()
@@ -2852,6 +3260,7 @@ void CmdRequest_Set::SharedCtor() {
   value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   expire_ = NULL;
+  ack_replicas_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -2923,6 +3332,7 @@ void CmdRequest_Set::Clear() {
     if (has_expire()) {
       if (expire_ != NULL) expire_->::client::KeyExpire::Clear();
     }
+    ack_replicas_ = 0;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -3008,6 +3418,22 @@ bool CmdRequest_Set::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(48)) goto parse_ack_replicas;
+        break;
+      }
+
+      // optional int32 ack_replicas = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_ack_replicas:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &ack_replicas_)));
+          set_has_ack_replicas();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -3069,6 +3495,11 @@ void CmdRequest_Set::SerializeWithCachedSizes(
       5, this->expire(), output);
   }
 
+  // optional int32 ack_replicas = 6;
+  if (has_ack_replicas()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->ack_replicas(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -3121,6 +3552,11 @@ void CmdRequest_Set::SerializeWithCachedSizes(
         5, this->expire(), target);
   }
 
+  // optional int32 ack_replicas = 6;
+  if (has_ack_replicas()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->ack_replicas(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -3167,6 +3603,13 @@ int CmdRequest_Set::ByteSize() const {
           this->expire());
     }
 
+    // optional int32 ack_replicas = 6;
+    if (has_ack_replicas()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->ack_replicas());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -3209,6 +3652,9 @@ void CmdRequest_Set::MergeFrom(const CmdRequest_Set& from) {
     if (from.has_expire()) {
       mutable_expire()->::client::KeyExpire::MergeFrom(from.expire());
     }
+    if (from.has_ack_replicas()) {
+      set_ack_replicas(from.ack_replicas());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -3241,6 +3687,7 @@ void CmdRequest_Set::Swap(CmdRequest_Set* other) {
     std::swap(value_, other->value_);
     std::swap(uuid_, other->uuid_);
     std::swap(expire_, other->expire_);
+    std::swap(ack_replicas_, other->ack_replicas_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -3262,6 +3709,7 @@ void CmdRequest_Set::Swap(CmdRequest_Set* other) {
 const int CmdRequest_Get::kTableNameFieldNumber;
 const int CmdRequest_Get::kKeyFieldNumber;
 const int CmdRequest_Get::kUuidFieldNumber;
+const int CmdRequest_Get::kAllowStaleFieldNumber;
 #endif  // !_MSC_VER
 
 CmdRequest_Get::CmdRequest_Get()
@@ -3283,6 +3731,7 @@ void CmdRequest_Get::SharedCtor() {
   table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  allow_stale_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -3342,6 +3791,7 @@ void CmdRequest_Get::Clear() {
         uuid_->clear();
       }
     }
+    allow_stale_ = false;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -3399,6 +3849,22 @@ bool CmdRequest_Get::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(32)) goto parse_allow_stale;
+        break;
+      }
+
+      // optional bool allow_stale = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_allow_stale:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &allow_stale_)));
+          set_has_allow_stale();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -3448,6 +3914,11 @@ void CmdRequest_Get::SerializeWithCachedSizes(
       3, this->uuid(), output);
   }
 
+  // optional bool allow_stale = 4;
+  if (has_allow_stale()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->allow_stale(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -3486,6 +3957,11 @@ void CmdRequest_Get::SerializeWithCachedSizes(
         3, this->uuid(), target);
   }
 
+  // optional bool allow_stale = 4;
+  if (has_allow_stale()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->allow_stale(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -3518,6 +3994,11 @@ int CmdRequest_Get::ByteSize() const {
           this->uuid());
     }
 
+    // optional bool allow_stale = 4;
+    if (has_allow_stale()) {
+      total_size += 1 + 1;
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -3554,6 +4035,9 @@ void CmdRequest_Get::MergeFrom(const CmdRequest_Get& from) {
     if (from.has_uuid()) {
       set_uuid(from.uuid());
     }
+    if (from.has_allow_stale()) {
+      set_allow_stale(from.allow_stale());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -3581,6 +4065,7 @@ void CmdRequest_Get::Swap(CmdRequest_Get* other) {
     std::swap(table_name_, other->table_name_);
     std::swap(key_, other->key_);
     std::swap(uuid_, other->uuid_);
+    std::swap(allow_stale_, other->allow_stale_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -4704,304 +5189,144 @@ void CmdRequest_FlushDB::Swap(CmdRequest_FlushDB* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int CmdRequest::kTypeFieldNumber;
-const int CmdRequest::kSyncFieldNumber;
-const int CmdRequest::kSetFieldNumber;
-const int CmdRequest::kGetFieldNumber;
-const int CmdRequest::kDelFieldNumber;
-const int CmdRequest::kInfoFieldNumber;
-const int CmdRequest::kMgetFieldNumber;
-const int CmdRequest::kFlushdbFieldNumber;
+const int CmdRequest_Mset::kTableNameFieldNumber;
+const int CmdRequest_Mset::kKvsFieldNumber;
 #endif  // !_MSC_VER
 
-CmdRequest::CmdRequest()
+CmdRequest_Mset::CmdRequest_Mset()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdRequest::InitAsDefaultInstance() {
-  sync_ = const_cast< ::client::CmdRequest_Sync*>(&::client::CmdRequest_Sync::default_instance());
-  set_ = const_cast< ::client::CmdRequest_Set*>(&::client::CmdRequest_Set::default_instance());
-  get_ = const_cast< ::client::CmdRequest_Get*>(&::client::CmdRequest_Get::default_instance());
-  del_ = const_cast< ::client::CmdRequest_Del*>(&::client::CmdRequest_Del::default_instance());
-  info_ = const_cast< ::client::CmdRequest_Info*>(&::client::CmdRequest_Info::default_instance());
-  mget_ = const_cast< ::client::CmdRequest_Mget*>(&::client::CmdRequest_Mget::default_instance());
-  flushdb_ = const_cast< ::client::CmdRequest_FlushDB*>(&::client::CmdRequest_FlushDB::default_instance());
+void CmdRequest_Mset::InitAsDefaultInstance() {
 }
 
-CmdRequest::CmdRequest(const CmdRequest& from)
+CmdRequest_Mset::CmdRequest_Mset(const CmdRequest_Mset& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdRequest::SharedCtor() {
+void CmdRequest_Mset::SharedCtor() {
   _cached_size_ = 0;
-  type_ = 0;
-  sync_ = NULL;
-  set_ = NULL;
-  get_ = NULL;
-  del_ = NULL;
-  info_ = NULL;
-  mget_ = NULL;
-  flushdb_ = NULL;
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdRequest::~CmdRequest() {
+CmdRequest_Mset::~CmdRequest_Mset() {
   SharedDtor();
 }
 
-void CmdRequest::SharedDtor() {
+void CmdRequest_Mset::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
   if (this != default_instance_) {
-    delete sync_;
-    delete set_;
-    delete get_;
-    delete del_;
-    delete info_;
-    delete mget_;
-    delete flushdb_;
   }
 }
 
-void CmdRequest::SetCachedSize(int size) const {
+void CmdRequest_Mset::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdRequest::descriptor() {
+const ::google::protobuf::Descriptor* CmdRequest_Mset::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdRequest_descriptor_;
+  return CmdRequest_Mset_descriptor_;
 }
 
-const CmdRequest& CmdRequest::default_instance() {
+const CmdRequest_Mset& CmdRequest_Mset::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdRequest* CmdRequest::default_instance_ = NULL;
+CmdRequest_Mset* CmdRequest_Mset::default_instance_ = NULL;
 
-CmdRequest* CmdRequest::New() const {
-  return new CmdRequest;
+CmdRequest_Mset* CmdRequest_Mset::New() const {
+  return new CmdRequest_Mset;
 }
 
-void CmdRequest::Clear() {
+void CmdRequest_Mset::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    if (has_sync()) {
-      if (sync_ != NULL) sync_->::client::CmdRequest_Sync::Clear();
-    }
-    if (has_set()) {
-      if (set_ != NULL) set_->::client::CmdRequest_Set::Clear();
-    }
-    if (has_get()) {
-      if (get_ != NULL) get_->::client::CmdRequest_Get::Clear();
-    }
-    if (has_del()) {
-      if (del_ != NULL) del_->::client::CmdRequest_Del::Clear();
-    }
-    if (has_info()) {
-      if (info_ != NULL) info_->::client::CmdRequest_Info::Clear();
-    }
-    if (has_mget()) {
-      if (mget_ != NULL) mget_->::client::CmdRequest_Mget::Clear();
-    }
-    if (has_flushdb()) {
-      if (flushdb_ != NULL) flushdb_->::client::CmdRequest_FlushDB::Clear();
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
+      }
     }
   }
+  kvs_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdRequest::MergePartialFromCodedStream(
+bool CmdRequest_Mset::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .client.Type type = 1;
+      // required string table_name = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::client::Type_IsValid(value)) {
-            set_type(static_cast< ::client::Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_name().data(), this->table_name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_sync;
+        if (input->ExpectTag(18)) goto parse_kvs;
         break;
       }
 
-      // optional .client.CmdRequest.Sync sync = 2;
+      // repeated .client.Kv kvs = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync:
+         parse_kvs:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync()));
+                input, add_kvs()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(26)) goto parse_set;
+        if (input->ExpectTag(18)) goto parse_kvs;
+        if (input->ExpectAtEnd()) return true;
         break;
       }
 
-      // optional .client.CmdRequest.Set set = 3;
-      case 3: {
+      default: {
+      handle_uninterpreted:
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_set:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_set()));
-        } else {
-          goto handle_uninterpreted;
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
         }
-        if (input->ExpectTag(34)) goto parse_get;
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
         break;
       }
+    }
+  }
+  return true;
+#undef DO_
+}
 
-      // optional .client.CmdRequest.Get get = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_get:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_get()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_del;
-        break;
-      }
-
-      // optional .client.CmdRequest.Del del = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_del:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_del()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_info;
-        break;
-      }
-
-      // optional .client.CmdRequest.Info info = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_info()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_mget;
-        break;
-      }
-
-      // optional .client.CmdRequest.Mget mget = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_mget:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_mget()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(66)) goto parse_flushdb;
-        break;
-      }
-
-      // optional .client.CmdRequest.FlushDB flushdb = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_flushdb:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_flushdb()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdRequest::SerializeWithCachedSizes(
+void CmdRequest_Mset::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .client.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
-  }
-
-  // optional .client.CmdRequest.Sync sync = 2;
-  if (has_sync()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->sync(), output);
-  }
-
-  // optional .client.CmdRequest.Set set = 3;
-  if (has_set()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->set(), output);
-  }
-
-  // optional .client.CmdRequest.Get get = 4;
-  if (has_get()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->get(), output);
-  }
-
-  // optional .client.CmdRequest.Del del = 5;
-  if (has_del()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->del(), output);
-  }
-
-  // optional .client.CmdRequest.Info info = 6;
-  if (has_info()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->info(), output);
-  }
-
-  // optional .client.CmdRequest.Mget mget = 7;
-  if (has_mget()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->mget(), output);
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->table_name(), output);
   }
 
-  // optional .client.CmdRequest.FlushDB flushdb = 8;
-  if (has_flushdb()) {
+  // repeated .client.Kv kvs = 2;
+  for (int i = 0; i < this->kvs_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->flushdb(), output);
+      2, this->kvs(i), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -5010,61 +5335,23 @@ void CmdRequest::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdRequest::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CmdRequest_Mset::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required .client.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
-
-  // optional .client.CmdRequest.Sync sync = 2;
-  if (has_sync()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->sync(), target);
-  }
-
-  // optional .client.CmdRequest.Set set = 3;
-  if (has_set()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->set(), target);
-  }
-
-  // optional .client.CmdRequest.Get get = 4;
-  if (has_get()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->get(), target);
-  }
-
-  // optional .client.CmdRequest.Del del = 5;
-  if (has_del()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->del(), target);
-  }
-
-  // optional .client.CmdRequest.Info info = 6;
-  if (has_info()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->info(), target);
-  }
-
-  // optional .client.CmdRequest.Mget mget = 7;
-  if (has_mget()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->mget(), target);
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
   }
 
-  // optional .client.CmdRequest.FlushDB flushdb = 8;
-  if (has_flushdb()) {
+  // repeated .client.Kv kvs = 2;
+  for (int i = 0; i < this->kvs_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        8, this->flushdb(), target);
+        2, this->kvs(i), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -5074,66 +5361,26 @@ void CmdRequest::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdRequest::ByteSize() const {
+int CmdRequest_Mset::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .client.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
-
-    // optional .client.CmdRequest.Sync sync = 2;
-    if (has_sync()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync());
-    }
-
-    // optional .client.CmdRequest.Set set = 3;
-    if (has_set()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->set());
-    }
-
-    // optional .client.CmdRequest.Get get = 4;
-    if (has_get()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->get());
-    }
-
-    // optional .client.CmdRequest.Del del = 5;
-    if (has_del()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->del());
-    }
-
-    // optional .client.CmdRequest.Info info = 6;
-    if (has_info()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->info());
-    }
-
-    // optional .client.CmdRequest.Mget mget = 7;
-    if (has_mget()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->mget());
-    }
-
-    // optional .client.CmdRequest.FlushDB flushdb = 8;
-    if (has_flushdb()) {
+    // required string table_name = 1;
+    if (has_table_name()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->flushdb());
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
     }
 
   }
+  // repeated .client.Kv kvs = 2;
+  total_size += 1 * this->kvs_size();
+  for (int i = 0; i < this->kvs_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->kvs(i));
+  }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -5145,10 +5392,10 @@ int CmdRequest::ByteSize() const {
   return total_size;
 }
 
-void CmdRequest::MergeFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Mset::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest*>(
+  const CmdRequest_Mset* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Mset*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -5157,177 +5404,148 @@ void CmdRequest::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void CmdRequest::MergeFrom(const CmdRequest& from) {
+void CmdRequest_Mset::MergeFrom(const CmdRequest_Mset& from) {
   GOOGLE_CHECK_NE(&from, this);
+  kvs_.MergeFrom(from.kvs_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-    if (from.has_sync()) {
-      mutable_sync()->::client::CmdRequest_Sync::MergeFrom(from.sync());
-    }
-    if (from.has_set()) {
-      mutable_set()->::client::CmdRequest_Set::MergeFrom(from.set());
-    }
-    if (from.has_get()) {
-      mutable_get()->::client::CmdRequest_Get::MergeFrom(from.get());
-    }
-    if (from.has_del()) {
-      mutable_del()->::client::CmdRequest_Del::MergeFrom(from.del());
-    }
-    if (from.has_info()) {
-      mutable_info()->::client::CmdRequest_Info::MergeFrom(from.info());
-    }
-    if (from.has_mget()) {
-      mutable_mget()->::client::CmdRequest_Mget::MergeFrom(from.mget());
-    }
-    if (from.has_flushdb()) {
-      mutable_flushdb()->::client::CmdRequest_FlushDB::MergeFrom(from.flushdb());
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Mset::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdRequest::CopyFrom(const CmdRequest& from) {
+void CmdRequest_Mset::CopyFrom(const CmdRequest_Mset& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdRequest::IsInitialized() const {
+bool CmdRequest_Mset::IsInitialized() const {
   if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
 
-  if (has_sync()) {
-    if (!this->sync().IsInitialized()) return false;
-  }
-  if (has_set()) {
-    if (!this->set().IsInitialized()) return false;
-  }
-  if (has_get()) {
-    if (!this->get().IsInitialized()) return false;
-  }
-  if (has_del()) {
-    if (!this->del().IsInitialized()) return false;
-  }
-  if (has_mget()) {
-    if (!this->mget().IsInitialized()) return false;
-  }
-  if (has_flushdb()) {
-    if (!this->flushdb().IsInitialized()) return false;
+  for (int i = 0; i < kvs_size(); i++) {
+    if (!this->kvs(i).IsInitialized()) return false;
   }
   return true;
 }
 
-void CmdRequest::Swap(CmdRequest* other) {
+void CmdRequest_Mset::Swap(CmdRequest_Mset* other) {
   if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(sync_, other->sync_);
-    std::swap(set_, other->set_);
-    std::swap(get_, other->get_);
-    std::swap(del_, other->del_);
-    std::swap(info_, other->info_);
-    std::swap(mget_, other->mget_);
-    std::swap(flushdb_, other->flushdb_);
+    std::swap(table_name_, other->table_name_);
+    kvs_.Swap(&other->kvs_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdRequest::GetMetadata() const {
+::google::protobuf::Metadata CmdRequest_Mset::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_descriptor_;
-  metadata.reflection = CmdRequest_reflection_;
+  metadata.descriptor = CmdRequest_Mset_descriptor_;
+  metadata.reflection = CmdRequest_Mset_reflection_;
   return metadata;
 }
 
 
-// ===================================================================
+// -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int CmdResponse_Sync::kTableNameFieldNumber;
-const int CmdResponse_Sync::kSyncOffsetFieldNumber;
+const int CmdRequest_Scan::kTableNameFieldNumber;
+const int CmdRequest_Scan::kPartitionIdFieldNumber;
+const int CmdRequest_Scan::kKeyStartFieldNumber;
+const int CmdRequest_Scan::kLimitFieldNumber;
+const int CmdRequest_Scan::kMaxBytesFieldNumber;
 #endif  // !_MSC_VER
 
-CmdResponse_Sync::CmdResponse_Sync()
+CmdRequest_Scan::CmdRequest_Scan()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdResponse_Sync::InitAsDefaultInstance() {
-  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
+void CmdRequest_Scan::InitAsDefaultInstance() {
 }
 
-CmdResponse_Sync::CmdResponse_Sync(const CmdResponse_Sync& from)
+CmdRequest_Scan::CmdRequest_Scan(const CmdRequest_Scan& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdResponse_Sync::SharedCtor() {
+void CmdRequest_Scan::SharedCtor() {
   _cached_size_ = 0;
   table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  sync_offset_ = NULL;
+  partition_id_ = 0;
+  key_start_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  limit_ = 0;
+  max_bytes_ = GOOGLE_LONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdResponse_Sync::~CmdResponse_Sync() {
+CmdRequest_Scan::~CmdRequest_Scan() {
   SharedDtor();
 }
 
-void CmdResponse_Sync::SharedDtor() {
+void CmdRequest_Scan::SharedDtor() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     delete table_name_;
   }
+  if (key_start_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_start_;
+  }
   if (this != default_instance_) {
-    delete sync_offset_;
   }
 }
 
-void CmdResponse_Sync::SetCachedSize(int size) const {
+void CmdRequest_Scan::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdResponse_Sync::descriptor() {
+const ::google::protobuf::Descriptor* CmdRequest_Scan::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdResponse_Sync_descriptor_;
+  return CmdRequest_Scan_descriptor_;
 }
 
-const CmdResponse_Sync& CmdResponse_Sync::default_instance() {
+const CmdRequest_Scan& CmdRequest_Scan::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdResponse_Sync* CmdResponse_Sync::default_instance_ = NULL;
+CmdRequest_Scan* CmdRequest_Scan::default_instance_ = NULL;
 
-CmdResponse_Sync* CmdResponse_Sync::New() const {
-  return new CmdResponse_Sync;
+CmdRequest_Scan* CmdRequest_Scan::New() const {
+  return new CmdRequest_Scan;
 }
 
-void CmdResponse_Sync::Clear() {
+void CmdRequest_Scan::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (has_table_name()) {
       if (table_name_ != &::google::protobuf::internal::kEmptyString) {
         table_name_->clear();
       }
     }
-    if (has_sync_offset()) {
-      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+    partition_id_ = 0;
+    if (has_key_start()) {
+      if (key_start_ != &::google::protobuf::internal::kEmptyString) {
+        key_start_->clear();
+      }
     }
+    limit_ = 0;
+    max_bytes_ = GOOGLE_LONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdResponse_Sync::MergePartialFromCodedStream(
+bool CmdRequest_Scan::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
@@ -5345,17 +5563,68 @@ bool CmdResponse_Sync::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_sync_offset;
+        if (input->ExpectTag(16)) goto parse_partition_id;
         break;
       }
 
-      // required .client.SyncOffset sync_offset = 2;
+      // required int32 partition_id = 2;
       case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_partition_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &partition_id_)));
+          set_has_partition_id();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_key_start;
+        break;
+      }
+
+      // optional string key_start = 3;
+      case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync_offset:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync_offset()));
+         parse_key_start:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_key_start()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->key_start().data(), this->key_start().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_limit;
+        break;
+      }
+
+      // optional int32 limit = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_limit:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &limit_)));
+          set_has_limit();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_max_bytes;
+        break;
+      }
+
+      // optional int64 max_bytes = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_max_bytes:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &max_bytes_)));
+          set_has_max_bytes();
         } else {
           goto handle_uninterpreted;
         }
@@ -5379,7 +5648,7 @@ bool CmdResponse_Sync::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void CmdResponse_Sync::SerializeWithCachedSizes(
+void CmdRequest_Scan::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // required string table_name = 1;
   if (has_table_name()) {
@@ -5390,10 +5659,28 @@ void CmdResponse_Sync::SerializeWithCachedSizes(
       1, this->table_name(), output);
   }
 
-  // required .client.SyncOffset sync_offset = 2;
-  if (has_sync_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->sync_offset(), output);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition_id(), output);
+  }
+
+  // optional string key_start = 3;
+  if (has_key_start()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key_start().data(), this->key_start().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      3, this->key_start(), output);
+  }
+
+  // optional int32 limit = 4;
+  if (has_limit()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->limit(), output);
+  }
+
+  // optional int64 max_bytes = 5;
+  if (has_max_bytes()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->max_bytes(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -5402,7 +5689,7 @@ void CmdResponse_Sync::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdResponse_Sync::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CmdRequest_Scan::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
   // required string table_name = 1;
   if (has_table_name()) {
@@ -5414,11 +5701,29 @@ void CmdResponse_Sync::SerializeWithCachedSizes(
         1, this->table_name(), target);
   }
 
-  // required .client.SyncOffset sync_offset = 2;
-  if (has_sync_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->sync_offset(), target);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition_id(), target);
+  }
+
+  // optional string key_start = 3;
+  if (has_key_start()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key_start().data(), this->key_start().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->key_start(), target);
+  }
+
+  // optional int32 limit = 4;
+  if (has_limit()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->limit(), target);
+  }
+
+  // optional int64 max_bytes = 5;
+  if (has_max_bytes()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->max_bytes(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -5428,7 +5733,7 @@ void CmdResponse_Sync::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdResponse_Sync::ByteSize() const {
+int CmdRequest_Scan::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
@@ -5439,11 +5744,32 @@ int CmdResponse_Sync::ByteSize() const {
           this->table_name());
     }
 
-    // required .client.SyncOffset sync_offset = 2;
-    if (has_sync_offset()) {
+    // required int32 partition_id = 2;
+    if (has_partition_id()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync_offset());
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->partition_id());
+    }
+
+    // optional string key_start = 3;
+    if (has_key_start()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->key_start());
+    }
+
+    // optional int32 limit = 4;
+    if (has_limit()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->limit());
+    }
+
+    // optional int64 max_bytes = 5;
+    if (has_max_bytes()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->max_bytes());
     }
 
   }
@@ -5458,10 +5784,10 @@ int CmdResponse_Sync::ByteSize() const {
   return total_size;
 }
 
-void CmdResponse_Sync::MergeFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Scan::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_Sync* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Sync*>(
+  const CmdRequest_Scan* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Scan*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -5470,55 +5796,64 @@ void CmdResponse_Sync::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void CmdResponse_Sync::MergeFrom(const CmdResponse_Sync& from) {
+void CmdRequest_Scan::MergeFrom(const CmdRequest_Scan& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from.has_table_name()) {
       set_table_name(from.table_name());
     }
-    if (from.has_sync_offset()) {
-      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
+    if (from.has_partition_id()) {
+      set_partition_id(from.partition_id());
+    }
+    if (from.has_key_start()) {
+      set_key_start(from.key_start());
+    }
+    if (from.has_limit()) {
+      set_limit(from.limit());
+    }
+    if (from.has_max_bytes()) {
+      set_max_bytes(from.max_bytes());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdResponse_Sync::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Scan::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_Sync::CopyFrom(const CmdResponse_Sync& from) {
+void CmdRequest_Scan::CopyFrom(const CmdRequest_Scan& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_Sync::IsInitialized() const {
+bool CmdRequest_Scan::IsInitialized() const {
   if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
 
-  if (has_sync_offset()) {
-    if (!this->sync_offset().IsInitialized()) return false;
-  }
   return true;
 }
 
-void CmdResponse_Sync::Swap(CmdResponse_Sync* other) {
+void CmdRequest_Scan::Swap(CmdRequest_Scan* other) {
   if (other != this) {
     std::swap(table_name_, other->table_name_);
-    std::swap(sync_offset_, other->sync_offset_);
+    std::swap(partition_id_, other->partition_id_);
+    std::swap(key_start_, other->key_start_);
+    std::swap(limit_, other->limit_);
+    std::swap(max_bytes_, other->max_bytes_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdResponse_Sync::GetMetadata() const {
+::google::protobuf::Metadata CmdRequest_Scan::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_Sync_descriptor_;
-  metadata.reflection = CmdResponse_Sync_reflection_;
+  metadata.descriptor = CmdRequest_Scan_descriptor_;
+  metadata.reflection = CmdRequest_Scan_reflection_;
   return metadata;
 }
 
@@ -5526,89 +5861,194 @@ void CmdResponse_Sync::Swap(CmdResponse_Sync* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int CmdResponse_Get::kValueFieldNumber;
+const int CmdRequest_Cas::kTableNameFieldNumber;
+const int CmdRequest_Cas::kKeyFieldNumber;
+const int CmdRequest_Cas::kValueFieldNumber;
+const int CmdRequest_Cas::kExpectFieldNumber;
+const int CmdRequest_Cas::kUuidFieldNumber;
 #endif  // !_MSC_VER
 
-CmdResponse_Get::CmdResponse_Get()
+CmdRequest_Cas::CmdRequest_Cas()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdResponse_Get::InitAsDefaultInstance() {
+void CmdRequest_Cas::InitAsDefaultInstance() {
 }
 
-CmdResponse_Get::CmdResponse_Get(const CmdResponse_Get& from)
+CmdRequest_Cas::CmdRequest_Cas(const CmdRequest_Cas& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdResponse_Get::SharedCtor() {
+void CmdRequest_Cas::SharedCtor() {
   _cached_size_ = 0;
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  expect_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdResponse_Get::~CmdResponse_Get() {
+CmdRequest_Cas::~CmdRequest_Cas() {
   SharedDtor();
 }
 
-void CmdResponse_Get::SharedDtor() {
+void CmdRequest_Cas::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
   if (value_ != &::google::protobuf::internal::kEmptyString) {
     delete value_;
   }
+  if (expect_ != &::google::protobuf::internal::kEmptyString) {
+    delete expect_;
+  }
+  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+    delete uuid_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void CmdResponse_Get::SetCachedSize(int size) const {
+void CmdRequest_Cas::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdResponse_Get::descriptor() {
+const ::google::protobuf::Descriptor* CmdRequest_Cas::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdResponse_Get_descriptor_;
+  return CmdRequest_Cas_descriptor_;
 }
 
-const CmdResponse_Get& CmdResponse_Get::default_instance() {
+const CmdRequest_Cas& CmdRequest_Cas::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdResponse_Get* CmdResponse_Get::default_instance_ = NULL;
+CmdRequest_Cas* CmdRequest_Cas::default_instance_ = NULL;
 
-CmdResponse_Get* CmdResponse_Get::New() const {
-  return new CmdResponse_Get;
+CmdRequest_Cas* CmdRequest_Cas::New() const {
+  return new CmdRequest_Cas;
 }
 
-void CmdResponse_Get::Clear() {
+void CmdRequest_Cas::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
+      }
+    }
+    if (has_key()) {
+      if (key_ != &::google::protobuf::internal::kEmptyString) {
+        key_->clear();
+      }
+    }
     if (has_value()) {
       if (value_ != &::google::protobuf::internal::kEmptyString) {
         value_->clear();
       }
     }
+    if (has_expect()) {
+      if (expect_ != &::google::protobuf::internal::kEmptyString) {
+        expect_->clear();
+      }
+    }
+    if (has_uuid()) {
+      if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+        uuid_->clear();
+      }
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdResponse_Get::MergePartialFromCodedStream(
+bool CmdRequest_Cas::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional bytes value = 1;
+      // required string table_name = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_name().data(), this->table_name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_key;
+        break;
+      }
+
+      // required string key = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_key:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_key()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->key().data(), this->key().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_value;
+        break;
+      }
+
+      // required bytes value = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_value:
           DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
                 input, this->mutable_value()));
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(34)) goto parse_expect;
+        break;
+      }
+
+      // optional bytes expect = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_expect:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_expect()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_uuid;
+        break;
+      }
+
+      // optional string uuid = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_uuid:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_uuid()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->uuid().data(), this->uuid().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -5629,12 +6069,45 @@ bool CmdResponse_Get::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void CmdResponse_Get::SerializeWithCachedSizes(
+void CmdRequest_Cas::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional bytes value = 1;
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->table_name(), output);
+  }
+
+  // required string key = 2;
+  if (has_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key().data(), this->key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->key(), output);
+  }
+
+  // required bytes value = 3;
   if (has_value()) {
     ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      1, this->value(), output);
+      3, this->value(), output);
+  }
+
+  // optional bytes expect = 4;
+  if (has_expect()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      4, this->expect(), output);
+  }
+
+  // optional string uuid = 5;
+  if (has_uuid()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->uuid().data(), this->uuid().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      5, this->uuid(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -5643,13 +6116,50 @@ void CmdResponse_Get::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdResponse_Get::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CmdRequest_Cas::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // optional bytes value = 1;
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
+  }
+
+  // required string key = 2;
+  if (has_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key().data(), this->key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->key(), target);
+  }
+
+  // required bytes value = 3;
   if (has_value()) {
     target =
       ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->value(), target);
+        3, this->value(), target);
+  }
+
+  // optional bytes expect = 4;
+  if (has_expect()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        4, this->expect(), target);
+  }
+
+  // optional string uuid = 5;
+  if (has_uuid()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->uuid().data(), this->uuid().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        5, this->uuid(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -5659,17 +6169,45 @@ void CmdResponse_Get::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdResponse_Get::ByteSize() const {
+int CmdRequest_Cas::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional bytes value = 1;
+    // required string table_name = 1;
+    if (has_table_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
+    }
+
+    // required string key = 2;
+    if (has_key()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->key());
+    }
+
+    // required bytes value = 3;
     if (has_value()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::BytesSize(
           this->value());
     }
 
+    // optional bytes expect = 4;
+    if (has_expect()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->expect());
+    }
+
+    // optional string uuid = 5;
+    if (has_uuid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->uuid());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -5682,10 +6220,10 @@ int CmdResponse_Get::ByteSize() const {
   return total_size;
 }
 
-void CmdResponse_Get::MergeFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Cas::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_Get* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Get*>(
+  const CmdRequest_Cas* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Cas*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -5694,129 +6232,162 @@ void CmdResponse_Get::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void CmdResponse_Get::MergeFrom(const CmdResponse_Get& from) {
+void CmdRequest_Cas::MergeFrom(const CmdRequest_Cas& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
+    }
+    if (from.has_key()) {
+      set_key(from.key());
+    }
     if (from.has_value()) {
       set_value(from.value());
     }
+    if (from.has_expect()) {
+      set_expect(from.expect());
+    }
+    if (from.has_uuid()) {
+      set_uuid(from.uuid());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdResponse_Get::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Cas::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_Get::CopyFrom(const CmdResponse_Get& from) {
+void CmdRequest_Cas::CopyFrom(const CmdRequest_Cas& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_Get::IsInitialized() const {
+bool CmdRequest_Cas::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
 
   return true;
 }
 
-void CmdResponse_Get::Swap(CmdResponse_Get* other) {
+void CmdRequest_Cas::Swap(CmdRequest_Cas* other) {
   if (other != this) {
+    std::swap(table_name_, other->table_name_);
+    std::swap(key_, other->key_);
     std::swap(value_, other->value_);
+    std::swap(expect_, other->expect_);
+    std::swap(uuid_, other->uuid_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdResponse_Get::GetMetadata() const {
+::google::protobuf::Metadata CmdRequest_Cas::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_Get_descriptor_;
-  metadata.reflection = CmdResponse_Get_reflection_;
+  metadata.descriptor = CmdRequest_Cas_descriptor_;
+  metadata.reflection = CmdRequest_Cas_reflection_;
   return metadata;
 }
 
-
-// -------------------------------------------------------------------
+// ===================================================================
 
 #ifndef _MSC_VER
-const int CmdResponse_InfoStats::kTableNameFieldNumber;
-const int CmdResponse_InfoStats::kTotalQuerysFieldNumber;
-const int CmdResponse_InfoStats::kQpsFieldNumber;
+const int CmdRequest_Incrby::kTableNameFieldNumber;
+const int CmdRequest_Incrby::kKeyFieldNumber;
+const int CmdRequest_Incrby::kByFieldNumber;
+const int CmdRequest_Incrby::kUuidFieldNumber;
 #endif  // !_MSC_VER
 
-CmdResponse_InfoStats::CmdResponse_InfoStats()
+CmdRequest_Incrby::CmdRequest_Incrby()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdResponse_InfoStats::InitAsDefaultInstance() {
+void CmdRequest_Incrby::InitAsDefaultInstance() {
 }
 
-CmdResponse_InfoStats::CmdResponse_InfoStats(const CmdResponse_InfoStats& from)
+CmdRequest_Incrby::CmdRequest_Incrby(const CmdRequest_Incrby& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoStats::SharedCtor() {
+void CmdRequest_Incrby::SharedCtor() {
   _cached_size_ = 0;
   table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  total_querys_ = GOOGLE_LONGLONG(0);
-  qps_ = 0;
+  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  by_ = GOOGLE_LONGLONG(0);
+  uuid_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdResponse_InfoStats::~CmdResponse_InfoStats() {
+CmdRequest_Incrby::~CmdRequest_Incrby() {
   SharedDtor();
 }
 
-void CmdResponse_InfoStats::SharedDtor() {
+void CmdRequest_Incrby::SharedDtor() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     delete table_name_;
   }
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+    delete uuid_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void CmdResponse_InfoStats::SetCachedSize(int size) const {
+void CmdRequest_Incrby::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdResponse_InfoStats::descriptor() {
+const ::google::protobuf::Descriptor* CmdRequest_Incrby::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdResponse_InfoStats_descriptor_;
+  return CmdRequest_Incrby_descriptor_;
 }
 
-const CmdResponse_InfoStats& CmdResponse_InfoStats::default_instance() {
+const CmdRequest_Incrby& CmdRequest_Incrby::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdResponse_InfoStats* CmdResponse_InfoStats::default_instance_ = NULL;
+CmdRequest_Incrby* CmdRequest_Incrby::default_instance_ = NULL;
 
-CmdResponse_InfoStats* CmdResponse_InfoStats::New() const {
-  return new CmdResponse_InfoStats;
+CmdRequest_Incrby* CmdRequest_Incrby::New() const {
+  return new CmdRequest_Incrby;
 }
 
-void CmdResponse_InfoStats::Clear() {
+void CmdRequest_Incrby::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (has_table_name()) {
       if (table_name_ != &::google::protobuf::internal::kEmptyString) {
         table_name_->clear();
       }
     }
-    total_querys_ = GOOGLE_LONGLONG(0);
-    qps_ = 0;
+    if (has_key()) {
+      if (key_ != &::google::protobuf::internal::kEmptyString) {
+        key_->clear();
+      }
+    }
+    by_ = GOOGLE_LONGLONG(0);
+    if (has_uuid()) {
+      if (uuid_ != &::google::protobuf::internal::kEmptyString) {
+        uuid_->clear();
+      }
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdResponse_InfoStats::MergePartialFromCodedStream(
+bool CmdRequest_Incrby::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
@@ -5834,45 +6405,63 @@ bool CmdResponse_InfoStats::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_total_querys;
+        if (input->ExpectTag(18)) goto parse_key;
         break;
       }
 
-      // required int64 total_querys = 2;
+      // required string key = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_total_querys:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &total_querys_)));
-          set_has_total_querys();
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_key:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_key()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->key().data(), this->key().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(24)) goto parse_qps;
+        if (input->ExpectTag(24)) goto parse_by;
         break;
       }
 
-      // required int32 qps = 3;
+      // required int64 by = 3;
       case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_qps:
+         parse_by:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &qps_)));
-          set_has_qps();
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &by_)));
+          set_has_by();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectAtEnd()) return true;
+        if (input->ExpectTag(34)) goto parse_uuid;
         break;
       }
 
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+      // optional string uuid = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_uuid:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_uuid()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->uuid().data(), this->uuid().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
           return true;
         }
@@ -5886,7 +6475,7 @@ bool CmdResponse_InfoStats::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void CmdResponse_InfoStats::SerializeWithCachedSizes(
+void CmdRequest_Incrby::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // required string table_name = 1;
   if (has_table_name()) {
@@ -5897,14 +6486,27 @@ void CmdResponse_InfoStats::SerializeWithCachedSizes(
       1, this->table_name(), output);
   }
 
-  // required int64 total_querys = 2;
-  if (has_total_querys()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->total_querys(), output);
+  // required string key = 2;
+  if (has_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key().data(), this->key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->key(), output);
   }
 
-  // required int32 qps = 3;
-  if (has_qps()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->qps(), output);
+  // required int64 by = 3;
+  if (has_by()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->by(), output);
+  }
+
+  // optional string uuid = 4;
+  if (has_uuid()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->uuid().data(), this->uuid().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      4, this->uuid(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -5913,7 +6515,7 @@ void CmdResponse_InfoStats::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdResponse_InfoStats::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CmdRequest_Incrby::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
   // required string table_name = 1;
   if (has_table_name()) {
@@ -5925,14 +6527,29 @@ void CmdResponse_InfoStats::SerializeWithCachedSizes(
         1, this->table_name(), target);
   }
 
-  // required int64 total_querys = 2;
-  if (has_total_querys()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->total_querys(), target);
+  // required string key = 2;
+  if (has_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key().data(), this->key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->key(), target);
   }
 
-  // required int32 qps = 3;
-  if (has_qps()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->qps(), target);
+  // required int64 by = 3;
+  if (has_by()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->by(), target);
+  }
+
+  // optional string uuid = 4;
+  if (has_uuid()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->uuid().data(), this->uuid().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        4, this->uuid(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -5942,7 +6559,7 @@ void CmdResponse_InfoStats::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdResponse_InfoStats::ByteSize() const {
+int CmdRequest_Incrby::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
@@ -5953,18 +6570,25 @@ int CmdResponse_InfoStats::ByteSize() const {
           this->table_name());
     }
 
-    // required int64 total_querys = 2;
-    if (has_total_querys()) {
+    // required string key = 2;
+    if (has_key()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->key());
+    }
+
+    // required int64 by = 3;
+    if (has_by()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->total_querys());
+          this->by());
     }
 
-    // required int32 qps = 3;
-    if (has_qps()) {
+    // optional string uuid = 4;
+    if (has_uuid()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->qps());
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->uuid());
     }
 
   }
@@ -5979,10 +6603,10 @@ int CmdResponse_InfoStats::ByteSize() const {
   return total_size;
 }
 
-void CmdResponse_InfoStats::MergeFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Incrby::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_InfoStats* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoStats*>(
+  const CmdRequest_Incrby* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Incrby*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -5991,187 +6615,4877 @@ void CmdResponse_InfoStats::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void CmdResponse_InfoStats::MergeFrom(const CmdResponse_InfoStats& from) {
+void CmdRequest_Incrby::MergeFrom(const CmdRequest_Incrby& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from.has_table_name()) {
       set_table_name(from.table_name());
     }
-    if (from.has_total_querys()) {
-      set_total_querys(from.total_querys());
+    if (from.has_key()) {
+      set_key(from.key());
     }
-    if (from.has_qps()) {
-      set_qps(from.qps());
+    if (from.has_by()) {
+      set_by(from.by());
+    }
+    if (from.has_uuid()) {
+      set_uuid(from.uuid());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdResponse_InfoStats::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdRequest_Incrby::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoStats::CopyFrom(const CmdResponse_InfoStats& from) {
+void CmdRequest_Incrby::CopyFrom(const CmdRequest_Incrby& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_InfoStats::IsInitialized() const {
+bool CmdRequest_Incrby::IsInitialized() const {
   if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
 
   return true;
 }
 
-void CmdResponse_InfoStats::Swap(CmdResponse_InfoStats* other) {
+void CmdRequest_Incrby::Swap(CmdRequest_Incrby* other) {
   if (other != this) {
     std::swap(table_name_, other->table_name_);
-    std::swap(total_querys_, other->total_querys_);
-    std::swap(qps_, other->qps_);
+    std::swap(key_, other->key_);
+    std::swap(by_, other->by_);
+    std::swap(uuid_, other->uuid_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdResponse_InfoStats::GetMetadata() const {
+::google::protobuf::Metadata CmdRequest_Incrby::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_InfoStats_descriptor_;
-  metadata.reflection = CmdResponse_InfoStats_reflection_;
+  metadata.descriptor = CmdRequest_Incrby_descriptor_;
+  metadata.reflection = CmdRequest_Incrby_reflection_;
   return metadata;
 }
 
-
-// -------------------------------------------------------------------
+// ===================================================================
 
 #ifndef _MSC_VER
-const int CmdResponse_InfoCapacity::kTableNameFieldNumber;
-const int CmdResponse_InfoCapacity::kUsedFieldNumber;
-const int CmdResponse_InfoCapacity::kRemainFieldNumber;
+const int CmdRequest::kTypeFieldNumber;
+const int CmdRequest::kSyncFieldNumber;
+const int CmdRequest::kSetFieldNumber;
+const int CmdRequest::kGetFieldNumber;
+const int CmdRequest::kDelFieldNumber;
+const int CmdRequest::kInfoFieldNumber;
+const int CmdRequest::kMgetFieldNumber;
+const int CmdRequest::kFlushdbFieldNumber;
+const int CmdRequest::kMsetFieldNumber;
+const int CmdRequest::kScanFieldNumber;
+const int CmdRequest::kCasFieldNumber;
+const int CmdRequest::kIncrbyFieldNumber;
 #endif  // !_MSC_VER
 
-CmdResponse_InfoCapacity::CmdResponse_InfoCapacity()
+CmdRequest::CmdRequest()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdResponse_InfoCapacity::InitAsDefaultInstance() {
+void CmdRequest::InitAsDefaultInstance() {
+  sync_ = const_cast< ::client::CmdRequest_Sync*>(&::client::CmdRequest_Sync::default_instance());
+  set_ = const_cast< ::client::CmdRequest_Set*>(&::client::CmdRequest_Set::default_instance());
+  get_ = const_cast< ::client::CmdRequest_Get*>(&::client::CmdRequest_Get::default_instance());
+  del_ = const_cast< ::client::CmdRequest_Del*>(&::client::CmdRequest_Del::default_instance());
+  info_ = const_cast< ::client::CmdRequest_Info*>(&::client::CmdRequest_Info::default_instance());
+  mget_ = const_cast< ::client::CmdRequest_Mget*>(&::client::CmdRequest_Mget::default_instance());
+  flushdb_ = const_cast< ::client::CmdRequest_FlushDB*>(&::client::CmdRequest_FlushDB::default_instance());
+  mset_ = const_cast< ::client::CmdRequest_Mset*>(&::client::CmdRequest_Mset::default_instance());
+  scan_ = const_cast< ::client::CmdRequest_Scan*>(&::client::CmdRequest_Scan::default_instance());
+  cas_ = const_cast< ::client::CmdRequest_Cas*>(&::client::CmdRequest_Cas::default_instance());
+  incrby_ = const_cast< ::client::CmdRequest_Incrby*>(&::client::CmdRequest_Incrby::default_instance());
 }
 
-CmdResponse_InfoCapacity::CmdResponse_InfoCapacity(const CmdResponse_InfoCapacity& from)
+CmdRequest::CmdRequest(const CmdRequest& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoCapacity::SharedCtor() {
+void CmdRequest::SharedCtor() {
   _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  used_ = GOOGLE_LONGLONG(0);
-  remain_ = GOOGLE_LONGLONG(0);
+  type_ = 0;
+  sync_ = NULL;
+  set_ = NULL;
+  get_ = NULL;
+  del_ = NULL;
+  info_ = NULL;
+  mget_ = NULL;
+  flushdb_ = NULL;
+  mset_ = NULL;
+  scan_ = NULL;
+  cas_ = NULL;
+  incrby_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdResponse_InfoCapacity::~CmdResponse_InfoCapacity() {
+CmdRequest::~CmdRequest() {
   SharedDtor();
 }
 
-void CmdResponse_InfoCapacity::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
+void CmdRequest::SharedDtor() {
   if (this != default_instance_) {
+    delete sync_;
+    delete set_;
+    delete get_;
+    delete del_;
+    delete info_;
+    delete mget_;
+    delete flushdb_;
+    delete mset_;
+    delete scan_;
+    delete cas_;
+    delete incrby_;
   }
 }
 
-void CmdResponse_InfoCapacity::SetCachedSize(int size) const {
+void CmdRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdResponse_InfoCapacity::descriptor() {
+const ::google::protobuf::Descriptor* CmdRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdResponse_InfoCapacity_descriptor_;
+  return CmdRequest_descriptor_;
 }
 
-const CmdResponse_InfoCapacity& CmdResponse_InfoCapacity::default_instance() {
+const CmdRequest& CmdRequest::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdResponse_InfoCapacity* CmdResponse_InfoCapacity::default_instance_ = NULL;
+CmdRequest* CmdRequest::default_instance_ = NULL;
 
-CmdResponse_InfoCapacity* CmdResponse_InfoCapacity::New() const {
-  return new CmdResponse_InfoCapacity;
+CmdRequest* CmdRequest::New() const {
+  return new CmdRequest;
 }
 
-void CmdResponse_InfoCapacity::Clear() {
+void CmdRequest::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
+    type_ = 0;
+    if (has_sync()) {
+      if (sync_ != NULL) sync_->::client::CmdRequest_Sync::Clear();
+    }
+    if (has_set()) {
+      if (set_ != NULL) set_->::client::CmdRequest_Set::Clear();
+    }
+    if (has_get()) {
+      if (get_ != NULL) get_->::client::CmdRequest_Get::Clear();
+    }
+    if (has_del()) {
+      if (del_ != NULL) del_->::client::CmdRequest_Del::Clear();
+    }
+    if (has_info()) {
+      if (info_ != NULL) info_->::client::CmdRequest_Info::Clear();
+    }
+    if (has_mget()) {
+      if (mget_ != NULL) mget_->::client::CmdRequest_Mget::Clear();
+    }
+    if (has_flushdb()) {
+      if (flushdb_ != NULL) flushdb_->::client::CmdRequest_FlushDB::Clear();
+    }
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (has_mset()) {
+      if (mset_ != NULL) mset_->::client::CmdRequest_Mset::Clear();
+    }
+    if (has_scan()) {
+      if (scan_ != NULL) scan_->::client::CmdRequest_Scan::Clear();
+    }
+    if (has_cas()) {
+      if (cas_ != NULL) cas_->::client::CmdRequest_Cas::Clear();
+    }
+    if (has_incrby()) {
+      if (incrby_ != NULL) incrby_->::client::CmdRequest_Incrby::Clear();
     }
-    used_ = GOOGLE_LONGLONG(0);
-    remain_ = GOOGLE_LONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdResponse_InfoCapacity::MergePartialFromCodedStream(
+bool CmdRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string table_name = 1;
+      // required .client.Type type = 1;
       case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::client::Type_IsValid(value)) {
+            set_type(static_cast< ::client::Type >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(1, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_sync;
+        break;
+      }
+
+      // optional .client.CmdRequest.Sync sync = 2;
+      case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
+         parse_sync:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_sync()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_set;
+        break;
+      }
+
+      // optional .client.CmdRequest.Set set = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_set:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_set()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_get;
+        break;
+      }
+
+      // optional .client.CmdRequest.Get get = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_get:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_get()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_del;
+        break;
+      }
+
+      // optional .client.CmdRequest.Del del = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_del:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_del()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(50)) goto parse_info;
+        break;
+      }
+
+      // optional .client.CmdRequest.Info info = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_info:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_info()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(58)) goto parse_mget;
+        break;
+      }
+
+      // optional .client.CmdRequest.Mget mget = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_mget:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_mget()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(66)) goto parse_flushdb;
+        break;
+      }
+
+      // optional .client.CmdRequest.FlushDB flushdb = 8;
+      case 8: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_flushdb:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_flushdb()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(74)) goto parse_mset;
+        break;
+      }
+
+      // optional .client.CmdRequest.Mset mset = 9;
+      case 9: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_mset:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_mset()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(82)) goto parse_scan;
+        break;
+      }
+
+      // optional .client.CmdRequest.Scan scan = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_scan:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_scan()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(90)) goto parse_cas;
+        break;
+      }
+
+      // optional .client.CmdRequest.Cas cas = 11;
+      case 11: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_cas:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_cas()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(98)) goto parse_incrby;
+        break;
+      }
+
+      // optional .client.CmdRequest.Incrby incrby = 12;
+      case 12: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_incrby:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_incrby()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required .client.Type type = 1;
+  if (has_type()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->type(), output);
+  }
+
+  // optional .client.CmdRequest.Sync sync = 2;
+  if (has_sync()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->sync(), output);
+  }
+
+  // optional .client.CmdRequest.Set set = 3;
+  if (has_set()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->set(), output);
+  }
+
+  // optional .client.CmdRequest.Get get = 4;
+  if (has_get()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->get(), output);
+  }
+
+  // optional .client.CmdRequest.Del del = 5;
+  if (has_del()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->del(), output);
+  }
+
+  // optional .client.CmdRequest.Info info = 6;
+  if (has_info()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, this->info(), output);
+  }
+
+  // optional .client.CmdRequest.Mget mget = 7;
+  if (has_mget()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->mget(), output);
+  }
+
+  // optional .client.CmdRequest.FlushDB flushdb = 8;
+  if (has_flushdb()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, this->flushdb(), output);
+  }
+
+  // optional .client.CmdRequest.Mset mset = 9;
+  if (has_mset()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      9, this->mset(), output);
+  }
+
+  // optional .client.CmdRequest.Scan scan = 10;
+  if (has_scan()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      10, this->scan(), output);
+  }
+
+  // optional .client.CmdRequest.Cas cas = 11;
+  if (has_cas()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      11, this->cas(), output);
+  }
+
+  // optional .client.CmdRequest.Incrby incrby = 12;
+  if (has_incrby()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      12, this->incrby(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required .client.Type type = 1;
+  if (has_type()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->type(), target);
+  }
+
+  // optional .client.CmdRequest.Sync sync = 2;
+  if (has_sync()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->sync(), target);
+  }
+
+  // optional .client.CmdRequest.Set set = 3;
+  if (has_set()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->set(), target);
+  }
+
+  // optional .client.CmdRequest.Get get = 4;
+  if (has_get()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->get(), target);
+  }
+
+  // optional .client.CmdRequest.Del del = 5;
+  if (has_del()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->del(), target);
+  }
+
+  // optional .client.CmdRequest.Info info = 6;
+  if (has_info()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        6, this->info(), target);
+  }
+
+  // optional .client.CmdRequest.Mget mget = 7;
+  if (has_mget()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->mget(), target);
+  }
+
+  // optional .client.CmdRequest.FlushDB flushdb = 8;
+  if (has_flushdb()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        8, this->flushdb(), target);
+  }
+
+  // optional .client.CmdRequest.Mset mset = 9;
+  if (has_mset()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        9, this->mset(), target);
+  }
+
+  // optional .client.CmdRequest.Scan scan = 10;
+  if (has_scan()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        10, this->scan(), target);
+  }
+
+  // optional .client.CmdRequest.Cas cas = 11;
+  if (has_cas()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        11, this->cas(), target);
+  }
+
+  // optional .client.CmdRequest.Incrby incrby = 12;
+  if (has_incrby()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        12, this->incrby(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdRequest::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .client.Type type = 1;
+    if (has_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+    }
+
+    // optional .client.CmdRequest.Sync sync = 2;
+    if (has_sync()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->sync());
+    }
+
+    // optional .client.CmdRequest.Set set = 3;
+    if (has_set()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->set());
+    }
+
+    // optional .client.CmdRequest.Get get = 4;
+    if (has_get()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->get());
+    }
+
+    // optional .client.CmdRequest.Del del = 5;
+    if (has_del()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->del());
+    }
+
+    // optional .client.CmdRequest.Info info = 6;
+    if (has_info()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->info());
+    }
+
+    // optional .client.CmdRequest.Mget mget = 7;
+    if (has_mget()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->mget());
+    }
+
+    // optional .client.CmdRequest.FlushDB flushdb = 8;
+    if (has_flushdb()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->flushdb());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional .client.CmdRequest.Mset mset = 9;
+    if (has_mset()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->mset());
+    }
+
+    // optional .client.CmdRequest.Scan scan = 10;
+    if (has_scan()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->scan());
+    }
+
+    // optional .client.CmdRequest.Cas cas = 11;
+    if (has_cas()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->cas());
+    }
+
+    // optional .client.CmdRequest.Incrby incrby = 12;
+    if (has_incrby()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->incrby());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdRequest::MergeFrom(const CmdRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_type()) {
+      set_type(from.type());
+    }
+    if (from.has_sync()) {
+      mutable_sync()->::client::CmdRequest_Sync::MergeFrom(from.sync());
+    }
+    if (from.has_set()) {
+      mutable_set()->::client::CmdRequest_Set::MergeFrom(from.set());
+    }
+    if (from.has_get()) {
+      mutable_get()->::client::CmdRequest_Get::MergeFrom(from.get());
+    }
+    if (from.has_del()) {
+      mutable_del()->::client::CmdRequest_Del::MergeFrom(from.del());
+    }
+    if (from.has_info()) {
+      mutable_info()->::client::CmdRequest_Info::MergeFrom(from.info());
+    }
+    if (from.has_mget()) {
+      mutable_mget()->::client::CmdRequest_Mget::MergeFrom(from.mget());
+    }
+    if (from.has_flushdb()) {
+      mutable_flushdb()->::client::CmdRequest_FlushDB::MergeFrom(from.flushdb());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_mset()) {
+      mutable_mset()->::client::CmdRequest_Mset::MergeFrom(from.mset());
+    }
+    if (from.has_scan()) {
+      mutable_scan()->::client::CmdRequest_Scan::MergeFrom(from.scan());
+    }
+    if (from.has_cas()) {
+      mutable_cas()->::client::CmdRequest_Cas::MergeFrom(from.cas());
+    }
+    if (from.has_incrby()) {
+      mutable_incrby()->::client::CmdRequest_Incrby::MergeFrom(from.incrby());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdRequest::CopyFrom(const CmdRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  if (has_sync()) {
+    if (!this->sync().IsInitialized()) return false;
+  }
+  if (has_set()) {
+    if (!this->set().IsInitialized()) return false;
+  }
+  if (has_get()) {
+    if (!this->get().IsInitialized()) return false;
+  }
+  if (has_del()) {
+    if (!this->del().IsInitialized()) return false;
+  }
+  if (has_mget()) {
+    if (!this->mget().IsInitialized()) return false;
+  }
+  if (has_flushdb()) {
+    if (!this->flushdb().IsInitialized()) return false;
+  }
+  if (has_mset()) {
+    if (!this->mset().IsInitialized()) return false;
+  }
+  if (has_scan()) {
+    if (!this->scan().IsInitialized()) return false;
+  }
+  if (has_cas()) {
+    if (!this->cas().IsInitialized()) return false;
+  }
+  if (has_incrby()) {
+    if (!this->incrby().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CmdRequest::Swap(CmdRequest* other) {
+  if (other != this) {
+    std::swap(type_, other->type_);
+    std::swap(sync_, other->sync_);
+    std::swap(set_, other->set_);
+    std::swap(get_, other->get_);
+    std::swap(del_, other->del_);
+    std::swap(info_, other->info_);
+    std::swap(mget_, other->mget_);
+    std::swap(flushdb_, other->flushdb_);
+    std::swap(mset_, other->mset_);
+    std::swap(scan_, other->scan_);
+    std::swap(cas_, other->cas_);
+    std::swap(incrby_, other->incrby_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdRequest_descriptor_;
+  metadata.reflection = CmdRequest_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int CmdResponse_Sync::kTableNameFieldNumber;
+const int CmdResponse_Sync::kSyncOffsetFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_Sync::CmdResponse_Sync()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_Sync::InitAsDefaultInstance() {
+  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
+}
+
+CmdResponse_Sync::CmdResponse_Sync(const CmdResponse_Sync& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_Sync::SharedCtor() {
+  _cached_size_ = 0;
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  sync_offset_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_Sync::~CmdResponse_Sync() {
+  SharedDtor();
+}
+
+void CmdResponse_Sync::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (this != default_instance_) {
+    delete sync_offset_;
+  }
+}
+
+void CmdResponse_Sync::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_Sync::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_Sync_descriptor_;
+}
+
+const CmdResponse_Sync& CmdResponse_Sync::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_Sync* CmdResponse_Sync::default_instance_ = NULL;
+
+CmdResponse_Sync* CmdResponse_Sync::New() const {
+  return new CmdResponse_Sync;
+}
+
+void CmdResponse_Sync::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
+      }
+    }
+    if (has_sync_offset()) {
+      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_Sync::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string table_name = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_name().data(), this->table_name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_sync_offset;
+        break;
+      }
+
+      // required .client.SyncOffset sync_offset = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_sync_offset:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_sync_offset()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_Sync::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->table_name(), output);
+  }
+
+  // required .client.SyncOffset sync_offset = 2;
+  if (has_sync_offset()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->sync_offset(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_Sync::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
+  }
+
+  // required .client.SyncOffset sync_offset = 2;
+  if (has_sync_offset()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->sync_offset(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_Sync::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string table_name = 1;
+    if (has_table_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
+    }
+
+    // required .client.SyncOffset sync_offset = 2;
+    if (has_sync_offset()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->sync_offset());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_Sync::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_Sync* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Sync*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_Sync::MergeFrom(const CmdResponse_Sync& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
+    }
+    if (from.has_sync_offset()) {
+      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_Sync::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_Sync::CopyFrom(const CmdResponse_Sync& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_Sync::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  if (has_sync_offset()) {
+    if (!this->sync_offset().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CmdResponse_Sync::Swap(CmdResponse_Sync* other) {
+  if (other != this) {
+    std::swap(table_name_, other->table_name_);
+    std::swap(sync_offset_, other->sync_offset_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_Sync::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_Sync_descriptor_;
+  metadata.reflection = CmdResponse_Sync_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_Get::kValueFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_Get::CmdResponse_Get()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_Get::InitAsDefaultInstance() {
+}
+
+CmdResponse_Get::CmdResponse_Get(const CmdResponse_Get& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_Get::SharedCtor() {
+  _cached_size_ = 0;
+  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_Get::~CmdResponse_Get() {
+  SharedDtor();
+}
+
+void CmdResponse_Get::SharedDtor() {
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    delete value_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_Get::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_Get::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_Get_descriptor_;
+}
+
+const CmdResponse_Get& CmdResponse_Get::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_Get* CmdResponse_Get::default_instance_ = NULL;
+
+CmdResponse_Get* CmdResponse_Get::New() const {
+  return new CmdResponse_Get;
+}
+
+void CmdResponse_Get::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_value()) {
+      if (value_ != &::google::protobuf::internal::kEmptyString) {
+        value_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_Get::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional bytes value = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_value()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_Get::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional bytes value = 1;
+  if (has_value()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      1, this->value(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_Get::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional bytes value = 1;
+  if (has_value()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        1, this->value(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_Get::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional bytes value = 1;
+    if (has_value()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->value());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_Get::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_Get* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Get*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_Get::MergeFrom(const CmdResponse_Get& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_value()) {
+      set_value(from.value());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_Get::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_Get::CopyFrom(const CmdResponse_Get& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_Get::IsInitialized() const {
+
+  return true;
+}
+
+void CmdResponse_Get::Swap(CmdResponse_Get* other) {
+  if (other != this) {
+    std::swap(value_, other->value_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_Get::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_Get_descriptor_;
+  metadata.reflection = CmdResponse_Get_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_InfoStats::kTableNameFieldNumber;
+const int CmdResponse_InfoStats::kTotalQuerysFieldNumber;
+const int CmdResponse_InfoStats::kQpsFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_InfoStats::CmdResponse_InfoStats()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_InfoStats::InitAsDefaultInstance() {
+}
+
+CmdResponse_InfoStats::CmdResponse_InfoStats(const CmdResponse_InfoStats& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoStats::SharedCtor() {
+  _cached_size_ = 0;
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  total_querys_ = GOOGLE_LONGLONG(0);
+  qps_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_InfoStats::~CmdResponse_InfoStats() {
+  SharedDtor();
+}
+
+void CmdResponse_InfoStats::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_InfoStats::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_InfoStats::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_InfoStats_descriptor_;
+}
+
+const CmdResponse_InfoStats& CmdResponse_InfoStats::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_InfoStats* CmdResponse_InfoStats::default_instance_ = NULL;
+
+CmdResponse_InfoStats* CmdResponse_InfoStats::New() const {
+  return new CmdResponse_InfoStats;
+}
+
+void CmdResponse_InfoStats::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
+      }
+    }
+    total_querys_ = GOOGLE_LONGLONG(0);
+    qps_ = 0;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_InfoStats::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string table_name = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_name().data(), this->table_name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_total_querys;
+        break;
+      }
+
+      // required int64 total_querys = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_total_querys:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &total_querys_)));
+          set_has_total_querys();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_qps;
+        break;
+      }
+
+      // required int32 qps = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_qps:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &qps_)));
+          set_has_qps();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_InfoStats::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->table_name(), output);
+  }
+
+  // required int64 total_querys = 2;
+  if (has_total_querys()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->total_querys(), output);
+  }
+
+  // required int32 qps = 3;
+  if (has_qps()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->qps(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_InfoStats::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
+  }
+
+  // required int64 total_querys = 2;
+  if (has_total_querys()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->total_querys(), target);
+  }
+
+  // required int32 qps = 3;
+  if (has_qps()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->qps(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_InfoStats::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string table_name = 1;
+    if (has_table_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
+    }
+
+    // required int64 total_querys = 2;
+    if (has_total_querys()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->total_querys());
+    }
+
+    // required int32 qps = 3;
+    if (has_qps()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->qps());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_InfoStats::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_InfoStats* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoStats*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_InfoStats::MergeFrom(const CmdResponse_InfoStats& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
+    }
+    if (from.has_total_querys()) {
+      set_total_querys(from.total_querys());
+    }
+    if (from.has_qps()) {
+      set_qps(from.qps());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_InfoStats::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoStats::CopyFrom(const CmdResponse_InfoStats& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_InfoStats::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+
+  return true;
+}
+
+void CmdResponse_InfoStats::Swap(CmdResponse_InfoStats* other) {
+  if (other != this) {
+    std::swap(table_name_, other->table_name_);
+    std::swap(total_querys_, other->total_querys_);
+    std::swap(qps_, other->qps_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_InfoStats::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_InfoStats_descriptor_;
+  metadata.reflection = CmdResponse_InfoStats_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_InfoCapacity::kTableNameFieldNumber;
+const int CmdResponse_InfoCapacity::kUsedFieldNumber;
+const int CmdResponse_InfoCapacity::kRemainFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_InfoCapacity::CmdResponse_InfoCapacity()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_InfoCapacity::InitAsDefaultInstance() {
+}
+
+CmdResponse_InfoCapacity::CmdResponse_InfoCapacity(const CmdResponse_InfoCapacity& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoCapacity::SharedCtor() {
+  _cached_size_ = 0;
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  used_ = GOOGLE_LONGLONG(0);
+  remain_ = GOOGLE_LONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_InfoCapacity::~CmdResponse_InfoCapacity() {
+  SharedDtor();
+}
+
+void CmdResponse_InfoCapacity::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_InfoCapacity::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_InfoCapacity::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_InfoCapacity_descriptor_;
+}
+
+const CmdResponse_InfoCapacity& CmdResponse_InfoCapacity::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_InfoCapacity* CmdResponse_InfoCapacity::default_instance_ = NULL;
+
+CmdResponse_InfoCapacity* CmdResponse_InfoCapacity::New() const {
+  return new CmdResponse_InfoCapacity;
+}
+
+void CmdResponse_InfoCapacity::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
+      }
+    }
+    used_ = GOOGLE_LONGLONG(0);
+    remain_ = GOOGLE_LONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_InfoCapacity::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string table_name = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_name().data(), this->table_name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_used;
+        break;
+      }
+
+      // required int64 used = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_used:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &used_)));
+          set_has_used();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_remain;
+        break;
+      }
+
+      // required int64 remain = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_remain:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &remain_)));
+          set_has_remain();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_InfoCapacity::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->table_name(), output);
+  }
+
+  // required int64 used = 2;
+  if (has_used()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->used(), output);
+  }
+
+  // required int64 remain = 3;
+  if (has_remain()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->remain(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_InfoCapacity::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
+  }
+
+  // required int64 used = 2;
+  if (has_used()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->used(), target);
+  }
+
+  // required int64 remain = 3;
+  if (has_remain()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->remain(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_InfoCapacity::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string table_name = 1;
+    if (has_table_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
+    }
+
+    // required int64 used = 2;
+    if (has_used()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->used());
+    }
+
+    // required int64 remain = 3;
+    if (has_remain()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->remain());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_InfoCapacity::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_InfoCapacity* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoCapacity*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_InfoCapacity::MergeFrom(const CmdResponse_InfoCapacity& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
+    }
+    if (from.has_used()) {
+      set_used(from.used());
+    }
+    if (from.has_remain()) {
+      set_remain(from.remain());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_InfoCapacity::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoCapacity::CopyFrom(const CmdResponse_InfoCapacity& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_InfoCapacity::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+
+  return true;
+}
+
+void CmdResponse_InfoCapacity::Swap(CmdResponse_InfoCapacity* other) {
+  if (other != this) {
+    std::swap(table_name_, other->table_name_);
+    std::swap(used_, other->used_);
+    std::swap(remain_, other->remain_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_InfoCapacity::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_InfoCapacity_descriptor_;
+  metadata.reflection = CmdResponse_InfoCapacity_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_InfoRepl::kTableNameFieldNumber;
+const int CmdResponse_InfoRepl::kPartitionCntFieldNumber;
+const int CmdResponse_InfoRepl::kPartitionStateFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_InfoRepl::CmdResponse_InfoRepl()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_InfoRepl::InitAsDefaultInstance() {
+}
+
+CmdResponse_InfoRepl::CmdResponse_InfoRepl(const CmdResponse_InfoRepl& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoRepl::SharedCtor() {
+  _cached_size_ = 0;
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  partition_cnt_ = GOOGLE_LONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_InfoRepl::~CmdResponse_InfoRepl() {
+  SharedDtor();
+}
+
+void CmdResponse_InfoRepl::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_InfoRepl::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_InfoRepl::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_InfoRepl_descriptor_;
+}
+
+const CmdResponse_InfoRepl& CmdResponse_InfoRepl::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_InfoRepl* CmdResponse_InfoRepl::default_instance_ = NULL;
+
+CmdResponse_InfoRepl* CmdResponse_InfoRepl::New() const {
+  return new CmdResponse_InfoRepl;
+}
+
+void CmdResponse_InfoRepl::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
+      }
+    }
+    partition_cnt_ = GOOGLE_LONGLONG(0);
+  }
+  partition_state_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_InfoRepl::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string table_name = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_name().data(), this->table_name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_partition_cnt;
+        break;
+      }
+
+      // required int64 partition_cnt = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_partition_cnt:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &partition_cnt_)));
+          set_has_partition_cnt();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_partition_state;
+        break;
+      }
+
+      // repeated .client.PartitionState partition_state = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_partition_state:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_partition_state()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_partition_state;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_InfoRepl::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->table_name(), output);
+  }
+
+  // required int64 partition_cnt = 2;
+  if (has_partition_cnt()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->partition_cnt(), output);
+  }
+
+  // repeated .client.PartitionState partition_state = 3;
+  for (int i = 0; i < this->partition_state_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->partition_state(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_InfoRepl::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
+  }
+
+  // required int64 partition_cnt = 2;
+  if (has_partition_cnt()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->partition_cnt(), target);
+  }
+
+  // repeated .client.PartitionState partition_state = 3;
+  for (int i = 0; i < this->partition_state_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->partition_state(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_InfoRepl::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string table_name = 1;
+    if (has_table_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
+    }
+
+    // required int64 partition_cnt = 2;
+    if (has_partition_cnt()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->partition_cnt());
+    }
+
+  }
+  // repeated .client.PartitionState partition_state = 3;
+  total_size += 1 * this->partition_state_size();
+  for (int i = 0; i < this->partition_state_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->partition_state(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_InfoRepl::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_InfoRepl* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoRepl*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_InfoRepl::MergeFrom(const CmdResponse_InfoRepl& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  partition_state_.MergeFrom(from.partition_state_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
+    }
+    if (from.has_partition_cnt()) {
+      set_partition_cnt(from.partition_cnt());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_InfoRepl::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoRepl::CopyFrom(const CmdResponse_InfoRepl& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_InfoRepl::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  for (int i = 0; i < partition_state_size(); i++) {
+    if (!this->partition_state(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CmdResponse_InfoRepl::Swap(CmdResponse_InfoRepl* other) {
+  if (other != this) {
+    std::swap(table_name_, other->table_name_);
+    std::swap(partition_cnt_, other->partition_cnt_);
+    partition_state_.Swap(&other->partition_state_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_InfoRepl::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_InfoRepl_descriptor_;
+  metadata.reflection = CmdResponse_InfoRepl_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_Mget::kKeyFieldNumber;
+const int CmdResponse_Mget::kValueFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_Mget::CmdResponse_Mget()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_Mget::InitAsDefaultInstance() {
+}
+
+CmdResponse_Mget::CmdResponse_Mget(const CmdResponse_Mget& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_Mget::SharedCtor() {
+  _cached_size_ = 0;
+  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_Mget::~CmdResponse_Mget() {
+  SharedDtor();
+}
+
+void CmdResponse_Mget::SharedDtor() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    delete value_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_Mget::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_Mget::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_Mget_descriptor_;
+}
+
+const CmdResponse_Mget& CmdResponse_Mget::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_Mget* CmdResponse_Mget::default_instance_ = NULL;
+
+CmdResponse_Mget* CmdResponse_Mget::New() const {
+  return new CmdResponse_Mget;
+}
+
+void CmdResponse_Mget::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_key()) {
+      if (key_ != &::google::protobuf::internal::kEmptyString) {
+        key_->clear();
+      }
+    }
+    if (has_value()) {
+      if (value_ != &::google::protobuf::internal::kEmptyString) {
+        value_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_Mget::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string key = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_key()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->key().data(), this->key().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_value;
+        break;
+      }
+
+      // required bytes value = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_value:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_value()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_Mget::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string key = 1;
+  if (has_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key().data(), this->key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->key(), output);
+  }
+
+  // required bytes value = 2;
+  if (has_value()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      2, this->value(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_Mget::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string key = 1;
+  if (has_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key().data(), this->key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->key(), target);
+  }
+
+  // required bytes value = 2;
+  if (has_value()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        2, this->value(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_Mget::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string key = 1;
+    if (has_key()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->key());
+    }
+
+    // required bytes value = 2;
+    if (has_value()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->value());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_Mget::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_Mget* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Mget*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_Mget::MergeFrom(const CmdResponse_Mget& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_key()) {
+      set_key(from.key());
+    }
+    if (from.has_value()) {
+      set_value(from.value());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_Mget::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_Mget::CopyFrom(const CmdResponse_Mget& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_Mget::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  return true;
+}
+
+void CmdResponse_Mget::Swap(CmdResponse_Mget* other) {
+  if (other != this) {
+    std::swap(key_, other->key_);
+    std::swap(value_, other->value_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_Mget::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_Mget_descriptor_;
+  metadata.reflection = CmdResponse_Mget_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_InfoServer::kEpochFieldNumber;
+const int CmdResponse_InfoServer::kTableNamesFieldNumber;
+const int CmdResponse_InfoServer::kCurMetaFieldNumber;
+const int CmdResponse_InfoServer::kMetaRenewingFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_InfoServer::CmdResponse_InfoServer()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_InfoServer::InitAsDefaultInstance() {
+  cur_meta_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
+}
+
+CmdResponse_InfoServer::CmdResponse_InfoServer(const CmdResponse_InfoServer& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoServer::SharedCtor() {
+  _cached_size_ = 0;
+  epoch_ = GOOGLE_LONGLONG(0);
+  cur_meta_ = NULL;
+  meta_renewing_ = false;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_InfoServer::~CmdResponse_InfoServer() {
+  SharedDtor();
+}
+
+void CmdResponse_InfoServer::SharedDtor() {
+  if (this != default_instance_) {
+    delete cur_meta_;
+  }
+}
+
+void CmdResponse_InfoServer::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_InfoServer::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_InfoServer_descriptor_;
+}
+
+const CmdResponse_InfoServer& CmdResponse_InfoServer::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_InfoServer* CmdResponse_InfoServer::default_instance_ = NULL;
+
+CmdResponse_InfoServer* CmdResponse_InfoServer::New() const {
+  return new CmdResponse_InfoServer;
+}
+
+void CmdResponse_InfoServer::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    epoch_ = GOOGLE_LONGLONG(0);
+    if (has_cur_meta()) {
+      if (cur_meta_ != NULL) cur_meta_->::client::Node::Clear();
+    }
+    meta_renewing_ = false;
+  }
+  table_names_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_InfoServer::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int64 epoch = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &epoch_)));
+          set_has_epoch();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_table_names;
+        break;
+      }
+
+      // repeated string table_names = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_table_names:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_table_names()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_names(this->table_names_size() - 1).data(),
+            this->table_names(this->table_names_size() - 1).length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_table_names;
+        if (input->ExpectTag(26)) goto parse_cur_meta;
+        break;
+      }
+
+      // required .client.Node cur_meta = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_cur_meta:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_cur_meta()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_meta_renewing;
+        break;
+      }
+
+      // required bool meta_renewing = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_meta_renewing:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &meta_renewing_)));
+          set_has_meta_renewing();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_InfoServer::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required int64 epoch = 1;
+  if (has_epoch()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->epoch(), output);
+  }
+
+  // repeated string table_names = 2;
+  for (int i = 0; i < this->table_names_size(); i++) {
+  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+    this->table_names(i).data(), this->table_names(i).length(),
+    ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->table_names(i), output);
+  }
+
+  // required .client.Node cur_meta = 3;
+  if (has_cur_meta()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->cur_meta(), output);
+  }
+
+  // required bool meta_renewing = 4;
+  if (has_meta_renewing()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->meta_renewing(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_InfoServer::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required int64 epoch = 1;
+  if (has_epoch()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->epoch(), target);
+  }
+
+  // repeated string table_names = 2;
+  for (int i = 0; i < this->table_names_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_names(i).data(), this->table_names(i).length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(2, this->table_names(i), target);
+  }
+
+  // required .client.Node cur_meta = 3;
+  if (has_cur_meta()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->cur_meta(), target);
+  }
+
+  // required bool meta_renewing = 4;
+  if (has_meta_renewing()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->meta_renewing(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_InfoServer::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required int64 epoch = 1;
+    if (has_epoch()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->epoch());
+    }
+
+    // required .client.Node cur_meta = 3;
+    if (has_cur_meta()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->cur_meta());
+    }
+
+    // required bool meta_renewing = 4;
+    if (has_meta_renewing()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  // repeated string table_names = 2;
+  total_size += 1 * this->table_names_size();
+  for (int i = 0; i < this->table_names_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->table_names(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_InfoServer::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_InfoServer* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoServer*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_InfoServer::MergeFrom(const CmdResponse_InfoServer& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  table_names_.MergeFrom(from.table_names_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_epoch()) {
+      set_epoch(from.epoch());
+    }
+    if (from.has_cur_meta()) {
+      mutable_cur_meta()->::client::Node::MergeFrom(from.cur_meta());
+    }
+    if (from.has_meta_renewing()) {
+      set_meta_renewing(from.meta_renewing());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_InfoServer::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoServer::CopyFrom(const CmdResponse_InfoServer& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_InfoServer::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000d) != 0x0000000d) return false;
+
+  if (has_cur_meta()) {
+    if (!this->cur_meta().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CmdResponse_InfoServer::Swap(CmdResponse_InfoServer* other) {
+  if (other != this) {
+    std::swap(epoch_, other->epoch_);
+    table_names_.Swap(&other->table_names_);
+    std::swap(cur_meta_, other->cur_meta_);
+    std::swap(meta_renewing_, other->meta_renewing_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_InfoServer::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_InfoServer_descriptor_;
+  metadata.reflection = CmdResponse_InfoServer_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_Scan::kKvsFieldNumber;
+const int CmdResponse_Scan::kNextKeyFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_Scan::CmdResponse_Scan()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_Scan::InitAsDefaultInstance() {
+}
+
+CmdResponse_Scan::CmdResponse_Scan(const CmdResponse_Scan& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_Scan::SharedCtor() {
+  _cached_size_ = 0;
+  next_key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_Scan::~CmdResponse_Scan() {
+  SharedDtor();
+}
+
+void CmdResponse_Scan::SharedDtor() {
+  if (next_key_ != &::google::protobuf::internal::kEmptyString) {
+    delete next_key_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_Scan::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_Scan::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_Scan_descriptor_;
+}
+
+const CmdResponse_Scan& CmdResponse_Scan::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_Scan* CmdResponse_Scan::default_instance_ = NULL;
+
+CmdResponse_Scan* CmdResponse_Scan::New() const {
+  return new CmdResponse_Scan;
+}
+
+void CmdResponse_Scan::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_next_key()) {
+      if (next_key_ != &::google::protobuf::internal::kEmptyString) {
+        next_key_->clear();
+      }
+    }
+  }
+  kvs_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_Scan::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .client.Kv kvs = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_kvs:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_kvs()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(10)) goto parse_kvs;
+        if (input->ExpectTag(18)) goto parse_next_key;
+        break;
+      }
+
+      // optional string next_key = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_next_key:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_next_key()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->next_key().data(), this->next_key().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_Scan::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated .client.Kv kvs = 1;
+  for (int i = 0; i < this->kvs_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->kvs(i), output);
+  }
+
+  // optional string next_key = 2;
+  if (has_next_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->next_key().data(), this->next_key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->next_key(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_Scan::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // repeated .client.Kv kvs = 1;
+  for (int i = 0; i < this->kvs_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->kvs(i), target);
+  }
+
+  // optional string next_key = 2;
+  if (has_next_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->next_key().data(), this->next_key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->next_key(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_Scan::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional string next_key = 2;
+    if (has_next_key()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->next_key());
+    }
+
+  }
+  // repeated .client.Kv kvs = 1;
+  total_size += 1 * this->kvs_size();
+  for (int i = 0; i < this->kvs_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->kvs(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_Scan::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_Scan* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Scan*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_Scan::MergeFrom(const CmdResponse_Scan& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  kvs_.MergeFrom(from.kvs_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_next_key()) {
+      set_next_key(from.next_key());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_Scan::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_Scan::CopyFrom(const CmdResponse_Scan& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_Scan::IsInitialized() const {
+
+  for (int i = 0; i < kvs_size(); i++) {
+    if (!this->kvs(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void CmdResponse_Scan::Swap(CmdResponse_Scan* other) {
+  if (other != this) {
+    kvs_.Swap(&other->kvs_);
+    std::swap(next_key_, other->next_key_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_Scan::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_Scan_descriptor_;
+  metadata.reflection = CmdResponse_Scan_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_InfoLatency::kCmdTypeFieldNumber;
+const int CmdResponse_InfoLatency::kCountFieldNumber;
+const int CmdResponse_InfoLatency::kP50UsFieldNumber;
+const int CmdResponse_InfoLatency::kP99UsFieldNumber;
+const int CmdResponse_InfoLatency::kP999UsFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_InfoLatency::CmdResponse_InfoLatency()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_InfoLatency::InitAsDefaultInstance() {
+}
+
+CmdResponse_InfoLatency::CmdResponse_InfoLatency(const CmdResponse_InfoLatency& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoLatency::SharedCtor() {
+  _cached_size_ = 0;
+  cmd_type_ = 0;
+  count_ = GOOGLE_LONGLONG(0);
+  p50_us_ = GOOGLE_LONGLONG(0);
+  p99_us_ = GOOGLE_LONGLONG(0);
+  p999_us_ = GOOGLE_LONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_InfoLatency::~CmdResponse_InfoLatency() {
+  SharedDtor();
+}
+
+void CmdResponse_InfoLatency::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_InfoLatency::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_InfoLatency::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_InfoLatency_descriptor_;
+}
+
+const CmdResponse_InfoLatency& CmdResponse_InfoLatency::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_InfoLatency* CmdResponse_InfoLatency::default_instance_ = NULL;
+
+CmdResponse_InfoLatency* CmdResponse_InfoLatency::New() const {
+  return new CmdResponse_InfoLatency;
+}
+
+void CmdResponse_InfoLatency::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    cmd_type_ = 0;
+    count_ = GOOGLE_LONGLONG(0);
+    p50_us_ = GOOGLE_LONGLONG(0);
+    p99_us_ = GOOGLE_LONGLONG(0);
+    p999_us_ = GOOGLE_LONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_InfoLatency::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int32 cmd_type = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &cmd_type_)));
+          set_has_cmd_type();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_count;
+        break;
+      }
+
+      // required int64 count = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_count:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &count_)));
+          set_has_count();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_p50_us;
+        break;
+      }
+
+      // required int64 p50_us = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_p50_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &p50_us_)));
+          set_has_p50_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_p99_us;
+        break;
+      }
+
+      // required int64 p99_us = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_p99_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &p99_us_)));
+          set_has_p99_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_p999_us;
+        break;
+      }
+
+      // required int64 p999_us = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_p999_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &p999_us_)));
+          set_has_p999_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_InfoLatency::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required int32 cmd_type = 1;
+  if (has_cmd_type()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->cmd_type(), output);
+  }
+
+  // required int64 count = 2;
+  if (has_count()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->count(), output);
+  }
+
+  // required int64 p50_us = 3;
+  if (has_p50_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->p50_us(), output);
+  }
+
+  // required int64 p99_us = 4;
+  if (has_p99_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(4, this->p99_us(), output);
+  }
+
+  // required int64 p999_us = 5;
+  if (has_p999_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->p999_us(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_InfoLatency::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required int32 cmd_type = 1;
+  if (has_cmd_type()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->cmd_type(), target);
+  }
+
+  // required int64 count = 2;
+  if (has_count()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->count(), target);
+  }
+
+  // required int64 p50_us = 3;
+  if (has_p50_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->p50_us(), target);
+  }
+
+  // required int64 p99_us = 4;
+  if (has_p99_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(4, this->p99_us(), target);
+  }
+
+  // required int64 p999_us = 5;
+  if (has_p999_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->p999_us(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_InfoLatency::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required int32 cmd_type = 1;
+    if (has_cmd_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->cmd_type());
+    }
+
+    // required int64 count = 2;
+    if (has_count()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->count());
+    }
+
+    // required int64 p50_us = 3;
+    if (has_p50_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->p50_us());
+    }
+
+    // required int64 p99_us = 4;
+    if (has_p99_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->p99_us());
+    }
+
+    // required int64 p999_us = 5;
+    if (has_p999_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->p999_us());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_InfoLatency::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_InfoLatency* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoLatency*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_InfoLatency::MergeFrom(const CmdResponse_InfoLatency& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_cmd_type()) {
+      set_cmd_type(from.cmd_type());
+    }
+    if (from.has_count()) {
+      set_count(from.count());
+    }
+    if (from.has_p50_us()) {
+      set_p50_us(from.p50_us());
+    }
+    if (from.has_p99_us()) {
+      set_p99_us(from.p99_us());
+    }
+    if (from.has_p999_us()) {
+      set_p999_us(from.p999_us());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_InfoLatency::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoLatency::CopyFrom(const CmdResponse_InfoLatency& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_InfoLatency::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000001f) != 0x0000001f) return false;
+
+  return true;
+}
+
+void CmdResponse_InfoLatency::Swap(CmdResponse_InfoLatency* other) {
+  if (other != this) {
+    std::swap(cmd_type_, other->cmd_type_);
+    std::swap(count_, other->count_);
+    std::swap(p50_us_, other->p50_us_);
+    std::swap(p99_us_, other->p99_us_);
+    std::swap(p999_us_, other->p999_us_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_InfoLatency::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_InfoLatency_descriptor_;
+  metadata.reflection = CmdResponse_InfoLatency_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_Cas::kValueFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_Cas::CmdResponse_Cas()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_Cas::InitAsDefaultInstance() {
+}
+
+CmdResponse_Cas::CmdResponse_Cas(const CmdResponse_Cas& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_Cas::SharedCtor() {
+  _cached_size_ = 0;
+  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_Cas::~CmdResponse_Cas() {
+  SharedDtor();
+}
+
+void CmdResponse_Cas::SharedDtor() {
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    delete value_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_Cas::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_Cas::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_Cas_descriptor_;
+}
+
+const CmdResponse_Cas& CmdResponse_Cas::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_Cas* CmdResponse_Cas::default_instance_ = NULL;
+
+CmdResponse_Cas* CmdResponse_Cas::New() const {
+  return new CmdResponse_Cas;
+}
+
+void CmdResponse_Cas::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_value()) {
+      if (value_ != &::google::protobuf::internal::kEmptyString) {
+        value_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_Cas::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional bytes value = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_value()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_Cas::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional bytes value = 1;
+  if (has_value()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      1, this->value(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_Cas::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional bytes value = 1;
+  if (has_value()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        1, this->value(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_Cas::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional bytes value = 1;
+    if (has_value()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->value());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_Cas::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_Cas* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Cas*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_Cas::MergeFrom(const CmdResponse_Cas& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_value()) {
+      set_value(from.value());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_Cas::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_Cas::CopyFrom(const CmdResponse_Cas& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_Cas::IsInitialized() const {
+
+  return true;
+}
+
+void CmdResponse_Cas::Swap(CmdResponse_Cas* other) {
+  if (other != this) {
+    std::swap(value_, other->value_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_Cas::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_Cas_descriptor_;
+  metadata.reflection = CmdResponse_Cas_reflection_;
+  return metadata;
+}
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int CmdResponse_Incrby::kValueFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_Incrby::CmdResponse_Incrby()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_Incrby::InitAsDefaultInstance() {
+}
+
+CmdResponse_Incrby::CmdResponse_Incrby(const CmdResponse_Incrby& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_Incrby::SharedCtor() {
+  _cached_size_ = 0;
+  value_ = GOOGLE_LONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_Incrby::~CmdResponse_Incrby() {
+  SharedDtor();
+}
+
+void CmdResponse_Incrby::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_Incrby::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_Incrby::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_Incrby_descriptor_;
+}
+
+const CmdResponse_Incrby& CmdResponse_Incrby::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_Incrby* CmdResponse_Incrby::default_instance_ = NULL;
+
+CmdResponse_Incrby* CmdResponse_Incrby::New() const {
+  return new CmdResponse_Incrby;
+}
+
+void CmdResponse_Incrby::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    value_ = GOOGLE_LONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_Incrby::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int64 value = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &value_)));
+          set_has_value();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_Incrby::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required int64 value = 1;
+  if (has_value()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->value(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_Incrby::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required int64 value = 1;
+  if (has_value()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->value(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_Incrby::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required int64 value = 1;
+    if (has_value()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->value());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_Incrby::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_Incrby* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Incrby*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_Incrby::MergeFrom(const CmdResponse_Incrby& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_value()) {
+      set_value(from.value());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_Incrby::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_Incrby::CopyFrom(const CmdResponse_Incrby& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_Incrby::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  return true;
+}
+
+void CmdResponse_Incrby::Swap(CmdResponse_Incrby* other) {
+  if (other != this) {
+    std::swap(value_, other->value_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_Incrby::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_Incrby_descriptor_;
+  metadata.reflection = CmdResponse_Incrby_reflection_;
+  return metadata;
+}
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int CmdResponse_InfoSlowlog::kTimeFieldNumber;
+const int CmdResponse_InfoSlowlog::kTableNameFieldNumber;
+const int CmdResponse_InfoSlowlog::kPartitionFieldNumber;
+const int CmdResponse_InfoSlowlog::kCmdTypeFieldNumber;
+const int CmdResponse_InfoSlowlog::kTotalUsFieldNumber;
+const int CmdResponse_InfoSlowlog::kSuspendWaitUsFieldNumber;
+const int CmdResponse_InfoSlowlog::kLockWaitUsFieldNumber;
+const int CmdResponse_InfoSlowlog::kDbUsFieldNumber;
+const int CmdResponse_InfoSlowlog::kBinlogUsFieldNumber;
+const int CmdResponse_InfoSlowlog::kAckWaitUsFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse_InfoSlowlog::CmdResponse_InfoSlowlog()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse_InfoSlowlog::InitAsDefaultInstance() {
+}
+
+CmdResponse_InfoSlowlog::CmdResponse_InfoSlowlog(const CmdResponse_InfoSlowlog& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoSlowlog::SharedCtor() {
+  _cached_size_ = 0;
+  time_ = GOOGLE_LONGLONG(0);
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  partition_ = 0;
+  cmd_type_ = 0;
+  total_us_ = GOOGLE_LONGLONG(0);
+  suspend_wait_us_ = GOOGLE_LONGLONG(0);
+  lock_wait_us_ = GOOGLE_LONGLONG(0);
+  db_us_ = GOOGLE_LONGLONG(0);
+  binlog_us_ = GOOGLE_LONGLONG(0);
+  ack_wait_us_ = GOOGLE_LONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse_InfoSlowlog::~CmdResponse_InfoSlowlog() {
+  SharedDtor();
+}
+
+void CmdResponse_InfoSlowlog::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void CmdResponse_InfoSlowlog::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse_InfoSlowlog::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_InfoSlowlog_descriptor_;
+}
+
+const CmdResponse_InfoSlowlog& CmdResponse_InfoSlowlog::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse_InfoSlowlog* CmdResponse_InfoSlowlog::default_instance_ = NULL;
+
+CmdResponse_InfoSlowlog* CmdResponse_InfoSlowlog::New() const {
+  return new CmdResponse_InfoSlowlog;
+}
+
+void CmdResponse_InfoSlowlog::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    time_ = GOOGLE_LONGLONG(0);
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
+      }
+    }
+    partition_ = 0;
+    cmd_type_ = 0;
+    total_us_ = GOOGLE_LONGLONG(0);
+    suspend_wait_us_ = GOOGLE_LONGLONG(0);
+    lock_wait_us_ = GOOGLE_LONGLONG(0);
+    db_us_ = GOOGLE_LONGLONG(0);
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    binlog_us_ = GOOGLE_LONGLONG(0);
+    ack_wait_us_ = GOOGLE_LONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse_InfoSlowlog::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int64 time = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &time_)));
+          set_has_time();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_table_name;
+        break;
+      }
+
+      // required string table_name = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_table_name:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_name().data(), this->table_name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_partition;
+        break;
+      }
+
+      // required int32 partition = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_partition:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &partition_)));
+          set_has_partition();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_cmd_type;
+        break;
+      }
+
+      // required int32 cmd_type = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_cmd_type:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &cmd_type_)));
+          set_has_cmd_type();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_total_us;
+        break;
+      }
+
+      // required int64 total_us = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_total_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &total_us_)));
+          set_has_total_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(48)) goto parse_suspend_wait_us;
+        break;
+      }
+
+      // required int64 suspend_wait_us = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_suspend_wait_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &suspend_wait_us_)));
+          set_has_suspend_wait_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(56)) goto parse_lock_wait_us;
+        break;
+      }
+
+      // required int64 lock_wait_us = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_lock_wait_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &lock_wait_us_)));
+          set_has_lock_wait_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(64)) goto parse_db_us;
+        break;
+      }
+
+      // required int64 db_us = 8;
+      case 8: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_db_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &db_us_)));
+          set_has_db_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(72)) goto parse_binlog_us;
+        break;
+      }
+
+      // required int64 binlog_us = 9;
+      case 9: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_binlog_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &binlog_us_)));
+          set_has_binlog_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(80)) goto parse_ack_wait_us;
+        break;
+      }
+
+      // required int64 ack_wait_us = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_ack_wait_us:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &ack_wait_us_)));
+          set_has_ack_wait_us();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CmdResponse_InfoSlowlog::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required int64 time = 1;
+  if (has_time()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->time(), output);
+  }
+
+  // required string table_name = 2;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->table_name(), output);
+  }
+
+  // required int32 partition = 3;
+  if (has_partition()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->partition(), output);
+  }
+
+  // required int32 cmd_type = 4;
+  if (has_cmd_type()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->cmd_type(), output);
+  }
+
+  // required int64 total_us = 5;
+  if (has_total_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->total_us(), output);
+  }
+
+  // required int64 suspend_wait_us = 6;
+  if (has_suspend_wait_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(6, this->suspend_wait_us(), output);
+  }
+
+  // required int64 lock_wait_us = 7;
+  if (has_lock_wait_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(7, this->lock_wait_us(), output);
+  }
+
+  // required int64 db_us = 8;
+  if (has_db_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(8, this->db_us(), output);
+  }
+
+  // required int64 binlog_us = 9;
+  if (has_binlog_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(9, this->binlog_us(), output);
+  }
+
+  // required int64 ack_wait_us = 10;
+  if (has_ack_wait_us()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(10, this->ack_wait_us(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* CmdResponse_InfoSlowlog::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required int64 time = 1;
+  if (has_time()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->time(), target);
+  }
+
+  // required string table_name = 2;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->table_name(), target);
+  }
+
+  // required int32 partition = 3;
+  if (has_partition()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->partition(), target);
+  }
+
+  // required int32 cmd_type = 4;
+  if (has_cmd_type()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->cmd_type(), target);
+  }
+
+  // required int64 total_us = 5;
+  if (has_total_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->total_us(), target);
+  }
+
+  // required int64 suspend_wait_us = 6;
+  if (has_suspend_wait_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(6, this->suspend_wait_us(), target);
+  }
+
+  // required int64 lock_wait_us = 7;
+  if (has_lock_wait_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(7, this->lock_wait_us(), target);
+  }
+
+  // required int64 db_us = 8;
+  if (has_db_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(8, this->db_us(), target);
+  }
+
+  // required int64 binlog_us = 9;
+  if (has_binlog_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(9, this->binlog_us(), target);
+  }
+
+  // required int64 ack_wait_us = 10;
+  if (has_ack_wait_us()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(10, this->ack_wait_us(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int CmdResponse_InfoSlowlog::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required int64 time = 1;
+    if (has_time()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->time());
+    }
+
+    // required string table_name = 2;
+    if (has_table_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
+    }
+
+    // required int32 partition = 3;
+    if (has_partition()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->partition());
+    }
+
+    // required int32 cmd_type = 4;
+    if (has_cmd_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->cmd_type());
+    }
+
+    // required int64 total_us = 5;
+    if (has_total_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->total_us());
+    }
+
+    // required int64 suspend_wait_us = 6;
+    if (has_suspend_wait_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->suspend_wait_us());
+    }
+
+    // required int64 lock_wait_us = 7;
+    if (has_lock_wait_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->lock_wait_us());
+    }
+
+    // required int64 db_us = 8;
+    if (has_db_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->db_us());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // required int64 binlog_us = 9;
+    if (has_binlog_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->binlog_us());
+    }
+
+    // required int64 ack_wait_us = 10;
+    if (has_ack_wait_us()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->ack_wait_us());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CmdResponse_InfoSlowlog::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const CmdResponse_InfoSlowlog* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoSlowlog*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void CmdResponse_InfoSlowlog::MergeFrom(const CmdResponse_InfoSlowlog& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_time()) {
+      set_time(from.time());
+    }
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
+    }
+    if (from.has_partition()) {
+      set_partition(from.partition());
+    }
+    if (from.has_cmd_type()) {
+      set_cmd_type(from.cmd_type());
+    }
+    if (from.has_total_us()) {
+      set_total_us(from.total_us());
+    }
+    if (from.has_suspend_wait_us()) {
+      set_suspend_wait_us(from.suspend_wait_us());
+    }
+    if (from.has_lock_wait_us()) {
+      set_lock_wait_us(from.lock_wait_us());
+    }
+    if (from.has_db_us()) {
+      set_db_us(from.db_us());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_binlog_us()) {
+      set_binlog_us(from.binlog_us());
+    }
+    if (from.has_ack_wait_us()) {
+      set_ack_wait_us(from.ack_wait_us());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void CmdResponse_InfoSlowlog::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CmdResponse_InfoSlowlog::CopyFrom(const CmdResponse_InfoSlowlog& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_InfoSlowlog::IsInitialized() const {
+  if ((_has_bits_[0] & 0x000003ff) != 0x000003ff) return false;
+
+  return true;
+}
+
+void CmdResponse_InfoSlowlog::Swap(CmdResponse_InfoSlowlog* other) {
+  if (other != this) {
+    std::swap(time_, other->time_);
+    std::swap(table_name_, other->table_name_);
+    std::swap(partition_, other->partition_);
+    std::swap(cmd_type_, other->cmd_type_);
+    std::swap(total_us_, other->total_us_);
+    std::swap(suspend_wait_us_, other->suspend_wait_us_);
+    std::swap(lock_wait_us_, other->lock_wait_us_);
+    std::swap(db_us_, other->db_us_);
+    std::swap(binlog_us_, other->binlog_us_);
+    std::swap(ack_wait_us_, other->ack_wait_us_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata CmdResponse_InfoSlowlog::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = CmdResponse_InfoSlowlog_descriptor_;
+  metadata.reflection = CmdResponse_InfoSlowlog_reflection_;
+  return metadata;
+}
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int CmdResponse::kTypeFieldNumber;
+const int CmdResponse::kCodeFieldNumber;
+const int CmdResponse::kMsgFieldNumber;
+const int CmdResponse::kSyncFieldNumber;
+const int CmdResponse::kGetFieldNumber;
+const int CmdResponse::kRedirectFieldNumber;
+const int CmdResponse::kInfoStatsFieldNumber;
+const int CmdResponse::kInfoCapacityFieldNumber;
+const int CmdResponse::kInfoReplFieldNumber;
+const int CmdResponse::kMgetFieldNumber;
+const int CmdResponse::kInfoServerFieldNumber;
+const int CmdResponse::kScanFieldNumber;
+const int CmdResponse::kInfoLatencyFieldNumber;
+const int CmdResponse::kCasFieldNumber;
+const int CmdResponse::kIncrbyFieldNumber;
+const int CmdResponse::kInfoSlowlogFieldNumber;
+#endif  // !_MSC_VER
+
+CmdResponse::CmdResponse()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void CmdResponse::InitAsDefaultInstance() {
+  sync_ = const_cast< ::client::CmdResponse_Sync*>(&::client::CmdResponse_Sync::default_instance());
+  get_ = const_cast< ::client::CmdResponse_Get*>(&::client::CmdResponse_Get::default_instance());
+  redirect_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
+  info_server_ = const_cast< ::client::CmdResponse_InfoServer*>(&::client::CmdResponse_InfoServer::default_instance());
+  scan_ = const_cast< ::client::CmdResponse_Scan*>(&::client::CmdResponse_Scan::default_instance());
+  cas_ = const_cast< ::client::CmdResponse_Cas*>(&::client::CmdResponse_Cas::default_instance());
+  incrby_ = const_cast< ::client::CmdResponse_Incrby*>(&::client::CmdResponse_Incrby::default_instance());
+}
+
+CmdResponse::CmdResponse(const CmdResponse& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CmdResponse::SharedCtor() {
+  _cached_size_ = 0;
+  type_ = 0;
+  code_ = 0;
+  msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  sync_ = NULL;
+  get_ = NULL;
+  redirect_ = NULL;
+  info_server_ = NULL;
+  scan_ = NULL;
+  cas_ = NULL;
+  incrby_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CmdResponse::~CmdResponse() {
+  SharedDtor();
+}
+
+void CmdResponse::SharedDtor() {
+  if (msg_ != &::google::protobuf::internal::kEmptyString) {
+    delete msg_;
+  }
+  if (this != default_instance_) {
+    delete sync_;
+    delete get_;
+    delete redirect_;
+    delete info_server_;
+    delete scan_;
+    delete cas_;
+    delete incrby_;
+  }
+}
+
+void CmdResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CmdResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return CmdResponse_descriptor_;
+}
+
+const CmdResponse& CmdResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
+  return *default_instance_;
+}
+
+CmdResponse* CmdResponse::default_instance_ = NULL;
+
+CmdResponse* CmdResponse::New() const {
+  return new CmdResponse;
+}
+
+void CmdResponse::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    type_ = 0;
+    code_ = 0;
+    if (has_msg()) {
+      if (msg_ != &::google::protobuf::internal::kEmptyString) {
+        msg_->clear();
+      }
+    }
+    if (has_sync()) {
+      if (sync_ != NULL) sync_->::client::CmdResponse_Sync::Clear();
+    }
+    if (has_get()) {
+      if (get_ != NULL) get_->::client::CmdResponse_Get::Clear();
+    }
+    if (has_redirect()) {
+      if (redirect_ != NULL) redirect_->::client::Node::Clear();
+    }
+  }
+  if (_has_bits_[10 / 32] & (0xffu << (10 % 32))) {
+    if (has_info_server()) {
+      if (info_server_ != NULL) info_server_->::client::CmdResponse_InfoServer::Clear();
+    }
+    if (has_scan()) {
+      if (scan_ != NULL) scan_->::client::CmdResponse_Scan::Clear();
+    }
+    if (has_cas()) {
+      if (cas_ != NULL) cas_->::client::CmdResponse_Cas::Clear();
+    }
+    if (has_incrby()) {
+      if (incrby_ != NULL) incrby_->::client::CmdResponse_Incrby::Clear();
+    }
+  }
+  info_stats_.Clear();
+  info_capacity_.Clear();
+  info_repl_.Clear();
+  mget_.Clear();
+  info_latency_.Clear();
+  info_slowlog_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool CmdResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required .client.Type type = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::client::Type_IsValid(value)) {
+            set_type(static_cast< ::client::Type >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(1, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_code;
+        break;
+      }
+
+      // required .client.StatusCode code = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_code:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::client::StatusCode_IsValid(value)) {
+            set_code(static_cast< ::client::StatusCode >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(2, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_msg;
+        break;
+      }
+
+      // optional string msg = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_msg:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_msg()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->msg().data(), this->msg().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_sync;
+        break;
+      }
+
+      // optional .client.CmdResponse.Sync sync = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_sync:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_sync()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_get;
+        break;
+      }
+
+      // optional .client.CmdResponse.Get get = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_get:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_get()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(50)) goto parse_redirect;
+        break;
+      }
+
+      // optional .client.Node redirect = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_redirect:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_redirect()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(58)) goto parse_info_stats;
+        break;
+      }
+
+      // repeated .client.CmdResponse.InfoStats info_stats = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_info_stats:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_info_stats()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(58)) goto parse_info_stats;
+        if (input->ExpectTag(66)) goto parse_info_capacity;
+        break;
+      }
+
+      // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+      case 8: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_info_capacity:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_info_capacity()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(66)) goto parse_info_capacity;
+        if (input->ExpectTag(74)) goto parse_info_repl;
+        break;
+      }
+
+      // repeated .client.CmdResponse.InfoRepl info_repl = 9;
+      case 9: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_info_repl:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_info_repl()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(74)) goto parse_info_repl;
+        if (input->ExpectTag(82)) goto parse_mget;
+        break;
+      }
+
+      // repeated .client.CmdResponse.Mget mget = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_mget:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_mget()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(82)) goto parse_mget;
+        if (input->ExpectTag(90)) goto parse_info_server;
+        break;
+      }
+
+      // optional .client.CmdResponse.InfoServer info_server = 11;
+      case 11: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_info_server:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_info_server()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(98)) goto parse_scan;
+        break;
+      }
+
+      // optional .client.CmdResponse.Scan scan = 12;
+      case 12: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_scan:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_scan()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(106)) goto parse_info_latency;
+        break;
+      }
+
+      // repeated .client.CmdResponse.InfoLatency info_latency = 13;
+      case 13: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_info_latency:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_info_latency()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(106)) goto parse_info_latency;
+        if (input->ExpectTag(114)) goto parse_cas;
+        break;
+      }
+
+      // optional .client.CmdResponse.Cas cas = 14;
+      case 14: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_cas:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_cas()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_used;
+        if (input->ExpectTag(122)) goto parse_incrby;
         break;
       }
 
-      // required int64 used = 2;
-      case 2: {
+      // optional .client.CmdResponse.Incrby incrby = 15;
+      case 15: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_used:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &used_)));
-          set_has_used();
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_incrby:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_incrby()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(24)) goto parse_remain;
+        if (input->ExpectTag(130)) goto parse_info_slowlog;
         break;
       }
 
-      // required int64 remain = 3;
-      case 3: {
+      // repeated .client.CmdResponse.InfoSlowlog info_slowlog = 16;
+      case 16: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_remain:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &remain_)));
-          set_has_remain();
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_info_slowlog:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_info_slowlog()));
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(130)) goto parse_info_slowlog;
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -6192,25 +11506,105 @@ bool CmdResponse_InfoCapacity::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void CmdResponse_InfoCapacity::SerializeWithCachedSizes(
+void CmdResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
+  // required .client.Type type = 1;
+  if (has_type()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->type(), output);
+  }
+
+  // required .client.StatusCode code = 2;
+  if (has_code()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->code(), output);
+  }
+
+  // optional string msg = 3;
+  if (has_msg()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
+      this->msg().data(), this->msg().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+      3, this->msg(), output);
   }
 
-  // required int64 used = 2;
-  if (has_used()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->used(), output);
+  // optional .client.CmdResponse.Sync sync = 4;
+  if (has_sync()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->sync(), output);
   }
 
-  // required int64 remain = 3;
-  if (has_remain()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->remain(), output);
+  // optional .client.CmdResponse.Get get = 5;
+  if (has_get()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->get(), output);
+  }
+
+  // optional .client.Node redirect = 6;
+  if (has_redirect()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, this->redirect(), output);
+  }
+
+  // repeated .client.CmdResponse.InfoStats info_stats = 7;
+  for (int i = 0; i < this->info_stats_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->info_stats(i), output);
+  }
+
+  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+  for (int i = 0; i < this->info_capacity_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, this->info_capacity(i), output);
+  }
+
+  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
+  for (int i = 0; i < this->info_repl_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      9, this->info_repl(i), output);
+  }
+
+  // repeated .client.CmdResponse.Mget mget = 10;
+  for (int i = 0; i < this->mget_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      10, this->mget(i), output);
+  }
+
+  // optional .client.CmdResponse.InfoServer info_server = 11;
+  if (has_info_server()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      11, this->info_server(), output);
+  }
+
+  // optional .client.CmdResponse.Scan scan = 12;
+  if (has_scan()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      12, this->scan(), output);
+  }
+
+  // repeated .client.CmdResponse.InfoLatency info_latency = 13;
+  for (int i = 0; i < this->info_latency_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      13, this->info_latency(i), output);
+  }
+
+  // optional .client.CmdResponse.Cas cas = 14;
+  if (has_cas()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      14, this->cas(), output);
+  }
+
+  // optional .client.CmdResponse.Incrby incrby = 15;
+  if (has_incrby()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      15, this->incrby(), output);
+  }
+
+  // repeated .client.CmdResponse.InfoSlowlog info_slowlog = 16;
+  for (int i = 0; i < this->info_slowlog_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      16, this->info_slowlog(i), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -6219,26 +11613,119 @@ void CmdResponse_InfoCapacity::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdResponse_InfoCapacity::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CmdResponse::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
+  // required .client.Type type = 1;
+  if (has_type()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->type(), target);
+  }
+
+  // required .client.StatusCode code = 2;
+  if (has_code()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->code(), target);
+  }
+
+  // optional string msg = 3;
+  if (has_msg()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
+      this->msg().data(), this->msg().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+        3, this->msg(), target);
   }
 
-  // required int64 used = 2;
-  if (has_used()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->used(), target);
+  // optional .client.CmdResponse.Sync sync = 4;
+  if (has_sync()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->sync(), target);
   }
 
-  // required int64 remain = 3;
-  if (has_remain()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->remain(), target);
+  // optional .client.CmdResponse.Get get = 5;
+  if (has_get()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->get(), target);
+  }
+
+  // optional .client.Node redirect = 6;
+  if (has_redirect()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        6, this->redirect(), target);
+  }
+
+  // repeated .client.CmdResponse.InfoStats info_stats = 7;
+  for (int i = 0; i < this->info_stats_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->info_stats(i), target);
+  }
+
+  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+  for (int i = 0; i < this->info_capacity_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        8, this->info_capacity(i), target);
+  }
+
+  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
+  for (int i = 0; i < this->info_repl_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        9, this->info_repl(i), target);
+  }
+
+  // repeated .client.CmdResponse.Mget mget = 10;
+  for (int i = 0; i < this->mget_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        10, this->mget(i), target);
+  }
+
+  // optional .client.CmdResponse.InfoServer info_server = 11;
+  if (has_info_server()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        11, this->info_server(), target);
+  }
+
+  // optional .client.CmdResponse.Scan scan = 12;
+  if (has_scan()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        12, this->scan(), target);
+  }
+
+  // repeated .client.CmdResponse.InfoLatency info_latency = 13;
+  for (int i = 0; i < this->info_latency_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        13, this->info_latency(i), target);
+  }
+
+  // optional .client.CmdResponse.Cas cas = 14;
+  if (has_cas()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        14, this->cas(), target);
+  }
+
+  // optional .client.CmdResponse.Incrby incrby = 15;
+  if (has_incrby()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        15, this->incrby(), target);
+  }
+
+  // repeated .client.CmdResponse.InfoSlowlog info_slowlog = 16;
+  for (int i = 0; i < this->info_slowlog_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        16, this->info_slowlog(i), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -6248,32 +11735,129 @@ void CmdResponse_InfoCapacity::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdResponse_InfoCapacity::ByteSize() const {
-  int total_size = 0;
+int CmdResponse::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required .client.Type type = 1;
+    if (has_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+    }
+
+    // required .client.StatusCode code = 2;
+    if (has_code()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->code());
+    }
+
+    // optional string msg = 3;
+    if (has_msg()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->msg());
+    }
+
+    // optional .client.CmdResponse.Sync sync = 4;
+    if (has_sync()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->sync());
+    }
+
+    // optional .client.CmdResponse.Get get = 5;
+    if (has_get()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->get());
+    }
+
+    // optional .client.Node redirect = 6;
+    if (has_redirect()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->redirect());
+    }
+
+  }
+  if (_has_bits_[10 / 32] & (0xffu << (10 % 32))) {
+    // optional .client.CmdResponse.InfoServer info_server = 11;
+    if (has_info_server()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->info_server());
+    }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string table_name = 1;
-    if (has_table_name()) {
+    // optional .client.CmdResponse.Scan scan = 12;
+    if (has_scan()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->scan());
     }
 
-    // required int64 used = 2;
-    if (has_used()) {
+    // optional .client.CmdResponse.Cas cas = 14;
+    if (has_cas()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->used());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->cas());
     }
 
-    // required int64 remain = 3;
-    if (has_remain()) {
+    // optional .client.CmdResponse.Incrby incrby = 15;
+    if (has_incrby()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->remain());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->incrby());
     }
 
   }
+  // repeated .client.CmdResponse.InfoStats info_stats = 7;
+  total_size += 1 * this->info_stats_size();
+  for (int i = 0; i < this->info_stats_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->info_stats(i));
+  }
+
+  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+  total_size += 1 * this->info_capacity_size();
+  for (int i = 0; i < this->info_capacity_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->info_capacity(i));
+  }
+
+  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
+  total_size += 1 * this->info_repl_size();
+  for (int i = 0; i < this->info_repl_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->info_repl(i));
+  }
+
+  // repeated .client.CmdResponse.Mget mget = 10;
+  total_size += 1 * this->mget_size();
+  for (int i = 0; i < this->mget_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->mget(i));
+  }
+
+  // repeated .client.CmdResponse.InfoLatency info_latency = 13;
+  total_size += 1 * this->info_latency_size();
+  for (int i = 0; i < this->info_latency_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->info_latency(i));
+  }
+
+  // repeated .client.CmdResponse.InfoSlowlog info_slowlog = 16;
+  total_size += 2 * this->info_slowlog_size();
+  for (int i = 0; i < this->info_slowlog_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->info_slowlog(i));
+  }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -6285,10 +11869,10 @@ int CmdResponse_InfoCapacity::ByteSize() const {
   return total_size;
 }
 
-void CmdResponse_InfoCapacity::MergeFrom(const ::google::protobuf::Message& from) {
+void CmdResponse::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_InfoCapacity* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoCapacity*>(
+  const CmdResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6297,94 +11881,170 @@ void CmdResponse_InfoCapacity::MergeFrom(const ::google::protobuf::Message& from
   }
 }
 
-void CmdResponse_InfoCapacity::MergeFrom(const CmdResponse_InfoCapacity& from) {
+void CmdResponse::MergeFrom(const CmdResponse& from) {
   GOOGLE_CHECK_NE(&from, this);
+  info_stats_.MergeFrom(from.info_stats_);
+  info_capacity_.MergeFrom(from.info_capacity_);
+  info_repl_.MergeFrom(from.info_repl_);
+  mget_.MergeFrom(from.mget_);
+  info_latency_.MergeFrom(from.info_latency_);
+  info_slowlog_.MergeFrom(from.info_slowlog_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+    if (from.has_type()) {
+      set_type(from.type());
     }
-    if (from.has_used()) {
-      set_used(from.used());
+    if (from.has_code()) {
+      set_code(from.code());
     }
-    if (from.has_remain()) {
-      set_remain(from.remain());
+    if (from.has_msg()) {
+      set_msg(from.msg());
+    }
+    if (from.has_sync()) {
+      mutable_sync()->::client::CmdResponse_Sync::MergeFrom(from.sync());
+    }
+    if (from.has_get()) {
+      mutable_get()->::client::CmdResponse_Get::MergeFrom(from.get());
+    }
+    if (from.has_redirect()) {
+      mutable_redirect()->::client::Node::MergeFrom(from.redirect());
+    }
+  }
+  if (from._has_bits_[10 / 32] & (0xffu << (10 % 32))) {
+    if (from.has_info_server()) {
+      mutable_info_server()->::client::CmdResponse_InfoServer::MergeFrom(from.info_server());
+    }
+    if (from.has_scan()) {
+      mutable_scan()->::client::CmdResponse_Scan::MergeFrom(from.scan());
+    }
+    if (from.has_cas()) {
+      mutable_cas()->::client::CmdResponse_Cas::MergeFrom(from.cas());
+    }
+    if (from.has_incrby()) {
+      mutable_incrby()->::client::CmdResponse_Incrby::MergeFrom(from.incrby());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdResponse_InfoCapacity::CopyFrom(const ::google::protobuf::Message& from) {
+void CmdResponse::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoCapacity::CopyFrom(const CmdResponse_InfoCapacity& from) {
+void CmdResponse::CopyFrom(const CmdResponse& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_InfoCapacity::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+bool CmdResponse::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
 
+  if (has_sync()) {
+    if (!this->sync().IsInitialized()) return false;
+  }
+  if (has_redirect()) {
+    if (!this->redirect().IsInitialized()) return false;
+  }
+  for (int i = 0; i < info_stats_size(); i++) {
+    if (!this->info_stats(i).IsInitialized()) return false;
+  }
+  for (int i = 0; i < info_capacity_size(); i++) {
+    if (!this->info_capacity(i).IsInitialized()) return false;
+  }
+  for (int i = 0; i < info_repl_size(); i++) {
+    if (!this->info_repl(i).IsInitialized()) return false;
+  }
+  for (int i = 0; i < mget_size(); i++) {
+    if (!this->mget(i).IsInitialized()) return false;
+  }
+  for (int i = 0; i < info_latency_size(); i++) {
+    if (!this->info_latency(i).IsInitialized()) return false;
+  }
+  for (int i = 0; i < info_slowlog_size(); i++) {
+    if (!this->info_slowlog(i).IsInitialized()) return false;
+  }
+  if (has_info_server()) {
+    if (!this->info_server().IsInitialized()) return false;
+  }
+  if (has_scan()) {
+    if (!this->scan().IsInitialized()) return false;
+  }
+  if (has_incrby()) {
+    if (!this->incrby().IsInitialized()) return false;
+  }
   return true;
 }
 
-void CmdResponse_InfoCapacity::Swap(CmdResponse_InfoCapacity* other) {
+void CmdResponse::Swap(CmdResponse* other) {
   if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(used_, other->used_);
-    std::swap(remain_, other->remain_);
+    std::swap(type_, other->type_);
+    std::swap(code_, other->code_);
+    std::swap(msg_, other->msg_);
+    std::swap(sync_, other->sync_);
+    std::swap(get_, other->get_);
+    std::swap(redirect_, other->redirect_);
+    info_stats_.Swap(&other->info_stats_);
+    info_capacity_.Swap(&other->info_capacity_);
+    info_repl_.Swap(&other->info_repl_);
+    mget_.Swap(&other->mget_);
+    std::swap(info_server_, other->info_server_);
+    std::swap(scan_, other->scan_);
+    info_latency_.Swap(&other->info_latency_);
+    std::swap(cas_, other->cas_);
+    std::swap(incrby_, other->incrby_);
+    info_slowlog_.Swap(&other->info_slowlog_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdResponse_InfoCapacity::GetMetadata() const {
+::google::protobuf::Metadata CmdResponse::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_InfoCapacity_descriptor_;
-  metadata.reflection = CmdResponse_InfoCapacity_reflection_;
+  metadata.descriptor = CmdResponse_descriptor_;
+  metadata.reflection = CmdResponse_reflection_;
   return metadata;
 }
 
 
-// -------------------------------------------------------------------
+// ===================================================================
 
 #ifndef _MSC_VER
-const int CmdResponse_InfoRepl::kTableNameFieldNumber;
-const int CmdResponse_InfoRepl::kPartitionCntFieldNumber;
-const int CmdResponse_InfoRepl::kPartitionStateFieldNumber;
+const int BinlogSkip::kTableNameFieldNumber;
+const int BinlogSkip::kPartitionIdFieldNumber;
+const int BinlogSkip::kGapFieldNumber;
 #endif  // !_MSC_VER
 
-CmdResponse_InfoRepl::CmdResponse_InfoRepl()
+BinlogSkip::BinlogSkip()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdResponse_InfoRepl::InitAsDefaultInstance() {
+void BinlogSkip::InitAsDefaultInstance() {
 }
 
-CmdResponse_InfoRepl::CmdResponse_InfoRepl(const CmdResponse_InfoRepl& from)
+BinlogSkip::BinlogSkip(const BinlogSkip& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoRepl::SharedCtor() {
+void BinlogSkip::SharedCtor() {
   _cached_size_ = 0;
   table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  partition_cnt_ = GOOGLE_LONGLONG(0);
+  partition_id_ = 0;
+  gap_ = GOOGLE_LONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdResponse_InfoRepl::~CmdResponse_InfoRepl() {
+BinlogSkip::~BinlogSkip() {
   SharedDtor();
 }
 
-void CmdResponse_InfoRepl::SharedDtor() {
+void BinlogSkip::SharedDtor() {
   if (table_name_ != &::google::protobuf::internal::kEmptyString) {
     delete table_name_;
   }
@@ -6392,42 +12052,42 @@ void CmdResponse_InfoRepl::SharedDtor() {
   }
 }
 
-void CmdResponse_InfoRepl::SetCachedSize(int size) const {
+void BinlogSkip::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdResponse_InfoRepl::descriptor() {
+const ::google::protobuf::Descriptor* BinlogSkip::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdResponse_InfoRepl_descriptor_;
+  return BinlogSkip_descriptor_;
 }
 
-const CmdResponse_InfoRepl& CmdResponse_InfoRepl::default_instance() {
+const BinlogSkip& BinlogSkip::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdResponse_InfoRepl* CmdResponse_InfoRepl::default_instance_ = NULL;
+BinlogSkip* BinlogSkip::default_instance_ = NULL;
 
-CmdResponse_InfoRepl* CmdResponse_InfoRepl::New() const {
-  return new CmdResponse_InfoRepl;
+BinlogSkip* BinlogSkip::New() const {
+  return new BinlogSkip;
 }
 
-void CmdResponse_InfoRepl::Clear() {
+void BinlogSkip::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (has_table_name()) {
       if (table_name_ != &::google::protobuf::internal::kEmptyString) {
         table_name_->clear();
       }
     }
-    partition_cnt_ = GOOGLE_LONGLONG(0);
+    partition_id_ = 0;
+    gap_ = GOOGLE_LONGLONG(0);
   }
-  partition_state_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdResponse_InfoRepl::MergePartialFromCodedStream(
+bool BinlogSkip::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
@@ -6445,37 +12105,38 @@ bool CmdResponse_InfoRepl::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_partition_cnt;
+        if (input->ExpectTag(16)) goto parse_partition_id;
         break;
       }
 
-      // required int64 partition_cnt = 2;
+      // required int32 partition_id = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_partition_cnt:
+         parse_partition_id:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &partition_cnt_)));
-          set_has_partition_cnt();
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &partition_id_)));
+          set_has_partition_id();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(26)) goto parse_partition_state;
+        if (input->ExpectTag(24)) goto parse_gap;
         break;
       }
 
-      // repeated .client.PartitionState partition_state = 3;
+      // required int64 gap = 3;
       case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_partition_state:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_partition_state()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_gap:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &gap_)));
+          set_has_gap();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(26)) goto parse_partition_state;
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -6496,7 +12157,7 @@ bool CmdResponse_InfoRepl::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void CmdResponse_InfoRepl::SerializeWithCachedSizes(
+void BinlogSkip::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
   // required string table_name = 1;
   if (has_table_name()) {
@@ -6507,15 +12168,14 @@ void CmdResponse_InfoRepl::SerializeWithCachedSizes(
       1, this->table_name(), output);
   }
 
-  // required int64 partition_cnt = 2;
-  if (has_partition_cnt()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->partition_cnt(), output);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition_id(), output);
   }
 
-  // repeated .client.PartitionState partition_state = 3;
-  for (int i = 0; i < this->partition_state_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->partition_state(i), output);
+  // required int64 gap = 3;
+  if (has_gap()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->gap(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -6524,7 +12184,7 @@ void CmdResponse_InfoRepl::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdResponse_InfoRepl::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* BinlogSkip::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
   // required string table_name = 1;
   if (has_table_name()) {
@@ -6536,16 +12196,14 @@ void CmdResponse_InfoRepl::SerializeWithCachedSizes(
         1, this->table_name(), target);
   }
 
-  // required int64 partition_cnt = 2;
-  if (has_partition_cnt()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->partition_cnt(), target);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition_id(), target);
   }
 
-  // repeated .client.PartitionState partition_state = 3;
-  for (int i = 0; i < this->partition_state_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->partition_state(i), target);
+  // required int64 gap = 3;
+  if (has_gap()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->gap(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -6555,7 +12213,7 @@ void CmdResponse_InfoRepl::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdResponse_InfoRepl::ByteSize() const {
+int BinlogSkip::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
@@ -6566,22 +12224,21 @@ int CmdResponse_InfoRepl::ByteSize() const {
           this->table_name());
     }
 
-    // required int64 partition_cnt = 2;
-    if (has_partition_cnt()) {
+    // required int32 partition_id = 2;
+    if (has_partition_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->partition_id());
+    }
+
+    // required int64 gap = 3;
+    if (has_gap()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->partition_cnt());
+          this->gap());
     }
 
   }
-  // repeated .client.PartitionState partition_state = 3;
-  total_size += 1 * this->partition_state_size();
-  for (int i = 0; i < this->partition_state_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->partition_state(i));
-  }
-
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -6593,10 +12250,10 @@ int CmdResponse_InfoRepl::ByteSize() const {
   return total_size;
 }
 
-void CmdResponse_InfoRepl::MergeFrom(const ::google::protobuf::Message& from) {
+void BinlogSkip::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_InfoRepl* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoRepl*>(
+  const BinlogSkip* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const BinlogSkip*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6605,171 +12262,184 @@ void CmdResponse_InfoRepl::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void CmdResponse_InfoRepl::MergeFrom(const CmdResponse_InfoRepl& from) {
+void BinlogSkip::MergeFrom(const BinlogSkip& from) {
   GOOGLE_CHECK_NE(&from, this);
-  partition_state_.MergeFrom(from.partition_state_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from.has_table_name()) {
       set_table_name(from.table_name());
     }
-    if (from.has_partition_cnt()) {
-      set_partition_cnt(from.partition_cnt());
+    if (from.has_partition_id()) {
+      set_partition_id(from.partition_id());
+    }
+    if (from.has_gap()) {
+      set_gap(from.gap());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdResponse_InfoRepl::CopyFrom(const ::google::protobuf::Message& from) {
+void BinlogSkip::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoRepl::CopyFrom(const CmdResponse_InfoRepl& from) {
+void BinlogSkip::CopyFrom(const BinlogSkip& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_InfoRepl::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool BinlogSkip::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
 
-  for (int i = 0; i < partition_state_size(); i++) {
-    if (!this->partition_state(i).IsInitialized()) return false;
-  }
   return true;
 }
 
-void CmdResponse_InfoRepl::Swap(CmdResponse_InfoRepl* other) {
+void BinlogSkip::Swap(BinlogSkip* other) {
   if (other != this) {
     std::swap(table_name_, other->table_name_);
-    std::swap(partition_cnt_, other->partition_cnt_);
-    partition_state_.Swap(&other->partition_state_);
+    std::swap(partition_id_, other->partition_id_);
+    std::swap(gap_, other->gap_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdResponse_InfoRepl::GetMetadata() const {
+::google::protobuf::Metadata BinlogSkip::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_InfoRepl_descriptor_;
-  metadata.reflection = CmdResponse_InfoRepl_reflection_;
+  metadata.descriptor = BinlogSkip_descriptor_;
+  metadata.reflection = BinlogSkip_reflection_;
   return metadata;
 }
 
 
-// -------------------------------------------------------------------
+// ===================================================================
 
 #ifndef _MSC_VER
-const int CmdResponse_Mget::kKeyFieldNumber;
-const int CmdResponse_Mget::kValueFieldNumber;
+const int SyncLease::kTableNameFieldNumber;
+const int SyncLease::kPartitionIdFieldNumber;
+const int SyncLease::kLeaseFieldNumber;
 #endif  // !_MSC_VER
 
-CmdResponse_Mget::CmdResponse_Mget()
+SyncLease::SyncLease()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdResponse_Mget::InitAsDefaultInstance() {
+void SyncLease::InitAsDefaultInstance() {
 }
 
-CmdResponse_Mget::CmdResponse_Mget(const CmdResponse_Mget& from)
+SyncLease::SyncLease(const SyncLease& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdResponse_Mget::SharedCtor() {
+void SyncLease::SharedCtor() {
   _cached_size_ = 0;
-  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  partition_id_ = 0;
+  lease_ = GOOGLE_LONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdResponse_Mget::~CmdResponse_Mget() {
+SyncLease::~SyncLease() {
   SharedDtor();
 }
 
-void CmdResponse_Mget::SharedDtor() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+void SyncLease::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
   }
   if (this != default_instance_) {
   }
 }
 
-void CmdResponse_Mget::SetCachedSize(int size) const {
+void SyncLease::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdResponse_Mget::descriptor() {
+const ::google::protobuf::Descriptor* SyncLease::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdResponse_Mget_descriptor_;
+  return SyncLease_descriptor_;
 }
 
-const CmdResponse_Mget& CmdResponse_Mget::default_instance() {
+const SyncLease& SyncLease::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdResponse_Mget* CmdResponse_Mget::default_instance_ = NULL;
+SyncLease* SyncLease::default_instance_ = NULL;
 
-CmdResponse_Mget* CmdResponse_Mget::New() const {
-  return new CmdResponse_Mget;
+SyncLease* SyncLease::New() const {
+  return new SyncLease;
 }
 
-void CmdResponse_Mget::Clear() {
+void SyncLease::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_key()) {
-      if (key_ != &::google::protobuf::internal::kEmptyString) {
-        key_->clear();
-      }
-    }
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
       }
     }
+    partition_id_ = 0;
+    lease_ = GOOGLE_LONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdResponse_Mget::MergePartialFromCodedStream(
+bool SyncLease::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string key = 1;
+      // required string table_name = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_key()));
+                input, this->mutable_table_name()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->key().data(), this->key().length(),
+            this->table_name().data(), this->table_name().length(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_value;
+        if (input->ExpectTag(16)) goto parse_partition_id;
         break;
       }
 
-      // required bytes value = 2;
+      // required int32 partition_id = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_value()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_partition_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &partition_id_)));
+          set_has_partition_id();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_lease;
+        break;
+      }
+
+      // required int64 lease = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_lease:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &lease_)));
+          set_has_lease();
         } else {
           goto handle_uninterpreted;
         }
@@ -6793,21 +12463,25 @@ bool CmdResponse_Mget::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void CmdResponse_Mget::SerializeWithCachedSizes(
+void SyncLease::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string key = 1;
-  if (has_key()) {
+  // required string table_name = 1;
+  if (has_table_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
+      this->table_name().data(), this->table_name().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->key(), output);
+      1, this->table_name(), output);
   }
 
-  // required bytes value = 2;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      2, this->value(), output);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition_id(), output);
+  }
+
+  // required int64 lease = 3;
+  if (has_lease()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->lease(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -6816,23 +12490,26 @@ void CmdResponse_Mget::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdResponse_Mget::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SyncLease::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required string key = 1;
-  if (has_key()) {
+  // required string table_name = 1;
+  if (has_table_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
+      this->table_name().data(), this->table_name().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->key(), target);
+        1, this->table_name(), target);
   }
 
-  // required bytes value = 2;
-  if (has_value()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->value(), target);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition_id(), target);
+  }
+
+  // required int64 lease = 3;
+  if (has_lease()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->lease(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -6842,22 +12519,29 @@ void CmdResponse_Mget::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdResponse_Mget::ByteSize() const {
+int SyncLease::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string key = 1;
-    if (has_key()) {
+    // required string table_name = 1;
+    if (has_table_name()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->key());
+          this->table_name());
     }
 
-    // required bytes value = 2;
-    if (has_value()) {
+    // required int32 partition_id = 2;
+    if (has_partition_id()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->value());
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->partition_id());
+    }
+
+    // required int64 lease = 3;
+    if (has_lease()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->lease());
     }
 
   }
@@ -6872,10 +12556,10 @@ int CmdResponse_Mget::ByteSize() const {
   return total_size;
 }
 
-void CmdResponse_Mget::MergeFrom(const ::google::protobuf::Message& from) {
+void SyncLease::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_Mget* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Mget*>(
+  const SyncLease* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const SyncLease*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6884,195 +12568,186 @@ void CmdResponse_Mget::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void CmdResponse_Mget::MergeFrom(const CmdResponse_Mget& from) {
+void SyncLease::MergeFrom(const SyncLease& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_key()) {
-      set_key(from.key());
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
     }
-    if (from.has_value()) {
-      set_value(from.value());
+    if (from.has_partition_id()) {
+      set_partition_id(from.partition_id());
+    }
+    if (from.has_lease()) {
+      set_lease(from.lease());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdResponse_Mget::CopyFrom(const ::google::protobuf::Message& from) {
+void SyncLease::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_Mget::CopyFrom(const CmdResponse_Mget& from) {
+void SyncLease::CopyFrom(const SyncLease& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_Mget::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool SyncLease::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
 
   return true;
 }
 
-void CmdResponse_Mget::Swap(CmdResponse_Mget* other) {
+void SyncLease::Swap(SyncLease* other) {
   if (other != this) {
-    std::swap(key_, other->key_);
-    std::swap(value_, other->value_);
+    std::swap(table_name_, other->table_name_);
+    std::swap(partition_id_, other->partition_id_);
+    std::swap(lease_, other->lease_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdResponse_Mget::GetMetadata() const {
+::google::protobuf::Metadata SyncLease::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_Mget_descriptor_;
-  metadata.reflection = CmdResponse_Mget_reflection_;
+  metadata.descriptor = SyncLease_descriptor_;
+  metadata.reflection = SyncLease_reflection_;
   return metadata;
 }
 
 
-// -------------------------------------------------------------------
+// ===================================================================
 
 #ifndef _MSC_VER
-const int CmdResponse_InfoServer::kEpochFieldNumber;
-const int CmdResponse_InfoServer::kTableNamesFieldNumber;
-const int CmdResponse_InfoServer::kCurMetaFieldNumber;
-const int CmdResponse_InfoServer::kMetaRenewingFieldNumber;
+const int SyncAck::kTableNameFieldNumber;
+const int SyncAck::kPartitionIdFieldNumber;
+const int SyncAck::kSyncOffsetFieldNumber;
 #endif  // !_MSC_VER
 
-CmdResponse_InfoServer::CmdResponse_InfoServer()
+SyncAck::SyncAck()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdResponse_InfoServer::InitAsDefaultInstance() {
-  cur_meta_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
+void SyncAck::InitAsDefaultInstance() {
+  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
 }
 
-CmdResponse_InfoServer::CmdResponse_InfoServer(const CmdResponse_InfoServer& from)
+SyncAck::SyncAck(const SyncAck& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoServer::SharedCtor() {
+void SyncAck::SharedCtor() {
   _cached_size_ = 0;
-  epoch_ = GOOGLE_LONGLONG(0);
-  cur_meta_ = NULL;
-  meta_renewing_ = false;
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  partition_id_ = 0;
+  sync_offset_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdResponse_InfoServer::~CmdResponse_InfoServer() {
+SyncAck::~SyncAck() {
   SharedDtor();
 }
 
-void CmdResponse_InfoServer::SharedDtor() {
+void SyncAck::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
   if (this != default_instance_) {
-    delete cur_meta_;
+    delete sync_offset_;
   }
 }
 
-void CmdResponse_InfoServer::SetCachedSize(int size) const {
+void SyncAck::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdResponse_InfoServer::descriptor() {
+const ::google::protobuf::Descriptor* SyncAck::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdResponse_InfoServer_descriptor_;
+  return SyncAck_descriptor_;
 }
 
-const CmdResponse_InfoServer& CmdResponse_InfoServer::default_instance() {
+const SyncAck& SyncAck::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdResponse_InfoServer* CmdResponse_InfoServer::default_instance_ = NULL;
+SyncAck* SyncAck::default_instance_ = NULL;
 
-CmdResponse_InfoServer* CmdResponse_InfoServer::New() const {
-  return new CmdResponse_InfoServer;
+SyncAck* SyncAck::New() const {
+  return new SyncAck;
 }
 
-void CmdResponse_InfoServer::Clear() {
+void SyncAck::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    epoch_ = GOOGLE_LONGLONG(0);
-    if (has_cur_meta()) {
-      if (cur_meta_ != NULL) cur_meta_->::client::Node::Clear();
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
+      }
+    }
+    partition_id_ = 0;
+    if (has_sync_offset()) {
+      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
     }
-    meta_renewing_ = false;
   }
-  table_names_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdResponse_InfoServer::MergePartialFromCodedStream(
+bool SyncAck::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required int64 epoch = 1;
+      // required string table_name = 1;
       case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &epoch_)));
-          set_has_epoch();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_table_names;
-        break;
-      }
-
-      // repeated string table_names = 2;
-      case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_table_names:
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_table_names()));
+                input, this->mutable_table_name()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_names(this->table_names_size() - 1).data(),
-            this->table_names(this->table_names_size() - 1).length(),
+            this->table_name().data(), this->table_name().length(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_table_names;
-        if (input->ExpectTag(26)) goto parse_cur_meta;
+        if (input->ExpectTag(16)) goto parse_partition_id;
         break;
       }
 
-      // required .client.Node cur_meta = 3;
-      case 3: {
+      // required int32 partition_id = 2;
+      case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_cur_meta:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_cur_meta()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_partition_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &partition_id_)));
+          set_has_partition_id();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(32)) goto parse_meta_renewing;
+        if (input->ExpectTag(26)) goto parse_sync_offset;
         break;
       }
 
-      // required bool meta_renewing = 4;
-      case 4: {
+      // required .client.SyncOffset sync_offset = 3;
+      case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_meta_renewing:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &meta_renewing_)));
-          set_has_meta_renewing();
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_sync_offset:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_sync_offset()));
         } else {
           goto handle_uninterpreted;
         }
@@ -7096,31 +12771,26 @@ bool CmdResponse_InfoServer::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void CmdResponse_InfoServer::SerializeWithCachedSizes(
+void SyncAck::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required int64 epoch = 1;
-  if (has_epoch()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->epoch(), output);
-  }
-
-  // repeated string table_names = 2;
-  for (int i = 0; i < this->table_names_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->table_names(i).data(), this->table_names(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
     ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->table_names(i), output);
+      1, this->table_name(), output);
   }
 
-  // required .client.Node cur_meta = 3;
-  if (has_cur_meta()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->cur_meta(), output);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition_id(), output);
   }
 
-  // required bool meta_renewing = 4;
-  if (has_meta_renewing()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->meta_renewing(), output);
+  // required .client.SyncOffset sync_offset = 3;
+  if (has_sync_offset()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->sync_offset(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -7129,32 +12799,28 @@ void CmdResponse_InfoServer::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdResponse_InfoServer::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SyncAck::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required int64 epoch = 1;
-  if (has_epoch()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->epoch(), target);
-  }
-
-  // repeated string table_names = 2;
-  for (int i = 0; i < this->table_names_size(); i++) {
+  // required string table_name = 1;
+  if (has_table_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_names(i).data(), this->table_names(i).length(),
+      this->table_name().data(), this->table_name().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(2, this->table_names(i), target);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
   }
 
-  // required .client.Node cur_meta = 3;
-  if (has_cur_meta()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->cur_meta(), target);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition_id(), target);
   }
 
-  // required bool meta_renewing = 4;
-  if (has_meta_renewing()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->meta_renewing(), target);
+  // required .client.SyncOffset sync_offset = 3;
+  if (has_sync_offset()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->sync_offset(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -7164,37 +12830,32 @@ void CmdResponse_InfoServer::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdResponse_InfoServer::ByteSize() const {
+int SyncAck::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int64 epoch = 1;
-    if (has_epoch()) {
+    // required string table_name = 1;
+    if (has_table_name()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->epoch());
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
     }
 
-    // required .client.Node cur_meta = 3;
-    if (has_cur_meta()) {
+    // required int32 partition_id = 2;
+    if (has_partition_id()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->cur_meta());
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->partition_id());
     }
 
-    // required bool meta_renewing = 4;
-    if (has_meta_renewing()) {
-      total_size += 1 + 1;
+    // required .client.SyncOffset sync_offset = 3;
+    if (has_sync_offset()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->sync_offset());
     }
 
   }
-  // repeated string table_names = 2;
-  total_size += 1 * this->table_names_size();
-  for (int i = 0; i < this->table_names_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->table_names(i));
-  }
-
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -7206,10 +12867,10 @@ int CmdResponse_InfoServer::ByteSize() const {
   return total_size;
 }
 
-void CmdResponse_InfoServer::MergeFrom(const ::google::protobuf::Message& from) {
+void SyncAck::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_InfoServer* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_InfoServer*>(
+  const SyncAck* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const SyncAck*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -7218,187 +12879,186 @@ void CmdResponse_InfoServer::MergeFrom(const ::google::protobuf::Message& from)
   }
 }
 
-void CmdResponse_InfoServer::MergeFrom(const CmdResponse_InfoServer& from) {
+void SyncAck::MergeFrom(const SyncAck& from) {
   GOOGLE_CHECK_NE(&from, this);
-  table_names_.MergeFrom(from.table_names_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_epoch()) {
-      set_epoch(from.epoch());
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
     }
-    if (from.has_cur_meta()) {
-      mutable_cur_meta()->::client::Node::MergeFrom(from.cur_meta());
+    if (from.has_partition_id()) {
+      set_partition_id(from.partition_id());
     }
-    if (from.has_meta_renewing()) {
-      set_meta_renewing(from.meta_renewing());
+    if (from.has_sync_offset()) {
+      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdResponse_InfoServer::CopyFrom(const ::google::protobuf::Message& from) {
+void SyncAck::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse_InfoServer::CopyFrom(const CmdResponse_InfoServer& from) {
+void SyncAck::CopyFrom(const SyncAck& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse_InfoServer::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000d) != 0x0000000d) return false;
+bool SyncAck::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
 
-  if (has_cur_meta()) {
-    if (!this->cur_meta().IsInitialized()) return false;
+  if (has_sync_offset()) {
+    if (!this->sync_offset().IsInitialized()) return false;
   }
   return true;
 }
-
-void CmdResponse_InfoServer::Swap(CmdResponse_InfoServer* other) {
-  if (other != this) {
-    std::swap(epoch_, other->epoch_);
-    table_names_.Swap(&other->table_names_);
-    std::swap(cur_meta_, other->cur_meta_);
-    std::swap(meta_renewing_, other->meta_renewing_);
+
+void SyncAck::Swap(SyncAck* other) {
+  if (other != this) {
+    std::swap(table_name_, other->table_name_);
+    std::swap(partition_id_, other->partition_id_);
+    std::swap(sync_offset_, other->sync_offset_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdResponse_InfoServer::GetMetadata() const {
+::google::protobuf::Metadata SyncAck::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_InfoServer_descriptor_;
-  metadata.reflection = CmdResponse_InfoServer_reflection_;
+  metadata.descriptor = SyncAck_descriptor_;
+  metadata.reflection = SyncAck_reflection_;
   return metadata;
 }
 
 
-// -------------------------------------------------------------------
+// ===================================================================
 
 #ifndef _MSC_VER
-const int CmdResponse::kTypeFieldNumber;
-const int CmdResponse::kCodeFieldNumber;
-const int CmdResponse::kMsgFieldNumber;
-const int CmdResponse::kSyncFieldNumber;
-const int CmdResponse::kGetFieldNumber;
-const int CmdResponse::kRedirectFieldNumber;
-const int CmdResponse::kInfoStatsFieldNumber;
-const int CmdResponse::kInfoCapacityFieldNumber;
-const int CmdResponse::kInfoReplFieldNumber;
-const int CmdResponse::kMgetFieldNumber;
-const int CmdResponse::kInfoServerFieldNumber;
+const int SyncRequest::kSyncTypeFieldNumber;
+const int SyncRequest::kEpochFieldNumber;
+const int SyncRequest::kFromFieldNumber;
+const int SyncRequest::kSyncOffsetFieldNumber;
+const int SyncRequest::kRequestFieldNumber;
+const int SyncRequest::kBinlogSkipFieldNumber;
+const int SyncRequest::kSyncLeaseFieldNumber;
+const int SyncRequest::kBinlogBatchFieldNumber;
+const int SyncRequest::kSyncAckFieldNumber;
 #endif  // !_MSC_VER
 
-CmdResponse::CmdResponse()
+SyncRequest::SyncRequest()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void CmdResponse::InitAsDefaultInstance() {
-  sync_ = const_cast< ::client::CmdResponse_Sync*>(&::client::CmdResponse_Sync::default_instance());
-  get_ = const_cast< ::client::CmdResponse_Get*>(&::client::CmdResponse_Get::default_instance());
-  redirect_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
-  info_server_ = const_cast< ::client::CmdResponse_InfoServer*>(&::client::CmdResponse_InfoServer::default_instance());
+void SyncRequest::InitAsDefaultInstance() {
+  from_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
+  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
+  request_ = const_cast< ::client::CmdRequest*>(&::client::CmdRequest::default_instance());
+  binlog_skip_ = const_cast< ::client::BinlogSkip*>(&::client::BinlogSkip::default_instance());
+  sync_lease_ = const_cast< ::client::SyncLease*>(&::client::SyncLease::default_instance());
+  binlog_batch_ = const_cast< ::client::BinlogBatch*>(&::client::BinlogBatch::default_instance());
+  sync_ack_ = const_cast< ::client::SyncAck*>(&::client::SyncAck::default_instance());
 }
 
-CmdResponse::CmdResponse(const CmdResponse& from)
+SyncRequest::SyncRequest(const SyncRequest& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void CmdResponse::SharedCtor() {
+void SyncRequest::SharedCtor() {
   _cached_size_ = 0;
-  type_ = 0;
-  code_ = 0;
-  msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  sync_ = NULL;
-  get_ = NULL;
-  redirect_ = NULL;
-  info_server_ = NULL;
+  sync_type_ = 0;
+  epoch_ = GOOGLE_LONGLONG(0);
+  from_ = NULL;
+  sync_offset_ = NULL;
+  request_ = NULL;
+  binlog_skip_ = NULL;
+  sync_lease_ = NULL;
+  binlog_batch_ = NULL;
+  sync_ack_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-CmdResponse::~CmdResponse() {
+SyncRequest::~SyncRequest() {
   SharedDtor();
 }
 
-void CmdResponse::SharedDtor() {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    delete msg_;
-  }
+void SyncRequest::SharedDtor() {
   if (this != default_instance_) {
-    delete sync_;
-    delete get_;
-    delete redirect_;
-    delete info_server_;
+    delete from_;
+    delete sync_offset_;
+    delete request_;
+    delete binlog_skip_;
+    delete sync_lease_;
+    delete binlog_batch_;
+    delete sync_ack_;
   }
 }
 
-void CmdResponse::SetCachedSize(int size) const {
+void SyncRequest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CmdResponse::descriptor() {
+const ::google::protobuf::Descriptor* SyncRequest::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return CmdResponse_descriptor_;
+  return SyncRequest_descriptor_;
 }
 
-const CmdResponse& CmdResponse::default_instance() {
+const SyncRequest& SyncRequest::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-CmdResponse* CmdResponse::default_instance_ = NULL;
+SyncRequest* SyncRequest::default_instance_ = NULL;
 
-CmdResponse* CmdResponse::New() const {
-  return new CmdResponse;
+SyncRequest* SyncRequest::New() const {
+  return new SyncRequest;
 }
 
-void CmdResponse::Clear() {
+void SyncRequest::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    code_ = 0;
-    if (has_msg()) {
-      if (msg_ != &::google::protobuf::internal::kEmptyString) {
-        msg_->clear();
-      }
+    sync_type_ = 0;
+    epoch_ = GOOGLE_LONGLONG(0);
+    if (has_from()) {
+      if (from_ != NULL) from_->::client::Node::Clear();
     }
-    if (has_sync()) {
-      if (sync_ != NULL) sync_->::client::CmdResponse_Sync::Clear();
+    if (has_sync_offset()) {
+      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
     }
-    if (has_get()) {
-      if (get_ != NULL) get_->::client::CmdResponse_Get::Clear();
+    if (has_request()) {
+      if (request_ != NULL) request_->::client::CmdRequest::Clear();
     }
-    if (has_redirect()) {
-      if (redirect_ != NULL) redirect_->::client::Node::Clear();
+    if (has_binlog_skip()) {
+      if (binlog_skip_ != NULL) binlog_skip_->::client::BinlogSkip::Clear();
     }
-  }
-  if (_has_bits_[10 / 32] & (0xffu << (10 % 32))) {
-    if (has_info_server()) {
-      if (info_server_ != NULL) info_server_->::client::CmdResponse_InfoServer::Clear();
+    if (has_sync_lease()) {
+      if (sync_lease_ != NULL) sync_lease_->::client::SyncLease::Clear();
+    }
+    if (has_binlog_batch()) {
+      if (binlog_batch_ != NULL) binlog_batch_->::client::BinlogBatch::Clear();
+    }
+    if (has_sync_ack()) {
+      if (sync_ack_ != NULL) sync_ack_->::client::SyncAck::Clear();
     }
   }
-  info_stats_.Clear();
-  info_capacity_.Clear();
-  info_repl_.Clear();
-  mget_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool CmdResponse::MergePartialFromCodedStream(
+bool SyncRequest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .client.Type type = 1;
+      // required .client.SyncType sync_type = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
@@ -7406,165 +13066,125 @@ bool CmdResponse::MergePartialFromCodedStream(
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
                  input, &value)));
-          if (::client::Type_IsValid(value)) {
-            set_type(static_cast< ::client::Type >(value));
+          if (::client::SyncType_IsValid(value)) {
+            set_sync_type(static_cast< ::client::SyncType >(value));
           } else {
             mutable_unknown_fields()->AddVarint(1, value);
           }
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_code;
+        if (input->ExpectTag(16)) goto parse_epoch;
         break;
       }
 
-      // required .client.StatusCode code = 2;
+      // required int64 epoch = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_code:
-          int value;
+         parse_epoch:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::client::StatusCode_IsValid(value)) {
-            set_code(static_cast< ::client::StatusCode >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(2, value);
-          }
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &epoch_)));
+          set_has_epoch();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(26)) goto parse_msg;
+        if (input->ExpectTag(26)) goto parse_from;
         break;
       }
 
-      // optional string msg = 3;
+      // required .client.Node from = 3;
       case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_msg:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_msg()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->msg().data(), this->msg().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
+         parse_from:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_from()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(34)) goto parse_sync;
+        if (input->ExpectTag(34)) goto parse_sync_offset;
         break;
       }
 
-      // optional .client.CmdResponse.Sync sync = 4;
+      // optional .client.SyncOffset sync_offset = 4;
       case 4: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync:
+         parse_sync_offset:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync()));
+               input, mutable_sync_offset()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(42)) goto parse_get;
+        if (input->ExpectTag(42)) goto parse_request;
         break;
       }
 
-      // optional .client.CmdResponse.Get get = 5;
+      // optional .client.CmdRequest request = 5;
       case 5: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_get:
+         parse_request:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_get()));
+               input, mutable_request()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(50)) goto parse_redirect;
+        if (input->ExpectTag(50)) goto parse_binlog_skip;
         break;
       }
 
-      // optional .client.Node redirect = 6;
+      // optional .client.BinlogSkip binlog_skip = 6;
       case 6: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_redirect:
+         parse_binlog_skip:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_redirect()));
+               input, mutable_binlog_skip()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(58)) goto parse_info_stats;
+        if (input->ExpectTag(58)) goto parse_sync_lease;
         break;
       }
 
-      // repeated .client.CmdResponse.InfoStats info_stats = 7;
+      // optional .client.SyncLease sync_lease = 7;
       case 7: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info_stats:
+         parse_sync_lease:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_info_stats()));
+               input, mutable_sync_lease()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(58)) goto parse_info_stats;
-        if (input->ExpectTag(66)) goto parse_info_capacity;
+        if (input->ExpectTag(66)) goto parse_binlog_batch;
         break;
       }
 
-      // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
+      // optional .client.BinlogBatch binlog_batch = 8;
       case 8: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info_capacity:
+         parse_binlog_batch:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_info_capacity()));
+               input, mutable_binlog_batch()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(66)) goto parse_info_capacity;
-        if (input->ExpectTag(74)) goto parse_info_repl;
+        if (input->ExpectTag(74)) goto parse_sync_ack;
         break;
       }
 
-      // repeated .client.CmdResponse.InfoRepl info_repl = 9;
+      // optional .client.SyncAck sync_ack = 9;
       case 9: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info_repl:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_info_repl()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(74)) goto parse_info_repl;
-        if (input->ExpectTag(82)) goto parse_mget;
-        break;
-      }
-
-      // repeated .client.CmdResponse.Mget mget = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_mget:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_mget()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(82)) goto parse_mget;
-        if (input->ExpectTag(90)) goto parse_info_server;
-        break;
-      }
-
-      // optional .client.CmdResponse.InfoServer info_server = 11;
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_info_server:
+         parse_sync_ack:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_info_server()));
+               input, mutable_sync_ack()));
         } else {
           goto handle_uninterpreted;
         }
@@ -7588,75 +13208,59 @@ bool CmdResponse::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void CmdResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .client.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
-  }
-
-  // required .client.StatusCode code = 2;
-  if (has_code()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->code(), output);
-  }
-
-  // optional string msg = 3;
-  if (has_msg()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->msg(), output);
+void SyncRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required .client.SyncType sync_type = 1;
+  if (has_sync_type()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->sync_type(), output);
   }
 
-  // optional .client.CmdResponse.Sync sync = 4;
-  if (has_sync()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->sync(), output);
+  // required int64 epoch = 2;
+  if (has_epoch()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->epoch(), output);
   }
 
-  // optional .client.CmdResponse.Get get = 5;
-  if (has_get()) {
+  // required .client.Node from = 3;
+  if (has_from()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->get(), output);
+      3, this->from(), output);
   }
 
-  // optional .client.Node redirect = 6;
-  if (has_redirect()) {
+  // optional .client.SyncOffset sync_offset = 4;
+  if (has_sync_offset()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->redirect(), output);
+      4, this->sync_offset(), output);
   }
 
-  // repeated .client.CmdResponse.InfoStats info_stats = 7;
-  for (int i = 0; i < this->info_stats_size(); i++) {
+  // optional .client.CmdRequest request = 5;
+  if (has_request()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->info_stats(i), output);
+      5, this->request(), output);
   }
 
-  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-  for (int i = 0; i < this->info_capacity_size(); i++) {
+  // optional .client.BinlogSkip binlog_skip = 6;
+  if (has_binlog_skip()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->info_capacity(i), output);
+      6, this->binlog_skip(), output);
   }
 
-  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-  for (int i = 0; i < this->info_repl_size(); i++) {
+  // optional .client.SyncLease sync_lease = 7;
+  if (has_sync_lease()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      9, this->info_repl(i), output);
+      7, this->sync_lease(), output);
   }
 
-  // repeated .client.CmdResponse.Mget mget = 10;
-  for (int i = 0; i < this->mget_size(); i++) {
+  // optional .client.BinlogBatch binlog_batch = 8;
+  if (has_binlog_batch()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      10, this->mget(i), output);
+      8, this->binlog_batch(), output);
   }
 
-  // optional .client.CmdResponse.InfoServer info_server = 11;
-  if (has_info_server()) {
+  // optional .client.SyncAck sync_ack = 9;
+  if (has_sync_ack()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      11, this->info_server(), output);
+      9, this->sync_ack(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -7665,84 +13269,66 @@ void CmdResponse::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* CmdResponse::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SyncRequest::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required .client.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
-
-  // required .client.StatusCode code = 2;
-  if (has_code()) {
+  // required .client.SyncType sync_type = 1;
+  if (has_sync_type()) {
     target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->code(), target);
-  }
-
-  // optional string msg = 3;
-  if (has_msg()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->msg().data(), this->msg().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->msg(), target);
+      1, this->sync_type(), target);
   }
 
-  // optional .client.CmdResponse.Sync sync = 4;
-  if (has_sync()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->sync(), target);
+  // required int64 epoch = 2;
+  if (has_epoch()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->epoch(), target);
   }
 
-  // optional .client.CmdResponse.Get get = 5;
-  if (has_get()) {
+  // required .client.Node from = 3;
+  if (has_from()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        5, this->get(), target);
+        3, this->from(), target);
   }
 
-  // optional .client.Node redirect = 6;
-  if (has_redirect()) {
+  // optional .client.SyncOffset sync_offset = 4;
+  if (has_sync_offset()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        6, this->redirect(), target);
+        4, this->sync_offset(), target);
   }
 
-  // repeated .client.CmdResponse.InfoStats info_stats = 7;
-  for (int i = 0; i < this->info_stats_size(); i++) {
+  // optional .client.CmdRequest request = 5;
+  if (has_request()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        7, this->info_stats(i), target);
+        5, this->request(), target);
   }
 
-  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-  for (int i = 0; i < this->info_capacity_size(); i++) {
+  // optional .client.BinlogSkip binlog_skip = 6;
+  if (has_binlog_skip()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        8, this->info_capacity(i), target);
+        6, this->binlog_skip(), target);
   }
 
-  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-  for (int i = 0; i < this->info_repl_size(); i++) {
+  // optional .client.SyncLease sync_lease = 7;
+  if (has_sync_lease()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        9, this->info_repl(i), target);
+        7, this->sync_lease(), target);
   }
 
-  // repeated .client.CmdResponse.Mget mget = 10;
-  for (int i = 0; i < this->mget_size(); i++) {
+  // optional .client.BinlogBatch binlog_batch = 8;
+  if (has_binlog_batch()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        10, this->mget(i), target);
+        8, this->binlog_batch(), target);
   }
 
-  // optional .client.CmdResponse.InfoServer info_server = 11;
-  if (has_info_server()) {
+  // optional .client.SyncAck sync_ack = 9;
+  if (has_sync_ack()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        11, this->info_server(), target);
+        9, this->sync_ack(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -7752,92 +13338,73 @@ void CmdResponse::SerializeWithCachedSizes(
   return target;
 }
 
-int CmdResponse::ByteSize() const {
+int SyncRequest::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .client.Type type = 1;
-    if (has_type()) {
+    // required .client.SyncType sync_type = 1;
+    if (has_sync_type()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->sync_type());
     }
 
-    // required .client.StatusCode code = 2;
-    if (has_code()) {
+    // required int64 epoch = 2;
+    if (has_epoch()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->code());
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->epoch());
     }
 
-    // optional string msg = 3;
-    if (has_msg()) {
+    // required .client.Node from = 3;
+    if (has_from()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->msg());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->from());
     }
 
-    // optional .client.CmdResponse.Sync sync = 4;
-    if (has_sync()) {
+    // optional .client.SyncOffset sync_offset = 4;
+    if (has_sync_offset()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync());
+          this->sync_offset());
     }
 
-    // optional .client.CmdResponse.Get get = 5;
-    if (has_get()) {
+    // optional .client.CmdRequest request = 5;
+    if (has_request()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->get());
+          this->request());
     }
 
-    // optional .client.Node redirect = 6;
-    if (has_redirect()) {
+    // optional .client.BinlogSkip binlog_skip = 6;
+    if (has_binlog_skip()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->redirect());
+          this->binlog_skip());
     }
 
-  }
-  if (_has_bits_[10 / 32] & (0xffu << (10 % 32))) {
-    // optional .client.CmdResponse.InfoServer info_server = 11;
-    if (has_info_server()) {
+    // optional .client.SyncLease sync_lease = 7;
+    if (has_sync_lease()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->info_server());
+          this->sync_lease());
     }
 
-  }
-  // repeated .client.CmdResponse.InfoStats info_stats = 7;
-  total_size += 1 * this->info_stats_size();
-  for (int i = 0; i < this->info_stats_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->info_stats(i));
-  }
-
-  // repeated .client.CmdResponse.InfoCapacity info_capacity = 8;
-  total_size += 1 * this->info_capacity_size();
-  for (int i = 0; i < this->info_capacity_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->info_capacity(i));
-  }
+    // optional .client.BinlogBatch binlog_batch = 8;
+    if (has_binlog_batch()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->binlog_batch());
+    }
 
-  // repeated .client.CmdResponse.InfoRepl info_repl = 9;
-  total_size += 1 * this->info_repl_size();
-  for (int i = 0; i < this->info_repl_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->info_repl(i));
-  }
+    // optional .client.SyncAck sync_ack = 9;
+    if (has_sync_ack()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->sync_ack());
+    }
 
-  // repeated .client.CmdResponse.Mget mget = 10;
-  total_size += 1 * this->mget_size();
-  for (int i = 0; i < this->mget_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->mget(i));
   }
-
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -7849,10 +13416,10 @@ int CmdResponse::ByteSize() const {
   return total_size;
 }
 
-void CmdResponse::MergeFrom(const ::google::protobuf::Message& from) {
+void SyncRequest::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse*>(
+  const SyncRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const SyncRequest*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -7861,103 +13428,101 @@ void CmdResponse::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void CmdResponse::MergeFrom(const CmdResponse& from) {
+void SyncRequest::MergeFrom(const SyncRequest& from) {
   GOOGLE_CHECK_NE(&from, this);
-  info_stats_.MergeFrom(from.info_stats_);
-  info_capacity_.MergeFrom(from.info_capacity_);
-  info_repl_.MergeFrom(from.info_repl_);
-  mget_.MergeFrom(from.mget_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
+    if (from.has_sync_type()) {
+      set_sync_type(from.sync_type());
     }
-    if (from.has_code()) {
-      set_code(from.code());
+    if (from.has_epoch()) {
+      set_epoch(from.epoch());
     }
-    if (from.has_msg()) {
-      set_msg(from.msg());
+    if (from.has_from()) {
+      mutable_from()->::client::Node::MergeFrom(from.from());
     }
-    if (from.has_sync()) {
-      mutable_sync()->::client::CmdResponse_Sync::MergeFrom(from.sync());
+    if (from.has_sync_offset()) {
+      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
     }
-    if (from.has_get()) {
-      mutable_get()->::client::CmdResponse_Get::MergeFrom(from.get());
+    if (from.has_request()) {
+      mutable_request()->::client::CmdRequest::MergeFrom(from.request());
     }
-    if (from.has_redirect()) {
-      mutable_redirect()->::client::Node::MergeFrom(from.redirect());
+    if (from.has_binlog_skip()) {
+      mutable_binlog_skip()->::client::BinlogSkip::MergeFrom(from.binlog_skip());
     }
-  }
-  if (from._has_bits_[10 / 32] & (0xffu << (10 % 32))) {
-    if (from.has_info_server()) {
-      mutable_info_server()->::client::CmdResponse_InfoServer::MergeFrom(from.info_server());
+    if (from.has_sync_lease()) {
+      mutable_sync_lease()->::client::SyncLease::MergeFrom(from.sync_lease());
+    }
+    if (from.has_binlog_batch()) {
+      mutable_binlog_batch()->::client::BinlogBatch::MergeFrom(from.binlog_batch());
+    }
+    if (from.has_sync_ack()) {
+      mutable_sync_ack()->::client::SyncAck::MergeFrom(from.sync_ack());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void CmdResponse::CopyFrom(const ::google::protobuf::Message& from) {
+void SyncRequest::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CmdResponse::CopyFrom(const CmdResponse& from) {
+void SyncRequest::CopyFrom(const SyncRequest& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool SyncRequest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
 
-  if (has_sync()) {
-    if (!this->sync().IsInitialized()) return false;
+  if (has_from()) {
+    if (!this->from().IsInitialized()) return false;
   }
-  if (has_redirect()) {
-    if (!this->redirect().IsInitialized()) return false;
+  if (has_sync_offset()) {
+    if (!this->sync_offset().IsInitialized()) return false;
   }
-  for (int i = 0; i < info_stats_size(); i++) {
-    if (!this->info_stats(i).IsInitialized()) return false;
+  if (has_request()) {
+    if (!this->request().IsInitialized()) return false;
   }
-  for (int i = 0; i < info_capacity_size(); i++) {
-    if (!this->info_capacity(i).IsInitialized()) return false;
+  if (has_binlog_skip()) {
+    if (!this->binlog_skip().IsInitialized()) return false;
   }
-  for (int i = 0; i < info_repl_size(); i++) {
-    if (!this->info_repl(i).IsInitialized()) return false;
+  if (has_sync_lease()) {
+    if (!this->sync_lease().IsInitialized()) return false;
   }
-  for (int i = 0; i < mget_size(); i++) {
-    if (!this->mget(i).IsInitialized()) return false;
+  if (has_binlog_batch()) {
+    if (!this->binlog_batch().IsInitialized()) return false;
   }
-  if (has_info_server()) {
-    if (!this->info_server().IsInitialized()) return false;
+  if (has_sync_ack()) {
+    if (!this->sync_ack().IsInitialized()) return false;
   }
   return true;
 }
 
-void CmdResponse::Swap(CmdResponse* other) {
+void SyncRequest::Swap(SyncRequest* other) {
   if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(code_, other->code_);
-    std::swap(msg_, other->msg_);
-    std::swap(sync_, other->sync_);
-    std::swap(get_, other->get_);
-    std::swap(redirect_, other->redirect_);
-    info_stats_.Swap(&other->info_stats_);
-    info_capacity_.Swap(&other->info_capacity_);
-    info_repl_.Swap(&other->info_repl_);
-    mget_.Swap(&other->mget_);
-    std::swap(info_server_, other->info_server_);
+    std::swap(sync_type_, other->sync_type_);
+    std::swap(epoch_, other->epoch_);
+    std::swap(from_, other->from_);
+    std::swap(sync_offset_, other->sync_offset_);
+    std::swap(request_, other->request_);
+    std::swap(binlog_skip_, other->binlog_skip_);
+    std::swap(sync_lease_, other->sync_lease_);
+    std::swap(binlog_batch_, other->binlog_batch_);
+    std::swap(sync_ack_, other->sync_ack_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata CmdResponse::GetMetadata() const {
+::google::protobuf::Metadata SyncRequest::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_descriptor_;
-  metadata.reflection = CmdResponse_reflection_;
+  metadata.descriptor = SyncRequest_descriptor_;
+  metadata.reflection = SyncRequest_reflection_;
   return metadata;
 }
 
@@ -7965,127 +13530,113 @@ void CmdResponse::Swap(CmdResponse* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int BinlogSkip::kTableNameFieldNumber;
-const int BinlogSkip::kPartitionIdFieldNumber;
-const int BinlogSkip::kGapFieldNumber;
+const int Kv::kKeyFieldNumber;
+const int Kv::kValueFieldNumber;
 #endif  // !_MSC_VER
 
-BinlogSkip::BinlogSkip()
+Kv::Kv()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void BinlogSkip::InitAsDefaultInstance() {
+void Kv::InitAsDefaultInstance() {
 }
 
-BinlogSkip::BinlogSkip(const BinlogSkip& from)
+Kv::Kv(const Kv& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void BinlogSkip::SharedCtor() {
+void Kv::SharedCtor() {
   _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  partition_id_ = 0;
-  gap_ = GOOGLE_LONGLONG(0);
+  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-BinlogSkip::~BinlogSkip() {
+Kv::~Kv() {
   SharedDtor();
 }
 
-void BinlogSkip::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
+void Kv::SharedDtor() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (value_ != &::google::protobuf::internal::kEmptyString) {
+    delete value_;
   }
   if (this != default_instance_) {
   }
 }
 
-void BinlogSkip::SetCachedSize(int size) const {
+void Kv::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* BinlogSkip::descriptor() {
+const ::google::protobuf::Descriptor* Kv::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return BinlogSkip_descriptor_;
+  return Kv_descriptor_;
 }
 
-const BinlogSkip& BinlogSkip::default_instance() {
+const Kv& Kv::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-BinlogSkip* BinlogSkip::default_instance_ = NULL;
+Kv* Kv::default_instance_ = NULL;
 
-BinlogSkip* BinlogSkip::New() const {
-  return new BinlogSkip;
+Kv* Kv::New() const {
+  return new Kv;
 }
 
-void BinlogSkip::Clear() {
+void Kv::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
+    if (has_key()) {
+      if (key_ != &::google::protobuf::internal::kEmptyString) {
+        key_->clear();
+      }
+    }
+    if (has_value()) {
+      if (value_ != &::google::protobuf::internal::kEmptyString) {
+        value_->clear();
       }
     }
-    partition_id_ = 0;
-    gap_ = GOOGLE_LONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool BinlogSkip::MergePartialFromCodedStream(
+bool Kv::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string table_name = 1;
+      // required string key = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
+                input, this->mutable_key()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
+            this->key().data(), this->key().length(),
             ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_partition_id;
+        if (input->ExpectTag(18)) goto parse_value;
         break;
       }
 
-      // required int32 partition_id = 2;
+      // required bytes value = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_partition_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &partition_id_)));
-          set_has_partition_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_gap;
-        break;
-      }
-
-      // required int64 gap = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_gap:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &gap_)));
-          set_has_gap();
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_value:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_value()));
         } else {
           goto handle_uninterpreted;
         }
@@ -8109,25 +13660,21 @@ bool BinlogSkip::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void BinlogSkip::SerializeWithCachedSizes(
+void Kv::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
+  // required string key = 1;
+  if (has_key()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
+      this->key().data(), this->key().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
-  }
-
-  // required int32 partition_id = 2;
-  if (has_partition_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition_id(), output);
+      1, this->key(), output);
   }
 
-  // required int64 gap = 3;
-  if (has_gap()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->gap(), output);
+  // required bytes value = 2;
+  if (has_value()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      2, this->value(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -8136,26 +13683,23 @@ void BinlogSkip::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* BinlogSkip::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Kv::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
+  // required string key = 1;
+  if (has_key()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
+      this->key().data(), this->key().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE);
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
-  }
-
-  // required int32 partition_id = 2;
-  if (has_partition_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition_id(), target);
+        1, this->key(), target);
   }
 
-  // required int64 gap = 3;
-  if (has_gap()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->gap(), target);
+  // required bytes value = 2;
+  if (has_value()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        2, this->value(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -8165,29 +13709,22 @@ void BinlogSkip::SerializeWithCachedSizes(
   return target;
 }
 
-int BinlogSkip::ByteSize() const {
+int Kv::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string table_name = 1;
-    if (has_table_name()) {
+    // required string key = 1;
+    if (has_key()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
-    }
-
-    // required int32 partition_id = 2;
-    if (has_partition_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->partition_id());
+          this->key());
     }
 
-    // required int64 gap = 3;
-    if (has_gap()) {
+    // required bytes value = 2;
+    if (has_value()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->gap());
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->value());
     }
 
   }
@@ -8202,10 +13739,10 @@ int BinlogSkip::ByteSize() const {
   return total_size;
 }
 
-void BinlogSkip::MergeFrom(const ::google::protobuf::Message& from) {
+void Kv::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const BinlogSkip* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const BinlogSkip*>(
+  const Kv* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Kv*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -8214,56 +13751,52 @@ void BinlogSkip::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void BinlogSkip::MergeFrom(const BinlogSkip& from) {
+void Kv::MergeFrom(const Kv& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
-    }
-    if (from.has_partition_id()) {
-      set_partition_id(from.partition_id());
+    if (from.has_key()) {
+      set_key(from.key());
     }
-    if (from.has_gap()) {
-      set_gap(from.gap());
+    if (from.has_value()) {
+      set_value(from.value());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void BinlogSkip::CopyFrom(const ::google::protobuf::Message& from) {
+void Kv::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void BinlogSkip::CopyFrom(const BinlogSkip& from) {
+void Kv::CopyFrom(const Kv& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BinlogSkip::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+bool Kv::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
 
   return true;
 }
 
-void BinlogSkip::Swap(BinlogSkip* other) {
+void Kv::Swap(Kv* other) {
   if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(partition_id_, other->partition_id_);
-    std::swap(gap_, other->gap_);
+    std::swap(key_, other->key_);
+    std::swap(value_, other->value_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata BinlogSkip::GetMetadata() const {
+::google::protobuf::Metadata Kv::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = BinlogSkip_descriptor_;
-  metadata.reflection = BinlogSkip_reflection_;
+  metadata.descriptor = Kv_descriptor_;
+  metadata.reflection = Kv_reflection_;
   return metadata;
 }
 
@@ -8271,127 +13804,123 @@ void BinlogSkip::Swap(BinlogSkip* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int SyncLease::kTableNameFieldNumber;
-const int SyncLease::kPartitionIdFieldNumber;
-const int SyncLease::kLeaseFieldNumber;
+const int SyncItem::kSyncOffsetFieldNumber;
+const int SyncItem::kRequestFieldNumber;
+const int SyncItem::kSkipGapFieldNumber;
 #endif  // !_MSC_VER
 
-SyncLease::SyncLease()
+SyncItem::SyncItem()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void SyncLease::InitAsDefaultInstance() {
+void SyncItem::InitAsDefaultInstance() {
+  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
+  request_ = const_cast< ::client::CmdRequest*>(&::client::CmdRequest::default_instance());
 }
 
-SyncLease::SyncLease(const SyncLease& from)
+SyncItem::SyncItem(const SyncItem& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void SyncLease::SharedCtor() {
+void SyncItem::SharedCtor() {
   _cached_size_ = 0;
-  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  partition_id_ = 0;
-  lease_ = GOOGLE_LONGLONG(0);
+  sync_offset_ = NULL;
+  request_ = NULL;
+  skip_gap_ = GOOGLE_LONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-SyncLease::~SyncLease() {
+SyncItem::~SyncItem() {
   SharedDtor();
 }
 
-void SyncLease::SharedDtor() {
-  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete table_name_;
-  }
+void SyncItem::SharedDtor() {
   if (this != default_instance_) {
+    delete sync_offset_;
+    delete request_;
   }
 }
 
-void SyncLease::SetCachedSize(int size) const {
+void SyncItem::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* SyncLease::descriptor() {
+const ::google::protobuf::Descriptor* SyncItem::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return SyncLease_descriptor_;
+  return SyncItem_descriptor_;
 }
 
-const SyncLease& SyncLease::default_instance() {
+const SyncItem& SyncItem::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-SyncLease* SyncLease::default_instance_ = NULL;
+SyncItem* SyncItem::default_instance_ = NULL;
 
-SyncLease* SyncLease::New() const {
-  return new SyncLease;
+SyncItem* SyncItem::New() const {
+  return new SyncItem;
 }
 
-void SyncLease::Clear() {
+void SyncItem::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_table_name()) {
-      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
-        table_name_->clear();
-      }
+    if (has_sync_offset()) {
+      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
     }
-    partition_id_ = 0;
-    lease_ = GOOGLE_LONGLONG(0);
+    if (has_request()) {
+      if (request_ != NULL) request_->::client::CmdRequest::Clear();
+    }
+    skip_gap_ = GOOGLE_LONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool SyncLease::MergePartialFromCodedStream(
+bool SyncItem::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required string table_name = 1;
+      // required .client.SyncOffset sync_offset = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_table_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->table_name().data(), this->table_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_sync_offset()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(16)) goto parse_partition_id;
+        if (input->ExpectTag(18)) goto parse_request;
         break;
       }
 
-      // required int32 partition_id = 2;
+      // optional .client.CmdRequest request = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_partition_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &partition_id_)));
-          set_has_partition_id();
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_request:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_request()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(24)) goto parse_lease;
+        if (input->ExpectTag(24)) goto parse_skip_gap;
         break;
       }
 
-      // required int64 lease = 3;
+      // optional int64 skip_gap = 3;
       case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_lease:
+         parse_skip_gap:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
                    ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &lease_)));
-          set_has_lease();
+                 input, &skip_gap_)));
+          set_has_skip_gap();
         } else {
           goto handle_uninterpreted;
         }
@@ -8415,25 +13944,23 @@ bool SyncLease::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void SyncLease::SerializeWithCachedSizes(
+void SyncItem::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->table_name(), output);
+  // required .client.SyncOffset sync_offset = 1;
+  if (has_sync_offset()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->sync_offset(), output);
   }
 
-  // required int32 partition_id = 2;
-  if (has_partition_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition_id(), output);
+  // optional .client.CmdRequest request = 2;
+  if (has_request()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->request(), output);
   }
 
-  // required int64 lease = 3;
-  if (has_lease()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->lease(), output);
+  // optional int64 skip_gap = 3;
+  if (has_skip_gap()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->skip_gap(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -8442,26 +13969,25 @@ void SyncLease::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* SyncLease::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* SyncItem::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required string table_name = 1;
-  if (has_table_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->table_name().data(), this->table_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->table_name(), target);
+  // required .client.SyncOffset sync_offset = 1;
+  if (has_sync_offset()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->sync_offset(), target);
   }
 
-  // required int32 partition_id = 2;
-  if (has_partition_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition_id(), target);
+  // optional .client.CmdRequest request = 2;
+  if (has_request()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->request(), target);
   }
 
-  // required int64 lease = 3;
-  if (has_lease()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->lease(), target);
+  // optional int64 skip_gap = 3;
+  if (has_skip_gap()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->skip_gap(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -8471,29 +13997,29 @@ void SyncLease::SerializeWithCachedSizes(
   return target;
 }
 
-int SyncLease::ByteSize() const {
+int SyncItem::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string table_name = 1;
-    if (has_table_name()) {
+    // required .client.SyncOffset sync_offset = 1;
+    if (has_sync_offset()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->table_name());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->sync_offset());
     }
 
-    // required int32 partition_id = 2;
-    if (has_partition_id()) {
+    // optional .client.CmdRequest request = 2;
+    if (has_request()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->partition_id());
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->request());
     }
 
-    // required int64 lease = 3;
-    if (has_lease()) {
+    // optional int64 skip_gap = 3;
+    if (has_skip_gap()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->lease());
+          this->skip_gap());
     }
 
   }
@@ -8508,10 +14034,10 @@ int SyncLease::ByteSize() const {
   return total_size;
 }
 
-void SyncLease::MergeFrom(const ::google::protobuf::Message& from) {
+void SyncItem::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const SyncLease* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SyncLease*>(
+  const SyncItem* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const SyncItem*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -8520,56 +14046,62 @@ void SyncLease::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void SyncLease::MergeFrom(const SyncLease& from) {
+void SyncItem::MergeFrom(const SyncItem& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_table_name()) {
-      set_table_name(from.table_name());
+    if (from.has_sync_offset()) {
+      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
     }
-    if (from.has_partition_id()) {
-      set_partition_id(from.partition_id());
+    if (from.has_request()) {
+      mutable_request()->::client::CmdRequest::MergeFrom(from.request());
     }
-    if (from.has_lease()) {
-      set_lease(from.lease());
+    if (from.has_skip_gap()) {
+      set_skip_gap(from.skip_gap());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void SyncLease::CopyFrom(const ::google::protobuf::Message& from) {
+void SyncItem::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SyncLease::CopyFrom(const SyncLease& from) {
+void SyncItem::CopyFrom(const SyncItem& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SyncLease::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+bool SyncItem::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
 
+  if (has_sync_offset()) {
+    if (!this->sync_offset().IsInitialized()) return false;
+  }
+  if (has_request()) {
+    if (!this->request().IsInitialized()) return false;
+  }
   return true;
 }
 
-void SyncLease::Swap(SyncLease* other) {
+void SyncItem::Swap(SyncItem* other) {
   if (other != this) {
-    std::swap(table_name_, other->table_name_);
-    std::swap(partition_id_, other->partition_id_);
-    std::swap(lease_, other->lease_);
+    std::swap(sync_offset_, other->sync_offset_);
+    std::swap(request_, other->request_);
+    std::swap(skip_gap_, other->skip_gap_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata SyncLease::GetMetadata() const {
+::google::protobuf::Metadata SyncItem::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SyncLease_descriptor_;
-  metadata.reflection = SyncLease_reflection_;
+  metadata.descriptor = SyncItem_descriptor_;
+  metadata.reflection = SyncItem_reflection_;
   return metadata;
 }
 
@@ -8577,213 +14109,128 @@ void SyncLease::Swap(SyncLease* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int SyncRequest::kSyncTypeFieldNumber;
-const int SyncRequest::kEpochFieldNumber;
-const int SyncRequest::kFromFieldNumber;
-const int SyncRequest::kSyncOffsetFieldNumber;
-const int SyncRequest::kRequestFieldNumber;
-const int SyncRequest::kBinlogSkipFieldNumber;
-const int SyncRequest::kSyncLeaseFieldNumber;
+const int BinlogBatch::kTableNameFieldNumber;
+const int BinlogBatch::kPartitionIdFieldNumber;
+const int BinlogBatch::kItemsFieldNumber;
 #endif  // !_MSC_VER
 
-SyncRequest::SyncRequest()
+BinlogBatch::BinlogBatch()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void SyncRequest::InitAsDefaultInstance() {
-  from_ = const_cast< ::client::Node*>(&::client::Node::default_instance());
-  sync_offset_ = const_cast< ::client::SyncOffset*>(&::client::SyncOffset::default_instance());
-  request_ = const_cast< ::client::CmdRequest*>(&::client::CmdRequest::default_instance());
-  binlog_skip_ = const_cast< ::client::BinlogSkip*>(&::client::BinlogSkip::default_instance());
-  sync_lease_ = const_cast< ::client::SyncLease*>(&::client::SyncLease::default_instance());
+void BinlogBatch::InitAsDefaultInstance() {
 }
 
-SyncRequest::SyncRequest(const SyncRequest& from)
+BinlogBatch::BinlogBatch(const BinlogBatch& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void SyncRequest::SharedCtor() {
+void BinlogBatch::SharedCtor() {
   _cached_size_ = 0;
-  sync_type_ = 0;
-  epoch_ = GOOGLE_LONGLONG(0);
-  from_ = NULL;
-  sync_offset_ = NULL;
-  request_ = NULL;
-  binlog_skip_ = NULL;
-  sync_lease_ = NULL;
+  table_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  partition_id_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-SyncRequest::~SyncRequest() {
+BinlogBatch::~BinlogBatch() {
   SharedDtor();
 }
 
-void SyncRequest::SharedDtor() {
+void BinlogBatch::SharedDtor() {
+  if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete table_name_;
+  }
   if (this != default_instance_) {
-    delete from_;
-    delete sync_offset_;
-    delete request_;
-    delete binlog_skip_;
-    delete sync_lease_;
   }
 }
 
-void SyncRequest::SetCachedSize(int size) const {
+void BinlogBatch::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* SyncRequest::descriptor() {
+const ::google::protobuf::Descriptor* BinlogBatch::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return SyncRequest_descriptor_;
+  return BinlogBatch_descriptor_;
 }
 
-const SyncRequest& SyncRequest::default_instance() {
+const BinlogBatch& BinlogBatch::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_client_2eproto();
   return *default_instance_;
 }
 
-SyncRequest* SyncRequest::default_instance_ = NULL;
+BinlogBatch* BinlogBatch::default_instance_ = NULL;
 
-SyncRequest* SyncRequest::New() const {
-  return new SyncRequest;
+BinlogBatch* BinlogBatch::New() const {
+  return new BinlogBatch;
 }
 
-void SyncRequest::Clear() {
+void BinlogBatch::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    sync_type_ = 0;
-    epoch_ = GOOGLE_LONGLONG(0);
-    if (has_from()) {
-      if (from_ != NULL) from_->::client::Node::Clear();
-    }
-    if (has_sync_offset()) {
-      if (sync_offset_ != NULL) sync_offset_->::client::SyncOffset::Clear();
-    }
-    if (has_request()) {
-      if (request_ != NULL) request_->::client::CmdRequest::Clear();
-    }
-    if (has_binlog_skip()) {
-      if (binlog_skip_ != NULL) binlog_skip_->::client::BinlogSkip::Clear();
-    }
-    if (has_sync_lease()) {
-      if (sync_lease_ != NULL) sync_lease_->::client::SyncLease::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SyncRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .client.SyncType sync_type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::client::SyncType_IsValid(value)) {
-            set_sync_type(static_cast< ::client::SyncType >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_epoch;
-        break;
-      }
-
-      // required int64 epoch = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_epoch:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &epoch_)));
-          set_has_epoch();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_from;
-        break;
-      }
-
-      // required .client.Node from = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_from:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_from()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_sync_offset;
-        break;
-      }
-
-      // optional .client.SyncOffset sync_offset = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync_offset:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync_offset()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_request;
-        break;
+    if (has_table_name()) {
+      if (table_name_ != &::google::protobuf::internal::kEmptyString) {
+        table_name_->clear();
       }
+    }
+    partition_id_ = 0;
+  }
+  items_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
 
-      // optional .client.CmdRequest request = 5;
-      case 5: {
+bool BinlogBatch::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string table_name = 1;
+      case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_request:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_request()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->table_name().data(), this->table_name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(50)) goto parse_binlog_skip;
+        if (input->ExpectTag(16)) goto parse_partition_id;
         break;
       }
 
-      // optional .client.BinlogSkip binlog_skip = 6;
-      case 6: {
+      // required int32 partition_id = 2;
+      case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_binlog_skip:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_binlog_skip()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_partition_id:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &partition_id_)));
+          set_has_partition_id();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(58)) goto parse_sync_lease;
+        if (input->ExpectTag(26)) goto parse_items;
         break;
       }
 
-      // optional .client.SyncLease sync_lease = 7;
-      case 7: {
+      // repeated .client.SyncItem items = 3;
+      case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sync_lease:
+         parse_items:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_sync_lease()));
+                input, add_items()));
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(26)) goto parse_items;
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -8804,47 +14251,26 @@ bool SyncRequest::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void SyncRequest::SerializeWithCachedSizes(
+void BinlogBatch::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .client.SyncType sync_type = 1;
-  if (has_sync_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->sync_type(), output);
-  }
-
-  // required int64 epoch = 2;
-  if (has_epoch()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->epoch(), output);
-  }
-
-  // required .client.Node from = 3;
-  if (has_from()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->from(), output);
-  }
-
-  // optional .client.SyncOffset sync_offset = 4;
-  if (has_sync_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->sync_offset(), output);
-  }
-
-  // optional .client.CmdRequest request = 5;
-  if (has_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->request(), output);
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->table_name(), output);
   }
 
-  // optional .client.BinlogSkip binlog_skip = 6;
-  if (has_binlog_skip()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->binlog_skip(), output);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->partition_id(), output);
   }
 
-  // optional .client.SyncLease sync_lease = 7;
-  if (has_sync_lease()) {
+  // repeated .client.SyncItem items = 3;
+  for (int i = 0; i < this->items_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->sync_lease(), output);
+      3, this->items(i), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -8853,52 +14279,28 @@ void SyncRequest::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* SyncRequest::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* BinlogBatch::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // required .client.SyncType sync_type = 1;
-  if (has_sync_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->sync_type(), target);
-  }
-
-  // required int64 epoch = 2;
-  if (has_epoch()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->epoch(), target);
-  }
-
-  // required .client.Node from = 3;
-  if (has_from()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->from(), target);
-  }
-
-  // optional .client.SyncOffset sync_offset = 4;
-  if (has_sync_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->sync_offset(), target);
-  }
-
-  // optional .client.CmdRequest request = 5;
-  if (has_request()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->request(), target);
+  // required string table_name = 1;
+  if (has_table_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->table_name().data(), this->table_name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
   }
 
-  // optional .client.BinlogSkip binlog_skip = 6;
-  if (has_binlog_skip()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->binlog_skip(), target);
+  // required int32 partition_id = 2;
+  if (has_partition_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->partition_id(), target);
   }
 
-  // optional .client.SyncLease sync_lease = 7;
-  if (has_sync_lease()) {
+  // repeated .client.SyncItem items = 3;
+  for (int i = 0; i < this->items_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        7, this->sync_lease(), target);
+        3, this->items(i), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -8908,59 +14310,33 @@ void SyncRequest::SerializeWithCachedSizes(
   return target;
 }
 
-int SyncRequest::ByteSize() const {
+int BinlogBatch::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .client.SyncType sync_type = 1;
-    if (has_sync_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->sync_type());
-    }
-
-    // required int64 epoch = 2;
-    if (has_epoch()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->epoch());
-    }
-
-    // required .client.Node from = 3;
-    if (has_from()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->from());
-    }
-
-    // optional .client.SyncOffset sync_offset = 4;
-    if (has_sync_offset()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync_offset());
-    }
-
-    // optional .client.CmdRequest request = 5;
-    if (has_request()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->request());
-    }
-
-    // optional .client.BinlogSkip binlog_skip = 6;
-    if (has_binlog_skip()) {
+    // required string table_name = 1;
+    if (has_table_name()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->binlog_skip());
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->table_name());
     }
 
-    // optional .client.SyncLease sync_lease = 7;
-    if (has_sync_lease()) {
+    // required int32 partition_id = 2;
+    if (has_partition_id()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->sync_lease());
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->partition_id());
     }
 
   }
+  // repeated .client.SyncItem items = 3;
+  total_size += 1 * this->items_size();
+  for (int i = 0; i < this->items_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->items(i));
+  }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -8972,10 +14348,10 @@ int SyncRequest::ByteSize() const {
   return total_size;
 }
 
-void SyncRequest::MergeFrom(const ::google::protobuf::Message& from) {
+void BinlogBatch::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const SyncRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SyncRequest*>(
+  const BinlogBatch* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const BinlogBatch*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -8984,87 +14360,57 @@ void SyncRequest::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void SyncRequest::MergeFrom(const SyncRequest& from) {
+void BinlogBatch::MergeFrom(const BinlogBatch& from) {
   GOOGLE_CHECK_NE(&from, this);
+  items_.MergeFrom(from.items_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_sync_type()) {
-      set_sync_type(from.sync_type());
-    }
-    if (from.has_epoch()) {
-      set_epoch(from.epoch());
-    }
-    if (from.has_from()) {
-      mutable_from()->::client::Node::MergeFrom(from.from());
-    }
-    if (from.has_sync_offset()) {
-      mutable_sync_offset()->::client::SyncOffset::MergeFrom(from.sync_offset());
-    }
-    if (from.has_request()) {
-      mutable_request()->::client::CmdRequest::MergeFrom(from.request());
-    }
-    if (from.has_binlog_skip()) {
-      mutable_binlog_skip()->::client::BinlogSkip::MergeFrom(from.binlog_skip());
+    if (from.has_table_name()) {
+      set_table_name(from.table_name());
     }
-    if (from.has_sync_lease()) {
-      mutable_sync_lease()->::client::SyncLease::MergeFrom(from.sync_lease());
+    if (from.has_partition_id()) {
+      set_partition_id(from.partition_id());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void SyncRequest::CopyFrom(const ::google::protobuf::Message& from) {
+void BinlogBatch::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SyncRequest::CopyFrom(const SyncRequest& from) {
+void BinlogBatch::CopyFrom(const BinlogBatch& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SyncRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+bool BinlogBatch::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
 
-  if (has_from()) {
-    if (!this->from().IsInitialized()) return false;
-  }
-  if (has_sync_offset()) {
-    if (!this->sync_offset().IsInitialized()) return false;
-  }
-  if (has_request()) {
-    if (!this->request().IsInitialized()) return false;
-  }
-  if (has_binlog_skip()) {
-    if (!this->binlog_skip().IsInitialized()) return false;
-  }
-  if (has_sync_lease()) {
-    if (!this->sync_lease().IsInitialized()) return false;
+  for (int i = 0; i < items_size(); i++) {
+    if (!this->items(i).IsInitialized()) return false;
   }
   return true;
 }
 
-void SyncRequest::Swap(SyncRequest* other) {
+void BinlogBatch::Swap(BinlogBatch* other) {
   if (other != this) {
-    std::swap(sync_type_, other->sync_type_);
-    std::swap(epoch_, other->epoch_);
-    std::swap(from_, other->from_);
-    std::swap(sync_offset_, other->sync_offset_);
-    std::swap(request_, other->request_);
-    std::swap(binlog_skip_, other->binlog_skip_);
-    std::swap(sync_lease_, other->sync_lease_);
+    std::swap(table_name_, other->table_name_);
+    std::swap(partition_id_, other->partition_id_);
+    items_.Swap(&other->items_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata SyncRequest::GetMetadata() const {
+::google::protobuf::Metadata BinlogBatch::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SyncRequest_descriptor_;
-  metadata.reflection = SyncRequest_reflection_;
+  metadata.descriptor = BinlogBatch_descriptor_;
+  metadata.reflection = BinlogBatch_reflection_;
   return metadata;
 }
 
@@ -17,6 +17,7 @@
 #include <glog/logging.h>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "src/node/zp_data_server.h"
 #include "src/node/zp_data_partition.h"
@@ -40,6 +41,20 @@ void ZPBinlogReceiveBgWorker::AddTask(ZPBinlogReceiveTask *task) {
   bg_thread_->Schedule(&DoBinlogReceiveTask, static_cast<void*>(task));
 }
 
+// Apply the CMD items grouped so far as one batch,
+// option carries the offset of the first grouped item
+static void ApplyCmdBatch(const std::shared_ptr<Partition>& partition,
+    const PartitionSyncOption& option,
+    std::vector<const Cmd*>* cmds,
+    std::vector<client::CmdRequest>* reqs) {
+  if (cmds->empty()) {
+    return;
+  }
+  partition->DoBinlogCommandBatch(option, *cmds, *reqs);
+  cmds->clear();
+  reqs->clear();
+}
+
 void ZPBinlogReceiveBgWorker::DoBinlogReceiveTask(void* task) {
   ZPBinlogReceiveTask *task_ptr = static_cast<ZPBinlogReceiveTask*>(task);
   PartitionSyncOption option = task_ptr->option;
@@ -70,6 +85,57 @@ void ZPBinlogReceiveBgWorker::DoBinlogReceiveTask(void* task) {
           option,
           task_ptr->i);
       break;
+    case client::SyncType::BATCH: {
+      // Apply all the items carried by one BATCH frame in order
+      // Consecutive commands are grouped together,
+      // then applied as one write batch and one binlog append
+      std::vector<const Cmd*> group_cmds;
+      std::vector<client::CmdRequest> group_reqs;
+      PartitionSyncOption group_option = option;
+      for (int i = 0; i < task_ptr->batch.items_size(); i++) {
+        const client::SyncItem& item = task_ptr->batch.items(i);
+        PartitionSyncOption item_option = option;
+        item_option.filenum = item.sync_offset().filenum();
+        item_option.offset = item.sync_offset().offset();
+        if (item.has_request()) {
+          item_option.type = client::SyncType::CMD;
+          Cmd* cmd = zp_data_server->CmdGet(
+              static_cast<int>(item.request().type()));
+          if (cmd == NULL) {
+            LOG(ERROR) << "unsupported type in binlog batch: "
+              << static_cast<int>(item.request().type());
+            break;
+          }
+          if (cmd->is_suspend()) {
+            // Suspend command should not share the batch,
+            // since the batch itself holds the suspend read lock
+            ApplyCmdBatch(partition, group_option,
+                &group_cmds, &group_reqs);
+            partition->DoBinlogCommand(item_option, cmd, item.request());
+            continue;
+          }
+          if (group_cmds.empty()) {
+            group_option = item_option;
+          }
+          group_cmds.push_back(cmd);
+          group_reqs.push_back(item.request());
+        } else {
+          item_option.type = client::SyncType::SKIP;
+          ApplyCmdBatch(partition, group_option,
+              &group_cmds, &group_reqs);
+          partition->DoBinlogSkip(item_option, item.skip_gap());
+        }
+      }
+      ApplyCmdBatch(partition, group_option, &group_cmds, &group_reqs);
+      if (task_ptr->i > 0) {
+        // Lease piggybacked on the frame, renew it right here instead
+        // of costing the master a standalone LEASE dispatch
+        PartitionSyncOption lease_option = option;
+        lease_option.type = client::SyncType::LEASE;
+        partition->DoBinlogLeaseRenew(lease_option, task_ptr->i);
+      }
+      break;
+    }
     default:
       LOG(WARNING) << "Unknown binlog sync type: "
         << static_cast<int>(option.type);
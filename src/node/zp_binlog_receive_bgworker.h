@@ -22,6 +22,7 @@ struct ZPBinlogReceiveTask {
   PartitionSyncOption option;
   const Cmd* cmd;
   client::CmdRequest request;
+  client::BinlogBatch batch;
   uint64_t i;
 
   ZPBinlogReceiveTask(const PartitionSyncOption &opt,
@@ -30,6 +31,13 @@ struct ZPBinlogReceiveTask {
     cmd(c),
     request(req) {}
 
+  // A BATCH frame may piggyback a lease renewal, 0 means none
+  ZPBinlogReceiveTask(const PartitionSyncOption &opt,
+      const client::BinlogBatch &b, uint64_t lease = 0)
+    : option(opt),
+    batch(b),
+    i(lease) {}
+
   ZPBinlogReceiveTask(const PartitionSyncOption &opt,
       uint64_t integer)
     : option(opt),
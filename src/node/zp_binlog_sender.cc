@@ -17,6 +17,7 @@
 #include <google/protobuf/text_format.h>
 #include <limits>
 #include <memory>
+#include <thread>
 
 #include "slash/include/env.h"
 
@@ -67,35 +68,66 @@ ZPBinlogSendTask::ZPBinlogSendTask(uint64_t seq, const std::string &table,
   pre_filenum_(0),
   pre_offset_(0),
   pre_has_content_(false),
-  binlog_filename_(binlog_prefix) {
+  pending_frame_full_(false),
+  next_frame_ready_(false),
+  next_frame_full_(false),
+  binlog_filename_(binlog_prefix),
+  reader_(NULL),
+  reader_synced_(false) {
     name_ = ZPBinlogSendTaskName(table, partition_id_, target);
-    pre_content_.reserve(1024 * 1024);
+    pre_scratch_.reserve(1024 * 1024);
   }
 
 ZPBinlogSendTask::~ZPBinlogSendTask() {
   delete reader_;
-  delete queue_;
 }
 
 Status ZPBinlogSendTask::Init() {
   std::string confile = NewFileName(binlog_filename_, filenum_);
-  if (!slash::NewSequentialFile(confile, &queue_).ok()) {
-    return Status::IOError("ZPBinlogSendTask Init new sequtial file failed");
+  Status s = BinlogMmapReader::Create(confile, &reader_);
+  if (!s.ok()) {
+    return s;
   }
-  reader_ = new BinlogReader(queue_);
-  Status s = reader_->Seek(offset_);
+  s = reader_->Seek(offset_);
   if (!s.ok()) {
     return s;
   }
+  reader_synced_ = true;
   return Status::OK();
 }
 
-// Return Status::OK if has something to be send
-Status ZPBinlogSendTask::ProcessTask() {
-  if (reader_ == NULL || queue_ == NULL) {
-    return Status::InvalidArgument("Error Task");
+// Reopen the binlog file and seek to current offset
+// Required after some records were served from the tail cache,
+// which left the file reader behind
+Status ZPBinlogSendTask::ResetReader() {
+  delete reader_;
+  reader_ = NULL;
+  Status s = Init();
+  if (!s.ok()) {
+    LOG(WARNING) << "ZPBinlogSendTask failed to reset reader: "
+      << s.ToString() << ", table: " << table_name_
+      << ", partition:" << partition_id_;
   }
+  return s;
+}
 
+// How many binlog files the task is behind its partition
+uint32_t ZPBinlogSendTask::FilenumLag() const {
+  std::shared_ptr<Partition> partition =
+    zp_data_server->GetTablePartitionById(table_name_, partition_id_);
+  if (partition == NULL) {
+    return 0;
+  }
+  BinlogOffset head;
+  if (!partition->GetBinlogOffsetWithLock(&head)
+      || head.filenum <= filenum_) {
+    return 0;
+  }
+  return head.filenum - filenum_;
+}
+
+// Return Status::OK if has something to be send
+Status ZPBinlogSendTask::ProcessTask() {
   // Check task position
   BinlogOffset boffset;
   std::shared_ptr<Partition> partition =
@@ -114,7 +146,30 @@ Status ZPBinlogSendTask::ProcessTask() {
   RecordPreOffset();
 
   uint64_t consume_len = 0;
-  Status s = reader_->Consume(&consume_len, &pre_content_);
+
+  // Serve fresh written records from the binlog tail cache first
+  Status s = partition->GetCachedBinlog(filenum_, offset_,
+      &pre_scratch_, &consume_len);
+  if (s.ok()) {
+    reader_synced_ = false;  // file reader is left behind
+    pre_content_ = Slice(pre_scratch_.data(), pre_scratch_.size());
+    pre_has_content_ = true;
+    offset_ += consume_len;
+    return Status::OK();
+  }
+
+  // Cache miss, the task is lagging, read from binlog file
+  if (!reader_synced_) {
+    s = ResetReader();
+    if (!s.ok()) {
+      return s;
+    }
+  }
+  if (reader_ == NULL) {
+    return Status::InvalidArgument("Error Task");
+  }
+
+  s = reader_->Consume(&consume_len, &pre_content_, &pre_scratch_);
   if (s.IsEndFile()) {
     // Roll to next File
     std::string confile = NewFileName(binlog_filename_, filenum_ + 1);
@@ -124,17 +179,14 @@ Status ZPBinlogSendTask::ProcessTask() {
         << confile << ", Partition: " << table_name_ << "_" << partition_id_;
       delete reader_;
       reader_ = NULL;
-      delete queue_;
-      queue_ = NULL;
 
-      s = slash::NewSequentialFile(confile, &(queue_));
+      s = BinlogMmapReader::Create(confile, &reader_);
       if (!s.ok()) {
         LOG(WARNING) << "Failed to roll to next binlog file:" << (filenum_ + 1)
           << " Error:" << s.ToString() << ", Partition: " << table_name_
           << "_" << partition_id_;
         return s;
       }
-      reader_ = new BinlogReader(queue_);
       filenum_++;
       offset_ = 0;
       return ProcessTask();
@@ -165,6 +217,76 @@ Status ZPBinlogSendTask::ProcessTask() {
   return Status::OK();
 }
 
+// Coalesce up to kBinlogBatchMaxCount binlog items
+// or kBinlogBatchMaxBytes bytes into one BATCH frame
+// Return OK if the frame carries at least one item
+// full reports whether a coalesce limit was hit,
+// which means the task has more binlog waiting right behind
+Status ZPBinlogSendTask::FillBatchFrame(client::SyncRequest* frame,
+    bool* full) {
+  frame->Clear();
+  frame->set_sync_type(client::SyncType::BATCH);
+  client::BinlogBatch* batch = frame->mutable_binlog_batch();
+  batch->set_table_name(table_name_);
+  batch->set_partition_id(partition_id_);
+
+  Status s;
+  uint64_t batch_bytes = 0;
+  while (batch->items_size() < kBinlogBatchMaxCount
+      && batch_bytes < kBinlogBatchMaxBytes) {
+    s = ProcessTask();
+    if (!s.ok()) {
+      // Send what we already have, the error would
+      // be seen again by the next ProcessBatchTask
+      break;
+    }
+    client::SyncItem* item = batch->add_items();
+    client::SyncOffset* sync_offset = item->mutable_sync_offset();
+    sync_offset->set_filenum(pre_filenum_);
+    sync_offset->set_offset(pre_offset_);
+    if (pre_has_content_) {
+      // Parse straight from the mapped binlog file
+      item->mutable_request()->ParseFromArray(pre_content_.data(),
+          static_cast<int>(pre_content_.size()));
+      batch_bytes += pre_content_.size();
+    } else {
+      item->set_skip_gap(offset_ - pre_offset_);
+    }
+  }
+  *full = (batch->items_size() >= kBinlogBatchMaxCount
+      || batch_bytes >= kBinlogBatchMaxBytes);
+
+  if (batch->items_size() > 0) {
+    return Status::OK();
+  }
+  return s;
+}
+
+Status ZPBinlogSendTask::ProcessBatchTask() {
+  if (next_frame_ready_) {
+    // A frame was read ahead while the previous one was on the wire
+    pending_frame_.Swap(&next_frame_);
+    pending_frame_full_ = next_frame_full_;
+    next_frame_ready_ = false;
+    return Status::OK();
+  }
+  return FillBatchFrame(&pending_frame_, &pending_frame_full_);
+}
+
+// Read one more BATCH frame ahead; meant to run while the frame built
+// before is on the wire, so binlog read overlaps the network send
+// An error here is not remembered, the next real ProcessBatchTask
+// runs into it again by itself
+void ZPBinlogSendTask::PrefetchBatchTask() {
+  if (next_frame_ready_) {
+    return;
+  }
+  Status s = FillBatchFrame(&next_frame_, &next_frame_full_);
+  if (s.ok()) {
+    next_frame_ready_ = true;
+  }
+}
+
 // Build LEASE SyncRequest
 void ZPBinlogSendTask::BuildLeaseSyncRequest(int64_t lease_time,
     client::SyncRequest* msg) const {
@@ -180,60 +302,69 @@ void ZPBinlogSendTask::BuildLeaseSyncRequest(int64_t lease_time,
   lease->set_lease(lease_time);
 }
 
-// Build CMD or SKIP SyncRequest by ZPBinlogSendTask
-void ZPBinlogSendTask::BuildCommonSyncRequest(client::SyncRequest *msg) const {
-  // Common part
+// Build BATCH SyncRequest from the pending frame
+// Common part is refreshed on every send attempt.
+// The lease rides along with the frame, so a partition under
+// steady sync traffic needs no standalone LEASE chatter at all
+void ZPBinlogSendTask::BuildBatchSyncRequest(int64_t lease_time,
+    client::SyncRequest *msg) const {
+  msg->CopyFrom(pending_frame_);
   msg->set_epoch(zp_data_server->meta_epoch());
   client::Node *node = msg->mutable_from();
   node->set_ip(zp_data_server->local_ip());
   node->set_port(zp_data_server->local_port());
-  client::SyncOffset *sync_offset = msg->mutable_sync_offset();
-  sync_offset->set_filenum(pre_filenum_);
-  sync_offset->set_offset(pre_offset_);
-
-  // Different part
-  if (pre_has_content_) {
-    msg->set_sync_type(client::SyncType::CMD);
-    client::CmdRequest *req_ptr = msg->mutable_request();
-    client::CmdRequest req;
-    assert(!pre_content_.empty());
-    req.ParseFromString(pre_content_);
-    req_ptr->CopyFrom(req);
-  } else {
-    msg->set_sync_type(client::SyncType::SKIP);
-    client::BinlogSkip* skip = msg->mutable_binlog_skip();
-    skip->set_table_name(table_name_);
-    skip->set_partition_id(partition_id_);
-    skip->set_gap(offset_ - pre_offset_);
-  }
+
+  client::SyncLease* lease = msg->mutable_sync_lease();
+  lease->set_table_name(table_name_);
+  lease->set_partition_id(partition_id_);
+  lease->set_lease(lease_time);
 }
 
 /**
  * ZPBinlogSendTaskPool
  */
-ZPBinlogSendTaskPool::ZPBinlogSendTaskPool()
-  : next_sequence_(0) {
-  pthread_rwlock_init(&tasks_rwlock_, NULL);
-  task_ptrs_.reserve(1000);
-  LOG(INFO) << "size: " << tasks_.size();
+ZPBinlogSendTaskPool::ZPBinlogSendTaskPool(int shard_num)
+  : shard_num_(shard_num),
+  next_sequence_(0) {
+  assert(shard_num_ > 0);
+  for (int i = 0; i < shard_num_; i++) {
+    ZPBinlogSendTaskShard* shard = new ZPBinlogSendTaskShard();
+    pthread_rwlock_init(&shard->rwlock, NULL);
+    shard->task_ptrs.reserve(1000 / shard_num_ + 1);
+    shards_.push_back(shard);
+  }
 }
 
 ZPBinlogSendTaskPool::~ZPBinlogSendTaskPool() {
-  std::list<ZPBinlogSendTask*>::iterator it;
-  for (it = tasks_.begin(); it != tasks_.end(); ++it) {
-    delete *it;
+  for (int i = 0; i < shard_num_; i++) {
+    std::list<ZPBinlogSendTask*>::iterator it;
+    for (it = shards_[i]->tasks.begin();
+        it != shards_[i]->tasks.end(); ++it) {
+      delete *it;
+    }
+    pthread_rwlock_destroy(&shards_[i]->rwlock);
+    delete shards_[i];
   }
-  pthread_rwlock_destroy(&tasks_rwlock_);
 }
 
 bool ZPBinlogSendTaskPool::TaskExist(const std::string& task_name) {
-  slash::RWLock l(&tasks_rwlock_, false);
-  if (task_ptrs_.find(task_name) == task_ptrs_.end()) {
+  ZPBinlogSendTaskShard* shard = TaskShard(task_name);
+  slash::RWLock l(&shard->rwlock, false);
+  if (shard->task_ptrs.find(task_name) == shard->task_ptrs.end()) {
     return false;
   }
   return true;
 }
 
+size_t ZPBinlogSendTaskPool::Size() {
+  size_t size = 0;
+  for (int i = 0; i < shard_num_; i++) {
+    slash::RWLock l(&shards_[i]->rwlock, false);
+    size += shards_[i]->task_ptrs.size();
+  }
+  return size;
+}
+
 // Create and add a new Task
 Status ZPBinlogSendTaskPool::AddNewTask(const std::string &table_name,
     int32_t id, const std::string& binlog_filename, const Node& target,
@@ -263,31 +394,35 @@ Status ZPBinlogSendTaskPool::AddNewTask(const std::string &table_name,
 
 Status ZPBinlogSendTaskPool::AddTask(ZPBinlogSendTask* task) {
   assert(task != NULL);
-  slash::RWLock l(&tasks_rwlock_, true);
-  if (task_ptrs_.find(task->name()) != task_ptrs_.end()) {
+  ZPBinlogSendTaskShard* shard = TaskShard(task->name());
+  slash::RWLock l(&shard->rwlock, true);
+  if (shard->task_ptrs.find(task->name()) != shard->task_ptrs.end()) {
     return Status::Complete("Task already exist");
   }
-  tasks_.push_back(task);
+  shard->tasks.push_back(task);
   // index point to the last one just push back
-  task_ptrs_[task->name()].iter = tasks_.end();
-  --(task_ptrs_[task->name()].iter);
-  task_ptrs_[task->name()].sequence = task->sequence();  // the latest one
-  task_ptrs_[task->name()].filenum_snap = task->filenum();  // current filenum
+  shard->task_ptrs[task->name()].iter = shard->tasks.end();
+  --(shard->task_ptrs[task->name()].iter);
+  shard->task_ptrs[task->name()].sequence
+    = task->sequence();  // the latest one
+  shard->task_ptrs[task->name()].filenum_snap
+    = task->filenum();  // current filenum
   return Status::OK();
 }
 
 Status ZPBinlogSendTaskPool::RemoveTask(const std::string &name) {
-  slash::RWLock l(&tasks_rwlock_, true);
-  ZPBinlogSendTaskIndex::iterator it = task_ptrs_.find(name);
-  if (it == task_ptrs_.end()) {
+  ZPBinlogSendTaskShard* shard = TaskShard(name);
+  slash::RWLock l(&shard->rwlock, true);
+  ZPBinlogSendTaskIndex::iterator it = shard->task_ptrs.find(name);
+  if (it == shard->task_ptrs.end()) {
     return Status::NotFound("Task not exist");
   }
   // Task has been FetchOut should be deleted when Pushback
-  if (it->second.iter != tasks_.end()) {
+  if (it->second.iter != shard->tasks.end()) {
     delete *(it->second.iter);
-    tasks_.erase(it->second.iter);
+    shard->tasks.erase(it->second.iter);
   }
-  task_ptrs_.erase(it);
+  shard->task_ptrs.erase(it);
   return Status::OK();
 }
 
@@ -295,12 +430,13 @@ Status ZPBinlogSendTaskPool::RemoveTask(const std::string &name) {
 // max() when the task is not exist
 // -1 when the task is exist but is processing now
 int32_t ZPBinlogSendTaskPool::TaskFilenum(const std::string &name) {
-  slash::RWLock l(&tasks_rwlock_, false);
-  ZPBinlogSendTaskIndex::iterator it = task_ptrs_.find(name);
-  if (it == task_ptrs_.end()) {
+  ZPBinlogSendTaskShard* shard = TaskShard(name);
+  slash::RWLock l(&shard->rwlock, false);
+  ZPBinlogSendTaskIndex::iterator it = shard->task_ptrs.find(name);
+  if (it == shard->task_ptrs.end()) {
     return std::numeric_limits<int32_t>::max();
   }
-  if (it->second.iter == tasks_.end()) {
+  if (it->second.iter == shard->tasks.end()) {
     // The task is processing by some thread
     // return its snapshot of last time
     return it->second.filenum_snap;
@@ -308,30 +444,40 @@ int32_t ZPBinlogSendTaskPool::TaskFilenum(const std::string &name) {
   return (*(it->second.iter))->filenum();
 }
 
-// Fetch one task out from the front of tasks_ list
-// and live the its ptr point to the tasks_.end()
+// Fetch one task out from the front of one shard task list
+// and live the its ptr point to the tasks end()
 // to distinguish from task has been removed
-Status ZPBinlogSendTaskPool::FetchOut(ZPBinlogSendTask** task_ptr) {
-  slash::RWLock l(&tasks_rwlock_, true);
-  if (tasks_.size() == 0) {
-    return Status::NotFound("No more task");
-  }
-  *task_ptr = tasks_.front();
-  tasks_.pop_front();
-  // Do not remove from the task_ptrs_ map
-  // When the same task put back we need to know it is a old one
-  task_ptrs_[(*task_ptr)->name()].iter = tasks_.end();
-  return Status::OK();
+// Begin with the shard bound to the worker index,
+// steal from the other shards when it is empty,
+// so that an idle worker could pick up lagging tasks
+Status ZPBinlogSendTaskPool::FetchOut(int worker_index,
+    ZPBinlogSendTask** task_ptr) {
+  for (int i = 0; i < shard_num_; i++) {
+    ZPBinlogSendTaskShard* shard
+      = shards_[(worker_index + i) % shard_num_];
+    slash::RWLock l(&shard->rwlock, true);
+    if (shard->tasks.empty()) {
+      continue;
+    }
+    *task_ptr = shard->tasks.front();
+    shard->tasks.pop_front();
+    // Do not remove from the task_ptrs map
+    // When the same task put back we need to know it is a old one
+    shard->task_ptrs[(*task_ptr)->name()].iter = shard->tasks.end();
+    return Status::OK();
+  }
+  return Status::NotFound("No more task");
 }
 
 // PutBack the task who has been FetchOut
 // return NotFound when the task is not exist in index map task_pts_
 // which mean the task has been removed or its not a task fetch out before
 Status ZPBinlogSendTaskPool::PutBack(ZPBinlogSendTask* task) {
-  slash::RWLock l(&tasks_rwlock_, true);
-  ZPBinlogSendTaskIndex::iterator it = task_ptrs_.find(task->name());
-  if (it == task_ptrs_.end()              // task has been removed
-      || it->second.iter != tasks_.end()
+  ZPBinlogSendTaskShard* shard = TaskShard(task->name());
+  slash::RWLock l(&shard->rwlock, true);
+  ZPBinlogSendTaskIndex::iterator it = shard->task_ptrs.find(task->name());
+  if (it == shard->task_ptrs.end()        // task has been removed
+      || it->second.iter != shard->tasks.end()
         || it->second.sequence != task->sequence()) {  // task belong to
                                                        // same partition exist
     LOG(INFO) << "Remove BinlogTask when put back for Table:" << task->name()
@@ -343,29 +489,33 @@ Status ZPBinlogSendTaskPool::PutBack(ZPBinlogSendTask* task) {
     delete task;
     return Status::NotFound("Task may have been deleted");
   }
-  tasks_.push_back(task);
-  it->second.iter = tasks_.end();
+  shard->tasks.push_back(task);
+  it->second.iter = shard->tasks.end();
   --(it->second.iter);
   it->second.filenum_snap = task->filenum();
   return Status::OK();
 }
 
 void ZPBinlogSendTaskPool::Dump() {
-  slash::RWLock l(&tasks_rwlock_, false);
-  ZPBinlogSendTaskIndex::iterator it = task_ptrs_.begin();
-  for (; it != task_ptrs_.end(); ++it) {
-    std::list<ZPBinlogSendTask*>::iterator tptr = it->second.iter;
-    LOG(INFO) << "----------------------------";
-    LOG(INFO) << "+Binlog Send Task" << it->first;
-    LOG(INFO) << "  +Sequence  " << it->second.sequence;
-    if (tptr != tasks_.end()) {
-      LOG(INFO) << "  +filenum " << (*tptr)->filenum();
-      LOG(INFO) << "  +offset " << (*tptr)->offset();
-    } else {
-      LOG(INFO) << "  +filenum " << it->second.filenum_snap;
-      LOG(INFO) << "  +Being occupied";
+  for (int i = 0; i < shard_num_; i++) {
+    ZPBinlogSendTaskShard* shard = shards_[i];
+    slash::RWLock l(&shard->rwlock, false);
+    ZPBinlogSendTaskIndex::iterator it = shard->task_ptrs.begin();
+    for (; it != shard->task_ptrs.end(); ++it) {
+      std::list<ZPBinlogSendTask*>::iterator tptr = it->second.iter;
+      LOG(INFO) << "----------------------------";
+      LOG(INFO) << "+Binlog Send Task" << it->first;
+      LOG(INFO) << "  +Shard  " << i;
+      LOG(INFO) << "  +Sequence  " << it->second.sequence;
+      if (tptr != shard->tasks.end()) {
+        LOG(INFO) << "  +filenum " << (*tptr)->filenum();
+        LOG(INFO) << "  +offset " << (*tptr)->offset();
+      } else {
+        LOG(INFO) << "  +filenum " << it->second.filenum_snap;
+        LOG(INFO) << "  +Being occupied";
+      }
+      LOG(INFO) << "----------------------------";
     }
-    LOG(INFO) << "----------------------------";
   }
 }
 
@@ -373,9 +523,11 @@ void ZPBinlogSendTaskPool::Dump() {
  * ZPBinlogSendThread
  */
 
-ZPBinlogSendThread::ZPBinlogSendThread(ZPBinlogSendTaskPool *pool)
+ZPBinlogSendThread::ZPBinlogSendThread(ZPBinlogSendTaskPool *pool,
+    int worker_index)
   : pink::Thread::Thread(),
-  pool_(pool) {
+  pool_(pool),
+  worker_index_(worker_index) {
     set_thread_name("ZPDataSyncSender");
   }
 
@@ -384,17 +536,28 @@ ZPBinlogSendThread::~ZPBinlogSendThread() {
   LOG(INFO) << "a BinlogSender thread " << thread_id() << " exit!";
   }
 
-// Send LEASE SyncRequest to peer
-bool ZPBinlogSendThread::RenewPeerLease(ZPBinlogSendTask* task) {
+int64_t ZPBinlogSendThread::PeerLeaseTime() {
   // In terms of the most conservative estimation,
   // current task will be fetch out from the pool
-  // and be process again after lease_time
-  int64_t lease_time = (pool_->Size() * kBinlogTimeSlice)
+  // and be process again after lease_time,
+  // where every other task may occupy up to
+  // kBinlogMaxLagSliceFactor slices in a row
+  int64_t lease_time =
+    (pool_->Size() * kBinlogTimeSlice * kBinlogMaxLagSliceFactor)
     / zp_data_server->binlog_sender_count() + kBinlogRedundantLease;
-  if (lease_time < kBinlogMinLease) {
+  if (lease_time < g_zp_conf->sync_lease_min()) {
     // Set lower limit to avoid frequentlly trysync
-    lease_time = kBinlogMinLease;
+    lease_time = g_zp_conf->sync_lease_min();
+  } else if (lease_time > g_zp_conf->sync_lease_max()) {
+    lease_time = g_zp_conf->sync_lease_max();
   }
+  return lease_time;
+}
+
+// Send standalone LEASE SyncRequest to peer,
+// only worth it when no BATCH frame carried the lease recently
+bool ZPBinlogSendThread::RenewPeerLease(ZPBinlogSendTask* task) {
+  int64_t lease_time = PeerLeaseTime();
 
   client::SyncRequest sreq;
   task->BuildLeaseSyncRequest(lease_time, &sreq);
@@ -421,7 +584,7 @@ void* ZPBinlogSendThread::ThreadMain() {
 
   while (!should_stop()) {
     ZPBinlogSendTask* task = NULL;
-    Status s = pool_->FetchOut(&task);
+    Status s = pool_->FetchOut(worker_index_, &task);
     if (!s.ok()) {
       // No task to be processed
       sleep(kBinlogSendInterval);
@@ -437,12 +600,22 @@ void* ZPBinlogSendThread::ThreadMain() {
     }
 
     // Fetched one task, process it
+    // A task lagging behind gets proportionally more consecutive slices,
+    // so that a slave in recovery catches up instead of waiting
+    // one slice per rotation like the caught up ones
+    uint64_t slice_num = 1 + task->FilenumLag();
+    if (slice_num > static_cast<uint64_t>(kBinlogMaxLagSliceFactor)) {
+      slice_num = kBinlogMaxLagSliceFactor;
+    }
+    uint64_t slice_us = slice_num * kBinlogTimeSlice * 1000000;
     Status item_s = Status::OK();
     uint64_t time_begin = slash::NowMicros();
+    // Whether some BATCH frame already carried the lease this slice
+    bool lease_delivered = false;
     while (!should_stop()) {
       if (task->send_next) {
-        // Process ProcessTask
-        item_s = task->ProcessTask();
+        // Coalesce binlog items into one BATCH frame
+        item_s = task->ProcessBatchTask();
         if (item_s.IsEndFile()) {
           RenewPeerLease(task);
         }
@@ -452,12 +625,12 @@ void* ZPBinlogSendThread::ThreadMain() {
           task->renew_process_error_time();
           break;
         }
-        // ProcessTask OK here
+        // ProcessBatchTask OK here
       }
 
       // Construct SyncRequest
       client::SyncRequest sreq;
-      task->BuildCommonSyncRequest(&sreq);
+      task->BuildBatchSyncRequest(PeerLeaseTime(), &sreq);
 
       // Send SyncRequest
       if (!sreq.IsInitialized()) {
@@ -475,7 +648,18 @@ void* ZPBinlogSendThread::ThreadMain() {
         task->send_next = false;
         sleep(kBinlogSendInterval);
       } else {
+        // Read the next frame ahead while this one is on the wire,
+        // only worth a thread when the frame just built hit a
+        // coalesce limit, which means the task is in catch-up
+        std::thread prefetcher;
+        if (task->pending_frame_full()) {
+          prefetcher = std::thread(
+              &ZPBinlogSendTask::PrefetchBatchTask, task);
+        }
         item_s = zp_data_server->SendToPeer(task->node(), sreq);
+        if (prefetcher.joinable()) {
+          prefetcher.join();
+        }
         if (!item_s.ok()) {
           LOG(ERROR) << "Failed to send to peer " << task->node()
             << ", table:" << task->table_name() << ", partition:"
@@ -489,13 +673,16 @@ void* ZPBinlogSendThread::ThreadMain() {
           sleep(kBinlogSendInterval);
         } else {
           task->send_next = true;
+          lease_delivered = true;
         }
       }
 
       // Check if need to switch task
-      if (slash::NowMicros() - time_begin > kBinlogTimeSlice * 1000000) {
+      if (slash::NowMicros() - time_begin > slice_us) {
         // Switch Task
-        RenewPeerLease(task);
+        if (!lease_delivered) {
+          RenewPeerLease(task);
+        }
         pool_->PutBack(task);
         break;
       }
@@ -12,9 +12,12 @@
 // limitations under the License.
 #ifndef SRC_NODE_ZP_BINLOG_SENDER_H_
 #define SRC_NODE_ZP_BINLOG_SENDER_H_
+#include <atomic>
+#include <functional>
 #include <list>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "slash/include/slash_status.h"
 #include "slash/include/slash_mutex.h"
@@ -88,17 +91,21 @@ class ZPBinlogSendTask  {
   uint32_t pre_filenum() const {
     return pre_filenum_;
   }
+  uint32_t FilenumLag() const;
   uint64_t pre_offset() const {
     return pre_offset_;
   }
-  std::string pre_content() const {
-    return pre_content_;
-  }
 
   Status ProcessTask();
+  Status ProcessBatchTask();
+  void PrefetchBatchTask();
+  bool pending_frame_full() const {
+    return pending_frame_full_;
+  }
   void BuildLeaseSyncRequest(int64_t lease_time,
       client::SyncRequest* msg) const;
-  void BuildCommonSyncRequest(client::SyncRequest *msg) const;
+  void BuildBatchSyncRequest(int64_t lease_time,
+      client::SyncRequest *msg) const;
 
  private:
   uint64_t sequence_;
@@ -114,12 +121,29 @@ class ZPBinlogSendTask  {
   // For sending use later
   uint32_t pre_filenum_;
   uint64_t pre_offset_;
-  std::string pre_content_;
+  // Content of the last item, pointing into the mapped binlog file
+  // for the common case, into pre_scratch_ otherwise
+  // Only valid until the next ProcessTask
+  Slice pre_content_;
+  std::string pre_scratch_;
   bool pre_has_content_;
+  // Pending BATCH frame coalesced from the last ProcessBatchTask
+  // Kept here so that the same frame could be resent after PutBack
+  client::SyncRequest pending_frame_;
+  bool pending_frame_full_;  // frame hit a coalesce limit, task lagging
+  // One frame of read ahead, filled by PrefetchBatchTask while the
+  // pending frame is on the wire, handed out by next ProcessBatchTask
+  client::SyncRequest next_frame_;
+  bool next_frame_ready_;
+  bool next_frame_full_;
+  Status FillBatchFrame(client::SyncRequest* frame, bool* full);
   std::string binlog_filename_;  // Name of the binlog file
-  slash::SequentialFile *queue_;
-  BinlogReader *reader_;
+  BinlogMmapReader *reader_;
+  // Whether reader_ points to (filenum_, offset_)
+  // Would be left behind after records were served from the tail cache
+  bool reader_synced_;
   Status Init();
+  Status ResetReader();
   // Record current filenum and offset in the pre one
   // So that we can know where the last binlog item begin
   void RecordPreOffset() {
@@ -131,9 +155,17 @@ class ZPBinlogSendTask  {
 //
 // ZPBinlogSendTaskPool
 //
+// One shard of the pool with its own lock, task list and index,
+// so that send workers on different shards do not contend
+struct ZPBinlogSendTaskShard {
+  pthread_rwlock_t rwlock;
+  std::list<ZPBinlogSendTask*> tasks;
+  ZPBinlogSendTaskIndex task_ptrs;
+};
+
 class ZPBinlogSendTaskPool  {
  public:
-  ZPBinlogSendTaskPool();
+  explicit ZPBinlogSendTaskPool(int shard_num);
   ~ZPBinlogSendTaskPool();
 
   bool TaskExist(const std::string& task_name);
@@ -143,23 +175,26 @@ class ZPBinlogSendTaskPool  {
       uint32_t ifilenum, uint64_t ioffset, bool force);
   Status RemoveTask(const std::string &name);
   int32_t TaskFilenum(const std::string &name);
-  size_t Size() {
-    slash::RWLock l(&tasks_rwlock_, false);
-    return task_ptrs_.size();
-  }
+  size_t Size();
 
   // Use by Task Worker
   // Who Fetchout one task, process it, and then PutBack
-  Status FetchOut(ZPBinlogSendTask** task);
+  // Worker drains the shard bound to its index first,
+  // then steals from the other shards when it runs empty
+  Status FetchOut(int worker_index, ZPBinlogSendTask** task);
   Status PutBack(ZPBinlogSendTask* task);
 
   void Dump();
 
  private:
-  pthread_rwlock_t tasks_rwlock_;
-  uint64_t next_sequence_;  // Give every task a unique sequence
-  ZPBinlogSendTaskIndex task_ptrs_;
-  std::list<ZPBinlogSendTask*> tasks_;
+  int shard_num_;
+  std::vector<ZPBinlogSendTaskShard*> shards_;
+  std::atomic<uint64_t> next_sequence_;  // Give every task a unique sequence
+  // A task always lives in the shard chosen by its name,
+  // so index lookups need only the lock of that shard
+  ZPBinlogSendTaskShard* TaskShard(const std::string& name) {
+    return shards_[std::hash<std::string>()(name) % shard_num_];
+  }
   Status AddTask(ZPBinlogSendTask* task);
 };
 
@@ -168,12 +203,14 @@ class ZPBinlogSendTaskPool  {
  */
 class ZPBinlogSendThread : public pink::Thread  {
  public:
-  explicit ZPBinlogSendThread(ZPBinlogSendTaskPool *pool);
+  ZPBinlogSendThread(ZPBinlogSendTaskPool *pool, int worker_index);
   virtual ~ZPBinlogSendThread();
 
  private:
   ZPBinlogSendTaskPool *pool_;
+  int worker_index_;  // Bind the worker to one shard of the pool
   virtual void* ThreadMain();
+  int64_t PeerLeaseTime();
   bool RenewPeerLease(ZPBinlogSendTask* task);
 };
 
@@ -13,26 +13,113 @@
 // limitations under the License.
 #include "src/node/zp_data_client_conn.h"
 
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <arpa/inet.h>
+
 #include <glog/logging.h>
 #include <memory>
 #include "src/node/zp_data_server.h"
 
 extern ZPDataServer* zp_data_server;
 
+// At most this many framed responses per writev call
+static const int kClientConnRespIovMax = 16;
+// Wait this long (ms) per round for a jammed client to drain,
+// give up and close the conn after kClientConnWriteRetry rounds
+static const int kClientConnWritePollTimeout = 100;
+static const int kClientConnWriteRetry = 100;
+
 ////// ZPDataClientConn ///// /
 ZPDataClientConn::ZPDataClientConn(int fd, std::string ip_port,
     pink::ServerThread* server_thread) :
-  PbConn(fd, ip_port, server_thread) {
+  PbConn(fd, ip_port, server_thread),
+  front_sent_(0) {
 }
 
 ZPDataClientConn::~ZPDataClientConn() {
 }
 
 int ZPDataClientConn::DealMessage() {
-  set_is_reply(true);
-  int s = DealMessageInternal();
-  res_ = &response_;
-  return s;
+  // Reply by ourselves instead of through the reply machinery,
+  // so that the conn goes on parsing the requests a pipelining client
+  // sent ahead, instead of strict request/reply rounds
+  set_is_reply(false);
+  int ret = DealMessageInternal();
+  int fret = QueueResponse();
+  return (ret < 0) ? ret : fret;
+}
+
+// Frame the response with its length header and write it out,
+// coalescing with responses a former partial write left pending
+int ZPDataClientConn::QueueResponse() {
+  std::string buf;
+  buf.resize(sizeof(uint32_t));
+  uint32_t body_len = htonl(response_.ByteSize());
+  memcpy(&buf[0], &body_len, sizeof(uint32_t));
+  if (!response_.AppendToString(&buf)) {
+    LOG(WARNING) << "Failed to serialize client response, conn: "
+      << ip_port();
+    return -1;
+  }
+  pending_resp_.push_back(std::string());
+  pending_resp_.back().swap(buf);
+  return FlushPendingResponses();
+}
+
+int ZPDataClientConn::FlushPendingResponses() {
+  int retry = 0;
+  while (!pending_resp_.empty()) {
+    struct iovec iov[kClientConnRespIovMax];
+    int iov_cnt = 0;
+    std::deque<std::string>::iterator it = pending_resp_.begin();
+    for (; it != pending_resp_.end()
+        && iov_cnt < kClientConnRespIovMax; ++it, ++iov_cnt) {
+      size_t skip = (iov_cnt == 0) ? front_sent_ : 0;
+      iov[iov_cnt].iov_base = const_cast<char*>(it->data()) + skip;
+      iov[iov_cnt].iov_len = it->size() - skip;
+    }
+
+    ssize_t n = writev(fd(), iov, iov_cnt);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        if (++retry > kClientConnWriteRetry) {
+          LOG(WARNING) << "Client stopped draining its responses, conn: "
+            << ip_port();
+          return -1;
+        }
+        // Backpressure: wait the client to drain
+        struct pollfd pfd;
+        pfd.fd = fd();
+        pfd.events = POLLOUT;
+        pfd.revents = 0;
+        poll(&pfd, 1, kClientConnWritePollTimeout);
+        continue;
+      }
+      LOG(WARNING) << "Failed to write client response, conn: "
+        << ip_port() << ", error: " << strerror(errno);
+      return -1;
+    }
+
+    // Consume the written bytes from the front
+    while (n > 0 && !pending_resp_.empty()) {
+      size_t left = pending_resp_.front().size() - front_sent_;
+      if (static_cast<size_t>(n) >= left) {
+        n -= left;
+        front_sent_ = 0;
+        pending_resp_.pop_front();
+      } else {
+        front_sent_ += n;
+        n = 0;
+      }
+    }
+  }
+  return 0;
 }
 
 // Msg is  [ length (int32) | pb_msg (length bytes) ]
@@ -94,7 +181,12 @@ int ZPDataClientConn::DealMessageInternal() {
     return -1;
   }
 
-  partition->DoCommand(cmd, request_, &response_);
+  // Hand the wire bytes down beside the parsed request, a write
+  // command whose binlog record equals the request logs them in
+  // place instead of serializing the big value string again
+  partition->DoCommand(cmd, request_, &response_,
+      slash::Slice(reinterpret_cast<const char*>(
+          rbuf_ + cur_pos_ - header_len_), header_len_));
 
   return 0;
 }
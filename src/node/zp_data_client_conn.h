@@ -14,6 +14,7 @@
 #ifndef SRC_NODE_ZP_DATA_CLIENT_CONN_H_
 #define SRC_NODE_ZP_DATA_CLIENT_CONN_H_
 
+#include <deque>
 #include <string>
 #include "pink/include/pb_conn.h"
 #include "pink/include/pink_thread.h"
@@ -32,8 +33,14 @@ class ZPDataClientConn : public pink::PbConn  {
  private:
   client::CmdRequest request_;
   client::CmdResponse response_;
+  // Responses not yet on the wire, each framed with its length header
+  // Kept in request order so a pipelining client sees ordered replies
+  std::deque<std::string> pending_resp_;
+  size_t front_sent_;  // bytes of the front response already written
 
   int DealMessageInternal();
+  int QueueResponse();
+  int FlushPendingResponses();
 };
 
 class ZPDataClientConnHandle : public pink::ServerHandle  {
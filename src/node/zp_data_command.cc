@@ -14,12 +14,15 @@
 #include "src/node/zp_data_command.h"
 
 #include <glog/logging.h>
+#include <stdint.h>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 #include "slash/include/slash_string.h"
+#include "rocksdb/write_batch.h"
 
 #include "include/db_nemo.h"
+#include "include/zp_compress.h"
 #include "src/node/zp_data_server.h"
 
 extern ZPDataServer *zp_data_server;
@@ -36,13 +39,30 @@ void SetCmd::Do(const google::protobuf::Message *req,
   response->Clear();
   response->set_type(client::Type::SET);
 
+  // A replicated ttl write, marked by expire.base from the sync conn,
+  // stores the very bytes the master shipped; plain replicated writes
+  // go through BatchDo and never reach here. Client values envelope
+  // on ingest: compressed under a codec, and escaped whatever the
+  // codec when they collide with the envelope magic. Otherwise the
+  // value string feeds the DB as a Slice in place and is never copied
+  int codec = g_zp_conf->compress_value();
+  const std::string* value = &request->set().value();
+  std::string enveloped;
+  bool from_sync = request->set().has_expire()
+    && request->set().expire().has_base();
+  if (!from_sync
+      && (codec != kCompressNone || IsCompressedValue(*value))) {
+    enveloped = CompressValue(codec, *value);
+    value = &enveloped;
+  }
+
   rocksdb::Status s;
   if (request->set().has_expire()) {
     int base = 0, ttl = request->set().expire().ttl();
     if (request->set().expire().has_base()) {
       // Come from sync conn
       base = request->set().expire().base();
-      ttl -= (time(NULL) - base);
+      ttl -= (CoarseClock::NowSeconds() - base);
       if (ttl <= 0) {
         // Already expire
         DLOG(INFO) << "Set key(" << request->set().key() << ") at "
@@ -54,12 +74,12 @@ void SetCmd::Do(const google::protobuf::Message *req,
     }
     s = ptr->db()->Put(rocksdb::WriteOptions(),
         request->set().key(),
-        request->set().value(),
+        *value,
         ttl);
   } else {
     s = ptr->db()->Put(rocksdb::WriteOptions(),
         request->set().key(),
-        request->set().value());
+        *value);
   }
 
   if (!s.ok()) {
@@ -79,14 +99,48 @@ bool SetCmd::GenerateLog(const google::protobuf::Message *req,
     std::string* log_raw) const {
   const client::CmdRequest* request =
     static_cast<const client::CmdRequest*>(req);
-  if (request->set().has_expire()) {
+  int codec = g_zp_conf->compress_value();
+  // The binlog ships the stored bytes, so slaves replay the envelope
+  // the master produced instead of repeating the enveloping
+  bool envelope = codec != kCompressNone
+    || IsCompressedValue(request->set().value());
+  if (request->set().has_expire() || envelope) {
     client::CmdRequest log_req(*request);
-    log_req.mutable_set()->mutable_expire()->set_base(time(NULL));
+    if (request->set().has_expire()) {
+      log_req.mutable_set()->mutable_expire()->set_base(CoarseClock::NowSeconds());
+    }
+    if (envelope) {
+      log_req.mutable_set()->set_value(
+          CompressValue(codec, request->set().value()));
+    }
     return log_req.SerializeToString(log_raw);
   }
   return request->SerializeToString(log_raw);
 }
 
+bool SetCmd::LogReusesRequest(
+    const google::protobuf::Message *req) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  return !request->set().has_expire()
+    && g_zp_conf->compress_value() == kCompressNone
+    && !IsCompressedValue(request->set().value());
+}
+
+bool SetCmd::BatchDo(const google::protobuf::Message *req,
+    rocksdb::WriteBatch* batch) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  if (request->set().has_expire()) {
+    // A record with its own ttl could not share the batch
+    return false;
+  }
+  // Only the sync path batches, the value was already enveloped by
+  // the master and goes in verbatim
+  batch->Put(request->set().key(), request->set().value());
+  return true;
+}
+
 void GetCmd::Do(const google::protobuf::Message *req,
     google::protobuf::Message *res, void* partition) const {
   const client::CmdRequest* request =
@@ -103,11 +157,20 @@ void GetCmd::Do(const google::protobuf::Message *req,
       request->get().key(),
       &value);
   if (s.ok()) {
+    std::string raw;
+    if (!DecompressValue(value, &raw)) {
+      response->set_code(client::StatusCode::kError);
+      response->set_msg("corrupt compressed value");
+      LOG(WARNING) << "command failed: Get key(" << request->get().key()
+        << ") at " << ptr->table_name() << "_" << ptr->partition_id()
+        << ", caz corrupt compressed value";
+      return;
+    }
     response->set_code(client::StatusCode::kOk);
-    get_res->set_value(value);
+    get_res->set_value(raw);
     DLOG(INFO) << "Get key(" << request->get().key()
       << ") at " << ptr->table_name() << "_" << ptr->partition_id()
-      << " ok, value is (" << value << ")";
+      << " ok, value is (" << raw << ")";
   } else if (s.IsNotFound()) {
     response->set_code(client::StatusCode::kNotFound);
     DLOG(INFO) << "Get key(" << request->get().key()
@@ -149,54 +212,375 @@ void DelCmd::Do(const google::protobuf::Message *req,
   }
 }
 
+bool DelCmd::BatchDo(const google::protobuf::Message *req,
+    rocksdb::WriteBatch* batch) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  batch->Delete(request->del().key());
+  return true;
+}
+
+void CasCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  Partition* ptr = static_cast<Partition*>(partition);
+
+  response->Clear();
+  response->set_type(client::Type::CAS);
+
+  // Safe to read then write, DoCommand holds the key lock for us
+  std::string current;
+  rocksdb::Status s = ptr->db()->Get(rocksdb::ReadOptions(),
+      request->cas().key(),
+      &current);
+  if (!s.ok() && !s.IsNotFound()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(WARNING) << "command failed: Cas key(" << request->cas().key()
+      << ") at " << ptr->table_name() << "_" << ptr->partition_id()
+      << ", caz:" << s.ToString();
+    return;
+  }
+
+  std::string raw;
+  if (s.IsNotFound()) {
+    if (request->cas().has_expect()) {
+      // Expect some value but the key is gone
+      response->set_code(client::StatusCode::kNotFound);
+      DLOG(INFO) << "Cas key(" << request->cas().key()
+        << ") at " << ptr->table_name() << "_"
+        << ptr->partition_id() << " not found!";
+      return;
+    }
+  } else if (!DecompressValue(current, &raw)) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("corrupt compressed value");
+    LOG(WARNING) << "command failed: Cas key(" << request->cas().key()
+      << ") at " << ptr->table_name() << "_" << ptr->partition_id()
+      << ", caz corrupt compressed value";
+    return;
+  } else if (!request->cas().has_expect()
+      || raw != request->cas().expect()) {
+    // Kick back the winner's value so the client could retry on it
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("cas mismatch");
+    response->mutable_cas()->set_value(raw);
+    DLOG(INFO) << "Cas key(" << request->cas().key() << ") at "
+      << ptr->table_name() << "_" << ptr->partition_id() << " mismatch";
+    return;
+  }
+
+  s = ptr->db()->Put(rocksdb::WriteOptions(),
+      request->cas().key(),
+      CompressValue(g_zp_conf->compress_value(), request->cas().value()));
+  if (!s.ok()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(WARNING) << "command failed: Cas key(" << request->cas().key()
+      << ") at " << ptr->table_name() << "_" << ptr->partition_id()
+      << ", caz:" << s.ToString();
+  } else {
+    response->set_code(client::StatusCode::kOk);
+    DLOG(INFO) << "Cas key(" << request->cas().key() << ") at "
+      << ptr->table_name() << "_" << ptr->partition_id() << " ok";
+  }
+}
+
+void IncrbyCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  Partition* ptr = static_cast<Partition*>(partition);
+
+  response->Clear();
+  response->set_type(client::Type::INCRBY);
+
+  // Safe to read then write, DoCommand holds the key lock for us
+  std::string current;
+  long value = 0;
+  rocksdb::Status s = ptr->db()->Get(rocksdb::ReadOptions(),
+      request->incrby().key(),
+      &current);
+  if (s.ok()) {
+    if (!slash::string2l(current.data(), current.size(), &value)) {
+      response->set_code(client::StatusCode::kError);
+      response->set_msg("value is not an integer");
+      return;
+    }
+  } else if (!s.IsNotFound()) {
+    // A missing key counts from 0, anything else is fatal
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(WARNING) << "command failed: Incrby key(" << request->incrby().key()
+      << ") at " << ptr->table_name() << "_" << ptr->partition_id()
+      << ", caz:" << s.ToString();
+    return;
+  }
+
+  int64_t by = request->incrby().by();
+  if ((by > 0 && value > INT64_MAX - by)
+      || (by < 0 && value < INT64_MIN - by)) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg("increment or decrement would overflow");
+    return;
+  }
+  value += by;
+
+  s = ptr->db()->Put(rocksdb::WriteOptions(),
+      request->incrby().key(),
+      std::to_string(value));
+  if (!s.ok()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(s.ToString());
+    LOG(WARNING) << "command failed: Incrby key(" << request->incrby().key()
+      << ") at " << ptr->table_name() << "_" << ptr->partition_id()
+      << ", caz:" << s.ToString();
+  } else {
+    response->set_code(client::StatusCode::kOk);
+    response->mutable_incrby()->set_value(value);
+    DLOG(INFO) << "Incrby key(" << request->incrby().key() << ") at "
+      << ptr->table_name() << "_" << ptr->partition_id()
+      << " ok, value is (" << value << ")";
+  }
+}
+
 void MgetCmd::Do(const google::protobuf::Message *req,
-    google::protobuf::Message *res, void* ptr) const {
+    google::protobuf::Message *res, void* partition) const {
   const client::CmdRequest* request =
     static_cast<const client::CmdRequest*>(req);
   client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+
   response->Clear();
   response->set_type(client::Type::MGET);
 
-  // One error all error
-  Cmd* sub_cmd = zp_data_server->CmdGet(client::Type::GET);
-  client::CmdRequest sub_req;
-  sub_req.set_type(client::Type::GET);
-  client::CmdResponse sub_res;
-  sub_res.set_type(client::Type::GET);
+  if (partition != NULL) {
+    // Partition scoped batch, all keys belong to me,
+    // read them out in one MultiGet
+    Partition* ptr = static_cast<Partition*>(partition);
+    std::vector<rocksdb::Slice> keys;
+    for (auto& key : request->mget().keys()) {
+      keys.push_back(rocksdb::Slice(key));
+    }
+    std::vector<std::string> values;
+    std::vector<rocksdb::Status> ss = ptr->db()->MultiGet(
+        rocksdb::ReadOptions(), keys, &values);
+    for (size_t i = 0; i < ss.size(); i++) {
+      if (!ss[i].ok() && !ss[i].IsNotFound()) {
+        response->clear_mget();
+        response->set_code(client::StatusCode::kError);
+        response->set_msg(ss[i].ToString());
+        LOG(WARNING) << "command failed: Mget key("
+          << request->mget().keys(i) << ") at "
+          << ptr->table_name() << "_" << ptr->partition_id()
+          << ", caz " << ss[i].ToString();
+        return;
+      }
+      client::CmdResponse_Mget* mget = response->add_mget();
+      mget->set_key(request->mget().keys(i));
+      if (ss[i].ok()) {
+        std::string raw;
+        if (!DecompressValue(values[i], &raw)) {
+          response->clear_mget();
+          response->set_code(client::StatusCode::kError);
+          response->set_msg("corrupt compressed value");
+          LOG(WARNING) << "command failed: Mget key("
+            << request->mget().keys(i) << ") at "
+            << ptr->table_name() << "_" << ptr->partition_id()
+            << ", caz corrupt compressed value";
+          return;
+        }
+        mget->set_value(raw);
+      } else {
+        mget->set_value("");
+      }
+    }
+    DLOG(INFO) << "Mget " << request->mget().keys_size() << " keys at "
+      << ptr->table_name() << "_" << ptr->partition_id() << " ok";
+    response->set_code(client::StatusCode::kOk);
+    return;
+  }
+
+  // Group keys by partition once, then execute one sub command
+  // per partition which fetches all its keys in a single MultiGet
+  std::unordered_map<int, std::shared_ptr<Partition>> partitions;
+  std::unordered_map<int, client::CmdRequest> sub_reqs;
   for (auto& key : request->mget().keys()) {
-    std::shared_ptr<Partition> partition = zp_data_server->GetTablePartition(
+    std::shared_ptr<Partition> ptr = zp_data_server->GetTablePartition(
         request->mget().table_name(), key);
-    if (partition == NULL) {
+    if (ptr == NULL) {
       LOG(WARNING) << "command failed: Mget, no partition for key:" << key;
       response->set_code(client::StatusCode::kError);
       response->set_msg("no partition" + key);
       return;
     }
+    int id = ptr->partition_id();
+    if (sub_reqs.find(id) == sub_reqs.end()) {
+      partitions[id] = ptr;
+      sub_reqs[id].set_type(client::Type::MGET);
+      sub_reqs[id].mutable_mget()->set_table_name(
+          request->mget().table_name());
+    }
+    sub_reqs[id].mutable_mget()->add_keys(key);
+  }
 
-    // convert to multi sub command, then execute
-    sub_req.Clear();
+  // One error all error
+  std::unordered_map<std::string, std::string> values;
+  // Reuse one sub response per worker thread across requests
+  static __thread client::CmdResponse* sub_res_ptr = NULL;
+  if (sub_res_ptr == NULL) {
+    sub_res_ptr = new client::CmdResponse();
+  }
+  client::CmdResponse& sub_res = *sub_res_ptr;
+  for (auto& sub_req : sub_reqs) {
     sub_res.Clear();
-    client::CmdRequest_Get* get = sub_req.mutable_get();
-    get->set_table_name(request->mget().table_name());
-    get->set_key(key);
-    partition->DoCommand(sub_cmd, sub_req, &sub_res);
-    if (sub_res.code() != client::StatusCode::kOk
-        && sub_res.code() != client::StatusCode::kNotFound) {
+    partitions[sub_req.first]->DoCommand(this, sub_req.second, &sub_res);
+    if (sub_res.code() != client::StatusCode::kOk) {
       response->set_code(sub_res.code());
       response->set_msg(sub_res.msg());
+      if (sub_res.has_redirect()) {
+        response->mutable_redirect()->CopyFrom(sub_res.redirect());
+      }
       return;
     }
+    for (auto& mget : sub_res.mget()) {
+      values[mget.key()] = mget.value();
+    }
+  }
+
+  // Reply in request order
+  for (auto& key : request->mget().keys()) {
     client::CmdResponse_Mget* mget = response->add_mget();
     mget->set_key(key);
-    if (sub_res.code() == client::StatusCode::kOk) {
-      mget->set_value(sub_res.get().value());
+    mget->set_value(values[key]);
+  }
+  response->set_code(client::StatusCode::kOk);
+}
+
+void MsetCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+
+  response->Clear();
+  response->set_type(client::Type::MSET);
+
+  if (partition != NULL) {
+    // Partition scoped batch, all keys belong to me,
+    // write them down in one batch
+    Partition* ptr = static_cast<Partition*>(partition);
+    rocksdb::WriteBatch batch;
+    int codec = g_zp_conf->compress_value();
+    for (auto& kv : request->mset().kvs()) {
+      batch.Put(kv.key(), CompressValue(codec, kv.value()));
+    }
+    rocksdb::Status s = ptr->db()->Write(rocksdb::WriteOptions(), &batch);
+    if (!s.ok()) {
+      response->set_code(client::StatusCode::kError);
+      response->set_msg(s.ToString());
+      LOG(WARNING) << "command failed: Mset " << request->mset().kvs_size()
+        << " keys at " << ptr->table_name() << "_" << ptr->partition_id()
+        << ", caz:" << s.ToString();
     } else {
-      mget->set_value("");
+      response->set_code(client::StatusCode::kOk);
+      DLOG(INFO) << "Mset " << request->mset().kvs_size() << " keys at "
+        << ptr->table_name() << "_" << ptr->partition_id() << " ok";
+    }
+    return;
+  }
+
+  // Group keys by partition, then execute one sub command per partition,
+  // so that every partition writes and binlogs its keys in a single batch
+  std::unordered_map<int, std::shared_ptr<Partition>> partitions;
+  std::unordered_map<int, client::CmdRequest> sub_reqs;
+  for (auto& kv : request->mset().kvs()) {
+    std::shared_ptr<Partition> ptr = zp_data_server->GetTablePartition(
+        request->mset().table_name(), kv.key());
+    if (ptr == NULL) {
+      LOG(WARNING) << "command failed: Mset, no partition for key:"
+        << kv.key();
+      response->set_code(client::StatusCode::kError);
+      response->set_msg("no partition" + kv.key());
+      return;
+    }
+    int id = ptr->partition_id();
+    if (sub_reqs.find(id) == sub_reqs.end()) {
+      partitions[id] = ptr;
+      sub_reqs[id].set_type(client::Type::MSET);
+      sub_reqs[id].mutable_mset()->set_table_name(
+          request->mset().table_name());
+    }
+    sub_reqs[id].mutable_mset()->add_kvs()->CopyFrom(kv);
+  }
+
+  // One error all error
+  // Reuse one sub response per worker thread across requests
+  static __thread client::CmdResponse* sub_res_ptr = NULL;
+  if (sub_res_ptr == NULL) {
+    sub_res_ptr = new client::CmdResponse();
+  }
+  client::CmdResponse& sub_res = *sub_res_ptr;
+  for (auto& sub_req : sub_reqs) {
+    sub_res.Clear();
+    partitions[sub_req.first]->DoCommand(this, sub_req.second, &sub_res);
+    if (sub_res.code() != client::StatusCode::kOk) {
+      response->set_code(sub_res.code());
+      response->set_msg(sub_res.msg());
+      if (sub_res.has_redirect()) {
+        response->mutable_redirect()->CopyFrom(sub_res.redirect());
+      }
+      return;
     }
   }
   response->set_code(client::StatusCode::kOk);
 }
 
+bool MsetCmd::GenerateLog(const google::protobuf::Message *req,
+    std::string* log_raw) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  int codec = g_zp_conf->compress_value();
+  if (LogReusesRequest(request)) {
+    return request->SerializeToString(log_raw);
+  }
+  client::CmdRequest log_req(*request);
+  for (int i = 0; i < log_req.mset().kvs_size(); i++) {
+    client::Kv* kv = log_req.mutable_mset()->mutable_kvs(i);
+    kv->set_value(CompressValue(codec, kv->value()));
+  }
+  return log_req.SerializeToString(log_raw);
+}
+
+bool MsetCmd::LogReusesRequest(
+    const google::protobuf::Message *req) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  if (g_zp_conf->compress_value() != kCompressNone) {
+    return false;
+  }
+  // Any member value colliding with the envelope magic gets escaped
+  // on ingest, the binlog then has to ship the escaped bytes
+  for (auto& kv : request->mset().kvs()) {
+    if (IsCompressedValue(kv.value())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool MsetCmd::BatchDo(const google::protobuf::Message *req,
+    rocksdb::WriteBatch* batch) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  for (auto& kv : request->mset().kvs()) {
+    batch->Put(kv.key(), kv.value());
+  }
+  return true;
+}
+
 void InfoCmd::Do(const google::protobuf::Message *req,
     google::protobuf::Message *res, void* p) const {
   const client::CmdRequest* request =
@@ -264,6 +648,20 @@ void InfoCmd::Do(const google::protobuf::Message *req,
       response->mutable_info_server()->CopyFrom(info_server);
       break;
     }
+    case client::Type::INFOLATENCY: {
+      response->set_type(client::Type::INFOLATENCY);
+      zp_data_server->GetLatencyInfo(response);
+      DLOG(INFO) << "InfoLatency with " << response->info_latency_size()
+        << " command types total";
+      break;
+    }
+    case client::Type::INFOSLOWLOG: {
+      response->set_type(client::Type::INFOSLOWLOG);
+      zp_data_server->GetSlowlogInfo(response);
+      DLOG(INFO) << "InfoSlowlog with " << response->info_slowlog_size()
+        << " slow requests total";
+      break;
+    }
     default: {
       response->set_code(client::StatusCode::kError);
       response->set_msg("unsupported cmd type");
@@ -386,3 +784,80 @@ void FlushDBCmd::Do(const google::protobuf::Message *req,
       << ptr->table_name() << "_" << ptr->partition_id();
   }
 }
+
+// Chunk caps used when the client does not provide its own
+const int32_t kScanDefaultLimit = 1000;
+const int64_t kScanDefaultMaxBytes = 1024 * 1024;  // 1M
+
+void ScanCmd::Do(const google::protobuf::Message *req,
+    google::protobuf::Message *res, void* partition) const {
+  const client::CmdRequest* request =
+    static_cast<const client::CmdRequest*>(req);
+  client::CmdResponse* response = static_cast<client::CmdResponse*>(res);
+  Partition* ptr = static_cast<Partition*>(partition);
+
+  response->Clear();
+  client::CmdResponse_Scan* scan_res = response->mutable_scan();
+  response->set_type(client::Type::SCAN);
+
+  int32_t limit = kScanDefaultLimit;
+  if (request->scan().has_limit() && request->scan().limit() > 0) {
+    limit = request->scan().limit();
+  }
+  int64_t max_bytes = kScanDefaultMaxBytes;
+  if (request->scan().has_max_bytes() && request->scan().max_bytes() > 0) {
+    max_bytes = request->scan().max_bytes();
+  }
+
+  // The iterator pins a snapshot, so one chunk never mixes versions.
+  // Skip the cache fill, a scan would otherwise evict the hot read set
+  rocksdb::ReadOptions options;
+  options.fill_cache = false;
+  rocksdb::Iterator* it = ptr->db()->NewIterator(options);
+  if (request->scan().has_key_start()) {
+    it->Seek(request->scan().key_start());
+  } else {
+    it->SeekToFirst();
+  }
+
+  int32_t count = 0;
+  int64_t bytes = 0;
+  for (; it->Valid(); it->Next()) {
+    if (count >= limit || bytes >= max_bytes) {
+      // More records left, hand out the cursor for the next chunk
+      scan_res->set_next_key(it->key().ToString());
+      break;
+    }
+    std::string raw;
+    if (!DecompressValue(it->value().ToString(), &raw)) {
+      response->set_code(client::StatusCode::kError);
+      response->set_msg("corrupt compressed value");
+      LOG(WARNING) << "command failed: Scan at "
+        << ptr->table_name() << "_" << ptr->partition_id()
+        << " key(" << it->key().ToString()
+        << "), caz corrupt compressed value";
+      delete it;
+      return;
+    }
+    client::Kv* kv = scan_res->add_kvs();
+    kv->set_key(it->key().ToString());
+    kv->set_value(raw);
+    count++;
+    bytes += it->key().size() + raw.size();
+  }
+
+  if (!it->status().ok()) {
+    response->set_code(client::StatusCode::kError);
+    response->set_msg(it->status().ToString());
+    LOG(WARNING) << "command failed: Scan at "
+      << ptr->table_name() << "_" << ptr->partition_id()
+      << " from key(" << request->scan().key_start()
+      << "), caz " << it->status().ToString();
+  } else {
+    response->set_code(client::StatusCode::kOk);
+    DLOG(INFO) << "Scan at " << ptr->table_name()
+      << "_" << ptr->partition_id() << " return " << count
+      << " records, " << (scan_res->has_next_key() ? "more left" : "exhausted");
+  }
+  delete it;
+}
@@ -28,6 +28,10 @@ class SetCmd : public Cmd  {
       google::protobuf::Message *res, void* partition) const;
   virtual bool GenerateLog(const google::protobuf::Message *request,
       std::string* raw) const;
+  virtual bool LogReusesRequest(
+      const google::protobuf::Message *request) const;
+  virtual bool BatchDo(const google::protobuf::Message *req,
+      rocksdb::WriteBatch* batch) const;
   virtual std::string ExtractTable(const google::protobuf::Message *req) const {
     const client::CmdRequest* request =
       static_cast<const client::CmdRequest*>(req);
@@ -58,6 +62,11 @@ class GetCmd : public Cmd  {
       static_cast<const client::CmdRequest*>(req);
     return request->get().key();
   }
+  virtual bool AllowStaleRead(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    return request->get().allow_stale();
+  }
 };
 
 class DelCmd : public Cmd  {
@@ -68,6 +77,8 @@ class DelCmd : public Cmd  {
   }
   virtual void Do(const google::protobuf::Message *req,
       google::protobuf::Message *res, void* partition) const;
+  virtual bool BatchDo(const google::protobuf::Message *req,
+      rocksdb::WriteBatch* batch) const;
   virtual std::string ExtractTable(const google::protobuf::Message *req) const {
     const client::CmdRequest* request =
       static_cast<const client::CmdRequest*>(req);
@@ -80,6 +91,46 @@ class DelCmd : public Cmd  {
   }
 };
 
+class CasCmd : public Cmd  {
+ public:
+  explicit CasCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const {
+    return "Cas";
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition) const;
+  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    return request->cas().table_name();
+  }
+  virtual std::string ExtractKey(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    return request->cas().key();
+  }
+};
+
+class IncrbyCmd : public Cmd  {
+ public:
+  explicit IncrbyCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const {
+    return "Incrby";
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition) const;
+  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    return request->incrby().table_name();
+  }
+  virtual std::string ExtractKey(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    return request->incrby().key();
+  }
+};
+
 ////// Info Cmds //// /
 class InfoCmd : public Cmd  {
  public:
@@ -135,6 +186,43 @@ class MgetCmd : public Cmd  {
   }
 };
 
+class MsetCmd : public Cmd  {
+ public:
+  explicit MsetCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const {
+    return "Mset";
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition) const;
+  virtual bool GenerateLog(const google::protobuf::Message *request,
+      std::string* raw) const;
+  virtual bool LogReusesRequest(
+      const google::protobuf::Message *request) const;
+  virtual bool BatchDo(const google::protobuf::Message *req,
+      rocksdb::WriteBatch* batch) const;
+  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    return request->mset().table_name();
+  }
+  virtual std::string ExtractKey(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    if (request->mset().kvs_size() > 0) {
+      return request->mset().kvs(0).key();
+    }
+    return "";
+  }
+  virtual void ExtractAllKeys(const google::protobuf::Message *req,
+      std::vector<std::string>* keys) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    for (int i = 0; i < request->mset().kvs_size(); i++) {
+      keys->push_back(request->mset().kvs(i).key());
+    }
+  }
+};
+
 class FlushDBCmd : public Cmd  {
  public:
   explicit FlushDBCmd(int flag) : Cmd(flag) {}
@@ -155,4 +243,24 @@ class FlushDBCmd : public Cmd  {
   }
 };
 
+class ScanCmd : public Cmd  {
+ public:
+  explicit ScanCmd(int flag) : Cmd(flag) {}
+  virtual std::string name() const {
+    return "Scan";
+  }
+  virtual void Do(const google::protobuf::Message *req,
+      google::protobuf::Message *res, void* partition) const;
+  virtual std::string ExtractTable(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    return request->scan().table_name();
+  }
+  virtual int ExtractPartition(const google::protobuf::Message *req) const {
+    const client::CmdRequest* request =
+      static_cast<const client::CmdRequest*>(req);
+    return request->scan().partition_id();
+  }
+};
+
 #endif  // SRC_NODE_ZP_DATA_COMMAND_H_
@@ -15,15 +15,26 @@
 
 #include <unistd.h>
 #include <pthread.h>
+#include <zlib.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <fstream>
+#include <thread>
 #include <utility>
 
-#include "slash/include/rsync.h"
+#include "rocksdb/table.h"
+#include "rocksdb/filter_policy.h"
+#include "rocksdb/write_batch.h"
 #include "src/node/zp_data_server.h"
+#include "src/node/zp_dbsync_channel.h"
+
+// Sealed binlogs get gzip-compressed into this subdir of the
+// partition log path when purge would otherwise drop them
+static const std::string kArchiveSubDir = "archive/";
+static const std::string kArchiveSuffix = ".gz";
 
 extern ZPDataServer* zp_data_server;
 
@@ -41,6 +52,11 @@ struct PurgeArg {
   bool manual;
 };
 
+// Owns only a path, the partition may be gone when the task runs
+struct ReclaimArg {
+  std::string path;
+};
+
 Partition::Partition(const std::string& table_name, const int partition_id,
     const std::string& log_path, const std::string& data_path,
     const std::string& trash_path)
@@ -55,8 +71,12 @@ Partition::Partition(const std::string& table_name, const int partition_id,
   last_sync_time_(slash::NowMicros()),
   sync_lease_(kBinlogDefaultLease),
   stuck_recover_sync_flag_(0),
+  master_rtt_us_(0),
+  last_recover_time_(0),
+  cron_pending_(false),
   purging_(false),
-  purged_index_(0) {
+  purged_index_(0),
+  ack_cond_(&ack_mu_) {
     // Partition related path
     log_path_ = NewPartitionPath(log_path, partition_id_);
     data_path_ = NewPartitionPath(data_path, partition_id_);
@@ -78,6 +98,47 @@ Partition::Partition(const std::string& table_name, const int partition_id,
     pthread_rwlock_init(&fallback_rw_, &attr);
   }
 
+static rocksdb::CompressionType CompressionTypeByName(
+    const std::string& name) {
+  if (name == "snappy") {
+    return rocksdb::kSnappyCompression;
+  } else if (name == "zlib") {
+    return rocksdb::kZlibCompression;
+  }
+  return rocksdb::kNoCompression;
+}
+
+// Node-wide options with the per table overlay from meta applied,
+// absent overlay fields keep the node defaults
+rocksdb::Options Partition::OpenOptions() const {
+  rocksdb::Options options = *(zp_data_server->db_options());
+  if (table_options_.has_bloom_filter_bits()
+      || table_options_.has_block_size()) {
+    // Rebuild the table factory for this table,
+    // the block cache stays the node-wide shared one
+    rocksdb::BlockBasedTableOptions table_options;
+    table_options.block_cache = zp_data_server->db_block_cache();
+    table_options.block_size = (table_options_.has_block_size()
+        ? table_options_.block_size()
+        : g_zp_conf->db_block_size()) * 1024;
+    if (table_options_.bloom_filter_bits() > 0) {
+      table_options.filter_policy.reset(
+          rocksdb::NewBloomFilterPolicy(
+            table_options_.bloom_filter_bits(), false));
+    }
+    options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  }
+  if (table_options_.compression_per_level_size() > 0) {
+    // Rocksdb repeats the last entry for the deeper levels
+    options.compression_per_level.clear();
+    for (int i = 0; i < table_options_.compression_per_level_size(); i++) {
+      options.compression_per_level.push_back(
+          CompressionTypeByName(table_options_.compression_per_level(i)));
+    }
+  }
+  return options;
+}
+
 // Requeired: hold write lock of state_rw_
 Status Partition::Open() {
   if (opened_) {
@@ -93,7 +154,7 @@ Status Partition::Open() {
   }
 
   // Create db handle
-  rocksdb::Status rs = rocksdb::DBNemo::Open(*(zp_data_server->db_options()),
+  rocksdb::Status rs = rocksdb::DBNemo::Open(OpenOptions(),
       data_path_, &db_);
   if (!rs.ok()) {
     LOG(FATAL) << "DBNemo open failed. table: " << table_name_
@@ -134,18 +195,65 @@ void Partition::MoveToTrash() {
     return;
   }
 
-  // Move data and log to Trash
-  std::string db_trash(trash_path_ + "db/"), log_trash(trash_path_ + "log/");
-  slash::DeleteDirIfExist(db_trash);
-  if (0 != slash::RenameFile(data_path_.c_str(),
-        db_trash.c_str())) {
-    LOG(WARNING) << "Failed to move db to trash, error: " << strerror(errno);
+  // Move data and log to Trash, reclaimed in background
+  MoveAsideToTrash(data_path_, "db");
+  MoveAsideToTrash(log_path_, "log");
+}
+
+// Rename path to an unique name under trash and schedule its erase
+// on a bgpurge worker, the rename is cheap so callers could hold
+// state_rw_ or suspend_rw_ without stalling the partition
+std::string Partition::MoveAsideToTrash(const std::string& path,
+    const std::string& prefix) {
+  std::string trash(trash_path_ + prefix + "."
+      + std::to_string(slash::NowMicros()));
+  if (0 != slash::RenameFile(path.c_str(), trash.c_str())) {
+    LOG(WARNING) << "Failed to move " << path << " to trash, error: "
+      << strerror(errno);
+    return std::string();
+  }
+  ReclaimArg* arg = new ReclaimArg();
+  arg->path = trash;
+  zp_data_server->BGPurgeTaskSchedule(&DoReclaimTrash,
+      static_cast<void*>(arg), partition_id_);
+  return trash;
+}
+
+void Partition::DoReclaimTrash(void* arg) {
+  ReclaimArg* reclaim = static_cast<ReclaimArg*>(arg);
+  uint64_t start_us = slash::NowMicros();
+  ReclaimTrash(reclaim->path);
+  LOG(INFO) << "Reclaimed trash: " << reclaim->path
+    << ", in " << (slash::NowMicros() - start_us) / 1000 << " ms";
+  delete reclaim;
+}
+
+// Erase one moved-aside directory file by file,
+// paced by kTrashReclaimSpeedLimit to leave disk bandwidth
+// for the serving DBs besides
+void Partition::ReclaimTrash(const std::string& path) {
+  std::vector<std::string> children;
+  if (0 != slash::GetChildren(path, children)) {
+    LOG(WARNING) << "Failed to list trash dir: " << path
+      << ", error: " << strerror(errno);
+    return;
   }
-  slash::DeleteDirIfExist(log_trash);
-  if (0 != slash::RenameFile(log_path_.c_str(),
-        log_trash.c_str())) {
-    LOG(WARNING) << "Failed to move db to trash, error: " << strerror(errno);
+  for (auto& child : children) {
+    std::string full = path + "/" + child;
+    if (0 == slash::IsDir(full)) {
+      ReclaimTrash(full);
+      continue;
+    }
+    struct stat st;
+    uint64_t file_size = (0 == stat(full.c_str(), &st)) ? st.st_size : 0;
+    slash::DeleteFile(full);
+    uint64_t sleep_us = file_size
+      / (kTrashReclaimSpeedLimit * 1024 * 1024 / 1000000);
+    if (sleep_us > 0) {
+      usleep(sleep_us);
+    }
   }
+  slash::DeleteDirIfExist(path);
 }
 
 Partition::~Partition() {
@@ -170,6 +278,7 @@ void Partition::SetWaitDBSync() {
   slash::RWLock l(&state_rw_, true);
   assert(ReplState::kShouldConnect == repl_state_);
   repl_state_ = ReplState::kWaitDBSync;
+  RefreshStateSnapshot();
 }
 
 void Partition::WaitDBSyncDone() {
@@ -179,6 +288,7 @@ void Partition::WaitDBSyncDone() {
   LOG(INFO) << "Partition: " << table_name_ << "_" << partition_id_
     << " WaitDBSyncDone  set repl_state: " << ReplStateMsg[repl_state_]
     << " Master Node:" << master_node_.ip << ":" << master_node_.port;
+  RefreshStateSnapshot();
 }
 
 bool Partition::ShouldTrySync() {
@@ -197,18 +307,20 @@ void Partition::TrySyncDone() {
   LOG(INFO) << " Partition: " << table_name_ << "_" << partition_id_
     << " TrySyncDone  set repl_state: " << ReplStateMsg[repl_state_]
     <<", Master Node:" << master_node_.ip << ":" << master_node_.port;
+  RefreshStateSnapshot();
 }
 
 // Required: hold write mutex of state_rw_ or write mutex of suspend_rw_
 // as to block any other operation
 Status Partition::ChangeDb(const std::string& new_path) {
-  std::string tmp_path(trash_path_ + "obsolete");
-  slash::DeleteDirIfExist(tmp_path);
-  DLOG(INFO) << "Prepare change db from: " << tmp_path;
+  DLOG(INFO) << "Prepare change db from: " << data_path_;
   delete db_;
-  if (0 != slash::RenameFile(data_path_, tmp_path)) {
+  // Unique name per change, the one of a previous change
+  // may still be reclaiming in background
+  std::string tmp_path = MoveAsideToTrash(data_path_, "obsolete");
+  if (tmp_path.empty()) {
     LOG(FATAL) << "Failed to rename db path: " << data_path_
-      << " to tmp path " << tmp_path << " when change db, table: "
+      << " to trash when change db, table: "
       << table_name_ << "_" << partition_id_
       << ", error: " << strerror(errno);
     return Status::Corruption(strerror(errno));
@@ -222,7 +334,11 @@ Status Partition::ChangeDb(const std::string& new_path) {
       << ", error: " << strerror(errno);
     return Status::Corruption(strerror(errno));
   }
-  rocksdb::Status s = rocksdb::DBNemo::Open(*(zp_data_server->db_options()),
+  // Dumps of the replaced db could collide with new file names,
+  // never inherit across a db change
+  slash::DeleteDirIfExist(bgsave_path_);
+
+  rocksdb::Status s = rocksdb::DBNemo::Open(OpenOptions(),
       data_path_, &db_);
   if (!s.ok()) {
     LOG(FATAL) << "Failed to open new db: " << data_path_
@@ -260,10 +376,34 @@ bool Partition::InitBgsaveEnv() {
       localtime(&bgsave_info_.start_time));
   bgsave_info_.s_start_time.assign(s_time, len);
   bgsave_info_.path = bgsave_path_;
-  if (!slash::DeleteDirIfExist(bgsave_info_.path)) {
-    LOG(WARNING) << "Remove exist bgsave dir failed, Partition:"
+  // Keep the newest previous dump around as "prev",
+  // its unchanged SSTs are hard-linked into the new dump
+  // instead of being re-materialized by the checkpoint
+  std::string prev_path = bgsave_path_ + "prev";
+  slash::DeleteDirIfExist(prev_path);
+  std::vector<std::string> old_dumps;
+  slash::GetChildren(bgsave_path_, old_dumps);
+  std::string newest;
+  for (auto& dump : old_dumps) {
+    if (dump > newest) {
+      newest = dump;
+    }
+  }
+  for (auto& dump : old_dumps) {
+    if (dump == newest) {
+      continue;
+    }
+    if (!slash::DeleteDirIfExist(bgsave_path_ + dump)) {
+      LOG(WARNING) << "Remove old bgsave dir failed, Partition:"
+        << table_name_ << "_" << partition_id_;
+      return false;
+    }
+  }
+  if (!newest.empty()
+      && 0 != slash::RenameFile(bgsave_path_ + newest, prev_path)) {
+    LOG(WARNING) << "Keep previous bgsave dir failed, Partition:"
       << table_name_ << "_" << partition_id_;
-    return false;
+    slash::DeleteDirIfExist(bgsave_path_ + newest);
   }
   slash::CreatePath(bgsave_info_.path, 0755);  // create parent directory
   bgsave_info_.path += std::string(s_time, 8);
@@ -299,6 +439,47 @@ bool Partition::InitBgsaveContent(rocksdb::DBNemoCheckpoint* cp,
       return false;
     }
   }
+
+  // SSTs are immutable, a live one carried by the previous dump
+  // under the same name and size needs no second materialization
+  std::string prev_path = bgsave_path_ + "prev";
+  if (0 == slash::IsDir(prev_path)) {
+    std::vector<std::string> remain_files;
+    struct stat prev_st, live_st;
+    for (auto& file : content->live_files) {
+      if (file.size() > 4
+          && file.compare(file.size() - 4, 4, ".sst") == 0
+          && 0 == stat((prev_path + file).c_str(), &prev_st)
+          && 0 == stat((data_path_ + file).c_str(), &live_st)
+          && prev_st.st_size == live_st.st_size) {
+        content->inherited_files.push_back(file);
+      } else {
+        remain_files.push_back(file);
+      }
+    }
+    content->live_files.swap(remain_files);
+  }
+  return true;
+}
+
+// Hard link unchanged SSTs out of the previous dump into the new one,
+// and record their names beside them for later inspection
+bool Partition::LinkInheritedFiles(const std::vector<std::string>& files,
+    const std::string& new_path) {
+  std::string prev_path = bgsave_path_ + "prev";
+  for (auto& file : files) {
+    if (0 != link((prev_path + file).c_str(),
+          (new_path + file).c_str())) {
+      LOG(WARNING) << "Link inherited file failed: " << file
+        << ", error: " << strerror(errno)
+        << ", Partition: " << table_name_ << "_" << partition_id_;
+      return false;
+    }
+  }
+  std::ofstream writer(new_path + "/" + kBgsaveInheritedFile);
+  for (auto& file : files) {
+    writer << file << std::endl;
+  }
   return true;
 }
 
@@ -332,13 +513,29 @@ bool Partition::RunBgsave() {
     << ",  filenum=" << info.filenum
     << ", offset=" << info.offset;
 
-  // Backup to tmp dir
+  // Backup to tmp dir, without the SSTs inherited from the last dump
   s = cp->CreateCheckpointWithFiles(info.path,
       content.live_files,
       content.live_wal_files,
       content.manifest_file_size,
       content.sequence_number);
+  if (s.ok() && !content.inherited_files.empty()
+      && !LinkInheritedFiles(content.inherited_files, info.path)) {
+    // Incremental reuse broke half way, redo a full checkpoint
+    LOG(WARNING) << "Inherit previous bgsave failed, fall back to full"
+      << ", Table:" << table_name_ << ", Partition:" << partition_id_;
+    slash::DeleteDirIfExist(info.path);
+    content.live_files.insert(content.live_files.end(),
+        content.inherited_files.begin(), content.inherited_files.end());
+    content.inherited_files.clear();
+    s = cp->CreateCheckpointWithFiles(info.path,
+        content.live_files,
+        content.live_wal_files,
+        content.manifest_file_size,
+        content.sequence_number);
+  }
   LOG(INFO) << "Create new backup finished, path is " << info.path
+      << ", inherited files: " << content.inherited_files.size()
       << ", Table:" << table_name_ << ", Partition:" << partition_id_;
 
   delete cp;
@@ -361,7 +558,8 @@ void Partition::Bgsave() {
     bgsave_info_.bgsaving = true;
   }
 
-  zp_data_server->BGSaveTaskSchedule(&DoBgsave, static_cast<void*>(this));
+  zp_data_server->BGSaveTaskSchedule(&DoBgsave, static_cast<void*>(this),
+      partition_id_);
 }
 
 void Partition::DoBgsave(void* arg) {
@@ -474,6 +672,7 @@ bool Partition::TryUpdateMasterOffset() {
 
   // Update master offset
   SetBinlogOffset(BinlogOffset(filenum, offset));
+  RefreshStateSnapshot();
   return true;
 }
 
@@ -502,20 +701,55 @@ Status Partition::SlaveAskSync(const Node &node, BinlogOffset boffset) {
   }
 
   // Binlog already be purged
-  slash::RWLock lp(&purged_index_rw_, false);
-  LOG(INFO) << "Partition:" << table_name_ << "_" << partition_id_
-    << ", We " << (purged_index_ > boffset.filenum ? "will" : "won't")
-    << " TryDBSync, purged_index_=" << purged_index_
-    << ", filenum=" << boffset.filenum;
-  if (purged_index_ > boffset.filenum) {
-    TryDBSync(node.ip, node.port + kPortShiftRsync, cur_filenum);
-    return Status::Incomplete("Bgsaving and DBSync first");
+  uint32_t purged_index = 0;
+  {
+    slash::RWLock lp(&purged_index_rw_, false);
+    purged_index = purged_index_;
+  }
+  bool restore_pinned = false;
+  if (purged_index > boffset.filenum) {
+    // The archive may still bridge the gap, decompressing a few
+    // sealed binlogs back beats hours of full DBSync. The slave has
+    // no send task yet, which CouldPurge reads as no constraint, so
+    // pin a restore floor first: otherwise a concurrent purge could
+    // re-raise purged_index_ and delete the restored files anywhere
+    // in the gunzip-to-task-registration window
+    {
+      slash::RWLock lp(&purged_index_rw_, true);
+      restore_floors_.insert(boffset.filenum);
+      restore_pinned = true;
+    }
+    if (RestoreArchivedBinlogs(boffset.filenum, purged_index)) {
+      slash::RWLock lp(&purged_index_rw_, true);
+      if (purged_index_ > boffset.filenum) {
+        purged_index_ = boffset.filenum;
+      }
+      LOG(INFO) << "Partition:" << table_name_ << "_" << partition_id_
+        << ", Bridged purged binlogs [" << boffset.filenum
+        << ", " << purged_index << ") from the archive for " << node;
+    } else {
+      {
+        slash::RWLock lp(&purged_index_rw_, true);
+        restore_floors_.erase(restore_floors_.find(boffset.filenum));
+      }
+      LOG(INFO) << "Partition:" << table_name_ << "_" << partition_id_
+        << ", We will TryDBSync, purged_index_=" << purged_index
+        << ", filenum=" << boffset.filenum;
+      TryDBSync(node.ip, node.port + kPortShiftRsync, cur_filenum);
+      return Status::Incomplete("Bgsaving and DBSync first");
+    }
   }
 
   // Add binlog send task
   Status s = zp_data_server->AddBinlogSendTask(table_name_, partition_id_,
       logger_->filename(), Node(node.ip, node.port + kPortShiftSync),
       boffset.filenum, boffset.offset);
+  if (restore_pinned) {
+    // The task now anchors the purge on success; on failure the slave
+    // will ask again and the files are fair game in the meantime
+    slash::RWLock lp(&purged_index_rw_, true);
+    restore_floors_.erase(restore_floors_.find(boffset.filenum));
+  }
   if (s.ok()) {
     LOG(INFO) << "Success AddBinlogSendTask for Table " << table_name_
       << " Partition " << partition_id_ << " To "
@@ -546,6 +780,11 @@ void Partition::CleanSlaves(const std::set<Node> &old_slaves) {
     zp_data_server->RemoveBinlogSendTask(table_name_,
         partition_id_, Node(old.ip, old.port + kPortShiftSync));
   }
+
+  slash::MutexLock l(&ack_mu_);
+  for (auto& old : old_slaves) {
+    slave_acked_.erase(slash::IpPortString(old.ip, old.port));
+  }
 }
 
 // Requeired: hold write lock of state_rw_
@@ -608,6 +847,7 @@ void Partition::Update(ZPMeta::PState state, const Node &master,
   if (ZPMeta::PState::ACTIVE != (pstate_ = state)) {
     // Do not update master and slaves for stuck partition,
     // which will be updated when it become active
+    RefreshStateSnapshot();
     return;
   }
 
@@ -666,6 +906,7 @@ void Partition::Update(ZPMeta::PState state, const Node &master,
     // Change master
     BecomeSlave();
   }
+  RefreshStateSnapshot();
 }
 
 void Partition::Leave() {
@@ -676,6 +917,7 @@ void Partition::Leave() {
     CleanSlaves(slave_nodes_);
   }
   BecomeSingle();
+  RefreshStateSnapshot();
 }
 
 std::string NewPartitionPath(const std::string& name, const uint32_t current) {
@@ -736,6 +978,18 @@ bool Partition::GetBinlogOffset(BinlogOffset* boffset) const {
   return true;
 }
 
+// Serve binlog record from the in memory tail cache
+// Return NotFound on cache miss,
+// then the caller should fall back to binlog file read
+Status Partition::GetCachedBinlog(uint32_t filenum, uint64_t offset,
+    std::string* record, uint64_t* length) {
+  slash::RWLock l(&state_rw_, false);
+  if (!opened_) {
+    return Status::InvalidArgument("Partition not opened");
+  }
+  return logger_->GetCached(filenum, offset, record, length);
+}
+
 // Required: hold read mutex of state_rw_
 bool Partition::CheckSyncOption(const PartitionSyncOption& option,
     bool has_offset) {
@@ -761,7 +1015,7 @@ bool Partition::CheckSyncOption(const PartitionSyncOption& option,
   }
 
   // Update last sync_time
-  last_sync_time_ = slash::NowMicros();
+  last_sync_time_ = CoarseClock::NowMicros();
 
   // Check offset
   if (!has_offset) {
@@ -787,6 +1041,12 @@ bool Partition::CheckSyncOption(const PartitionSyncOption& option,
   return true;
 }
 
+// Whether a replicated write asked to be acked back to its master
+static bool RequestWantsAck(const client::CmdRequest& req) {
+  return req.type() == client::Type::SET
+    && req.set().ack_replicas() > 0;
+}
+
 // Keep binlog order outside
 void Partition::DoBinlogCommand(const PartitionSyncOption& option,
     const Cmd* cmd, const client::CmdRequest &req) {
@@ -805,8 +1065,13 @@ void Partition::DoBinlogCommand(const PartitionSyncOption& option,
     pthread_rwlock_rdlock(&suspend_rw_);
   }
 
-  client::CmdResponse res;
-  cmd->Do(&req, &res, this);
+  // The response is thrown away on the sync path
+  // Reuse one per worker thread so its buffers stay allocated
+  static __thread client::CmdResponse* res = NULL;
+  if (res == NULL) {
+    res = new client::CmdResponse();
+  }
+  cmd->Do(&req, res, this);
 
   std::string raw;
   req.SerializeToString(&raw);
@@ -822,6 +1087,10 @@ void Partition::DoBinlogCommand(const PartitionSyncOption& option,
     pthread_rwlock_unlock(&suspend_rw_);
   }
 
+  if (RequestWantsAck(req)) {
+    SendSyncAck();
+  }
+
   if (g_zp_conf->slowlog_slower_than() >= 0) {
     int64_t duration = slash::NowMicros() - start_us;
     if (duration > g_zp_conf->slowlog_slower_than()) {
@@ -832,6 +1101,186 @@ void Partition::DoBinlogCommand(const PartitionSyncOption& option,
   }
 }
 
+// Keep binlog order outside
+// Apply consecutive replicated commands as one batch:
+// their db writes share one rocksdb::WriteBatch
+// and their binlog records share one append
+// option carries the offset of the first record,
+// the followings are consecutive by construction
+void Partition::DoBinlogCommandBatch(const PartitionSyncOption& option,
+    const std::vector<const Cmd*>& cmds,
+    const std::vector<client::CmdRequest>& reqs) {
+  slash::RWLock l(&state_rw_, false);
+  if (cmds.empty() || !CheckSyncOption(option)) {
+    return;
+  }
+
+  uint64_t start_us = 0;
+  if (g_zp_conf->slowlog_slower_than() >= 0) {
+    start_us = slash::NowMicros();
+  }
+
+  // Batched commands are never suspend ones, see caller
+  pthread_rwlock_rdlock(&suspend_rw_);
+
+  int lane_num = g_zp_conf->sync_apply_thread_num();
+  if (lane_num > static_cast<int>(cmds.size())) {
+    lane_num = cmds.size();
+  }
+  if (lane_num <= 1) {
+    // Reused per worker thread, the response is thrown away
+    static __thread client::CmdResponse* res = NULL;
+    if (res == NULL) {
+      res = new client::CmdResponse();
+    }
+    rocksdb::WriteBatch batch;
+    for (size_t i = 0; i < cmds.size(); i++) {
+      if (cmds[i]->BatchDo(&reqs[i], &batch)) {
+        continue;
+      }
+      // Command could not join the write batch, such as SET with ttl
+      // Flush the records batched before it to keep the write order
+      if (batch.Count() > 0) {
+        rocksdb::Status bs = db_->Write(rocksdb::WriteOptions(), &batch);
+        if (!bs.ok()) {
+          LOG(WARNING) << "WriteBatch failed: " << bs.ToString()
+            << ", table: " << table_name_
+            << ", partition: " << partition_id_;
+        }
+        batch.Clear();
+      }
+      cmds[i]->Do(&reqs[i], res, this);
+    }
+    if (batch.Count() > 0) {
+      rocksdb::Status bs = db_->Write(rocksdb::WriteOptions(), &batch);
+      if (!bs.ok()) {
+        LOG(WARNING) << "WriteBatch failed: " << bs.ToString()
+          << ", table: " << table_name_
+          << ", partition: " << partition_id_;
+      }
+    }
+  } else {
+    // Fan the commands across lanes by key hash: one key sticks to one
+    // lane and a lane replays its share in the original sequence, so
+    // per-key order is kept while writes to different keys, which
+    // commute, apply in parallel; the shared binlog append below still
+    // happens once for the whole batch in the original order.
+    // A command whose keys span more than one lane (MSET) is a lane
+    // barrier: the lanes drain before it applies alone, then filling
+    // restarts, keeping its order against every member key
+    std::vector<std::vector<size_t> > lanes(lane_num);
+    auto drain_lanes = [this, lane_num, &lanes, &cmds, &reqs]() {
+      std::vector<std::thread> appliers;
+      for (int t = 0; t < lane_num; t++) {
+        if (lanes[t].empty()) {
+          continue;
+        }
+        appliers.push_back(std::thread([this, t, &lanes, &cmds, &reqs]() {
+          client::CmdResponse res;
+          rocksdb::WriteBatch batch;
+          for (size_t idx : lanes[t]) {
+            if (cmds[idx]->BatchDo(&reqs[idx], &batch)) {
+              continue;
+            }
+            if (batch.Count() > 0) {
+              rocksdb::Status bs = db_->Write(rocksdb::WriteOptions(), &batch);
+              if (!bs.ok()) {
+                LOG(WARNING) << "WriteBatch failed: " << bs.ToString()
+                  << ", table: " << table_name_
+                  << ", partition: " << partition_id_;
+              }
+              batch.Clear();
+            }
+            cmds[idx]->Do(&reqs[idx], &res, this);
+          }
+          if (batch.Count() > 0) {
+            rocksdb::Status bs = db_->Write(rocksdb::WriteOptions(), &batch);
+            if (!bs.ok()) {
+              LOG(WARNING) << "WriteBatch failed: " << bs.ToString()
+                << ", table: " << table_name_
+                << ", partition: " << partition_id_;
+            }
+          }
+        }));
+      }
+      for (size_t t = 0; t < appliers.size(); t++) {
+        appliers[t].join();
+      }
+      for (int t = 0; t < lane_num; t++) {
+        lanes[t].clear();
+      }
+    };
+
+    client::CmdResponse barrier_res;
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < cmds.size(); i++) {
+      keys.clear();
+      cmds[i]->ExtractAllKeys(&reqs[i], &keys);
+      int lane = keys.empty() ? 0
+        : std::hash<std::string>()(keys[0]) % lane_num;
+      bool spans = false;
+      for (size_t k = 1; k < keys.size(); k++) {
+        if (static_cast<int>(
+              std::hash<std::string>()(keys[k]) % lane_num) != lane) {
+          spans = true;
+          break;
+        }
+      }
+      if (!spans) {
+        lanes[lane].push_back(i);
+        continue;
+      }
+      drain_lanes();
+      rocksdb::WriteBatch batch;
+      if (cmds[i]->BatchDo(&reqs[i], &batch)) {
+        rocksdb::Status bs = db_->Write(rocksdb::WriteOptions(), &batch);
+        if (!bs.ok()) {
+          LOG(WARNING) << "WriteBatch failed: " << bs.ToString()
+            << ", table: " << table_name_
+            << ", partition: " << partition_id_;
+        }
+      } else {
+        cmds[i]->Do(&reqs[i], &barrier_res, this);
+      }
+    }
+    drain_lanes();
+  }
+
+  // One binlog append for the whole batch,
+  // every record keeps the same frame as applied alone
+  std::vector<std::string> raws(reqs.size());
+  for (size_t i = 0; i < reqs.size(); i++) {
+    reqs[i].SerializeToString(&raws[i]);
+  }
+  Status s = logger_->Put(raws);
+  if (!s.ok()) {
+    LOG(WARNING) << "Binlog Put batch failed : " << s.ToString()
+      << ", table: " << table_name_
+      << ", partition: " << partition_id_
+      << ", batch size: " << raws.size();
+  }
+
+  pthread_rwlock_unlock(&suspend_rw_);
+
+  // One ack covers the whole batch, the binlog offset after
+  // the shared append is beyond every record in it
+  for (auto& r : reqs) {
+    if (RequestWantsAck(r)) {
+      SendSyncAck();
+      break;
+    }
+  }
+
+  if (g_zp_conf->slowlog_slower_than() >= 0) {
+    int64_t duration = slash::NowMicros() - start_us;
+    if (duration > g_zp_conf->slowlog_slower_than()) {
+      LOG(WARNING) << "slow sync command batch with " << cmds.size()
+        << " items, duration(us): " << duration
+        << ", For " << table_name_ << "_" << partition_id_;
+    }
+  }
+}
+
 // Keep binlog order outside
 void Partition::DoBinlogSkip(const PartitionSyncOption& option,
     uint64_t gap) {
@@ -855,16 +1304,35 @@ void Partition::DoBinlogLeaseRenew(const PartitionSyncOption& option,
   if (!CheckSyncOption(option)) {
     return;
   }
+  uint64_t lease_min = g_zp_conf->sync_lease_min();
+  uint64_t lease_max = g_zp_conf->sync_lease_max();
+  if (lease < lease_min) {
+    lease = lease_min;
+  } else if (lease > lease_max) {
+    lease = lease_max;
+  }
   sync_lease_ = lease;
 }
 
-void Partition::DoCommand(const Cmd* cmd, const client::CmdRequest &req,
-    client::CmdResponse *res) {
-  std::string key = cmd->ExtractKey(&req);
+// Required: hold read lock of state_rw_
+// A connected slave whose sync lease is still alive lags the master
+// by no more than one lease, which bounds the staleness of its reads
+bool Partition::StaleReadOk() {
+  if (role_ != Role::kNodeSlave
+      || repl_state_ != ReplState::kConnected) {
+    return false;
+  }
+  return CoarseClock::NowMicros() - last_sync_time_ <= sync_lease_ * 1000 * 1000;
+}
 
+void Partition::DoCommand(const Cmd* cmd, const client::CmdRequest &req,
+    client::CmdResponse *res, const Slice& raw_request) {
   slash::RWLock l(&state_rw_, false);
+  bool stale_read = !cmd->is_write()
+    && cmd->AllowStaleRead(&req)
+    && StaleReadOk();
   if (!opened_
-      || role_ != Role::kNodeMaster) {
+      || (role_ != Role::kNodeMaster && !stale_read)) {
     res->set_type(req.type());
     res->set_code(client::StatusCode::kMove);
     res->set_msg("Command Redirect");
@@ -891,44 +1359,192 @@ void Partition::DoCommand(const Cmd* cmd, const client::CmdRequest &req,
     return;
   }
 
-  uint64_t start_us = 0;
-  if (g_zp_conf->slowlog_slower_than() >= 0) {
-    start_us = slash::NowMicros();
-  }
+  // Always timed, the duration also feeds the latency histograms,
+  // the stage costs tell a slow request where it spent the time
+  uint64_t start_us = slash::NowMicros();
+  uint64_t suspend_wait_us = 0;
+  uint64_t lock_wait_us = 0;
+  uint64_t db_us = 0;
+  uint64_t binlog_us = 0;
+  uint64_t ack_wait_us = 0;
+  uint64_t stage_us = start_us;
 
   // Add read lock for no suspend command
   if (!cmd->is_suspend()) {
     pthread_rwlock_rdlock(&suspend_rw_);
+    suspend_wait_us = slash::NowMicros() - stage_us;
   }
 
+  // A multi key write guards every member key: stripes locked in
+  // sorted deduped order so overlapping writers cannot deadlock.
+  // Guarding only the routing key would let a concurrent writer of
+  // another member key interleave db apply and binlog append, and
+  // slaves replaying binlog order would diverge
+  std::vector<size_t> stripes;
   if (cmd->is_write()) {
-    mutex_record_.Lock(key);
+    std::vector<std::string> keys;
+    cmd->ExtractAllKeys(&req, &keys);
+    for (size_t i = 0; i < keys.size(); i++) {
+      stripes.push_back(RecordLockStripe(keys[i]));
+    }
+    std::sort(stripes.begin(), stripes.end());
+    stripes.erase(std::unique(stripes.begin(), stripes.end()),
+        stripes.end());
+    stage_us = slash::NowMicros();
+    for (size_t i = 0; i < stripes.size(); i++) {
+      record_lock_stripes_[stripes[i]].Lock();
+    }
+    lock_wait_us = slash::NowMicros() - stage_us;
   }
 
+  stage_us = slash::NowMicros();
   cmd->Do(&req, res, this);
+  db_us = slash::NowMicros() - stage_us;
 
+  bool wait_ack = false;
+  BinlogOffset ack_target;
   if (cmd->is_write()) {
     if (res->code() == client::StatusCode::kOk) {
-      // Restore Message
       std::string raw;
-      if (cmd->GenerateLog(&req, &raw)) {
+      bool has_log = true;
+      stage_us = slash::NowMicros();
+      if (!raw_request.empty() && cmd->LogReusesRequest(&req)) {
+        // The wire bytes are exactly the record GenerateLog would
+        // rebuild, skip the serialization and its value copy
+        logger_->Put(raw_request);
+      } else if (cmd->GenerateLog(&req, &raw)) {
         logger_->Put(raw);
+      } else {
+        has_log = false;
+      }
+      if (has_log) {
+        binlog_us = slash::NowMicros() - stage_us;
+        if (req.type() == client::Type::SET
+            && req.set().ack_replicas() > 0) {
+          GetBinlogOffset(&ack_target);
+          wait_ack = true;
+        }
       }
     }
-    mutex_record_.Unlock(key);
+    for (size_t i = stripes.size(); i > 0; i--) {
+      record_lock_stripes_[stripes[i - 1]].Unlock();
+    }
   }
 
   if (!cmd->is_suspend()) {
     pthread_rwlock_unlock(&suspend_rw_);
   }
 
-  if (g_zp_conf->slowlog_slower_than() >= 0) {
-    int64_t duration = slash::NowMicros() - start_us;
-    if (duration > g_zp_conf->slowlog_slower_than()) {
-      LOG(WARNING) << "slow client command:" << cmd->name()
-        << ", duration(us): " << duration
-        << ", For " << table_name_ << "_" << partition_id_;
+  if (wait_ack) {
+    stage_us = slash::NowMicros();
+    if (!WaitSlaveAck(ack_target, req.set().ack_replicas())) {
+      // The write applied and binlogged locally,
+      // only its replica durability is unconfirmed
+      res->set_code(client::StatusCode::kWait);
+      res->set_msg("replica ack timeout");
     }
+    ack_wait_us = slash::NowMicros() - stage_us;
+  }
+
+  uint64_t end_us = slash::NowMicros();
+  int64_t duration = end_us - start_us;
+  zp_data_server->PlusLatency(static_cast<int>(req.type()), duration);
+  if (g_zp_conf->slowlog_slower_than() >= 0
+      && duration > g_zp_conf->slowlog_slower_than()) {
+    LOG(WARNING) << "slow client command:" << cmd->name()
+      << ", duration(us): " << duration
+      << " suspend_wait: " << suspend_wait_us
+      << " lock_wait: " << lock_wait_us
+      << " db: " << db_us
+      << " binlog: " << binlog_us
+      << " ack_wait: " << ack_wait_us
+      << ", For " << table_name_ << "_" << partition_id_;
+
+    client::CmdResponse_InfoSlowlog slowlog;
+    slowlog.set_time(static_cast<int64_t>(end_us));
+    slowlog.set_table_name(table_name_);
+    slowlog.set_partition(partition_id_);
+    slowlog.set_cmd_type(static_cast<int>(req.type()));
+    slowlog.set_total_us(duration);
+    slowlog.set_suspend_wait_us(suspend_wait_us);
+    slowlog.set_lock_wait_us(lock_wait_us);
+    slowlog.set_db_us(db_us);
+    slowlog.set_binlog_us(binlog_us);
+    slowlog.set_ack_wait_us(ack_wait_us);
+    zp_data_server->RecordSlowlog(slowlog);
+  }
+}
+
+// Called by the sync conn when a slave reports its applied offset
+// Only ever raise it, acks arriving out of order are ignored
+void Partition::RecordSlaveAck(const std::string& node,
+    const BinlogOffset& boffset) {
+  slash::MutexLock l(&ack_mu_);
+  auto iter = slave_acked_.find(node);
+  if (iter == slave_acked_.end()) {
+    slave_acked_[node] = boffset;
+  } else if (iter->second < boffset) {
+    iter->second = boffset;
+  }
+  ack_cond_.SignalAll();
+}
+
+// Requeired: hold read lock of state_rw_
+// Block until replicas slaves acked offsets covering target,
+// bounded by kWriteAckTimeout. Return false on timeout
+bool Partition::WaitSlaveAck(const BinlogOffset& target, int replicas) {
+  int needed = replicas;
+  if (needed > static_cast<int>(slave_nodes_.size())) {
+    needed = slave_nodes_.size();
+  }
+  if (needed <= 0) {
+    return true;
+  }
+
+  uint64_t deadline_us = slash::NowMicros() + kWriteAckTimeout * 1000;
+  slash::MutexLock l(&ack_mu_);
+  while (true) {
+    int acked = 0;
+    for (auto& sa : slave_acked_) {
+      if (!(sa.second < target)) {
+        acked++;
+      }
+    }
+    if (acked >= needed) {
+      return true;
+    }
+    uint64_t now = slash::NowMicros();
+    if (now >= deadline_us) {
+      return false;
+    }
+    ack_cond_.TimedWait((deadline_us - now) / 1000 + 1);
+  }
+}
+
+// Requeired: hold read lock of state_rw_
+// Report the applied binlog offset back to master over the sync channel
+void Partition::SendSyncAck() {
+  BinlogOffset boffset;
+  GetBinlogOffset(&boffset);
+
+  client::SyncRequest sreq;
+  sreq.set_sync_type(client::SyncType::ACK);
+  sreq.set_epoch(zp_data_server->meta_epoch());
+  client::Node* from = sreq.mutable_from();
+  from->set_ip(zp_data_server->local_ip());
+  from->set_port(zp_data_server->local_port());
+  client::SyncAck* sack = sreq.mutable_sync_ack();
+  sack->set_table_name(table_name_);
+  sack->set_partition_id(partition_id_);
+  sack->mutable_sync_offset()->set_filenum(boffset.filenum);
+  sack->mutable_sync_offset()->set_offset(boffset.offset);
+
+  Status s = zp_data_server->SendToPeer(
+      Node(master_node_.ip, master_node_.port + kPortShiftSync), sreq);
+  if (!s.ok()) {
+    LOG(WARNING) << "Send SyncAck failed: " << s.ToString()
+      << ", table: " << table_name_
+      << ", partition: " << partition_id_;
   }
 }
 
@@ -936,6 +1552,46 @@ inline void Partition::TryRecoverSync() {
   do_recovery_sync_ = true;
 }
 
+void Partition::RecordMasterRtt(uint64_t rtt_us) {
+  uint64_t prev = master_rtt_us_;
+  // Smoothed 7:1, one congested round trip should not
+  // reshape every delay at once
+  master_rtt_us_ = (prev == 0) ? rtt_us : (prev * 7 + rtt_us) / 8;
+}
+
+// Crons of patience before redoing trysync on serially errored
+// binlogs. The base comes from conf, every kRecoverSyncRttStepUs of
+// measured master RTT adds one more cron since flapping into a WAN
+// trysync costs far more than into a LAN one, and a recovery in the
+// near past doubles it once more: the last one obviously did not
+// stick. Capped by the stuck delay which is the configured ceiling.
+int Partition::RecoverSyncDelayCrons() {
+  const int cron_sec = kNodeCronInterval * kNodeCronWaitCount / 1000;
+  int crons = g_zp_conf->recover_sync_delay() / cron_sec
+    + master_rtt_us_ / kRecoverSyncRttStepUs;
+  if (last_recover_time_ > 0
+      && slash::NowMicros() - last_recover_time_
+      < kRecoverSyncBackoffWindow * 1000000ULL) {
+    crons *= 2;
+  }
+  int limit = g_zp_conf->stuck_recover_sync_delay() / cron_sec;
+  return crons < limit ? crons : limit;
+}
+
+// A slave stuck out of kConnected is likely waiting out a DBSync,
+// it gets the configured ceiling plus the RTT scaled patience
+int Partition::StuckRecoverSyncDelayCrons() {
+  const int cron_sec = kNodeCronInterval * kNodeCronWaitCount / 1000;
+  return g_zp_conf->stuck_recover_sync_delay() / cron_sec
+    + master_rtt_us_ / kRecoverSyncRttStepUs;
+}
+
+// A lease renewal crossing the wire is about one RTT stale when it
+// lands, a few RTTs of slack keeps that from reading as a timeout
+uint64_t Partition::SyncLeaseSlackUs() {
+  return master_rtt_us_ * kSyncLeaseRttFactor;
+}
+
 inline void Partition::ResetRecoverSync() {
   // no mutex protect this two together
   // since we can tolerant the inconsistence
@@ -953,10 +1609,12 @@ bool Partition::NeedRecoverSync() {
   if (repl_state_ != ReplState::kConnected) {
     // repl state mybe one of kNoConnect, kShouldConnect or kWaitDBSync
     stuck_recover_sync_flag_++;
-    if (stuck_recover_sync_flag_ > kStuckRecoverSyncDelayCronCount) {
+    int stuck_delay_crons = StuckRecoverSyncDelayCrons();
+    if (stuck_recover_sync_flag_ > stuck_delay_crons) {
       LOG(INFO) << "Slave stuck out of kConnected for more than "
-        << kStuckRecoverSyncDelayCronCount << " cron times, would redo trysync."
+        << stuck_delay_crons << " cron times, would redo trysync."
         << " table: " << table_name_ << ", partition_id: " << partition_id_;
+      last_recover_time_ = slash::NowMicros();
       return true;
     }
     return false;
@@ -966,39 +1624,80 @@ bool Partition::NeedRecoverSync() {
   // Recover trigger by serially error binlog
   if (do_recovery_sync_) {
     recover_sync_flag_++;
-    if (recover_sync_flag_ > kRecoverSyncDelayCronCount) {
+    if (recover_sync_flag_ > RecoverSyncDelayCrons()) {
       // will be reset when BecomeSlave
       LOG(INFO) << "Serially error binlog received, would redo trysync."
         << " table: " << table_name_ << ", partition_id: " << partition_id_;
+      last_recover_time_ = slash::NowMicros();
       return true;
     }
   }
 
   // Recover trigger by lease timeout
   uint64_t now_time = slash::NowMicros();
-  if (now_time - last_sync_time_ > sync_lease_ * 1000 * 1000) {
+  if (now_time - last_sync_time_
+      > sync_lease_ * 1000 * 1000 + SyncLeaseSlackUs()) {
     // We know last_sync_time_ and sync_lease is not atomic here,
     // but it's not critical, there will be one more trysync at worse
     LOG(INFO) << "Sync lease timeout, lease:" << sync_lease_
       << ", now: " << now_time << ", last sync: " << last_sync_time_
       << ", would redo trysync" << " table: " << table_name_
       << ", partition_id: " << partition_id_;
+    last_recover_time_ = slash::NowMicros();
     return true;
   }
   return false;
 }
 
-void Partition::DoTimingTask() {
-  // Purge log
-  if (!PurgeLogs(0, false)) {
+// Run the timing task on one of the sharded cron workers,
+// a slow check of one partition then cannot delay the failure
+// detection of the partitions behind it in the old serial walk
+void Partition::ScheduleTimingTask() {
+  bool expected = false;
+  if (!cron_pending_.compare_exchange_strong(expected, true)) {
+    // The former tick is still queued or running
+    return;
+  }
+  zp_data_server->CronTaskSchedule(&DoCronTask, static_cast<void*>(this),
+      partition_id_);
+}
+
+void Partition::DoCronTask(void* arg) {
+  Partition* p = static_cast<Partition*>(arg);
+  p->DoTimingTask();
+  p->cron_pending_ = false;
+}
+
+void Partition::ApplyDBOptions(
+    const std::map<std::string, std::string>& options) {
+  slash::RWLock l(&state_rw_, false);
+  if (!opened_) {
     return;
   }
+  rocksdb::Status s = db_->SetOptions(options);
+  if (!s.ok()) {
+    LOG(WARNING) << "SetOptions failed, Table: " << table_name_
+      << " Partition: " << partition_id_ << " Error: " << s.ToString();
+  }
+}
+
+void Partition::DoTimingTask() {
+  // Kick a binlog purge unless one is still trickling; purges pace
+  // their deletions and may gzip archives, so one can span many cron
+  // ticks and must not starve the lease expiry check and snapshot
+  // refresh below for its whole duration
+  if (!purging_) {
+    PurgeLogs(0, false);
+  }
 
   // Maybe trysync
   slash::RWLock l(&state_rw_, true);
   if (NeedRecoverSync()) {
     BecomeSlave();
   }
+
+  // Keep the binlog offset carried by the state snapshot fresh
+  RefreshStateSnapshot();
 }
 
 // Required: hold read mutex of state_rw_
@@ -1038,10 +1737,11 @@ void Partition::DBSync(const std::string& ip, int port) {
 
   LOG(INFO) << " DBSync add new SyncTask for (" << ip_port
     << "), Parition " << table_name_ << "_" << partition_id_;
-  // Reuse the bg_thread for Bgsave
-  // Since we expect Bgsave and DBSync execute serially
+  // Reuse the bgsave pool for DBSync with the same partition key,
+  // since we expect Bgsave and DBSync of one partition execute serially
   DBSyncArg *arg = new DBSyncArg(this, ip, port);
-  zp_data_server->BGSaveTaskSchedule(&DoDBSync, static_cast<void*>(arg));
+  zp_data_server->BGSaveTaskSchedule(&DoDBSync, static_cast<void*>(arg),
+      partition_id_);
 }
 
 void Partition::DoDBSync(void* arg) {
@@ -1085,46 +1785,72 @@ void Partition::DBSyncSendFile(const std::string& ip, int port) {
     << ", to node: " << ip << ":" << port << ", bg_path: " << bg_path
     << ", Partition: " << table_name_<< "_" << partition_id_;
 
-  // Iterate to send files
-  int ret = 0;
-  std::string target_path;
+  // Send files over several concurrent channel streams,
+  // each file is owned by exactly one stream so that a failed file
+  // is retried (and resumed from the received size) without touching
+  // the others, while the total bandwidth cap is divided among them
   std::string target_dir = NewPartitionPath(table_name_ + "/.", partition_id_);
-  std::string module = kDBSyncModule;
-  std::vector<std::string>::iterator it = descendant.begin();
-  slash::RsyncRemote remote(ip, port, module, kDBSyncSpeedLimit * 1024);
-  for (; it != descendant.end(); ++it) {
-    target_path = (*it).substr(bg_path.size() + 1);
-    DLOG(INFO) << "--- descendant: " << target_path;
-    if (target_path == kBgsaveInfoFile) {
-      continue;
-    }
-    // We need specify the speed limit for every single file
-    int retry_count = kDBSyncRetryTime;
-    do {
-      ret = slash::RsyncSendFile(*it, target_dir + target_path, remote);
-    } while (0 != ret && retry_count--);
-
-    if (0 != ret) {
-      LOG(WARNING) << "rsync send file failed after retry: " << ret
-        << ", to node: " << ip << ":" << port << ", bg_path: " << bg_path
-        << ", Partition: " << table_name_<< "_" << partition_id_;
-      break;
-    }
-    if (!opened_) {
-      LOG(WARNING) << "Partition has been closed when try to send dbsync"
-        << ", to node: " << ip << ":" << port << ", bg_path: " << bg_path
-        << ", Partition: " << table_name_<< "_" << partition_id_;
-      return;  // Terminate as soon as possible
-    }
+  int stream_num = g_zp_conf->db_sync_stream_num();
+  if (stream_num > static_cast<int>(descendant.size())) {
+    stream_num = descendant.size();
+  }
+  if (stream_num < 1) {
+    stream_num = 1;
+  }
+  int stream_speed_kbps = g_zp_conf->db_sync_speed() * 1024 / stream_num;
+
+  std::atomic<int> result(0);
+  std::vector<std::thread> streams;
+  for (int t = 0; t < stream_num; t++) {
+    streams.push_back(std::thread([this, t, stream_num, stream_speed_kbps,
+          &descendant, &bg_path, &target_dir, &ip, &port, &result]() {
+          for (size_t i = t; i < descendant.size(); i += stream_num) {
+            std::string target_path = descendant[i].substr(bg_path.size() + 1);
+            DLOG(INFO) << "--- descendant: " << target_path;
+            if (target_path == kBgsaveInfoFile
+                || target_path == kBgsaveInheritedFile) {
+              continue;
+            }
+            // An interrupted file is resumed from what the slave holds
+            int ret = 0;
+            int retry_count = kDBSyncRetryTime;
+            do {
+              ret = DBSyncSendFileChannel(descendant[i],
+                  target_dir + target_path, ip, port, stream_speed_kbps);
+            } while (0 != ret && retry_count--);
+
+            if (0 != ret) {
+              LOG(WARNING) << "dbsync send file failed after retry: " << ret
+                << ", to node: " << ip << ":" << port
+                << ", bg_path: " << bg_path
+                << ", Partition: " << table_name_<< "_" << partition_id_;
+              result = ret;
+              break;
+            }
+            if (result != 0 || !opened_) {
+              break;  // Terminate as soon as possible
+            }
+          }
+        }));
+  }
+  for (auto& stream : streams) {
+    stream.join();
+  }
+  int ret = result;
+  if (!opened_) {
+    LOG(WARNING) << "Partition has been closed when try to send dbsync"
+      << ", to node: " << ip << ":" << port << ", bg_path: " << bg_path
+      << ", Partition: " << table_name_<< "_" << partition_id_;
+    return;
   }
 
   // Clear target path
-  slash::RsyncSendClearTarget(bg_path, target_dir, remote);
+  DBSyncClearTargetChannel(bg_path, target_dir, ip, port);
 
   // Send info file at last
   if (0 == ret) {
-    if (0 != (ret = slash::RsyncSendFile(bg_path + "/" + kBgsaveInfoFile,
-            target_dir + kBgsaveInfoFile, remote))) {
+    if (0 != (ret = DBSyncSendFileChannel(bg_path + "/" + kBgsaveInfoFile,
+            target_dir + kBgsaveInfoFile, ip, port, stream_speed_kbps))) {
       LOG(WARNING) << "send info file failed: " << ret
         << ", to node: " << ip << ":" << port << ", bg_path: " << bg_path
         << ", Partition: " << table_name_<< "_" << partition_id_;
@@ -1132,12 +1858,181 @@ void Partition::DBSyncSendFile(const std::string& ip, int port) {
   }
 
   if (0 == ret) {
-    LOG(INFO) << "rsync send files success" 
+    LOG(INFO) << "dbsync send files success" 
       << ", to node: " << ip << ":" << port << ", bg_path: " << bg_path
       << ", Partition: " << table_name_<< "_" << partition_id_;
   }
 }
 
+std::string Partition::ArchivePath(uint32_t index) {
+  return log_path_ + kArchiveSubDir + kBinlogPrefix
+    + std::to_string(index) + kArchiveSuffix;
+}
+
+bool Partition::GetArchiveFiles(std::map<uint32_t, std::string>* archives) {
+  std::string dir = log_path_ + kArchiveSubDir;
+  if (!slash::FileExists(dir)) {
+    return true;
+  }
+  std::vector<std::string> children;
+  int ret = slash::GetChildren(dir, children);
+  if (ret != 0) {
+    LOG(WARNING) << "GetArchiveFiles Get all files in archive path failed:"
+      << ret << ", Partition: " << table_name_ << "_" << partition_id_;
+    return false;
+  }
+  int64_t index = 0;
+  for (auto& child : children) {
+    if (child.size() <= kBinlogPrefixLen + kArchiveSuffix.size()
+        || child.compare(0, kBinlogPrefixLen, kBinlogPrefix) != 0
+        || child.compare(child.size() - kArchiveSuffix.size(),
+          kArchiveSuffix.size(), kArchiveSuffix) != 0) {
+      continue;
+    }
+    std::string sindex = child.substr(kBinlogPrefixLen,
+        child.size() - kBinlogPrefixLen - kArchiveSuffix.size());
+    if (slash::string2l(sindex.c_str(), sindex.size(), &index) == 1) {
+      archives->insert(std::pair<uint32_t, std::string>(
+            static_cast<uint32_t>(index), child));
+    }
+  }
+  return true;
+}
+
+bool Partition::ArchiveBinlogFile(uint32_t index, const std::string& name) {
+  const std::string dest = ArchivePath(index);
+  if (slash::FileExists(dest)) {
+    // A formerly restored file going away again, its copy is there
+    return true;
+  }
+  slash::CreateDir(log_path_ + kArchiveSubDir);
+  FILE* in = fopen((log_path_ + name).c_str(), "rb");
+  if (in == NULL) {
+    LOG(WARNING) << "Archive open binlog " << name << " failed"
+      << ", Partition: " << table_name_ << "_" << partition_id_;
+    return false;
+  }
+  // Level 1 is enough, binlog records squash well anyway
+  const std::string tmp = dest + ".tmp";
+  gzFile out = gzopen(tmp.c_str(), "wb1");
+  if (out == NULL) {
+    fclose(in);
+    return false;
+  }
+  char buf[64 * 1024];
+  size_t n;
+  bool ok = true;
+  while ((n = fread(buf, 1, sizeof(buf), in)) > 0) {
+    if (gzwrite(out, buf, n) != static_cast<int>(n)) {
+      ok = false;
+      break;
+    }
+  }
+  if (ferror(in)) {
+    ok = false;
+  }
+  fclose(in);
+  if (gzclose(out) != Z_OK) {
+    ok = false;
+  }
+  if (!ok || 0 != slash::RenameFile(tmp, dest)) {
+    slash::DeleteFile(tmp);
+    LOG(WARNING) << "Archive binlog " << name << " failed"
+      << ", Partition: " << table_name_ << "_" << partition_id_;
+    return false;
+  }
+  return true;
+}
+
+bool Partition::RestoreArchivedBinlogs(uint32_t from, uint32_t to) {
+  if (g_zp_conf->binlog_archive_mb() <= 0) {
+    return false;
+  }
+  // Every piece has to be coverable before touching anything,
+  // a half-bridged gap is as useless as no bridge
+  for (uint32_t index = from; index < to; index++) {
+    if (!slash::FileExists(log_path_ + kBinlogPrefix + std::to_string(index))
+        && !slash::FileExists(ArchivePath(index))) {
+      return false;
+    }
+  }
+  for (uint32_t index = from; index < to; index++) {
+    const std::string dest = log_path_ + kBinlogPrefix + std::to_string(index);
+    if (slash::FileExists(dest)) {
+      continue;
+    }
+    gzFile in = gzopen(ArchivePath(index).c_str(), "rb");
+    if (in == NULL) {
+      return false;
+    }
+    const std::string tmp = dest + ".restore";
+    FILE* out = fopen(tmp.c_str(), "wb");
+    if (out == NULL) {
+      gzclose(in);
+      return false;
+    }
+    char buf[64 * 1024];
+    int n;
+    bool ok = true;
+    while ((n = gzread(in, buf, sizeof(buf))) > 0) {
+      if (fwrite(buf, 1, n, out) != static_cast<size_t>(n)) {
+        ok = false;
+        break;
+      }
+    }
+    if (n < 0) {
+      ok = false;
+    }
+    gzclose(in);
+    if (fclose(out) != 0) {
+      ok = false;
+    }
+    if (!ok || 0 != slash::RenameFile(tmp, dest)) {
+      slash::DeleteFile(tmp);
+      LOG(WARNING) << "Restore binlog " << index << " from archive failed"
+        << ", Partition: " << table_name_ << "_" << partition_id_;
+      return false;
+    }
+    LOG(INFO) << "Restored binlog " << index << " from archive"
+      << ", Partition: " << table_name_ << "_" << partition_id_;
+  }
+  return true;
+}
+
+void Partition::TrimArchive() {
+  std::map<uint32_t, std::string> archives;
+  if (!GetArchiveFiles(&archives) || archives.empty()) {
+    return;
+  }
+  uint64_t budget =
+    static_cast<uint64_t>(g_zp_conf->binlog_archive_mb()) * 1024 * 1024;
+  uint64_t total = 0;
+  struct stat file_stat;
+  std::map<uint32_t, uint64_t> sizes;
+  for (auto& item : archives) {
+    if (stat((log_path_ + kArchiveSubDir + item.second).c_str(),
+          &file_stat) == 0) {
+      sizes[item.first] = file_stat.st_size;
+      total += file_stat.st_size;
+    }
+  }
+  // Oldest first, the far past leaves before the recent window
+  int dropped = 0;
+  for (auto& item : archives) {
+    if (total <= budget) {
+      break;
+    }
+    slash::DeleteFile(log_path_ + kArchiveSubDir + item.second);
+    total -= sizes[item.first];
+    dropped++;
+  }
+  if (dropped) {
+    LOG(INFO) << "Archive budget dropped " << dropped << " files, "
+      << total << " bytes kept for "
+      << table_name_ << "_" << partition_id_;
+  }
+}
+
 bool Partition::PurgeLogs(uint32_t to, bool manual) {
   // Only one thread can go through
   bool expect = false;
@@ -1156,7 +2051,8 @@ bool Partition::PurgeLogs(uint32_t to, bool manual) {
   arg->p = this;
   arg->to = to;
   arg->manual = manual;
-  zp_data_server->BGPurgeTaskSchedule(&DoPurgeLogs, static_cast<void*>(arg));
+  zp_data_server->BGPurgeTaskSchedule(&DoPurgeLogs, static_cast<void*>(arg),
+      partition_id_);
   return true;
 }
 
@@ -1171,16 +2067,17 @@ void Partition::DoPurgeLogs(void* arg) {
 }
 
 bool Partition::PurgeFiles(uint32_t to, bool manual) {
-  slash::RWLock l(&state_rw_, false);
-  if (!opened_) {
-    return true;
-  }
-
   std::map<uint32_t, std::string> binlogs;
-  if (!GetBinlogFiles(&binlogs)) {
-    LOG(WARNING) << "Could not get binlog files!"
-      << ", Partition: " << table_name_ << "_" << partition_id_; 
-    return false;
+  {
+    slash::RWLock l(&state_rw_, false);
+    if (!opened_) {
+      return true;
+    }
+    if (!GetBinlogFiles(&binlogs)) {
+      LOG(WARNING) << "Could not get binlog files!"
+        << ", Partition: " << table_name_ << "_" << partition_id_; 
+      return false;
+    }
   }
 
   if (binlogs.size() <= kBinlogRemainMinCount) {
@@ -1189,29 +2086,85 @@ bool Partition::PurgeFiles(uint32_t to, bool manual) {
   }
 
   int delete_num = 0;
+  uint64_t delete_bytes = 0;
   struct stat file_stat;
   int remain_expire_num = binlogs.size() - kBinlogRemainMaxCount;
   std::map<uint32_t, std::string>::iterator it;
 
+  // Trickle the unlinks instead of dropping dozens of files at once,
+  // a burst of big deletions stalls the disk the foreground is using
+  uint64_t begin_us = slash::NowMicros();
+  uint64_t files_per_sec = g_zp_conf->purge_files_per_sec();
+  uint64_t bytes_per_sec =
+    static_cast<uint64_t>(g_zp_conf->purge_mb_per_sec()) * 1024 * 1024;
+  int defer_qps = g_zp_conf->purge_defer_qps();
+
   for (it = binlogs.begin(); it != binlogs.end(); ++it) {
+    bool has_stat =
+      (stat(((log_path_ + it->second)).c_str(), &file_stat) == 0);
     if ((manual && it->first <= to) ||           // Argument bound
         remain_expire_num > 0 ||                 // Expire num trigger
-        (stat(((log_path_ + it->second)).c_str(), &file_stat) == 0 &&
+        (has_stat &&
          file_stat.st_mtime < time(NULL) - kBinlogRemainMaxDay*24*3600)) {  // Expire time trigger
-      // We check this every time to avoid lock when we do file deletion
-      if (!CouldPurge(it->first)) {
-        return false;
+      // Leave the remainder to the next cron purge when the
+      // foreground is busy, the files only get more eligible
+      if (defer_qps >= 0) {
+        Statistic qps_stat;
+        zp_data_server->GetTotalStat(StatType::kClient, &qps_stat);
+        if (qps_stat.last_qps > static_cast<uint64_t>(defer_qps)) {
+          LOG(INFO) << "Purge deferred by qps " << qps_stat.last_qps
+            << " after " << delete_num << " files for "
+            << table_name_ << "_" << partition_id_;
+          break;
+        }
       }
 
-      // Do delete
-      slash::Status s = slash::DeleteFile(log_path_ + it->second);
-      if (s.ok()) {
-        ++delete_num;
-        --remain_expire_num;
-      } else {
-        LOG(WARNING) << "Purge log file : " << (it->second)
-          << " failed! error:" << s.ToString()
-          << ", Partition: " << table_name_ << "_" << partition_id_; 
+      // Seal the file into the archive before it goes, compressed
+      // it extends the incremental resync window on a budget;
+      // done outside the state lock, gzip of a full binlog is slow
+      if (g_zp_conf->binlog_archive_mb() > 0
+          && !ArchiveBinlogFile(it->first, it->second)) {
+        LOG(WARNING) << "Binlog " << it->second
+          << " leaves the resync window unarchived on purge"
+          << ", Partition: " << table_name_ << "_" << partition_id_;
+      }
+
+      {
+        // Reacquire per file so a long purge never pins the
+        // partition state lock across the whole batch
+        slash::RWLock l(&state_rw_, false);
+        if (!opened_) {
+          return true;
+        }
+        // We check this every time to avoid lock when we do file deletion
+        if (!CouldPurge(it->first)) {
+          return false;
+        }
+
+        // Do delete
+        slash::Status s = slash::DeleteFile(log_path_ + it->second);
+        if (!s.ok()) {
+          LOG(WARNING) << "Purge log file : " << (it->second)
+            << " failed! error:" << s.ToString()
+            << ", Partition: " << table_name_ << "_" << partition_id_; 
+          continue;
+        }
+      }
+      ++delete_num;
+      --remain_expire_num;
+      if (has_stat) {
+        delete_bytes += file_stat.st_size;
+      }
+
+      // Sleep whatever is needed to stay under both per-second caps
+      uint64_t expect_us = delete_num * 1000000 / files_per_sec;
+      uint64_t bytes_us = delete_bytes * 1000000 / bytes_per_sec;
+      if (bytes_us > expect_us) {
+        expect_us = bytes_us;
+      }
+      uint64_t elapsed_us = slash::NowMicros() - begin_us;
+      if (expect_us > elapsed_us) {
+        usleep(expect_us - elapsed_us);
       }
     } else {
       // Break when face the first one not satisfied
@@ -1224,6 +2177,9 @@ bool Partition::PurgeFiles(uint32_t to, bool manual) {
       << table_name_ << "_" << partition_id_;
   }
 
+  // Also collects leftovers after the archive was sized down or off
+  TrimArchive();
+
   return true;
 }
 
@@ -1311,6 +2267,11 @@ bool Partition::CouldPurge(uint32_t index) {
 
   std::set<Node>::iterator it;
   slash::RWLock lp(&purged_index_rw_, true);
+  if (!restore_floors_.empty() && index >= *restore_floors_.begin()) {
+    // A trysync is mid restore from the archive with no send task
+    // registered yet, do not delete what it is bringing back
+    return false;
+  }
   for (it = slave_nodes_.begin(); it != slave_nodes_.end(); ++it) {
     int32_t filenum = zp_data_server->GetBinlogSendFilenum(table_name_,
         partition_id_, Node((*it).ip, (*it).port + kPortShiftSync));
@@ -1322,11 +2283,38 @@ bool Partition::CouldPurge(uint32_t index) {
   return true;
 }
 
+// Rebuild the state snapshot served to info commands, which read it
+// under snapshot_mu_ alone instead of competing with topology changes
+// for state_rw_
+// Required: hold lock of state_rw_
+void Partition::RefreshStateSnapshot() {
+  StateSnapshot fresh;
+  fresh.opened = opened_;
+  fresh.master_node = master_node_;
+  fresh.slave_nodes = slave_nodes_;
+  fresh.pstate = pstate_;
+  fresh.role = role_;
+  fresh.repl_state = repl_state_;
+  if (opened_) {
+    GetBinlogOffset(&fresh.boffset);
+  }
+  {
+    slash::RWLock l(&fallback_rw_, false);
+    fresh.fallback = fallback_;
+  }
+  slash::MutexLock l(&snapshot_mu_);
+  state_snapshot_ = fresh;
+}
+
 void Partition::Dump() {
-  slash::RWLock l(&state_rw_, false);
+  StateSnapshot snapshot;
+  {
+    slash::MutexLock l(&snapshot_mu_);
+    snapshot = state_snapshot_;
+  }
   LOG(INFO) << "----------------------------";
   LOG(INFO) << "  +Partition    " << partition_id_;
-  switch (role_) {
+  switch (snapshot.role) {
     case Role::kNodeMaster:
       LOG(INFO) << "  +I'm master";
       break;
@@ -1336,28 +2324,31 @@ void Partition::Dump() {
     default:
       LOG(INFO) << "  +I'm single";
   }
-  if (pstate_ == ZPMeta::PState::ACTIVE) {
+  if (snapshot.pstate == ZPMeta::PState::ACTIVE) {
     LOG(INFO) << "     -*State ACTIVE";
-  } else if (pstate_ == ZPMeta::PState::STUCK) {
+  } else if (snapshot.pstate == ZPMeta::PState::STUCK) {
     LOG(INFO) << "     -*State STUCK";
   }
-  LOG(INFO) << "     -*Master node " << master_node_;
-  for (auto& slave : slave_nodes_) {
+  LOG(INFO) << "     -*Master node " << snapshot.master_node;
+  for (auto& slave : snapshot.slave_nodes) {
     LOG(INFO) << "     -* slave  " <<  slave;
   }
 }
 
 bool Partition::GetState(client::PartitionState* state) {
   state->set_partition_id(partition_id_);
-  slash::RWLock l(&state_rw_, false);
-  if (!opened_) {
+
+  // Serve from the snapshot, whose binlog offset is as fresh as the
+  // last timing task turn, which is enough for monitoring
+  slash::MutexLock l(&snapshot_mu_);
+  if (!state_snapshot_.opened) {
     return false;
   }
-  state->set_role(RoleMsg[role_]);
-  state->set_repl_state(ReplStateMsg[repl_state_]);
-  state->mutable_master()->set_ip(master_node_.ip);
-  state->mutable_master()->set_port(master_node_.port);
-  for (auto& s : slave_nodes_) {
+  state->set_role(RoleMsg[state_snapshot_.role]);
+  state->set_repl_state(ReplStateMsg[state_snapshot_.repl_state]);
+  state->mutable_master()->set_ip(state_snapshot_.master_node.ip);
+  state->mutable_master()->set_port(state_snapshot_.master_node.port);
+  for (auto& s : state_snapshot_.slave_nodes) {
     client::Node* slave = state->add_slaves();
     slave->set_ip(s.ip);
     slave->set_port(s.port);
@@ -1365,26 +2356,20 @@ bool Partition::GetState(client::PartitionState* state) {
 
   // SyncOffset
   client::SyncOffset* sync_offset = state->mutable_sync_offset();
-  BinlogOffset boffset;
-  GetBinlogOffset(&boffset);
-  sync_offset->set_filenum(boffset.filenum);
-  sync_offset->set_offset(boffset.offset);
+  sync_offset->set_filenum(state_snapshot_.boffset.filenum);
+  sync_offset->set_offset(state_snapshot_.boffset.offset);
 
   // Fallback
-  if (role_ == Role::kNodeSlave) {
-    slash::RWLock l(&fallback_rw_, false);
-    if (fallback_.time == 0) {
-      // No fallback
-      return true;
-    }
+  if (state_snapshot_.role == Role::kNodeSlave
+      && state_snapshot_.fallback.time != 0) {
     client::SlaveFallback* fallback = state->mutable_fallback();
-    fallback->set_time(fallback_.time);
+    fallback->set_time(state_snapshot_.fallback.time);
     client::SyncOffset* before = fallback->mutable_before();
-    before->set_filenum(fallback_.before.filenum);
-    before->set_offset(fallback_.before.offset);
+    before->set_filenum(state_snapshot_.fallback.before.filenum);
+    before->set_offset(state_snapshot_.fallback.before.offset);
     client::SyncOffset* after = fallback->mutable_after();
-    after->set_filenum(fallback_.after.filenum);
-    after->set_offset(fallback_.after.offset);
+    after->set_filenum(state_snapshot_.fallback.after.filenum);
+    after->set_offset(state_snapshot_.fallback.after.offset);
   }
   return true;
 }
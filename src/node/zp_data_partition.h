@@ -112,6 +112,9 @@ struct PartitionSyncOption {
 
 struct CheckpointContent {
   std::vector<std::string> live_files;
+  // Unchanged SSTs already present in the previous dump,
+  // brought over as hard links instead of re-materialized
+  std::vector<std::string> inherited_files;
   rocksdb::VectorLogPtr live_wal_files;
   uint64_t manifest_file_size;
   uint64_t sequence_number;
@@ -177,20 +180,31 @@ class Partition  {
   // Command related
   void DoBinlogCommand(const PartitionSyncOption& option,
       const Cmd* cmd, const client::CmdRequest &req);
+  void DoBinlogCommandBatch(const PartitionSyncOption& option,
+      const std::vector<const Cmd*>& cmds,
+      const std::vector<client::CmdRequest>& reqs);
+  // raw_request may carry the wire bytes req was parsed from, a
+  // write whose log equals the request then binlogs them in place
   void DoCommand(const Cmd* cmd, const client::CmdRequest &req,
-      client::CmdResponse *res);
+      client::CmdResponse *res, const Slice& raw_request = Slice());
   void DoBinlogSkip(const PartitionSyncOption& option, uint64_t gap);
   void DoBinlogLeaseRenew(const PartitionSyncOption& option, uint64_t lease);
 
   // Status related
   bool ShouldTrySync();
   void TrySyncDone();
+  void RecordMasterRtt(uint64_t rtt_us);
   bool TryUpdateMasterOffset();
   bool ShouldWaitDBSync();
   void SetWaitDBSync();
   void WaitDBSyncDone();
 
   // Partition node related
+  // Per table rocksdb overlay carried by meta, must be set before the
+  // first Update so Open sees it
+  void SetTableOptions(const ZPMeta::TableOptions& options) {
+    table_options_.CopyFrom(options);
+  }
   void Update(ZPMeta::PState state, const Node& master,
       const std::set<Node> &slaves);
   void Leave();
@@ -200,6 +214,9 @@ class Partition  {
   Status SlaveAskSync(const Node &node, BinlogOffset boffset);
   bool GetBinlogOffsetWithLock(BinlogOffset* boffset);
   Status SetBinlogOffsetWithLock(const BinlogOffset& target);
+  Status GetCachedBinlog(uint32_t filenum, uint64_t offset,
+      std::string* record, uint64_t* length);
+  void RecordSlaveAck(const std::string& node, const BinlogOffset& boffset);
 
   // State related
   void Dump();
@@ -207,6 +224,8 @@ class Partition  {
   bool GetState(client::PartitionState* state);
 
   void DoTimingTask();
+  void ScheduleTimingTask();
+  void ApplyDBOptions(const std::map<std::string, std::string>& options);
 
  private:
   std::string table_name_;
@@ -235,9 +254,13 @@ class Partition  {
   void BecomeMaster();
   void BecomeSlave();
   bool CheckSyncOption(const PartitionSyncOption& option, bool has_offset = true);
+  bool StaleReadOk();
 
   // DB related
   rocksdb::DBNemo *db_;
+  ZPMeta::TableOptions table_options_;
+  // Node-wide db_options_ with table_options_ overlaid
+  rocksdb::Options OpenOptions() const;
 
   // Binlog related
   Binlog* logger_;
@@ -246,9 +269,25 @@ class Partition  {
   bool GetBinlogOffset(BinlogOffset* boffset) const;
 
   // DoCommand related
-  slash::RecordMutex mutex_record_;
+  // Striped write-path key lock: a key maps to a fixed stripe,
+  // unlike RecordMutex no allocation or map mutation per operation.
+  // A multi key write locks the stripes of all its keys, sorted and
+  // deduped, so overlapping writers cannot deadlock
+  slash::Mutex record_lock_stripes_[kRecordLockStripes];
+  size_t RecordLockStripe(const std::string& key) const {
+    return std::hash<std::string>()(key) % kRecordLockStripes;
+  }
   pthread_rwlock_t suspend_rw_;  // To suspend others
 
+  // Write ack related
+  // A write carrying ack_replicas blocks its worker on ack_cond_
+  // until enough slaves reported applied offsets covering it
+  slash::Mutex ack_mu_;
+  slash::CondVar ack_cond_;
+  std::map<std::string, BinlogOffset> slave_acked_;
+  bool WaitSlaveAck(const BinlogOffset& target, int replicas);
+  void SendSyncAck();
+
   // Recover sync related
   // Be used only in the role of kNodeSlave
   std::atomic<bool> do_recovery_sync_;
@@ -262,6 +301,13 @@ class Partition  {
                                       //set by masters' binlog sender
   std::atomic<int> stuck_recover_sync_flag_;  // how mand cron times
                                               // stuck out of kConnect
+  // Smoothed master round trip measured on trysync, it sizes the
+  // lease slack and the recover delays for the distance to master
+  std::atomic<uint64_t> master_rtt_us_;
+  std::atomic<uint64_t> last_recover_time_;
+  int RecoverSyncDelayCrons();
+  int StuckRecoverSyncDelayCrons();
+  uint64_t SyncLeaseSlackUs();
 
   // BGSave related
   slash::Mutex bgsave_protector_;
@@ -272,6 +318,8 @@ class Partition  {
   bool InitBgsaveEnv();
   bool InitBgsaveContent(rocksdb::DBNemoCheckpoint* cp,
     CheckpointContent* content);
+  bool LinkInheritedFiles(const std::vector<std::string>& files,
+    const std::string& new_path);
   BGSaveInfo bgsave_info() {
     slash::MutexLock l(&bgsave_protector_);
     return bgsave_info_;
@@ -290,12 +338,40 @@ class Partition  {
   Status ChangeDb(const std::string& new_path);
   void DBSyncSendFile(const std::string& ip, int port);
 
+  // Trash related
+  // Rename path aside under trash with a unique name and hand it to a
+  // bgpurge worker, so FlushDb and Leave never delete data in line and
+  // the disk comes back without an operator run of tools/empty_trash
+  std::string MoveAsideToTrash(const std::string& path,
+      const std::string& prefix);
+  static void DoReclaimTrash(void* arg);
+  static void ReclaimTrash(const std::string& path);
+
+  // Cron related
+  // One tick of a partition in flight at most, a tick still
+  // underway on its cron worker just swallows the next one
+  std::atomic<bool> cron_pending_;
+  static void DoCronTask(void* arg);
+
   // Purge binlog related
   std::atomic<bool> purging_;
+  // Compressed sealed-binlog archive under the partition log path;
+  // purge feeds it instead of dropping files outright, SlaveAskSync
+  // restores from it to spare a lagging slave the full DBSync
+  std::string ArchivePath(uint32_t index);
+  bool GetArchiveFiles(std::map<uint32_t, std::string>* archives);
+  bool ArchiveBinlogFile(uint32_t index, const std::string& name);
+  bool RestoreArchivedBinlogs(uint32_t from, uint32_t to);
+  void TrimArchive();
   // protect purge index between purge thread and trysync command
   // Notice purged_index_rw_ should lock after state_rw_
   pthread_rwlock_t purged_index_rw_;
   uint32_t purged_index_;  // binlog before which has or will be purged
+  // Floors pinned by trysyncs mid restore from the archive, their
+  // slaves have no send task yet so CouldPurge would otherwise see
+  // no constraint and delete the files being brought back;
+  // guarded by purged_index_rw_
+  std::multiset<uint32_t> restore_floors_;
   bool GetBinlogFiles(std::map<uint32_t, std::string>* binlogs);
   static void DoPurgeLogs(void* arg);
   bool CouldPurge(uint32_t index);
@@ -306,13 +382,40 @@ class Partition  {
   pthread_rwlock_t fallback_rw_;  // protect partition status below
   FallbackInfo fallback_;
 
+  // Snapshot of the status fields above plus binlog offset and fallback,
+  // rebuilt by the write side after every state change and by the timing
+  // task, so that info commands are served under snapshot_mu_ alone and
+  // never compete with topology changes for state_rw_
+  struct StateSnapshot {
+    bool opened;
+    Node master_node;
+    std::set<Node> slave_nodes;
+    ZPMeta::PState pstate;
+    Role role;
+    int repl_state;
+    BinlogOffset boffset;
+    FallbackInfo fallback;
+    StateSnapshot()
+      : opened(false),
+      pstate(ZPMeta::PState::ACTIVE),
+      role(Role::kNodeSingle),
+      repl_state(ReplState::kNoConnect) {
+        fallback.time = 0;
+      }
+  };
+  slash::Mutex snapshot_mu_;
+  StateSnapshot state_snapshot_;
+  void RefreshStateSnapshot();  // Required: hold lock of state_rw_
+
   // Lock order:
   // state_rw_      >       suspend_rw_         >       bgsave_protector_
-  // state_rw_      >       suspend_rw_         >       mutex_record_
+  // state_rw_      >       suspend_rw_         >       record_lock_stripes_
   // state_rw_      >       bgsave_protector_
   // state_rw_      >       db_sync_protector_
   // state_rw_      >       purged_index_rw_
   // state_rw_      >       fallback_rw_
+  // state_rw_      >       ack_mu_
+  // state_rw_      >       snapshot_mu_
 
   Partition(const Partition&);
   void operator=(const Partition&);
@@ -21,25 +21,32 @@
 #include <utility>
 #include <fstream>
 
+#include "rocksdb/cache.h"
+#include "rocksdb/env.h"
+#include "rocksdb/rate_limiter.h"
 #include "rocksdb/table.h"
-#include "slash/include/rsync.h"
 
 #include "src/node/zp_sync_conn.h"
 #include "src/node/zp_data_client_conn.h"
 
 ZPDataServer::ZPDataServer()
   : table_count_(0),
+  binlog_send_pool_(g_zp_conf->sync_send_thread_num()),
   should_exit_(false),
+  conf_reload_pending_(false),
   meta_index_(-1),
   meta_port_(0),
   meta_epoch_(-1),
-  should_pull_meta_(false) {
+  should_pull_meta_(false),
+  slowlog_next_(0) {
     pthread_rwlock_init(&meta_state_rw_, NULL);
     pthread_rwlockattr_t attr;
     pthread_rwlockattr_init(&attr);
     pthread_rwlockattr_setkind_np(&attr,
         PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
     pthread_rwlock_init(&table_rw_, &attr);
+    std::atomic_store(&table_route_,
+        std::shared_ptr<const TableMap>(new TableMap()));
     LOG(INFO) << "ZPNodeServer start initialization";
 
     // Try to raise the limit of open files
@@ -96,8 +103,10 @@ ZPDataServer::ZPDataServer()
     zp_binlog_receiver_thread_->set_thread_name("ZPDataSyncDispatch");
 
     // Binlog send
+    // Bind every worker to one shard of the task pool
     for (int i = 0; i < g_zp_conf->sync_send_thread_num(); ++i) {
-      ZPBinlogSendThread *thread = new ZPBinlogSendThread(&binlog_send_pool_);
+      ZPBinlogSendThread *thread =
+        new ZPBinlogSendThread(&binlog_send_pool_, i);
       binlog_send_workers_.push_back(thread);
     }
 
@@ -116,6 +125,18 @@ ZPDataServer::ZPDataServer()
     zp_dispatch_thread_->set_keepalive_timeout(kKeepAlive);
     zp_dispatch_thread_->set_thread_name("ZPDataDispatch");
 
+    // Background worker pools for bgsave and binlog purge
+    for (int i = 0; i < g_zp_conf->bgsave_thread_num(); i++) {
+      bgsave_workers_.push_back(new pink::BGThread());
+    }
+    for (int i = 0; i < g_zp_conf->bgpurge_thread_num(); i++) {
+      bgpurge_workers_.push_back(new pink::BGThread());
+    }
+    // Sharded partition cron
+    for (int i = 0; i < kPartitionCronWorkerNum; i++) {
+      cron_workers_.push_back(new pink::BGThread());
+    }
+
     // Ping
     zp_ping_thread_ = new ZPPingThread();
 
@@ -125,6 +146,7 @@ ZPDataServer::ZPDataServer()
 
 ZPDataServer::~ZPDataServer() {
   LOG(INFO) << "ZPDataServer destoryed";
+  CoarseClock::Stop();
   // Order:
   // 1, Meta thread should before trysync thread
   // 2, binlog reciever should before recieve bgworker
@@ -145,11 +167,11 @@ ZPDataServer::~ZPDataServer() {
 
   {
     slash::MutexLock l(&mutex_peers_);
-    auto iter = peers_.begin();
-    while (iter != peers_.end()) {
-      iter->second->Close();
-      delete iter->second;
-      iter++;
+    for (auto& peer : peers_) {
+      for (auto cli : peer.second) {
+        cli->Close();
+        delete cli;
+      }
     }
   }
   LOG(INFO) << "Peers client exit!";
@@ -177,8 +199,18 @@ ZPDataServer::~ZPDataServer() {
   delete zp_metacmd_bgworker_;
 
   LOG(INFO) << " All Tables exit!!!";
-  bgsave_thread_.StopThread();
-  bgpurge_thread_.StopThread();
+  for (auto& worker : bgsave_workers_) {
+    worker->StopThread();
+    delete worker;
+  }
+  for (auto& worker : bgpurge_workers_) {
+    worker->StopThread();
+    delete worker;
+  }
+  for (auto& worker : cron_workers_) {
+    worker->StopThread();
+    delete worker;
+  }
 
   DestoryCmdTable(cmds_);
   pthread_rwlock_destroy(&meta_state_rw_);
@@ -214,6 +246,14 @@ void ZPDataServer::InitDBOptions() {
 
   block_based_table_options.block_size = g_zp_conf->db_block_size() * 1024;
 
+  // block cache total, shared by all partition DBs through the one
+  // table factory below, as write_buffer_manager shares the memtable
+  // budget, so the per-partition count doesn't multiply the memory
+  db_block_cache_ =
+    rocksdb::NewLRUCache(
+        static_cast<size_t>(g_zp_conf->db_block_cache_size()) * 1024);
+  block_based_table_options.block_cache = db_block_cache_;
+
   db_options_.table_factory.reset(
      NewBlockBasedTableFactory(block_based_table_options));
 
@@ -221,21 +261,65 @@ void ZPDataServer::InitDBOptions() {
   db_options_.max_background_compactions
     = g_zp_conf->max_background_compactions();
 
+  // flush+compaction write budget, one limiter shared by all partition
+  // DBs through the copied options, as the block cache above
+  if (g_zp_conf->db_rate_limit() > 0) {
+    db_options_.rate_limiter.reset(
+        rocksdb::NewGenericRateLimiter(
+          static_cast<int64_t>(g_zp_conf->db_rate_limit()) * 1024 * 1024));
+  }
+
+  // Drop the flush and compaction thread pools to a lower I/O class,
+  // so a compaction burst yields the disk to foreground reads
+  rocksdb::Env::Default()->LowerThreadPoolIOPriority(rocksdb::Env::HIGH);
+  rocksdb::Env::Default()->LowerThreadPoolIOPriority(rocksdb::Env::LOW);
+
   db_options_.create_if_missing = true;
 }
 
 Status ZPDataServer::Start() {
-  if (pink::RetCode::kSuccess != zp_dispatch_thread_->StartThread()) {
-    LOG(FATAL) << "Dispatch thread start failed";
-    return Status::Corruption("Dispatch thread start failed!");
+  CoarseClock::Start();
+
+  // Threads inherit the affinity mask of their creator, so the
+  // groups are pinned by switching this thread's mask around their
+  // StartThread calls. The background cpuset stays on for the rest
+  // of Start, everything spawned later (ping, metacmd, trysync,
+  // partition opening and the rocksdb threads it brings up, the
+  // bgsave/bgpurge/cron pools below) lands there, and with each
+  // group held to one NUMA node its memory follows by first touch.
+  ScopedCpuSet background_pin(g_zp_conf->background_thread_cpuset());
+
+  {
+    ScopedCpuSet pin(g_zp_conf->data_thread_cpuset());
+    if (pink::RetCode::kSuccess != zp_dispatch_thread_->StartThread()) {
+      LOG(FATAL) << "Dispatch thread start failed";
+      return Status::Corruption("Dispatch thread start failed!");
+    }
   }
   LOG(INFO) << "Dispatch thread started";
 
-  if (pink::RetCode::kSuccess != zp_binlog_receiver_thread_->StartThread()) {
-    LOG(FATAL) << "Binlog receiver thread start failed";
-    return Status::Corruption("Binlog receiver thread start failed!");
+  {
+    // Covers the receive dispatcher and its workers; the receive
+    // bgworkers and send workers started below follow since their
+    // threads come up from this scope or from those workers
+    ScopedCpuSet pin(g_zp_conf->sync_thread_cpuset());
+    if (pink::RetCode::kSuccess != zp_binlog_receiver_thread_->StartThread()) {
+      LOG(FATAL) << "Binlog receiver thread start failed";
+      return Status::Corruption("Binlog receiver thread start failed!");
+    }
+    LOG(INFO) << "Binlog receiver dispatch thread started";
+
+    std::vector<ZPBinlogSendThread*>::iterator bsit
+      = binlog_send_workers_.begin();
+    for (; bsit != binlog_send_workers_.end(); ++bsit) {
+      LOG(INFO) << "Start one binlog send worker thread";
+      if (pink::RetCode::kSuccess != (*bsit)->StartThread()) {
+        LOG(FATAL) << "Binlog send worker start failed";
+        return Status::Corruption("Binlog send worker start failed!");
+      }
+    }
+    LOG(INFO) << "Binlog sender thread started";
   }
-  LOG(INFO) << "Binlog receiver dispatch thread started";
 
   if (pink::RetCode::kSuccess != zp_ping_thread_->StartThread()) {
     LOG(FATAL) << "Ping thread start failed";
@@ -243,16 +327,26 @@ Status ZPDataServer::Start() {
   }
   LOG(INFO) << "Ping thread started";
 
-  std::vector<ZPBinlogSendThread*>::iterator bsit
-    = binlog_send_workers_.begin();
-  for (; bsit != binlog_send_workers_.end(); ++bsit) {
-    LOG(INFO) << "Start one binlog send worker thread";
-    if (pink::RetCode::kSuccess != (*bsit)->StartThread()) {
-      LOG(FATAL) << "Binlog send worker start failed";
-      return Status::Corruption("Binlog send worker start failed!");
+  // Start the background pools now so they inherit this thread's
+  // mask, the schedule-time StartThread then is a no-op
+  {
+    slash::MutexLock l(&bgsave_thread_protector_);
+    for (auto& worker : bgsave_workers_) {
+      worker->StartThread();
+    }
+  }
+  {
+    slash::MutexLock l(&bgpurge_thread_protector_);
+    for (auto& worker : bgpurge_workers_) {
+      worker->StartThread();
+    }
+  }
+  {
+    slash::MutexLock l(&cron_thread_protector_);
+    for (auto& worker : cron_workers_) {
+      worker->StartThread();
     }
   }
-  LOG(INFO) << "Binlog sender thread started";
 
   auto iter = g_zp_conf->meta_addr().begin();
   while (iter != g_zp_conf->meta_addr().end()) {
@@ -261,6 +355,9 @@ Status ZPDataServer::Start() {
   }
 
   while (!should_exit_) {
+    if (conf_reload_pending_.exchange(false)) {
+      DoConfReload();
+    }
     DoTimingTask();
     int sleep_count = kNodeCronWaitCount;
     while (!should_exit_ && sleep_count-- > 0) {
@@ -325,11 +422,20 @@ Status ZPDataServer::SendToPeer(const Node &node,
   pink::Status res;
   std::string ip_port = slash::IpPortString(node.ip, node.port);
 
-  slash::MutexLock pl(&mutex_peers_);
-  std::unordered_map<std::string, pink::PinkCli*>::iterator iter
-    = peers_.find(ip_port);
-  if (iter == peers_.end()) {
-    pink::PinkCli *cli = pink::NewPbCli();
+  // Check a free connection out, so neither the connect nor the send
+  // below runs under mutex_peers_ and senders to one node go parallel
+  pink::PinkCli* cli = NULL;
+  {
+    slash::MutexLock pl(&mutex_peers_);
+    std::vector<pink::PinkCli*>& free_conns = peers_[ip_port];
+    if (!free_conns.empty()) {
+      cli = free_conns.back();
+      free_conns.pop_back();
+    }
+  }
+
+  if (cli == NULL) {
+    cli = pink::NewPbCli();
     res = cli->Connect(node.ip, node.port);
     if (!res.ok()) {
       cli->Close();
@@ -338,18 +444,18 @@ Status ZPDataServer::SendToPeer(const Node &node,
     }
     cli->set_send_timeout(1000);
     cli->set_recv_timeout(1000);
-    iter = (peers_.insert(std::pair<std::string,
-          pink::PinkCli*>(ip_port, cli))).first;
   }
 
-  res = iter->second->Send(const_cast<client::SyncRequest*>(&msg));
+  res = cli->Send(const_cast<client::SyncRequest*>(&msg));
   if (!res.ok()) {
-    // Remove when second Failed, retry outside
-    iter->second->Close();
-    delete iter->second;
-    peers_.erase(iter);
+    // Drop the broken connection, retry outside rebuilds one
+    cli->Close();
+    delete cli;
     return Status::Corruption(res.ToString());
   }
+
+  slash::MutexLock pl(&mutex_peers_);
+  peers_[ip_port].push_back(cli);
   return Status::OK();
 }
 
@@ -363,6 +469,10 @@ std::shared_ptr<Table> ZPDataServer::GetOrAddTable(const std::string &tname) {
   std::shared_ptr<Table> table = NewTable(tname,
       g_zp_conf->log_path(), g_zp_conf->data_path(), g_zp_conf->trash_path());
   tables_[tname] = table;
+
+  // Republish the routing snapshot, still under table_rw_ write lock
+  std::atomic_store(&table_route_,
+      std::shared_ptr<const TableMap>(new TableMap(tables_)));
   return table;
 }
 
@@ -373,6 +483,9 @@ void ZPDataServer::DeleteTable(const std::string &table_name) {
     it->second->LeaveAllPartition();
   }
   tables_.erase(table_name);
+
+  std::atomic_store(&table_route_,
+      std::shared_ptr<const TableMap>(new TableMap(tables_)));
 }
 
 // Required: hold table_rw_
@@ -384,6 +497,17 @@ std::shared_ptr<Table> ZPDataServer::GetTable(const std::string &table_name) {
   return NULL;
 }
 
+// Lock-free: route through the immutable snapshot,
+// table topology only changes on meta epoch update
+std::shared_ptr<Table> ZPDataServer::LookupTable(const std::string &table_name) {
+  std::shared_ptr<const TableMap> route = std::atomic_load(&table_route_);
+  auto it = route->find(table_name);
+  if (it != route->end()) {
+    return it->second;
+  }
+  return NULL;
+}
+
 // We will dump all tables when table_name is empty.
 void ZPDataServer::DumpTableBinlogOffsets(const std::string &table_name,
     TablePartitionOffsets *all_offset) {
@@ -408,35 +532,47 @@ void ZPDataServer::DumpTableBinlogOffsets(const std::string &table_name,
 
 std::shared_ptr<Partition> ZPDataServer::GetTablePartition(
     const std::string &table_name, const std::string &key) {
-  slash::RWLock l(&table_rw_, false);
-  std::shared_ptr<Table> table = GetTable(table_name);
+  std::shared_ptr<Table> table = LookupTable(table_name);
   return table ? table->GetPartition(key) : NULL;
 }
 
 std::shared_ptr<Partition> ZPDataServer::GetTablePartitionById(
     const std::string &table_name, const int partition_id) {
-  slash::RWLock l(&table_rw_, false);
-  std::shared_ptr<Table> table = GetTable(table_name);
+  std::shared_ptr<Table> table = LookupTable(table_name);
   return table ? table->GetPartitionById(partition_id) : NULL;
 }
 
 int ZPDataServer::KeyToPartition(const std::string& table_name,
     const std::string &key) {
-  slash::RWLock l(&table_rw_, false);
-  std::shared_ptr<Table> table = GetTable(table_name);
+  std::shared_ptr<Table> table = LookupTable(table_name);
   return table ? table->KeyToPartition(key) : -1;
 }
 
-void ZPDataServer::BGSaveTaskSchedule(void (*function)(void*), void* arg) {
+void ZPDataServer::BGSaveTaskSchedule(void (*function)(void*), void* arg,
+    uint64_t partition_key) {
   slash::MutexLock l(&bgsave_thread_protector_);
-  bgsave_thread_.StartThread();
-  bgsave_thread_.Schedule(function, arg);
+  pink::BGThread* worker = bgsave_workers_[
+    partition_key % bgsave_workers_.size()];
+  worker->StartThread();
+  worker->Schedule(function, arg);
 }
 
-void ZPDataServer::BGPurgeTaskSchedule(void (*function)(void*), void* arg) {
+void ZPDataServer::BGPurgeTaskSchedule(void (*function)(void*), void* arg,
+    uint64_t partition_key) {
   slash::MutexLock l(&bgpurge_thread_protector_);
-  bgpurge_thread_.StartThread();
-  bgpurge_thread_.Schedule(function, arg);
+  pink::BGThread* worker = bgpurge_workers_[
+    partition_key % bgpurge_workers_.size()];
+  worker->StartThread();
+  worker->Schedule(function, arg);
+}
+
+void ZPDataServer::CronTaskSchedule(void (*function)(void*), void* arg,
+    uint64_t partition_key) {
+  slash::MutexLock l(&cron_thread_protector_);
+  pink::BGThread* worker = cron_workers_[
+    partition_key % cron_workers_.size()];
+  worker->StartThread();
+  worker->Schedule(function, arg);
 }
 
 // Add Task, remove first if already exist
@@ -490,11 +626,49 @@ void ZPDataServer::DispatchBinlogBGWorker(ZPBinlogReceiveTask *task) {
 //
 // Statistic related
 //
+// Each thread sticks to one shard picked round-robin on first use,
+// so concurrent PlusStat mostly lock distinct shard mutexes
+static int StatShardIndex(int shard_num) {
+  static std::atomic<int> next_shard(0);
+  static thread_local int shard_index = -1;
+  if (shard_index < 0) {
+    shard_index = next_shard++ % shard_num;
+  }
+  return shard_index;
+}
+
+// Rebuild the folded view from the shard counters,
+// required stats_[type].mu held by caller
+void ZPDataServer::FoldStat(ThreadStatistic* tstat) {
+  uint64_t other_querys = 0;
+  std::unordered_map<std::string, uint64_t> table_querys;
+  for (int i = 0; i < kStatShardNum; i++) {
+    slash::MutexLock l(&(tstat->shards[i].mu));
+    other_querys += tstat->shards[i].other_querys;
+    for (auto& item : tstat->shards[i].table_querys) {
+      table_querys[item.first] += item.second;
+    }
+  }
+
+  tstat->other_stat.querys = other_querys;
+  for (auto& item : table_querys) {
+    auto it = tstat->table_stats.find(item.first);
+    if (it == tstat->table_stats.end()) {
+      Statistic* pstat = new Statistic;
+      pstat->table_name = item.first;
+      it = tstat->table_stats.insert(
+          std::make_pair(item.first, pstat)).first;
+    }
+    (it->second)->querys = item.second;
+  }
+}
+
 bool ZPDataServer::GetStat(const StatType type,
     const std::string &table, Statistic* stat) {
   stat->Reset();
 
   slash::MutexLock l(&(stats_[type].mu));
+  FoldStat(&stats_[type]);
   auto it = stats_[type].table_stats.find(table);
   if (it == stats_[type].table_stats.end()) {
     return false;
@@ -504,25 +678,63 @@ bool ZPDataServer::GetStat(const StatType type,
 }
 
 void ZPDataServer::PlusStat(const StatType type, const std::string &table) {
-  slash::MutexLock l(&(stats_[type].mu));
+  StatShard* shard = &(stats_[type].shards[StatShardIndex(kStatShardNum)]);
+  slash::MutexLock l(&(shard->mu));
   if (table.empty()) {
-    stats_[type].other_stat.querys++;
+    shard->other_querys++;
   } else {
-    auto it = stats_[type].table_stats.find(table);
-    if (it == stats_[type].table_stats.end()) {
-      Statistic* pstat = new Statistic;
-      pstat->table_name = table;
-      pstat->querys++;
-      stats_[type].table_stats[table] = pstat;
-    } else {
-      (it->second)->querys++;
+    shard->table_querys[table]++;
+  }
+}
+
+void ZPDataServer::PlusLatency(int cmd_type, uint64_t duration_us) {
+  if (cmd_type < 0 || cmd_type >= client::Type_ARRAYSIZE) {
+    return;
+  }
+  latency_stats_[cmd_type].Add(duration_us);
+}
+
+void ZPDataServer::GetLatencyInfo(client::CmdResponse* response) {
+  for (int t = 0; t < client::Type_ARRAYSIZE; t++) {
+    uint64_t count = latency_stats_[t].Count();
+    if (count == 0) {
+      continue;
     }
+    client::CmdResponse_InfoLatency* info_latency =
+      response->add_info_latency();
+    info_latency->set_cmd_type(t);
+    info_latency->set_count(count);
+    info_latency->set_p50_us(latency_stats_[t].Quantile(0.50));
+    info_latency->set_p99_us(latency_stats_[t].Quantile(0.99));
+    info_latency->set_p999_us(latency_stats_[t].Quantile(0.999));
+  }
+}
+
+void ZPDataServer::RecordSlowlog(const client::CmdResponse_InfoSlowlog& entry) {
+  slash::MutexLock l(&slowlog_mutex_);
+  if (slowlog_ring_.size() < kSlowlogMaxLen) {
+    slowlog_ring_.push_back(entry);
+  } else {
+    slowlog_ring_[slowlog_next_ % kSlowlogMaxLen].CopyFrom(entry);
+  }
+  slowlog_next_++;
+}
+
+void ZPDataServer::GetSlowlogInfo(client::CmdResponse* response) {
+  slash::MutexLock l(&slowlog_mutex_);
+  // Oldest first, the latest slow request ends up at the tail
+  size_t begin = slowlog_ring_.size() < kSlowlogMaxLen
+    ? 0 : slowlog_next_ % kSlowlogMaxLen;
+  for (size_t i = 0; i < slowlog_ring_.size(); i++) {
+    response->add_info_slowlog()->CopyFrom(
+        slowlog_ring_[(begin + i) % slowlog_ring_.size()]);
   }
 }
 
 void ZPDataServer::ResetLastStat(const StatType type) {
   uint64_t cur_time_us = slash::NowMicros();
   slash::MutexLock l(&(stats_[type].mu));
+  FoldStat(&stats_[type]);
   for (auto it = stats_[type].table_stats.begin();
        it != stats_[type].table_stats.end(); it++) {
     auto stat = it->second;
@@ -548,6 +760,7 @@ bool ZPDataServer::GetAllTableName(std::set<std::string>* table_names) {
 bool ZPDataServer::GetTotalStat(const StatType type, Statistic* stat) {
   stat->Reset();
   slash::MutexLock l(&(stats_[type].mu));
+  FoldStat(&stats_[type]);
   for (auto it = stats_[type].table_stats.begin();
        it != stats_[type].table_stats.end(); it++) {
     stat->Add(*(it->second));
@@ -650,6 +863,14 @@ void ZPDataServer::InitClientCmdTable() {
   Cmd* delptr = new DelCmd(kCmdFlagsKv | kCmdFlagsWrite);
   cmds_.insert(std::pair<int, Cmd*>(
         static_cast<int>(client::Type::DEL), delptr));
+  // CasCmd
+  Cmd* casptr = new CasCmd(kCmdFlagsKv | kCmdFlagsWrite);
+  cmds_.insert(std::pair<int, Cmd*>(
+        static_cast<int>(client::Type::CAS), casptr));
+  // IncrbyCmd
+  Cmd* incrbyptr = new IncrbyCmd(kCmdFlagsKv | kCmdFlagsWrite);
+  cmds_.insert(std::pair<int, Cmd*>(
+        static_cast<int>(client::Type::INCRBY), incrbyptr));
   // One InfoCmd handle many type queries;
   Cmd* infostatsptr = new InfoCmd(
       kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsMultiPartition);
@@ -667,6 +888,14 @@ void ZPDataServer::InitClientCmdTable() {
       kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsMultiPartition);
   cmds_.insert(std::pair<int, Cmd*>(
         static_cast<int>(client::Type::INFOSERVER), infoserver));
+  Cmd* infolatency = new InfoCmd(
+      kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsMultiPartition);
+  cmds_.insert(std::pair<int, Cmd*>(
+        static_cast<int>(client::Type::INFOLATENCY), infolatency));
+  Cmd* infoslowlog = new InfoCmd(
+      kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsMultiPartition);
+  cmds_.insert(std::pair<int, Cmd*>(
+        static_cast<int>(client::Type::INFOSLOWLOG), infoslowlog));
   // SyncCmd
   Cmd* syncptr = new SyncCmd(
       kCmdFlagsAdmin | kCmdFlagsRead | kCmdFlagsSuspend);
@@ -677,11 +906,104 @@ void ZPDataServer::InitClientCmdTable() {
       kCmdFlagsKv | kCmdFlagsRead | kCmdFlagsMultiPartition);
   cmds_.insert(std::pair<int, Cmd*>(
         static_cast<int>(client::Type::MGET), mgetptr));
+  // MsetCmd
+  Cmd* msetptr = new MsetCmd(
+      kCmdFlagsKv | kCmdFlagsWrite | kCmdFlagsMultiPartition);
+  cmds_.insert(std::pair<int, Cmd*>(
+        static_cast<int>(client::Type::MSET), msetptr));
   // FlushDBCmd
   Cmd* flushdbptr = new FlushDBCmd(
       kCmdFlagsAdmin | kCmdFlagsWrite | kCmdFlagsSuspend);
   cmds_.insert(std::pair<int, Cmd*>(
         static_cast<int>(client::Type::FLUSHDB), flushdbptr));
+  // ScanCmd
+  Cmd* scanptr = new ScanCmd(kCmdFlagsKv | kCmdFlagsRead);
+  cmds_.insert(std::pair<int, Cmd*>(
+        static_cast<int>(client::Type::SCAN), scanptr));
+}
+
+// Apply a SIGHUP conf reload. Settings read from g_zp_conf on every
+// use (slowlog, purge caps, sync leases, recover delays, DBSync
+// speed, value compression) take effect by themselves, the rest is
+// pushed into the running parts here. Thread counts of the network
+// dispatchers and of the sharded binlog send/receive workers stay at
+// their startup values: resharding those live would reorder the
+// per-partition work they are keyed on.
+void ZPDataServer::DoConfReload() {
+  LOG(INFO) << "Conf reload begin";
+  if (g_zp_conf->Reload() != 0) {
+    LOG(WARNING) << "Conf reload failed, keep running values";
+    return;
+  }
+  g_zp_conf->Dump();
+
+  // Grow the background pools, shrinking would drop queued tasks
+  {
+    slash::MutexLock l(&bgsave_thread_protector_);
+    while (static_cast<int>(bgsave_workers_.size())
+        < g_zp_conf->bgsave_thread_num()) {
+      bgsave_workers_.push_back(new pink::BGThread());
+      // Started here so the thread inherits this background-pinned one
+      bgsave_workers_.back()->StartThread();
+    }
+  }
+  {
+    slash::MutexLock l(&bgpurge_thread_protector_);
+    while (static_cast<int>(bgpurge_workers_.size())
+        < g_zp_conf->bgpurge_thread_num()) {
+      bgpurge_workers_.push_back(new pink::BGThread());
+      bgpurge_workers_.back()->StartThread();
+    }
+  }
+
+  // Lift the shared rocksdb flush and compaction pools, they only
+  // grow; new threads inherit the lowered I/O class
+  rocksdb::Env::Default()->IncBackgroundThreadsIfNeeded(
+      g_zp_conf->max_background_flushes(), rocksdb::Env::HIGH);
+  rocksdb::Env::Default()->IncBackgroundThreadsIfNeeded(
+      g_zp_conf->max_background_compactions(), rocksdb::Env::LOW);
+  rocksdb::Env::Default()->LowerThreadPoolIOPriority(rocksdb::Env::HIGH);
+  rocksdb::Env::Default()->LowerThreadPoolIOPriority(rocksdb::Env::LOW);
+
+  // Retune the shared write limiter in place, it cannot be added or
+  // fully removed live since every open DB copied the options
+  if (db_options_.rate_limiter) {
+    if (g_zp_conf->db_rate_limit() > 0) {
+      db_options_.rate_limiter->SetBytesPerSecond(
+          static_cast<int64_t>(g_zp_conf->db_rate_limit()) * 1024 * 1024);
+    } else {
+      LOG(WARNING) << "db_rate_limit 0 cannot disable the limiter live,"
+        << " keep the running limit";
+    }
+  } else if (g_zp_conf->db_rate_limit() > 0) {
+    LOG(WARNING) << "db_rate_limit needs a restart,"
+      << " the limiter was off at startup";
+  }
+
+  // Refresh the option template partitions opened later copy, and
+  // push the dynamic column family options into every open DB
+  db_options_.write_buffer_size = g_zp_conf->db_write_buffer_size() * 1024;
+  db_options_.max_bytes_for_level_base = 2 * db_options_.write_buffer_size;
+  db_options_.target_file_size_base =
+    g_zp_conf->db_target_file_size_base() * 1024;
+  db_options_.max_background_flushes = g_zp_conf->max_background_flushes();
+  db_options_.max_background_compactions
+    = g_zp_conf->max_background_compactions();
+
+  std::map<std::string, std::string> dynamic_options;
+  dynamic_options["write_buffer_size"] =
+    std::to_string(db_options_.write_buffer_size);
+  dynamic_options["max_bytes_for_level_base"] =
+    std::to_string(db_options_.max_bytes_for_level_base);
+  dynamic_options["target_file_size_base"] =
+    std::to_string(db_options_.target_file_size_base);
+  {
+    slash::RWLock l(&table_rw_, false);
+    for (auto& pair : tables_) {
+      pair.second->ApplyDBOptions(dynamic_options);
+    }
+  }
+  LOG(INFO) << "Conf reload done";
 }
 
 void ZPDataServer::DoTimingTask() {
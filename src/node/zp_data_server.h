@@ -21,6 +21,7 @@
 #include <unordered_map>
 
 #include "rocksdb/options.h"
+#include "rocksdb/cache.h"
 
 #include "pink/include/bg_thread.h"
 #include "pink/include/server_thread.h"
@@ -97,6 +98,13 @@ class ZPDataServer  {
     return &db_options_;
   }
 
+  // Block cache shared by all partition DBs, kept here so a per-table
+  // table factory built at Partition::Open reuses it instead of
+  // multiplying the cache budget
+  std::shared_ptr<rocksdb::Cache> db_block_cache() const {
+    return db_block_cache_;
+  }
+
   size_t binlog_sender_count() {
     return binlog_send_workers_.size();
   }
@@ -105,6 +113,12 @@ class ZPDataServer  {
     should_exit_ = true;
   }
 
+  // Called from the SIGHUP handler, the reload itself is applied
+  // by the server cron on the main thread
+  void ScheduleConfReload() {
+    conf_reload_pending_ = true;
+  }
+
   // Meta related
   bool ShouldJoinMeta();
   void MetaConnected();
@@ -142,8 +156,14 @@ class ZPDataServer  {
   Status SendToPeer(const Node &node, const client::SyncRequest &msg);
 
   // Backgroud thread
-  void BGSaveTaskSchedule(void (*function)(void*), void* arg);
-  void BGPurgeTaskSchedule(void (*function)(void*), void* arg);
+  // Tasks with the same partition_key keep their mutual order,
+  // different keys spread over the pool and run in parallel
+  void BGSaveTaskSchedule(void (*function)(void*), void* arg,
+      uint64_t partition_key);
+  void BGPurgeTaskSchedule(void (*function)(void*), void* arg,
+      uint64_t partition_key);
+  void CronTaskSchedule(void (*function)(void*), void* arg,
+      uint64_t partition_key);
   void AddSyncTask(const std::string& table, int partition_id,
       uint64_t delay = 0);
   void AddMetacmdTask();
@@ -176,6 +196,10 @@ class ZPDataServer  {
   bool GetTableReplInfo(const std::string& table_name,
       std::unordered_map<std::string, client::CmdResponse_InfoRepl>* repls);
   bool GetServerInfo(client::CmdResponse_InfoServer* info_server);
+  void PlusLatency(int cmd_type, uint64_t duration_us);
+  void GetLatencyInfo(client::CmdResponse* response);
+  void RecordSlowlog(const client::CmdResponse_InfoSlowlog& entry);
+  void GetSlowlogInfo(client::CmdResponse* response);
 
  private:
   slash::Mutex server_mutex_;
@@ -184,14 +208,25 @@ class ZPDataServer  {
   // Table and Partition
   // Note: this lock only protect table map,
   // rather than certain partiton which should keep thread safety itself
+  typedef std::unordered_map<std::string, std::shared_ptr<Table>> TableMap;
   pthread_rwlock_t table_rw_;
   std::atomic<int> table_count_;
-  std::unordered_map<std::string, std::shared_ptr<Table>> tables_;
+  TableMap tables_;
   std::shared_ptr<Table> GetTable(const std::string &table_name);
 
+  // Immutable routing snapshot of tables_,
+  // republished under table_rw_ write lock whenever the map changes,
+  // so the per-request path could route lock-free with std::atomic_load
+  std::shared_ptr<const TableMap> table_route_;
+  std::shared_ptr<Table> LookupTable(const std::string &table_name);
+
   // Binlog Send related
+  // Free connections per peer, a sender checks one out, sends
+  // outside the mutex and parks it back, so concurrent send threads
+  // replicating to the same node each ride their own connection
+  // and the pool grows to the actual send concurrency at most
   slash::Mutex mutex_peers_;
-  std::unordered_map<std::string, pink::PinkCli*> peers_;
+  std::unordered_map<std::string, std::vector<pink::PinkCli*>> peers_;
   ZPBinlogSendTaskPool binlog_send_pool_;
   std::vector<ZPBinlogSendThread*> binlog_send_workers_;
 
@@ -210,6 +245,8 @@ class ZPDataServer  {
   ZPPingThread* zp_ping_thread_;
 
   std::atomic<bool> should_exit_;
+  std::atomic<bool> conf_reload_pending_;
+  void DoConfReload();
 
   // Meta State related
   pthread_rwlock_t meta_state_rw_;
@@ -224,30 +261,57 @@ class ZPDataServer  {
   // Cmd related
   void InitClientCmdTable();
 
-  // Background thread
+  // Background worker pools, sized by conf as the per-disk
+  // concurrency limit; one partition always lands on the same worker
   slash::Mutex bgsave_thread_protector_;
-  pink::BGThread bgsave_thread_;
+  std::vector<pink::BGThread*> bgsave_workers_;
   slash::Mutex bgpurge_thread_protector_;
-  pink::BGThread bgpurge_thread_;
+  std::vector<pink::BGThread*> bgpurge_workers_;
+  // Partition timing tasks, sharded like the pools above
+  slash::Mutex cron_thread_protector_;
+  std::vector<pink::BGThread*> cron_workers_;
   void DoTimingTask();
 
   // Statistic related
-  struct ThreadStatistic {
+  // Raw query counters are sharded so that PlusStat from many workers
+  // never serializes on a single hot mutex; shards are folded into the
+  // aggregated view lazily when somebody reads the stats
+  static const int kStatShardNum = 16;
+  struct StatShard {
     slash::Mutex mu;
+    uint64_t other_querys;
+    std::unordered_map<std::string, uint64_t> table_querys;
+
+    StatShard() : other_querys(0) {}
+  };
+
+  struct ThreadStatistic {
+    slash::Mutex mu;  // protect the folded view below
     uint64_t last_time_us;
     Statistic other_stat;
     std::unordered_map<std::string, Statistic*> table_stats;
+    StatShard shards[kStatShardNum];
 
     ThreadStatistic()
       : last_time_us(slash::NowMicros()) {}
   };
 
   ThreadStatistic stats_[2];
+  void FoldStat(ThreadStatistic* tstat);
+
+  // Per command type latency, indexed by client::Type value
+  LatencyHistogram latency_stats_[client::Type_ARRAYSIZE];
+
+  // Ring of the latest slow requests with their stage breakdown
+  slash::Mutex slowlog_mutex_;
+  std::vector<client::CmdResponse_InfoSlowlog> slowlog_ring_;
+  size_t slowlog_next_;
 
   bool GetStat(const StatType type, const std::string &table,
       Statistic* stat);
 
   rocksdb::Options db_options_;
+  std::shared_ptr<rocksdb::Cache> db_block_cache_;
   void InitDBOptions();
 };
 
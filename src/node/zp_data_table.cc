@@ -39,7 +39,8 @@ Table::Table(const std::string& table_name, const std::string &log_path,
   log_path_(log_path),
   data_path_(data_path),
   trash_path_(trash_path),
-  partition_cnt_(0) {
+  partition_cnt_(0),
+  capacity_refreshed_(false) {
   if (log_path_.back() != '/') {
     log_path_.push_back('/');
   }
@@ -62,6 +63,9 @@ Table::Table(const std::string& table_name, const std::string &log_path,
   pthread_rwlockattr_setkind_np(&attr,
       PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
   pthread_rwlock_init(&partition_rw_, &attr);
+
+  std::atomic_store(&route_,
+      std::shared_ptr<const PartitionMap>(new PartitionMap()));
 }
 
 Table::~Table() {
@@ -76,12 +80,19 @@ bool Table::SetPartitionCount(const int count) {
   return true;
 }
 
+void Table::SetTableOptions(const ZPMeta::TableOptions& options) {
+  slash::RWLock l(&partition_rw_, true);
+  table_options_.CopyFrom(options);
+}
+
+// Lock-free: route through the immutable snapshot,
+// partition topology only changes on meta epoch update
 std::shared_ptr<Partition> Table::GetPartition(const std::string &key) {
-  slash::RWLock l(&partition_rw_, false);
   if (partition_cnt_ > 0) {
+    std::shared_ptr<const PartitionMap> route = std::atomic_load(&route_);
     int partition_id = std::hash<std::string>()(key) % partition_cnt_;
-    auto it = partitions_.find(partition_id);
-    if (it != partitions_.end()) {
+    auto it = route->find(partition_id);
+    if (it != route->end()) {
       return it->second;
     }
   }
@@ -89,9 +100,9 @@ std::shared_ptr<Partition> Table::GetPartition(const std::string &key) {
 }
 
 std::shared_ptr<Partition> Table::GetPartitionById(const int partition_id) {
-  slash::RWLock l(&partition_rw_, false);
-  auto it = partitions_.find(partition_id);
-  if (it != partitions_.end()) {
+  std::shared_ptr<const PartitionMap> route = std::atomic_load(&route_);
+  auto it = route->find(partition_id);
+  if (it != route->end()) {
     return it->second;
   }
   return NULL;
@@ -99,11 +110,19 @@ std::shared_ptr<Partition> Table::GetPartitionById(const int partition_id) {
 
 bool Table::UpdateOrAddPartition(const int partition_id,
     ZPMeta::PState state, const Node& master, const std::set<Node>& slaves) {
-  slash::RWLock l(&partition_rw_, true);
-  auto iter = partitions_.find(partition_id);
-  if (iter != partitions_.end()) {
+  std::shared_ptr<Partition> partition = NULL;
+  {
+    slash::RWLock l(&partition_rw_, false);
+    auto iter = partitions_.find(partition_id);
+    if (iter != partitions_.end()) {
+      partition = iter->second;
+    }
+  }
+  if (partition != NULL) {
     // Exist partition: update it
-    (iter->second)->Update(state, master, slaves);
+    // Notice Update is called without partition_rw_,
+    // so that partitions of one table could open concurrently
+    partition->Update(state, master, slaves);
     return true;
   }
 
@@ -114,12 +133,32 @@ bool Table::UpdateOrAddPartition(const int partition_id,
   }
 
   // New Partition
-  std::shared_ptr<Partition> partition = NewPartition(table_name_,
+  partition = NewPartition(table_name_,
       log_path_, data_path_, trash_path_, partition_id, master, slaves);
   assert(partition != NULL);
+  {
+    slash::RWLock l(&partition_rw_, false);
+    partition->SetTableOptions(table_options_);
+  }
 
+  {
+    slash::RWLock l(&partition_rw_, true);
+    auto iter = partitions_.find(partition_id);
+    if (iter != partitions_.end()) {
+      // Lost the race with another opener, keep the existing one
+      partition = iter->second;
+    } else {
+      partitions_[partition_id] = partition;
+
+      // Republish the routing snapshot, still under partition_rw_ write lock
+      std::atomic_store(&route_,
+          std::shared_ptr<const PartitionMap>(new PartitionMap(partitions_)));
+    }
+  }
+
+  // The slow part, DB open and binlog file scan inside,
+  // runs without partition_rw_
   partition->Update(ZPMeta::PState::ACTIVE, master, slaves);
-  partitions_[partition_id] = partition;
 
   return true;
 }
@@ -146,13 +185,26 @@ void Table::Dump() {
   LOG(INFO) << "--------------------------";
 }
 
-void Table::DoTimingTask() {
+void Table::ApplyDBOptions(
+    const std::map<std::string, std::string>& options) {
   slash::RWLock l(&partition_rw_, false);
   for (auto pair : partitions_) {
-    pair.second->DoTimingTask();
+    pair.second->ApplyDBOptions(options);
   }
 }
 
+void Table::DoTimingTask() {
+  {
+    slash::RWLock l(&partition_rw_, false);
+    for (auto pair : partitions_) {
+      pair.second->ScheduleTimingTask();
+    }
+  }
+
+  // Keep the capacity cache fresh off the command path
+  RefreshCapacity();
+}
+
 void Table::DumpPartitionBinlogOffsets(std::map<int, BinlogOffset> *offset) {
   slash::RWLock l(&partition_rw_, false);
   BinlogOffset tboffset;
@@ -170,15 +222,37 @@ uint64_t Df(const std::string& path) {
   return 0LL;
 }
 
-void Table::GetCapacity(Statistic *stat) {
-  stat->Reset();
-  stat->table_name = table_name_;
-  stat->used_disk = slash::Du(data_path_) + slash::Du(log_path_);
+// Walk the data and log directories, the slow part with file metadata
+// scans proportional to the SST count, and publish into the cache
+void Table::RefreshCapacity() {
+  Statistic fresh;
+  fresh.table_name = table_name_;
+  fresh.used_disk = slash::Du(data_path_) + slash::Du(log_path_);
   // TODO(anan): we will support table based disk;
   // For now, just use node's free disk instead.
-  stat->free_disk = Df(data_path_);
-  DLOG(INFO) << "GetCapacity for table " << table_name_ << ":";
-  stat->Dump();
+  fresh.free_disk = Df(data_path_);
+  DLOG(INFO) << "RefreshCapacity for table " << table_name_
+    << ", used_disk: " << fresh.used_disk
+    << ", free_disk: " << fresh.free_disk;
+
+  slash::MutexLock l(&capacity_mu_);
+  capacity_stat_ = fresh;
+  capacity_refreshed_ = true;
+}
+
+void Table::GetCapacity(Statistic *stat) {
+  {
+    slash::MutexLock l(&capacity_mu_);
+    if (capacity_refreshed_) {
+      *stat = capacity_stat_;
+      return;
+    }
+  }
+
+  // No timing task turn yet, take the slow path this once
+  RefreshCapacity();
+  slash::MutexLock l(&capacity_mu_);
+  *stat = capacity_stat_;
 }
 
 void Table::GetReplInfo(client::CmdResponse_InfoRepl* repl_info) {
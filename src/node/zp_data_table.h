@@ -21,6 +21,7 @@
 #include <string>
 
 #include "include/zp_util.h"
+#include "slash/include/slash_mutex.h"
 #include "include/zp_const.h"
 #include "include/client.pb.h"
 #include "include/zp_meta.pb.h"
@@ -41,6 +42,7 @@ class Table  {
   ~Table();
 
   bool SetPartitionCount(int count);
+  void SetTableOptions(const ZPMeta::TableOptions& options);
   std::shared_ptr<Partition> GetPartition(const std::string &key);
   std::shared_ptr<Partition> GetPartitionById(const int partition_id);
   bool UpdateOrAddPartition(int partition_id, ZPMeta::PState state,
@@ -51,6 +53,9 @@ class Table  {
 
   void Dump();
   void DoTimingTask();
+  // Conf reload pushing new dynamic rocksdb options into every
+  // open partition DB
+  void ApplyDBOptions(const std::map<std::string, std::string>& options);
   void DumpPartitionBinlogOffsets(std::map<int, BinlogOffset> *offset);
   void GetCapacity(Statistic *stat);
   void GetReplInfo(client::CmdResponse_InfoRepl* repl_info);
@@ -61,9 +66,26 @@ class Table  {
   std::string data_path_;
   std::string trash_path_;
 
+  typedef std::map<int, std::shared_ptr<Partition>> PartitionMap;
+
   std::atomic<int> partition_cnt_;
+  // Per table rocksdb overlay carried by meta,
+  // handed to new partitions ahead of their Open, under partition_rw_
+  ZPMeta::TableOptions table_options_;
   pthread_rwlock_t partition_rw_;
-  std::map<int, std::shared_ptr<Partition>> partitions_;
+  PartitionMap partitions_;
+
+  // Capacity cached from the last timing task turn, so an INFOCAPACITY
+  // poll answers from memory instead of walking the data directories
+  slash::Mutex capacity_mu_;
+  Statistic capacity_stat_;
+  bool capacity_refreshed_;
+  void RefreshCapacity();
+
+  // Immutable routing snapshot of partitions_,
+  // republished under partition_rw_ write lock whenever the map changes,
+  // so GetPartition could route lock-free with std::atomic_load
+  std::shared_ptr<const PartitionMap> route_;
 
   Table(const Table&);
   void operator=(const Table&);
@@ -0,0 +1,507 @@
+// Copyright 2017 Qihoo
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http:// www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/node/zp_dbsync_channel.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/sendfile.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <glog/logging.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "slash/include/env.h"
+#include "include/zp_crc32c.h"
+
+// Wire format, host byte order since both ends are our own nodes:
+//   u32 magic, u32 op, u32 path_len, path
+// op kChannelOpFile:
+//   u64 file_size
+//   <- u64 resume_offset (receiver current size)
+//   then chunks of u32 len, u32 crc32c, payload; len 0 ends the file
+//   <- u32 status
+// op kChannelOpClear:
+//   u32 keep_count, keep_count * (u32 len, relative path)
+//   <- u32 status
+static const uint32_t kChannelMagic = 0x5A504442;  // "ZPDB"
+static const uint32_t kChannelOpFile = 1;
+static const uint32_t kChannelOpClear = 2;
+static const uint32_t kChannelChunkSize = 512 * 1024;
+static const uint32_t kChannelMaxChunkSize = 4 * 1024 * 1024;
+static const uint32_t kChannelMaxPathLen = 4096;
+
+static bool ReadFull(int fd, char* buf, size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    ssize_t n = read(fd, buf + done, len - done);
+    if (n <= 0) {
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    done += n;
+  }
+  return true;
+}
+
+static bool WriteFull(int fd, const char* buf, size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    ssize_t n = write(fd, buf + done, len - done);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    done += n;
+  }
+  return true;
+}
+
+template <typename T>
+static bool ReadValue(int fd, T* value) {
+  return ReadFull(fd, reinterpret_cast<char*>(value), sizeof(T));
+}
+
+template <typename T>
+static bool WriteValue(int fd, T value) {
+  return WriteFull(fd, reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static bool ReadPath(int fd, uint32_t len, std::string* path) {
+  if (len == 0 || len > kChannelMaxPathLen) {
+    return false;
+  }
+  std::vector<char> buf(len);
+  if (!ReadFull(fd, buf.data(), len)) {
+    return false;
+  }
+  path->assign(buf.data(), len);
+  // Keep the receiver inside its base dir
+  return path->find("..") == std::string::npos;
+}
+
+/*
+ * ZPDBSyncServer
+ */
+ZPDBSyncServer::ZPDBSyncServer()
+  : listen_fd_(-1),
+  running_(false),
+  should_stop_(false),
+  conn_num_(0) {
+}
+
+ZPDBSyncServer::~ZPDBSyncServer() {
+  Stop();
+}
+
+int ZPDBSyncServer::Start(const std::string& base_path,
+    const std::string& ip, int port) {
+  if (running_) {
+    return 0;
+  }
+  base_path_ = base_path;
+  if (base_path_.back() != '/') {
+    base_path_.push_back('/');
+  }
+  slash::CreatePath(base_path_);
+
+  listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd_ < 0) {
+    return -1;
+  }
+  int yes = 1;
+  setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = inet_addr(ip.c_str());
+  addr.sin_port = htons(port);
+  if (bind(listen_fd_, reinterpret_cast<struct sockaddr*>(&addr),
+        sizeof(addr)) < 0
+      || listen(listen_fd_, 16) < 0) {
+    LOG(WARNING) << "DBSync channel bind(" << ip << ":" << port
+      << ") failed: " << strerror(errno);
+    close(listen_fd_);
+    listen_fd_ = -1;
+    return -1;
+  }
+
+  should_stop_ = false;
+  if (pthread_create(&accept_tid_, NULL, AcceptThreadMain, this) != 0) {
+    close(listen_fd_);
+    listen_fd_ = -1;
+    return -1;
+  }
+  running_ = true;
+  LOG(INFO) << "DBSync channel listen on " << ip << ":" << port
+    << ", base_path: " << base_path_;
+  return 0;
+}
+
+void ZPDBSyncServer::Stop() {
+  if (!running_) {
+    return;
+  }
+  should_stop_ = true;
+  pthread_join(accept_tid_, NULL);
+  close(listen_fd_);
+  listen_fd_ = -1;
+  while (conn_num_ > 0) {
+    usleep(10000);
+  }
+  running_ = false;
+  LOG(INFO) << "DBSync channel stopped, base_path: " << base_path_;
+}
+
+void* ZPDBSyncServer::AcceptThreadMain(void* arg) {
+  static_cast<ZPDBSyncServer*>(arg)->AcceptLoop();
+  return NULL;
+}
+
+void ZPDBSyncServer::AcceptLoop() {
+  while (!should_stop_) {
+    struct pollfd pfd = {listen_fd_, POLLIN, 0};
+    int ret = poll(&pfd, 1, 500);
+    if (ret <= 0) {
+      continue;
+    }
+    int conn_fd = accept(listen_fd_, NULL, NULL);
+    if (conn_fd < 0) {
+      continue;
+    }
+    conn_num_++;
+    // One detached thread per stream, the master bounds their number
+    // with db_sync_stream_num
+    std::thread([this, conn_fd]() {
+        HandleConn(conn_fd);
+        close(conn_fd);
+        conn_num_--;
+      }).detach();
+  }
+}
+
+void ZPDBSyncServer::HandleConn(int fd) {
+  uint32_t magic = 0, op = 0;
+  if (!ReadValue(fd, &magic) || magic != kChannelMagic
+      || !ReadValue(fd, &op)) {
+    return;
+  }
+  int ret = -1;
+  if (op == kChannelOpFile) {
+    ret = HandleSendFile(fd);
+  } else if (op == kChannelOpClear) {
+    ret = HandleClearDir(fd);
+  }
+  WriteValue<uint32_t>(fd, ret == 0 ? 0 : 1);
+}
+
+int ZPDBSyncServer::HandleSendFile(int fd) {
+  uint32_t path_len = 0;
+  uint64_t file_size = 0;
+  std::string path;
+  if (!ReadValue(fd, &path_len) || !ReadPath(fd, path_len, &path)
+      || !ReadValue(fd, &file_size)) {
+    return -1;
+  }
+
+  std::string full_path = base_path_ + path;
+  size_t slash_pos = full_path.find_last_of('/');
+  if (slash_pos != std::string::npos) {
+    slash::CreatePath(full_path.substr(0, slash_pos));
+  }
+
+  int file_fd = open(full_path.c_str(), O_WRONLY | O_CREAT, 0644);
+  if (file_fd < 0) {
+    LOG(WARNING) << "DBSync channel open " << full_path
+      << " failed: " << strerror(errno);
+    return -1;
+  }
+
+  // A shorter file than what the master announces is resumed,
+  // anything else starts over
+  struct stat st;
+  uint64_t resume_offset = 0;
+  if (fstat(file_fd, &st) == 0
+      && static_cast<uint64_t>(st.st_size) <= file_size) {
+    resume_offset = st.st_size;
+  } else if (ftruncate(file_fd, 0) != 0) {
+    close(file_fd);
+    return -1;
+  }
+  if (!WriteValue(fd, resume_offset)
+      || lseek(file_fd, resume_offset, SEEK_SET) < 0) {
+    close(file_fd);
+    return -1;
+  }
+
+  std::vector<char> buf(kChannelChunkSize);
+  int ret = 0;
+  while (true) {
+    uint32_t len = 0, crc = 0;
+    if (!ReadValue(fd, &len)) {
+      ret = -1;
+      break;
+    }
+    if (len == 0) {  // whole file done
+      break;
+    }
+    if (len > kChannelMaxChunkSize || !ReadValue(fd, &crc)) {
+      ret = -1;
+      break;
+    }
+    if (buf.size() < len) {
+      buf.resize(len);
+    }
+    if (!ReadFull(fd, buf.data(), len)) {
+      ret = -1;
+      break;
+    }
+    if (Crc32c(buf.data(), len) != crc) {
+      LOG(WARNING) << "DBSync channel crc mismatch on " << full_path;
+      ret = -1;
+      break;
+    }
+    if (!WriteFull(file_fd, buf.data(), len)) {
+      ret = -1;
+      break;
+    }
+  }
+  if (ret == 0 && fsync(file_fd) != 0) {
+    ret = -1;
+  }
+  close(file_fd);
+  return ret;
+}
+
+int ZPDBSyncServer::HandleClearDir(int fd) {
+  uint32_t path_len = 0, keep_count = 0;
+  std::string target_dir;
+  if (!ReadValue(fd, &path_len) || !ReadPath(fd, path_len, &target_dir)
+      || !ReadValue(fd, &keep_count)) {
+    return -1;
+  }
+  std::set<std::string> keep;
+  for (uint32_t i = 0; i < keep_count; i++) {
+    uint32_t len = 0;
+    std::string name;
+    if (!ReadValue(fd, &len) || !ReadPath(fd, len, &name)) {
+      return -1;
+    }
+    keep.insert(name);
+  }
+
+  std::string full_dir = base_path_ + target_dir;
+  if (full_dir.back() != '/') {
+    full_dir.push_back('/');
+  }
+  std::vector<std::string> descendant;
+  if (!slash::GetDescendant(full_dir, descendant)) {
+    return 0;  // nothing there yet
+  }
+  for (auto& file : descendant) {
+    if (slash::IsDir(file) == 0) {
+      continue;
+    }
+    std::string relative = file.substr(full_dir.size());
+    if (keep.find(relative) == keep.end()) {
+      slash::DeleteFile(file);
+    }
+  }
+  return 0;
+}
+
+/*
+ * Sender side
+ */
+static int ConnectChannel(const std::string& ip, int port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = inet_addr(ip.c_str());
+  addr.sin_port = htons(port);
+  if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr),
+        sizeof(addr)) < 0) {
+    close(fd);
+    return -1;
+  }
+  int yes = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+  return fd;
+}
+
+static bool SendChannelHead(int fd, uint32_t op, const std::string& path) {
+  return WriteValue(fd, kChannelMagic) && WriteValue(fd, op)
+    && WriteValue(fd, static_cast<uint32_t>(path.size()))
+    && WriteFull(fd, path.data(), path.size());
+}
+
+int DBSyncSendFileChannel(const std::string& local_path,
+    const std::string& target_path, const std::string& ip, int port,
+    int speed_kbps) {
+  int file_fd = open(local_path.c_str(), O_RDONLY);
+  if (file_fd < 0) {
+    LOG(WARNING) << "DBSync channel open " << local_path
+      << " failed: " << strerror(errno);
+    return -1;
+  }
+  struct stat st;
+  if (fstat(file_fd, &st) != 0) {
+    close(file_fd);
+    return -1;
+  }
+  uint64_t file_size = st.st_size;
+
+  int sock_fd = ConnectChannel(ip, port);
+  if (sock_fd < 0) {
+    close(file_fd);
+    return -1;
+  }
+
+  int ret = -1;
+  uint64_t resume_offset = 0;
+  std::vector<char> crc_buf(kChannelChunkSize);
+  do {
+    if (!SendChannelHead(sock_fd, kChannelOpFile, target_path)
+        || !WriteValue(sock_fd, file_size)
+        || !ReadValue(sock_fd, &resume_offset)
+        || resume_offset > file_size) {
+      break;
+    }
+
+    uint64_t begin_us = slash::NowMicros();
+    uint64_t sent_bytes = 0;
+    off_t offset = resume_offset;
+    bool failed = false;
+    while (static_cast<uint64_t>(offset) < file_size) {
+      uint32_t len = kChannelChunkSize;
+      if (file_size - offset < len) {
+        len = file_size - offset;
+      }
+      // The chunk is read once here for its crc, straight from page
+      // cache, the payload itself goes out with sendfile below
+      if (pread(file_fd, crc_buf.data(), len, offset)
+          != static_cast<ssize_t>(len)) {
+        failed = true;
+        break;
+      }
+      if (!WriteValue(sock_fd, len)
+          || !WriteValue(sock_fd, Crc32c(crc_buf.data(), len))) {
+        failed = true;
+        break;
+      }
+      uint32_t chunk_left = len;
+      while (chunk_left > 0) {
+        ssize_t n = sendfile(sock_fd, file_fd, &offset, chunk_left);
+        if (n <= 0) {
+          if (n < 0 && errno == EINTR) {
+            continue;
+          }
+          failed = true;
+          break;
+        }
+        chunk_left -= n;
+      }
+      if (failed) {
+        break;
+      }
+      // Pace to the per-stream cap
+      sent_bytes += len;
+      if (speed_kbps > 0) {
+        uint64_t expect_us = sent_bytes * 1000 / speed_kbps;
+        uint64_t elapsed_us = slash::NowMicros() - begin_us;
+        if (expect_us > elapsed_us) {
+          usleep(expect_us - elapsed_us);
+        }
+      }
+    }
+    if (failed || !WriteValue<uint32_t>(sock_fd, 0)) {
+      break;
+    }
+    uint32_t status = 1;
+    if (ReadValue(sock_fd, &status) && status == 0) {
+      ret = 0;
+    }
+  } while (0);
+
+  close(sock_fd);
+  close(file_fd);
+  return ret;
+}
+
+int DBSyncClearTargetChannel(const std::string& local_dir,
+    const std::string& target_dir, const std::string& ip, int port) {
+  std::vector<std::string> descendant;
+  if (!slash::GetDescendant(local_dir, descendant)) {
+    return -1;
+  }
+  std::string prefix = local_dir;
+  if (prefix.back() != '/') {
+    prefix.push_back('/');
+  }
+
+  int sock_fd = ConnectChannel(ip, port);
+  if (sock_fd < 0) {
+    return -1;
+  }
+  int ret = -1;
+  do {
+    if (!SendChannelHead(sock_fd, kChannelOpClear, target_dir)) {
+      break;
+    }
+    uint32_t keep_count = 0;
+    for (auto& file : descendant) {
+      if (slash::IsDir(file) != 0) {
+        keep_count++;
+      }
+    }
+    if (!WriteValue(sock_fd, keep_count)) {
+      break;
+    }
+    bool failed = false;
+    for (auto& file : descendant) {
+      if (slash::IsDir(file) == 0) {
+        continue;
+      }
+      std::string relative = file.substr(prefix.size());
+      if (!WriteValue(sock_fd, static_cast<uint32_t>(relative.size()))
+          || !WriteFull(sock_fd, relative.data(), relative.size())) {
+        failed = true;
+        break;
+      }
+    }
+    uint32_t status = 1;
+    if (!failed && ReadValue(sock_fd, &status) && status == 0) {
+      ret = 0;
+    }
+  } while (0);
+
+  close(sock_fd);
+  return ret;
+}
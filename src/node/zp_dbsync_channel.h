@@ -0,0 +1,71 @@
+// Copyright 2017 Qihoo
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http:// www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef SRC_NODE_ZP_DBSYNC_CHANNEL_H_
+#define SRC_NODE_ZP_DBSYNC_CHANNEL_H_
+
+#include <atomic>
+#include <string>
+#include <pthread.h>
+
+// Native DBSync transfer channel on the kPortShiftRsync port,
+// replacing the external rsync daemon. The master pushes checkpoint
+// files with sendfile(2) so payload bytes never cross userspace on the
+// send side, every chunk carries a crc32c the receiver verifies before
+// appending, and a file interrupted mid-transfer is resumed from the
+// size the receiver already holds.
+
+// Receiver side, owned by ZPTrySyncThread on the slave
+class ZPDBSyncServer {
+ public:
+  ZPDBSyncServer();
+  ~ZPDBSyncServer();
+
+  // Listen on ip:port and write received files under base_path
+  int Start(const std::string& base_path, const std::string& ip, int port);
+  void Stop();
+
+ private:
+  static void* AcceptThreadMain(void* arg);
+  void AcceptLoop();
+  void HandleConn(int fd);
+  int HandleSendFile(int fd);
+  int HandleClearDir(int fd);
+
+  std::string base_path_;
+  int listen_fd_;
+  bool running_;
+  std::atomic<bool> should_stop_;
+  std::atomic<int> conn_num_;
+  pthread_t accept_tid_;
+
+  // No copying allowed
+  ZPDBSyncServer(const ZPDBSyncServer&);
+  void operator=(const ZPDBSyncServer&);
+};
+
+// Sender side helpers used by Partition::DBSyncSendFile
+// Both return 0 on success
+
+// Stream local_path to target_path (relative to the receiver base)
+// on ip:port, capped to speed_kbps
+int DBSyncSendFileChannel(const std::string& local_path,
+    const std::string& target_path, const std::string& ip, int port,
+    int speed_kbps);
+
+// Remove every file under target_dir on the receiver
+// which has no counterpart under local_dir
+int DBSyncClearTargetChannel(const std::string& local_dir,
+    const std::string& target_dir, const std::string& ip, int port);
+
+#endif  // SRC_NODE_ZP_DBSYNC_CHANNEL_H_
@@ -18,6 +18,8 @@
 #include <set>
 #include <string>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "src/node/zp_data_server.h"
 #include "include/zp_command.h"
@@ -75,6 +77,10 @@ pink::Status ZPMetacmdBGWorker::Send() {
   ZPMeta::Node* node = pull->mutable_node();
   node->set_ip(zp_data_server->local_ip());
   node->set_port(zp_data_server->local_port());
+  if (zp_data_server->meta_epoch() >= 0) {
+    // Tell the meta what we already hold, it may answer with a diff
+    pull->set_epoch(zp_data_server->meta_epoch());
+  }
 
   std::string text_format;
   google::protobuf::TextFormat::PrintToString(request, &text_format);
@@ -116,16 +122,35 @@ pink::Status ZPMetacmdBGWorker::ParsePullResponse(
   *receive_epoch = response.pull().version();
   ZPMeta::MetaCmdResponse_Pull pull = response.pull();
 
+  bool is_diff = pull.has_base();
+  if (is_diff && pull.base() != zp_data_server->meta_epoch()) {
+    // The diff was cut against an epoch we do not hold, retry
+    LOG(WARNING) << "Receive Pull diff against epoch: " << pull.base()
+      << ", local: " << zp_data_server->meta_epoch();
+    return pink::Status::IOError("pull diff base mismatch");
+  }
+
   LOG(INFO) << "Receive Pull message, new epoch: " << pull.version()
-    << ", will handle " << pull.info_size() << " tables.";
+    << ", will handle " << pull.info_size() << " tables"
+    << (is_diff ? " as diff." : ".");
   std::set<std::string> miss_tables;  // response for before but not any more
-  zp_data_server->GetAllTableName(&miss_tables);
+  if (!is_diff) {
+    // A diff only carries what changed, silence about a table means keep it
+    zp_data_server->GetAllTableName(&miss_tables);
+  }
 
   for (int i = 0; i < pull.info_size(); i++) {
     const ZPMeta::Table& table_info = pull.info(i);
     if (table_info.name().empty()) {
       continue;  // table name not null
     }
+    if (is_diff && table_info.partitions_size() == 0) {
+      // A bare table name in a diff means the table was dropped
+      LOG(WARNING) << "ZPMetaCmd delete dropped table after recv pull diff: "
+        << table_info.name();
+      zp_data_server->DeleteTable(table_info.name());
+      continue;
+    }
     DLOG(INFO) << " - handle Table " << table_info.name();
 
     // Record tables no longer response for
@@ -137,32 +162,52 @@ pink::Status ZPMetacmdBGWorker::ParsePullResponse(
     assert(table != NULL);
 
     table->SetPartitionCount(table_info.partitions_size());
-    for (int j = 0; j < table_info.partitions_size(); j++) {
-      const ZPMeta::Partitions& partition = table_info.partitions(j);
-      DLOG(INFO) << " - - handle Partition " << partition.id()
-        << ": master is " << partition.master().ip()
-        << ":" << partition.master().port();
-
-      Node master_node(partition.master().ip(), partition.master().port());
-      if (master_node.empty()) {
-        // No master patitions, simply ignore
-        continue;
-      }
-      std::set<Node> slave_nodes;
-      for (int j = 0; j < partition.slaves_size(); j++) {
-        slave_nodes.insert(Node(partition.slaves(j).ip(),
-              partition.slaves(j).port()));
-      }
-
-      bool result = table->UpdateOrAddPartition(partition.id(),
-          partition.state(), master_node, slave_nodes);
-      if (!result) {
-        LOG(WARNING) << "Failed to AddPartition "
-          << table_info.name() << "_" << partition.id()
-          << ", State: " << static_cast<int>(partition.state())
-          << ", partition master is " << partition.master().ip()
-          << ":" << partition.master().port();
-      }
+    if (table_info.has_options()) {
+      table->SetTableOptions(table_info.options());
+    }
+
+    // Handle the partitions of one table in parallel, since every new
+    // partition opens its DB and scans its binlog files inside
+    // UpdateOrAddPartition, serial opens dominate the restart time
+    int opener_num = g_zp_conf->partition_open_thread_num();
+    if (opener_num > table_info.partitions_size()) {
+      opener_num = table_info.partitions_size();
+    }
+    std::vector<std::thread> openers;
+    for (int t = 0; t < opener_num; t++) {
+      openers.push_back(std::thread([t, opener_num, &table_info, &table]() {
+        for (int j = t; j < table_info.partitions_size(); j += opener_num) {
+          const ZPMeta::Partitions& partition = table_info.partitions(j);
+          DLOG(INFO) << " - - handle Partition " << partition.id()
+            << ": master is " << partition.master().ip()
+            << ":" << partition.master().port();
+
+          Node master_node(partition.master().ip(),
+              partition.master().port());
+          if (master_node.empty()) {
+            // No master patitions, simply ignore
+            continue;
+          }
+          std::set<Node> slave_nodes;
+          for (int k = 0; k < partition.slaves_size(); k++) {
+            slave_nodes.insert(Node(partition.slaves(k).ip(),
+                  partition.slaves(k).port()));
+          }
+
+          bool result = table->UpdateOrAddPartition(partition.id(),
+              partition.state(), master_node, slave_nodes);
+          if (!result) {
+            LOG(WARNING) << "Failed to AddPartition "
+              << table_info.name() << "_" << partition.id()
+              << ", State: " << static_cast<int>(partition.state())
+              << ", partition master is " << partition.master().ip()
+              << ":" << partition.master().port();
+          }
+        }
+      }));
+    }
+    for (size_t t = 0; t < openers.size(); t++) {
+      openers[t].join();
     }
   }
 
@@ -52,8 +52,13 @@ static void IntSigHandle(const int sig) {
   LOG(INFO) << "data server Exit";
 }
 
+// Only flip a flag here, the reload itself runs on the main thread
+static void ReloadSigHandle(const int sig) {
+  zp_data_server->ScheduleConfReload();
+}
+
 static void ZPDataSignalSetup() {
-  signal(SIGHUP, SIG_IGN);
+  signal(SIGHUP, &ReloadSigHandle);
   signal(SIGPIPE, SIG_IGN);
   signal(SIGINT, &IntSigHandle);
   signal(SIGQUIT, &IntSigHandle);
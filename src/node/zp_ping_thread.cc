@@ -42,6 +42,12 @@ bool ZPPingThread::CheckOffsetDelta(const std::string table_name,
 
 slash::Status ZPPingThread::Send() {
   ZPMeta::MetaCmd request;
+  // Time for a full snapshot, forget the acked offsets so every
+  // partition goes along again
+  if (++pings_since_full_ >= kPingFullSnapshotCount) {
+    last_offsets_.clear();
+    pings_since_full_ = 0;
+  }
   int64_t meta_epoch = zp_data_server->meta_epoch();
   ZPMeta::MetaCmd_Ping* ping = request.mutable_ping();
   ping->set_version(meta_epoch);
@@ -75,10 +81,13 @@ slash::Status ZPPingThread::Send() {
 
   Status s = cli_->Send(&request);
 
-  // Update last_offsets only when send succ
+  // Remember what this ping carried, it moves into last_offsets_
+  // with the ack only, a ping the meta never processed must not
+  // suppress the same offsets from the next one
+  sent_offsets_.clear();
   if (s.ok()) {
     for (auto& off : ping->offset()) {
-      last_offsets_[off.table_name()][off.partition()]
+      sent_offsets_[off.table_name()][off.partition()]
         = BinlogOffset(off.filenum(), off.offset());
     }
   }
@@ -100,6 +109,27 @@ slash::Status ZPPingThread::RecvProc() {
   // StatusCode OK
   if (response.type() == ZPMeta::Type::PING) {
     zp_data_server->TryUpdateEpoch(response.ping().version());
+    if (response.ping().has_incarnation()
+        && response.ping().incarnation() != last_meta_incarnation_) {
+      // The meta leader changed under us, its offset map starts empty
+      // and the deltas we suppressed would never reach it; a stalled
+      // partition could then lose its master election for good. Resend
+      // everything with the next ping instead of waiting out the
+      // periodic full snapshot
+      if (last_meta_incarnation_ != 0) {
+        last_offsets_.clear();
+        pings_since_full_ = 0;
+      }
+      last_meta_incarnation_ = response.ping().incarnation();
+    }
+    // The meta ingested the ping in flight,
+    // its offsets need not be resent until they change again
+    for (auto& table : sent_offsets_) {
+      for (auto& p : table.second) {
+        last_offsets_[table.first][p.first] = p.second;
+      }
+    }
+    sent_offsets_.clear();
     return slash::Status::OK();
   }
   return slash::Status::Corruption("Receive reponse whose type is not ping");
@@ -121,6 +151,8 @@ void* ZPPingThread::ThreadMain() {
       gettimeofday(&now, NULL);
       last_interaction = now;
       last_offsets_.clear();  // should resend full dose offset after reconnect
+      sent_offsets_.clear();
+      pings_since_full_ = 0;
       cli_->set_send_timeout(1000);
       cli_->set_recv_timeout(1000);
 
@@ -25,13 +25,26 @@ class ZPPingThread : public pink::Thread  {
   ZPPingThread() {
     cli_ = pink::NewPbCli();
     cli_->set_connect_timeout(1500);
+    pings_since_full_ = 0;
+    last_meta_incarnation_ = 0;
     set_thread_name("ZPDataPing");
   }
   virtual ~ZPPingThread();
 
  private:
   pink::PinkCli *cli_;
+  // Offsets the meta has acked, the next ping carries the
+  // partitions differing from these only
   TablePartitionOffsets last_offsets_;
+  // Offsets carried by the ping in flight, committed into
+  // last_offsets_ once the meta acked the ping
+  TablePartitionOffsets sent_offsets_;
+  // Pings since the last full offset snapshot
+  int pings_since_full_;
+  // Leader incarnation of the last ping response, a change means a
+  // fresh leader with an empty offset map, so forget the acked
+  // offsets and let the next ping carry them all again
+  int64_t last_meta_incarnation_;
 
   bool CheckOffsetDelta(const std::string table_name,
       int partition_id, const BinlogOffset &new_offset);
@@ -78,7 +78,7 @@ int ZPSyncConn::DealMessage() {
   ZPBinlogReceiveTask *arg = NULL;
   if (request_.sync_type() == client::SyncType::LEASE) {
     // Receive a lease renew request
-    client::SyncLease slease = request_.sync_lease();
+    const client::SyncLease& slease = request_.sync_lease();
     PartitionSyncOption option(
         request_.sync_type(),
         slease.table_name(),
@@ -90,7 +90,7 @@ int ZPSyncConn::DealMessage() {
         slease.lease());
   } else if (request_.sync_type() == client::SyncType::SKIP) {
     // Receive a binlog skip request
-    client::BinlogSkip bskip = request_.binlog_skip();
+    const client::BinlogSkip& bskip = request_.binlog_skip();
 
     PartitionSyncOption option(
         request_.sync_type(),
@@ -104,9 +104,49 @@ int ZPSyncConn::DealMessage() {
         option,
         bskip.gap());
 
+  } else if (request_.sync_type() == client::SyncType::BATCH) {
+    // Receive a batch frame carrying multiple binlog items
+    // All items belong to one partition,
+    // dispatch the whole batch to one binlog bgworker
+    const client::BinlogBatch& batch = request_.binlog_batch();
+    DLOG(INFO) << "Receive sync batch with " << batch.items_size()
+      << " items, table=" << batch.table_name()
+      << ", partition=" << batch.partition_id();
+
+    zp_data_server->PlusStat(StatType::kSync, batch.table_name());
+
+    PartitionSyncOption option(
+        request_.sync_type(),
+        batch.table_name(),
+        batch.partition_id(),
+        slash::IpPortString(request_.from().ip(), request_.from().port()),
+        0, 0);
+
+    arg = new ZPBinlogReceiveTask(
+        option,
+        batch,
+        request_.has_sync_lease() ? request_.sync_lease().lease() : 0);
+  } else if (request_.sync_type() == client::SyncType::ACK) {
+    // Receive a write ack from a slave
+    // Handled inline, it only raises the acked offset
+    // and has no binlog order to keep
+    const client::SyncAck& sack = request_.sync_ack();
+    std::shared_ptr<Partition> partition =
+      zp_data_server->GetTablePartitionById(
+          sack.table_name(), sack.partition_id());
+    if (!partition) {
+      LOG(WARNING) << "Receive SyncAck of unknown partition, table: "
+        << sack.table_name() << ", partition: " << sack.partition_id();
+      return -1;
+    }
+    partition->RecordSlaveAck(
+        slash::IpPortString(request_.from().ip(), request_.from().port()),
+        BinlogOffset(sack.sync_offset().filenum(),
+          sack.sync_offset().offset()));
+    return 0;
   } else if (request_.sync_type() == client::SyncType::CMD) {
     // Receive a cmd request
-    client::CmdRequest crequest = request_.request();
+    const client::CmdRequest& crequest = request_.request();
     DebugReceive(crequest);
 
     Cmd* cmd = zp_data_server->CmdGet(static_cast<int>(crequest.type()));
@@ -116,7 +156,10 @@ int ZPSyncConn::DealMessage() {
     }
 
     std::string table_name = cmd->ExtractTable(&crequest);
-    if (!cmd->is_single_paritition()) {
+    // Mset is binlogged per partition by its master,
+    // so that the record could be routed by its first key as usual
+    if (!cmd->is_single_paritition()
+        && crequest.type() != client::Type::MSET) {
       LOG(ERROR) << "SyncConn shouldn't receive multi partition command: "
         << cmd->name() << ", table=" << table_name
         << " key=" << cmd->ExtractKey(&crequest);
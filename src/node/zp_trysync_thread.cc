@@ -14,7 +14,6 @@
 #include "src/node/zp_trysync_thread.h"
 
 #include <glog/logging.h>
-#include "slash/include/rsync.h"
 #include "src/node/zp_data_server.h"
 #include "src/node/zp_data_partition.h"
 
@@ -38,12 +37,16 @@ ZPTrySyncThread::~ZPTrySyncThread() {
     kv.second->Close();
     delete kv.second;
   }
-  slash::StopRsync(zp_data_server->db_sync_path());
+  dbsync_server_.Stop();
   LOG(INFO) << " TrySync thread " << pthread_self() << " exit!!!";
 }
 
 void ZPTrySyncThread::TrySyncTaskSchedule(const std::string& table,
     int partition_id, uint64_t delay) {
+  if (delay == 0) {
+    // A fresh request, not one of our own retries, starts over
+    ResetRetryDelay(table, partition_id);
+  }
   slash::MutexLock l(&bg_thread_protector_);
   bg_thread_->StartThread();
   TrySyncTaskArg *targ = new TrySyncTaskArg(this, table, partition_id);
@@ -66,12 +69,40 @@ void ZPTrySyncThread::TrySyncTask(const std::string& table_name,
   if (!zp_data_server->Availible()  // server is not availible now
       || !SendTrySync(table_name, partition_id)) {
     // Need one more trysync, since error happenning or waiting for db sync
-    LOG(WARNING) << "SendTrySync delay " << kTrySyncInterval
+    // Retry quickly at first, a master switch usually settles within
+    // a moment, then back off towards the old fixed interval
+    uint64_t delay = NextRetryDelay(table_name, partition_id);
+    LOG(WARNING) << "SendTrySync delay " << delay
       << "(ms) to ReSchedule for table:" << table_name
       << ", partition:" << partition_id
       << ",  meta_epoch:" << zp_data_server->meta_epoch();
-    zp_data_server->AddSyncTask(table_name, partition_id, kTrySyncInterval);
+    zp_data_server->AddSyncTask(table_name, partition_id, delay);
+  } else {
+    ResetRetryDelay(table_name, partition_id);
+  }
+}
+
+uint64_t ZPTrySyncThread::NextRetryDelay(const std::string& table,
+    int partition_id) {
+  std::string index = TablePartitionString(table, partition_id);
+  slash::MutexLock l(&retry_mutex_);
+  uint64_t delay = kTrySyncBaseInterval;
+  auto iter = retry_delays_.find(index);
+  if (iter != retry_delays_.end()) {
+    delay = iter->second * 2;
+    if (delay > kTrySyncInterval) {
+      delay = kTrySyncInterval;
+    }
   }
+  retry_delays_[index] = delay;
+  return delay;
+}
+
+void ZPTrySyncThread::ResetRetryDelay(const std::string& table,
+    int partition_id) {
+  std::string index = TablePartitionString(table, partition_id);
+  slash::MutexLock l(&retry_mutex_);
+  retry_delays_.erase(index);
 }
 
 bool ZPTrySyncThread::Send(std::shared_ptr<Partition> partition,
@@ -218,10 +249,14 @@ bool ZPTrySyncThread::SendTrySync(const std::string& table_name,
     slash::CreatePath(partition->sync_path());
     RsyncRef(index);
     // Send && Recv
+    // The round trip of this synchronous exchange is the best RTT
+    // sample to master we get, it feeds the adaptive recover delays
+    uint64_t rtt_begin = slash::NowMicros();
     if (Send(partition, cli)) {
       Status s;
       RecvResult res;
       if (Recv(partition, cli, &res)) {
+        partition->RecordMasterRtt(slash::NowMicros() - rtt_begin);
         switch (res.code) {
           case client::StatusCode::kOk:
             LOG(INFO) << "TrySync ok, Partition: "
@@ -278,22 +313,18 @@ bool ZPTrySyncThread::SendTrySync(const std::string& table_name,
 }
 
 void ZPTrySyncThread::RsyncRef(const std::string& index) {
-  // Start Rsync
+  // Start the native DBSync receive channel
   if (rsync_ref_.empty()) {
-    slash::StopRsync(zp_data_server->db_sync_path());
     std::string dbsync_path = zp_data_server->db_sync_path();
-
-    // We append the master ip port after module name
-    // To make sure only data from current master is received
-    int ret = slash::StartRsync(dbsync_path, kDBSyncModule,
+    int ret = dbsync_server_.Start(dbsync_path,
         zp_data_server->local_ip(),
         zp_data_server->local_port() + kPortShiftRsync);
     if (0 != ret) {
-      LOG(WARNING) << "Failed to start rsync, path:" << dbsync_path
+      LOG(WARNING) << "Failed to start dbsync channel, path:" << dbsync_path
         << " error : " << ret;
       return;
     } else {
-      LOG(INFO) << "Success start rsync, path:" << dbsync_path;
+      LOG(INFO) << "Success start dbsync channel, path:" << dbsync_path;
     }
   }
   
@@ -309,13 +340,8 @@ void ZPTrySyncThread::RsyncUnref(const std::string& index) {
 
   rsync_ref_.erase(index);
   if (rsync_ref_.empty()) {
-    std::string dbsync_path = zp_data_server->db_sync_path();
-    int ret = slash::StopRsync(dbsync_path);
-    if (0 != ret) {
-      LOG(WARNING) << "Failed to stop rsync, path:" << dbsync_path
-        << " error : " << ret;
-    } else {
-      LOG(INFO) << "Success stop rsync, path:" << dbsync_path;
-    }
+    dbsync_server_.Stop();
+    LOG(INFO) << "Success stop dbsync channel, path:"
+      << zp_data_server->db_sync_path();
   }
 }
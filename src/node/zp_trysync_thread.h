@@ -24,6 +24,7 @@
 
 #include "include/zp_const.h"
 #include "src/node/zp_data_partition.h"
+#include "src/node/zp_dbsync_channel.h"
 
 class ZPTrySyncThread  {
  public:
@@ -46,6 +47,14 @@ class ZPTrySyncThread  {
   pink::BGThread* bg_thread_;
   static void DoTrySyncTask(void* arg);
   bool SendTrySync(const std::string& table_name, int partition_id);
+
+  // Per-partition retry backoff, starting at kTrySyncBaseInterval and
+  // doubling up to kTrySyncInterval; a fresh schedule or a finished
+  // trysync resets it
+  slash::Mutex retry_mutex_;
+  std::map<std::string, uint64_t> retry_delays_;
+  uint64_t NextRetryDelay(const std::string& table, int partition_id);
+  void ResetRetryDelay(const std::string& table, int partition_id);
   bool Send(std::shared_ptr<Partition> partition, pink::PinkCli* cli);
 
   struct RecvResult {
@@ -57,7 +66,8 @@ class ZPTrySyncThread  {
   bool Recv(std::shared_ptr<Partition> partition, pink::PinkCli* cli,
       RecvResult* res);
 
-  // Rsync related
+  // DBSync receive channel related
+  ZPDBSyncServer dbsync_server_;
   std::unordered_set<std::string> rsync_ref_;
   void RsyncRef(const std::string& index);
   void RsyncUnref(const std::string& index);
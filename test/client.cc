@@ -3,11 +3,16 @@
 #include <unistd.h>
 #include <getopt.h>
 #include <algorithm>
+#include <deque>
+#include <functional>
+#include <thread>
 #include "logger.h"
-#include "client.pb.h"
 
 namespace client {
 
+// Give up on a request after this many kMove hops
+static const int kMaxRedirects = 3;
+
 void Tokenize(const std::string& str, std::vector<std::string>& tokens, const char& delimiter = ' ') {
   size_t prev_pos = str.find_first_not_of(delimiter, 0);
   size_t pos = str.find(delimiter, prev_pos);
@@ -34,7 +39,7 @@ Option::Option()
     : timeout(1000) {
     }
 
-Option::Option(const std::string& server_str) 
+Option::Option(const std::string& server_str)
   : timeout(1000) {
   std::vector<std::string> server_list;
   Tokenize(server_str, server_list, ',');
@@ -43,7 +48,7 @@ Option::Option(const std::string& server_str)
 
 Option::Option(const std::vector<std::string>& server_list)
   : timeout(1000) {
-  Init(server_list); 
+  Init(server_list);
 }
 
 Option::Option(const Option& option)
@@ -86,74 +91,449 @@ void Option::ParseFromArgs(int argc, char *argv[]) {
   Init(server_list);
 }
 
+////// Pending //////
+// One async request in flight
+struct Pending {
+  std::string table;
+  std::string key;
+  CmdRequest request;
+  Callback callback;
+  void* arg;
+  int redirects;
+};
+
+////// NodeConn //////
+// Pipelined connection of one data node: submitted requests go out
+// back to back and their responses come home in the same order on
+// the single connection, so one thread keeps many requests in flight
+// without a connection pool
+class NodeConn {
+ public:
+  NodeConn(Cluster* cluster, const Server& node)
+      : cluster_(cluster),
+      node_(node),
+      cli_(new pink::PbCli),
+      connected_(false),
+      exit_(false),
+      cv_(&mutex_) {
+    thread_ = std::thread(&NodeConn::WorkLoop, this);
+  }
+
+  ~NodeConn() {
+    {
+      slash::MutexLock l(&mutex_);
+      exit_ = true;
+      cv_.Signal();
+    }
+    thread_.join();
+    for (auto p : queue_) {
+      Fail(p, Status::IOError("Connection closed"));
+    }
+    if (connected_) {
+      cli_->Close();
+    }
+    delete cli_;
+  }
+
+  void Submit(Pending* pending) {
+    slash::MutexLock l(&mutex_);
+    queue_.push_back(pending);
+    cv_.Signal();
+  }
+
+ private:
+  void Fail(Pending* pending, const Status& s) {
+    CmdResponse response;
+    pending->callback(s, response, pending->arg);
+    delete pending;
+  }
+
+  void WorkLoop() {
+    while (true) {
+      std::deque<Pending*> batch;
+      {
+        slash::MutexLock l(&mutex_);
+        while (queue_.empty() && !exit_) {
+          cv_.Wait();
+        }
+        if (exit_) {
+          return;  // whatever is still queued fails in the dtor
+        }
+        batch.swap(queue_);
+      }
+
+      if (!connected_) {
+        pink::Status ps = cli_->Connect(node_.ip, node_.port);
+        if (!ps.ok()) {
+          LOG_ERROR("connect DataServer(%s:%d) failed, %s",
+              node_.ip.c_str(), node_.port, ps.ToString().c_str());
+          for (auto p : batch) {
+            Fail(p, Status::IOError("Connect failed, " + ps.ToString()));
+          }
+          continue;
+        }
+        connected_ = true;
+      }
+
+      // Send the whole batch before reading the first response
+      size_t sent = 0;
+      pink::Status ps;
+      while (sent < batch.size()) {
+        ps = cli_->Send(&batch[sent]->request);
+        if (!ps.ok()) {
+          break;
+        }
+        sent++;
+      }
+
+      size_t recved = 0;
+      CmdResponse response;
+      for (; recved < sent; recved++) {
+        ps = cli_->Recv(&response);
+        if (!ps.ok()) {
+          break;
+        }
+        cluster_->HandleResponse(batch[recved], response);
+      }
+
+      if (recved < batch.size()) {
+        // The pipeline broke somewhere, drop the connection and
+        // fail whatever never got an answer
+        cli_->Close();
+        connected_ = false;
+        for (size_t i = recved; i < batch.size(); i++) {
+          Fail(batch[i], Status::IOError("Connection broken, "
+                + ps.ToString()));
+        }
+      }
+    }
+  }
+
+  Cluster* cluster_;
+  Server node_;
+  pink::PbCli* cli_;
+  bool connected_;
+
+  bool exit_;
+  slash::Mutex mutex_;
+  slash::CondVar cv_;
+  std::deque<Pending*> queue_;
+  std::thread thread_;
+};
+
 ////// Cluster //////
 Cluster::Cluster(const Option& option)
   : option_(option),
   meta_cli_(new pink::PbCli),
-  pb_cli_(new pink::PbCli) {
+  epoch_(0) {
   Init();
 }
 
+Cluster::~Cluster() {
+  // Deleting a NodeConn joins its thread, which may be busy
+  // redirecting into GetNodeConn, so never hold conn_mutex_ across
+  // the join and sweep again for connections born meanwhile
+  while (true) {
+    std::map<Server, NodeConn*> conns;
+    {
+      slash::MutexLock l(&conn_mutex_);
+      conns.swap(conns_);
+    }
+    if (conns.empty()) {
+      break;
+    }
+    for (auto& conn : conns) {
+      delete conn.second;
+    }
+  }
+  delete meta_cli_;
+}
+
 void Cluster::Init() {
   if (option_.servers.size() < 1) {
     LOG_ERROR("cluster has no server!");
     abort();
   }
-  // TEST use the first server
- // pink::Status result = pb_cli_->Connect("127.0.0.1", 8001);
- // LOG_INFO("connect DataServer(127.0.0.1:8001), %s", result.ToString().c_str());
-  //pink::Status result = pb_cli_->Connect(option_.servers[0].ip, option_.servers[0].port);
-  //LOG_INFO("connect DataServer(%s:%d), %s", option_.servers[0].ip.c_str(), option_.servers[0].port, result.ToString().c_str());
-//  if (!result.ok()) {
-//    LOG_ERROR("cluster connect(%s:%d) error, %s", option_.servers[0].ip, option_.servers[0].port, result.ToString().c_str());
-//  }
+}
+
+Status Cluster::Connect() {
+  return Pull("");
+}
+
+Status Cluster::Pull(const std::string& table) {
+  slash::MutexLock ml(&meta_mutex_);
+
+  ZPMeta::MetaCmd request;
+  request.set_type(ZPMeta::PULL);
+  ZPMeta::MetaCmd_Pull* pull = request.mutable_pull();
+  if (!table.empty()) {
+    pull->set_name(table);
+  } else {
+    slash::MutexLock l(&map_mutex_);
+    if (epoch_ > 0) {
+      // Meta may answer with a diff against this epoch
+      pull->set_epoch(epoch_);
+    }
+  }
+
+  // Walk the meta servers until one answers
+  pink::Status ps;
+  ZPMeta::MetaCmdResponse response;
+  bool recved = false;
+  for (auto& server : option_.servers) {
+    ps = meta_cli_->Connect(server.ip, server.port);
+    if (!ps.ok()) {
+      continue;
+    }
+    ps = meta_cli_->Send(&request);
+    if (ps.ok()) {
+      ps = meta_cli_->Recv(&response);
+    }
+    meta_cli_->Close();
+    if (ps.ok()) {
+      recved = true;
+      break;
+    }
+  }
+  if (!recved) {
+    return Status::IOError("Pull failed on every meta, " + ps.ToString());
+  }
+  if (response.code() != ZPMeta::OK) {
+    return Status::Corruption("Pull refused, " + response.msg());
+  }
+
+  const ZPMeta::MetaCmdResponse_Pull& info = response.pull();
+  slash::MutexLock l(&map_mutex_);
+  if (table.empty() && !info.has_base()) {
+    // Full snapshot replaces everything we hold
+    tables_.clear();
+  }
+  for (int i = 0; i < info.info_size(); i++) {
+    const ZPMeta::Table& t = info.info(i);
+    if (t.partitions_size() == 0) {
+      // A bare name in a diff marks a dropped table
+      tables_.erase(t.name());
+      continue;
+    }
+    TableMap map;
+    map.partition_cnt = t.partitions_size();
+    for (int j = 0; j < t.partitions_size(); j++) {
+      const ZPMeta::Partitions& p = t.partitions(j);
+      map.masters[p.id()] = Server(p.master().ip(), p.master().port());
+    }
+    tables_[t.name()] = map;
+  }
+  epoch_ = info.version();
+  LOG_INFO("Pulled routing, epoch %d, %d table(s) carried",
+      epoch_, info.info_size());
+  return Status::OK();
+}
+
+int Cluster::KeyToPartition(const std::string& table,
+    const std::string& key) {
+  // Must mirror Table::KeyToPartition on the data node
+  slash::MutexLock l(&map_mutex_);
+  auto it = tables_.find(table);
+  if (it == tables_.end() || it->second.partition_cnt == 0) {
+    return -1;
+  }
+  return std::hash<std::string>()(key) % it->second.partition_cnt;
+}
 
-  //result = meta_cli_->Connect("127.0.0.1", 8101);
-  //LOG_INFO("connect DataServer's MetacmdWorker(127.0.0.1:8101), %s", result.ToString().c_str());
-  //LOG_INFO("connect DataServer's MetacmdWorker(%s:%d), %s", option_.servers[0].ip.c_str(), option_.servers[0].port + 100, result.ToString().c_str());
+bool Cluster::LookupMaster(const std::string& table,
+    const std::string& key, Server* master) {
+  slash::MutexLock l(&map_mutex_);
+  auto it = tables_.find(table);
+  if (it == tables_.end() || it->second.partition_cnt == 0) {
+    return false;
+  }
+  int id = std::hash<std::string>()(key) % it->second.partition_cnt;
+  auto mit = it->second.masters.find(id);
+  if (mit == it->second.masters.end()) {
+    return false;
+  }
+  *master = mit->second;
+  return true;
+}
 
-  hb_thread_ = new ZPHeartbeatThread(option_.servers[0].port + 100, 2000);
-  hb_thread_->StartThread();
+NodeConn* Cluster::GetNodeConn(const Server& node) {
+  slash::MutexLock l(&conn_mutex_);
+  auto it = conns_.find(node);
+  if (it != conns_.end()) {
+    return it->second;
+  }
+  NodeConn* conn = new NodeConn(this, node);
+  conns_[node] = conn;
+  return conn;
 }
 
-Status Cluster::Set(const std::string& key, const std::string& value, std::string ip, int port) {
-  pink::Status result = pb_cli_->Connect(ip, port);
-  LOG_INFO("connect DataServer(%s:%d), %s", ip.c_str(), port, result.ToString().c_str());
+void Cluster::UpdateMaster(const std::string& table, int partition_id,
+    const Server& master) {
+  slash::MutexLock l(&map_mutex_);
+  auto it = tables_.find(table);
+  if (it == tables_.end() || partition_id < 0) {
+    return;
+  }
+  it->second.masters[partition_id] = master;
+}
 
+Status Cluster::Submit(const std::string& table, const std::string& key,
+    const CmdRequest& request, Callback callback, void* arg) {
+  Server master("", 0);
+  if (!LookupMaster(table, key, &master)) {
+    // Unknown table, maybe created after our last pull
+    Pull(table);
+    if (!LookupMaster(table, key, &master)) {
+      return Status::NotFound("No such table: " + table);
+    }
+  }
+
+  Pending* pending = new Pending;
+  pending->table = table;
+  pending->key = key;
+  pending->request = request;
+  pending->callback = callback;
+  pending->arg = arg;
+  pending->redirects = 0;
+  GetNodeConn(master)->Submit(pending);
+  return Status::OK();
+}
+
+void Cluster::HandleResponse(Pending* pending,
+    const CmdResponse& response) {
+  if (response.code() == StatusCode::kMove && response.has_redirect()) {
+    // The node knows better than our cache, follow it and remember
+    Server master(response.redirect().ip(), response.redirect().port());
+    UpdateMaster(pending->table,
+        KeyToPartition(pending->table, pending->key), master);
+    if (++pending->redirects <= kMaxRedirects) {
+      GetNodeConn(master)->Submit(pending);
+      return;
+    }
+    pending->callback(Status::Corruption("Too many redirects"),
+        response, pending->arg);
+    delete pending;
+    return;
+  }
+
+  if (response.code() == StatusCode::kError) {
+    // The routing might be stale as a whole, refresh before the
+    // caller retries
+    Pull(pending->table);
+  }
+
+  Status s;
+  switch (response.code()) {
+    case StatusCode::kOk:
+      s = Status::OK();
+      break;
+    case StatusCode::kNotFound:
+      s = Status::NotFound(response.msg());
+      break;
+    case StatusCode::kWait:
+      s = Status::Incomplete(response.msg());
+      break;
+    default:
+      s = Status::Corruption(response.msg());
+  }
+  pending->callback(s, response, pending->arg);
+  delete pending;
+}
+
+Status Cluster::SetAsync(const std::string& table, const std::string& key,
+    const std::string& value, Callback callback, void* arg) {
   CmdRequest request;
   request.set_type(Type::SET);
-
   CmdRequest_Set* set_req = request.mutable_set();
+  set_req->set_table_name(table);
   set_req->set_key(key);
   set_req->set_value(value);
+  return Submit(table, key, request, callback, arg);
+}
 
+Status Cluster::GetAsync(const std::string& table, const std::string& key,
+    Callback callback, void* arg) {
+  CmdRequest request;
+  request.set_type(Type::GET);
+  CmdRequest_Get* get_req = request.mutable_get();
+  get_req->set_table_name(table);
+  get_req->set_key(key);
+  return Submit(table, key, request, callback, arg);
+}
 
-  result = pb_cli_->Send(&request);
-  if (!result.ok()) {
-    LOG_ERROR("Send error: %s", result.ToString().c_str());
-    return Status::IOError("Send failed, " + result.ToString());
-  }
+Status Cluster::DelAsync(const std::string& table, const std::string& key,
+    Callback callback, void* arg) {
+  CmdRequest request;
+  request.set_type(Type::DEL);
+  CmdRequest_Del* del_req = request.mutable_del();
+  del_req->set_table_name(table);
+  del_req->set_key(key);
+  return Submit(table, key, request, callback, arg);
+}
 
+////// Sync wrappers //////
+struct SyncWaiter {
+  slash::Mutex mutex;
+  slash::CondVar cv;
+  bool done;
+  Status result;
   CmdResponse response;
-  result = pb_cli_->Recv(&response);
-  if (!result.ok()) {
-    LOG_ERROR("Recv error: %s", result.ToString().c_str());
-    return Status::IOError("Recv failed, " + result.ToString());
+  SyncWaiter() : cv(&mutex), done(false) {}
+};
+
+static void SyncCallback(const Status& s, const CmdResponse& response,
+    void* arg) {
+  SyncWaiter* waiter = static_cast<SyncWaiter*>(arg);
+  slash::MutexLock l(&waiter->mutex);
+  waiter->result = s;
+  waiter->response = response;
+  waiter->done = true;
+  waiter->cv.Signal();
+}
+
+static Status WaitFor(SyncWaiter* waiter) {
+  slash::MutexLock l(&waiter->mutex);
+  while (!waiter->done) {
+    waiter->cv.Wait();
   }
+  return waiter->result;
+}
 
-  pb_cli_->Close();
-  if (response.set().code() == StatusCode::kOk) {
-    LOG_INFO("Set OK, status is %d, msg is %s\n", response.set().code(), response.set().msg().c_str());
-    return Status::OK();
-  } else if (response.set().code() == StatusCode::kNotFound) {
-    LOG_INFO("Set Not found, status is %d, msg is %s\n", response.set().code(), response.set().msg().c_str());
-    return Status::NotFound("");
-  } else {
-    return Status::Corruption(response.set().msg());
+Status Cluster::Set(const std::string& table, const std::string& key,
+    const std::string& value) {
+  SyncWaiter waiter;
+  Status s = SetAsync(table, key, value, &SyncCallback, &waiter);
+  if (!s.ok()) {
+    return s;
+  }
+  return WaitFor(&waiter);
+}
+
+Status Cluster::Get(const std::string& table, const std::string& key,
+    std::string* value) {
+  SyncWaiter waiter;
+  Status s = GetAsync(table, key, &SyncCallback, &waiter);
+  if (!s.ok()) {
+    return s;
+  }
+  s = WaitFor(&waiter);
+  if (s.ok()) {
+    *value = waiter.response.get().value();
+  }
+  return s;
+}
+
+Status Cluster::Del(const std::string& table, const std::string& key) {
+  SyncWaiter waiter;
+  Status s = DelAsync(table, key, &SyncCallback, &waiter);
+  if (!s.ok()) {
+    return s;
   }
+  return WaitFor(&waiter);
 }
 
 Status Cluster::Update(ZPMeta::MetaCmd &request, ZPMeta::MetaCmdResponse &response, std::string ip, int port) {
+  slash::MutexLock ml(&meta_mutex_);
   pink::Status result = meta_cli_->Connect(ip, port);
   LOG_INFO("connect DataServer's MetacmdWorker(%s:%d), %s", ip.c_str(), port, result.ToString().c_str());
   result = meta_cli_->Send(&request);
@@ -172,36 +552,6 @@ Status Cluster::Update(ZPMeta::MetaCmd &request, ZPMeta::MetaCmdResponse &respon
   return Status::OK();
 }
 
-Status Cluster::Get(const std::string& key, std::string* value, std::string ip, int port) {
-  pink::Status result = pb_cli_->Connect(ip, port);
-  LOG_INFO("connect DataServer(%s:%d), %s", ip.c_str(), port, result.ToString().c_str());
-
-  CmdRequest request;
-  request.set_type(Type::GET);
-
-  CmdRequest_Get* get_req = request.mutable_get();
-  get_req->set_key(key);
-
-  result = pb_cli_->Send(&request);
-  if (!result.ok()) {
-    LOG_ERROR("Send error: %s", result.ToString().c_str());
-    return Status::IOError("Send failed, " + result.ToString());
-  }
-
-  CmdResponse response;
-  result = pb_cli_->Recv(&response);
-  if (!result.ok()) {
-    LOG_ERROR("Recv error: %s", result.ToString().c_str());
-    return Status::IOError("Recv failed, " + result.ToString());
-  }
-
-  *value = response.get().value();
-
-  pb_cli_->Close();
-  LOG_INFO("Get OK, status is %d, value is %s\n", response.get().code(), response.get().value().c_str());
-  return Status::OK();
-}
-
 ////// ZPPbCli //////
 void ZPPbCli::BuildWbuf() {
   uint32_t len;
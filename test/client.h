@@ -1,24 +1,33 @@
 #ifndef ZP_CLIENT_H
 #define ZP_CLIENT_H
 
+#include <map>
 #include <string>
 #include <vector>
 
-#include "zp_heartbeat_thread.h"
 #include "zp_meta.pb.h"
+#include "client.pb.h"
 
 #include "pb_cli.h"
 #include "slash_status.h"
+#include "slash_mutex.h"
 
 using slash::Status;
 
 namespace client {
 
 struct Option;
+struct Pending;
 class Server;
 class Cluster;
+class NodeConn;
 class ZPPbCli;
 
+// Fired on the connection thread of the target node once the
+// response of an async request arrived or the request failed for good
+typedef void (*Callback)(const Status& s, const CmdResponse& response,
+    void* arg);
+
 class Server {
  public:
   std::string ip;
@@ -38,6 +47,10 @@ class Server {
     return *this;
   }
 
+  bool operator<(const Server& server) const {
+    return ip < server.ip || (ip == server.ip && port < server.port);
+  }
+
  private:
 };
 
@@ -52,36 +65,78 @@ struct Option {
   // comma separated server list:   ip1:port1,ip2:port2
   Option(const std::string& server_str);
 
-  Option(const std::vector<std::string>& server_list); 
+  Option(const std::vector<std::string>& server_list);
   Option(const Option& option);
 
   void ParseFromArgs(int argc, char *argv[]);
   void Init(const std::vector<std::string>& server_list);
 };
 
+// Routing of one table as pulled from meta
+struct TableMap {
+  int partition_cnt;
+  std::map<int, Server> masters;  // partition id -> master node
+};
+
 class Cluster {
  public:
   Cluster(const Option& option);
-  ~Cluster() {
-    delete hb_thread_;
-    delete meta_cli_;
-    //delete pb_cli_;
-  }
-
-  Status Get(const std::string& key, std::string* value, std::string ip, int port);
-  Status Set(const std::string& key, const std::string& value, std::string ip, int port);
+  ~Cluster();
+
+  // Pull the routing of every table from meta
+  Status Connect();
+
+  // Async API, routed client side by key, requests to the same node
+  // share one pipelined connection, the callback fires on its thread
+  Status SetAsync(const std::string& table, const std::string& key,
+      const std::string& value, Callback callback, void* arg);
+  Status GetAsync(const std::string& table, const std::string& key,
+      Callback callback, void* arg);
+  Status DelAsync(const std::string& table, const std::string& key,
+      Callback callback, void* arg);
+
+  // Sync wrappers over the async path
+  Status Set(const std::string& table, const std::string& key,
+      const std::string& value);
+  Status Get(const std::string& table, const std::string& key,
+      std::string* value);
+  Status Del(const std::string& table, const std::string& key);
+
+  // Refresh the local routing from meta, an empty name refreshes
+  // every table, carrying the held epoch so meta may answer a diff
+  Status Pull(const std::string& table);
+
+  // Admin passthrough kept for the test drivers
   Status Update(ZPMeta::MetaCmd &request, ZPMeta::MetaCmdResponse &response, std::string ip, int port);
-  //Status Sync(const std::string& ip, int port, int filenum = 0, int64_t offset = 0);
-
 
  private:
+  friend class NodeConn;
+
   void Init();
+  // Must mirror Table::KeyToPartition on the data node
+  int KeyToPartition(const std::string& table, const std::string& key);
+  bool LookupMaster(const std::string& table, const std::string& key,
+      Server* master);
+  Status Submit(const std::string& table, const std::string& key,
+      const CmdRequest& request, Callback callback, void* arg);
+  NodeConn* GetNodeConn(const Server& node);
+  void UpdateMaster(const std::string& table, int partition_id,
+      const Server& master);
+  void HandleResponse(Pending* pending, const CmdResponse& response);
 
   Option option_;
 
-  ZPHeartbeatThread* hb_thread_;
   pink::PbCli* meta_cli_;
-  pink::PbCli* pb_cli_;
+  slash::Mutex meta_mutex_;
+
+  // Local routing cache keyed by the pulled epoch, kMove responses
+  // patch single partitions, kError triggers a fresh pull
+  slash::Mutex map_mutex_;
+  int epoch_;
+  std::map<std::string, TableMap> tables_;
+
+  slash::Mutex conn_mutex_;
+  std::map<Server, NodeConn*> conns_;
 };
 
 class ZPPbCli : public pink::PbCli {
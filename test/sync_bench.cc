@@ -0,0 +1,631 @@
+// Replication benchmark: a fake slave driving one partition's sync
+// stream at full rate while a writer loads the master, reporting
+// records/sec, bytes/sec, write-to-replicated latency and the time to
+// catch up from a configurable backlog.
+//
+// The bench stands in for a configured slave: the target node must be
+// master of the partition with the node given by -l/-P listed among
+// its slaves. With the fake_meta topology (127.0.0.1:8001/8002/8003)
+// stop node 8002 and run:
+//
+//   ./sync_bench -p 8001 -P 8002 -t test
+//
+// Phases:
+//   1. backlog  - write -b records to the master with no slave attached
+//   2. catch-up - trysync from (0,0) and consume the stream until the
+//                 marker record written last in the backlog arrives
+//   3. steady   - keep writing timestamped records for -d seconds and
+//                 measure write-to-replicated latency at the slave
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "client.pb.h"
+
+#include "logger.h"
+#include "pb_conn.h"
+#include "pb_cli.h"
+#include "pink_thread.h"
+#include "holy_thread.h"
+#include "slash_status.h"
+#include "slash_mutex.h"
+
+using slash::Status;
+
+// Mirrors include/zp_const.h, which needs build-time defines we lack here
+static const int kPortShiftSync = 200;
+
+// Timestamp header of a steady phase value: 20 digit micros and a colon
+static const size_t kValueTsLen = 21;
+static const size_t kMinValueSize = 32;
+
+struct BenchOption {
+  std::string master_ip = "127.0.0.1";
+  int master_port = 8001;
+  std::string local_ip = "127.0.0.1";
+  int local_port = 8002;
+  std::string table = "test";
+  int partition_num = 2;
+  int partition = 0;
+  int64_t epoch = -1;          // -1 asks the master via INFOSERVER
+  uint64_t backlog_num = 100000;
+  size_t value_size = 128;
+  int duration = 10;
+  int window = 64;             // writer pipeline depth
+};
+
+static BenchOption g_opt;
+static std::string g_marker_key;
+
+// Shared between the sync listener, the acker and the main thread
+struct BenchState {
+  std::atomic<uint64_t> frames{0};
+  std::atomic<uint64_t> records{0};
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint64_t> skips{0};
+  std::atomic<uint64_t> leases{0};
+  std::atomic<uint64_t> acks_sent{0};
+  std::atomic<uint64_t> last_arrival_us{0};
+  std::atomic<bool> marker_seen{false};
+  std::atomic<bool> stop_acker{false};
+
+  slash::Mutex mu;  // guards the fields below
+  uint32_t ack_filenum = 0;
+  uint64_t ack_offset = 0;
+  bool offset_dirty = false;
+  std::vector<uint64_t> latencies_us;
+};
+
+static BenchState g_state;
+
+static uint64_t NowMicros() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<uint64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+// Must mirror Table::KeyToPartition on the data node
+static int KeyToPartition(const std::string& key) {
+  return std::hash<std::string>()(key) % g_opt.partition_num;
+}
+
+// The value of a steady phase record carries its send time, so the
+// receiving side can compute the write-to-replicated latency
+static void RecordLatency(const std::string& value, uint64_t now) {
+  if (value.size() < kValueTsLen || value[kValueTsLen - 1] != ':') {
+    return;
+  }
+  char* end = NULL;
+  uint64_t sent = strtoull(value.c_str(), &end, 10);
+  if (end != value.c_str() + kValueTsLen - 1 || sent == 0 || sent > now) {
+    return;
+  }
+  slash::MutexLock l(&g_state.mu);
+  g_state.latencies_us.push_back(now - sent);
+}
+
+////// Fake slave listener //////
+// The master connects to local_port + kPortShiftSync and streams
+// SyncRequest frames at it, exactly as to a real slave
+
+class SyncBenchConn : public pink::PbConn {
+ public:
+  SyncBenchConn(int fd, std::string ip_port, pink::Thread* thread)
+      : PbConn(fd, ip_port) {
+  }
+  virtual ~SyncBenchConn() {}
+  virtual int DealMessage();
+
+ private:
+  void DealItem(const client::SyncItem& item, uint64_t now);
+
+  client::SyncRequest request_;
+};
+
+void SyncBenchConn::DealItem(const client::SyncItem& item, uint64_t now) {
+  if (item.has_request()) {
+    g_state.records++;
+    const client::CmdRequest& req = item.request();
+    if (req.type() == client::Type::SET) {
+      RecordLatency(req.set().value(), now);
+      if (!g_state.marker_seen && req.set().key() == g_marker_key) {
+        g_state.marker_seen = true;
+      }
+    }
+  } else {
+    g_state.skips++;
+  }
+  slash::MutexLock l(&g_state.mu);
+  g_state.ack_filenum = item.sync_offset().filenum();
+  g_state.ack_offset = item.sync_offset().offset();
+  g_state.offset_dirty = true;
+}
+
+int SyncBenchConn::DealMessage() {
+  if (!request_.ParseFromArray(rbuf_ + 4, header_len_)) {
+    LOG_ERROR("parse SyncRequest failed, %d bytes", header_len_);
+    return -1;
+  }
+  set_is_reply(false);
+
+  uint64_t now = NowMicros();
+  g_state.frames++;
+  g_state.bytes += header_len_ + 4;
+  g_state.last_arrival_us = now;
+
+  switch (request_.sync_type()) {
+    case client::SyncType::BATCH: {
+      const client::BinlogBatch& batch = request_.binlog_batch();
+      for (int i = 0; i < batch.items_size(); i++) {
+        DealItem(batch.items(i), now);
+      }
+      break;
+    }
+    case client::SyncType::CMD: {
+      g_state.records++;
+      if (request_.request().type() == client::Type::SET) {
+        RecordLatency(request_.request().set().value(), now);
+      }
+      slash::MutexLock l(&g_state.mu);
+      g_state.ack_filenum = request_.sync_offset().filenum();
+      g_state.ack_offset = request_.sync_offset().offset();
+      g_state.offset_dirty = true;
+      break;
+    }
+    case client::SyncType::SKIP: {
+      g_state.skips++;
+      slash::MutexLock l(&g_state.mu);
+      g_state.ack_filenum = request_.sync_offset().filenum();
+      g_state.ack_offset = request_.sync_offset().offset() +
+        request_.binlog_skip().gap();
+      g_state.offset_dirty = true;
+      break;
+    }
+    case client::SyncType::LEASE: {
+      g_state.leases++;
+      break;
+    }
+    default:
+      LOG_ERROR("unexpected sync_type %d", (int)request_.sync_type());
+      break;
+  }
+  return 0;
+}
+
+class SyncBenchThread : public pink::HolyThread<SyncBenchConn> {
+ public:
+  SyncBenchThread(int port, int cron_interval = 0)
+      : HolyThread::HolyThread(port, cron_interval) {
+    LOG_INFO("SyncBenchThread on port:%d", port);
+  }
+  virtual ~SyncBenchThread() {}
+};
+
+////// Acker //////
+// A real slave reports its applied offset back on the master's sync
+// port; the bench acks the latest received item as fast as it arrives,
+// which also keeps the sync lease alive
+
+static void AckerLoop() {
+  pink::PbCli* cli = new pink::PbCli;
+  bool connected = false;
+
+  while (!g_state.stop_acker) {
+    uint32_t filenum;
+    uint64_t offset;
+    bool dirty;
+    {
+      slash::MutexLock l(&g_state.mu);
+      dirty = g_state.offset_dirty;
+      filenum = g_state.ack_filenum;
+      offset = g_state.ack_offset;
+      g_state.offset_dirty = false;
+    }
+    if (!dirty) {
+      usleep(2000);
+      continue;
+    }
+
+    if (!connected) {
+      pink::Status ps = cli->Connect(g_opt.master_ip,
+          g_opt.master_port + kPortShiftSync);
+      if (!ps.ok()) {
+        LOG_ERROR("acker connect(%s:%d) failed, %s", g_opt.master_ip.c_str(),
+            g_opt.master_port + kPortShiftSync, ps.ToString().c_str());
+        sleep(1);
+        continue;
+      }
+      connected = true;
+    }
+
+    client::SyncRequest ack;
+    ack.set_sync_type(client::SyncType::ACK);
+    ack.set_epoch(g_opt.epoch);
+    client::Node* from = ack.mutable_from();
+    from->set_ip(g_opt.local_ip);
+    from->set_port(g_opt.local_port);
+    client::SyncAck* sack = ack.mutable_sync_ack();
+    sack->set_table_name(g_opt.table);
+    sack->set_partition_id(g_opt.partition);
+    sack->mutable_sync_offset()->set_filenum(filenum);
+    sack->mutable_sync_offset()->set_offset(offset);
+
+    pink::Status ps = cli->Send(&ack);
+    if (!ps.ok()) {
+      LOG_ERROR("acker send failed, %s", ps.ToString().c_str());
+      cli->Close();
+      connected = false;
+      continue;
+    }
+    g_state.acks_sent++;
+  }
+
+  if (connected) {
+    cli->Close();
+  }
+  delete cli;
+}
+
+////// Writer //////
+
+struct WriterReport {
+  uint64_t records = 0;
+  uint64_t bytes = 0;
+  uint64_t errors = 0;
+};
+
+// Keys are picked so every record lands on the benched partition
+static std::vector<std::string> BuildKeyPool(size_t count) {
+  std::vector<std::string> pool;
+  for (uint64_t i = 0; pool.size() < count; i++) {
+    std::string key = "sync_bench_" + std::to_string(i);
+    if (KeyToPartition(key) == g_opt.partition) {
+      pool.push_back(key);
+    }
+  }
+  return pool;
+}
+
+// Pipelined like the test client NodeConn: a whole window goes out
+// before the first response is read back
+static bool RunWriter(pink::PbCli* cli, uint64_t max_records,
+    uint64_t deadline_us, bool timestamped, WriterReport* report) {
+  static std::vector<std::string> pool = BuildKeyPool(997);
+  std::string value(g_opt.value_size, 'x');
+  client::CmdRequest request;
+  client::CmdResponse response;
+  uint64_t next_key = 0;
+
+  while (report->records < max_records
+      && (deadline_us == 0 || NowMicros() < deadline_us)) {
+    uint64_t window = std::min<uint64_t>(g_opt.window,
+        max_records - report->records);
+    for (uint64_t i = 0; i < window; i++) {
+      request.Clear();
+      request.set_type(client::Type::SET);
+      client::CmdRequest_Set* set = request.mutable_set();
+      set->set_table_name(g_opt.table);
+      set->set_key(pool[next_key++ % pool.size()]);
+      if (timestamped) {
+        snprintf(&value[0], kValueTsLen + 1, "%020llu:",
+            (unsigned long long)NowMicros());
+        value[kValueTsLen] = 'x';  // snprintf's terminator
+      }
+      set->set_value(value);
+      pink::Status ps = cli->Send(&request);
+      if (!ps.ok()) {
+        LOG_ERROR("writer send failed, %s", ps.ToString().c_str());
+        return false;
+      }
+    }
+    for (uint64_t i = 0; i < window; i++) {
+      pink::Status ps = cli->Recv(&response);
+      if (!ps.ok()) {
+        LOG_ERROR("writer recv failed, %s", ps.ToString().c_str());
+        return false;
+      }
+      if (response.code() == client::StatusCode::kOk) {
+        report->records++;
+        report->bytes += g_opt.value_size;
+      } else {
+        report->errors++;
+      }
+    }
+  }
+  return true;
+}
+
+// The very last backlog record; once the fake slave sees it replicated,
+// everything written before it has arrived as well
+static bool WriteMarker(pink::PbCli* cli) {
+  client::CmdRequest request;
+  client::CmdResponse response;
+  request.set_type(client::Type::SET);
+  client::CmdRequest_Set* set = request.mutable_set();
+  set->set_table_name(g_opt.table);
+  set->set_key(g_marker_key);
+  set->set_value("sync_bench_marker");
+  pink::Status ps = cli->Send(&request);
+  if (ps.ok()) {
+    ps = cli->Recv(&response);
+  }
+  if (!ps.ok() || response.code() != client::StatusCode::kOk) {
+    LOG_ERROR("marker write failed, %s", ps.ok() ?
+        response.msg().c_str() : ps.ToString().c_str());
+    return false;
+  }
+  return true;
+}
+
+////// Master queries and trysync //////
+
+static bool FetchMasterEpoch(pink::PbCli* cli, int64_t* epoch) {
+  client::CmdRequest request;
+  client::CmdResponse response;
+  request.set_type(client::Type::INFOSERVER);
+  pink::Status ps = cli->Send(&request);
+  if (ps.ok()) {
+    ps = cli->Recv(&response);
+  }
+  if (!ps.ok() || !response.has_info_server()) {
+    LOG_ERROR("INFOSERVER failed, %s", ps.ToString().c_str());
+    return false;
+  }
+  *epoch = response.info_server().epoch();
+  return true;
+}
+
+// Warn early when meta does not list the bench node as a slave of the
+// partition, the trysync below would only be refused
+static void CheckSlaveListed(pink::PbCli* cli) {
+  client::CmdRequest request;
+  client::CmdResponse response;
+  request.set_type(client::Type::INFOREPL);
+  request.mutable_info()->set_table_name(g_opt.table);
+  pink::Status ps = cli->Send(&request);
+  if (ps.ok()) {
+    ps = cli->Recv(&response);
+  }
+  if (!ps.ok() || response.info_repl_size() < 1) {
+    LOG_ERROR("INFOREPL failed, cannot verify topology");
+    return;
+  }
+  for (int i = 0; i < response.info_repl(0).partition_state_size(); i++) {
+    const client::PartitionState& state =
+      response.info_repl(0).partition_state(i);
+    if (state.partition_id() != g_opt.partition) {
+      continue;
+    }
+    for (int j = 0; j < state.slaves_size(); j++) {
+      if (state.slaves(j).ip() == g_opt.local_ip
+          && state.slaves(j).port() == g_opt.local_port) {
+        return;
+      }
+    }
+    printf ("WARNING: %s:%d is not a slave of %s_%d on the master, "
+        "trysync will be refused\n", g_opt.local_ip.c_str(),
+        g_opt.local_port, g_opt.table.c_str(), g_opt.partition);
+    return;
+  }
+  printf ("WARNING: partition %d not found in INFOREPL of table %s\n",
+      g_opt.partition, g_opt.table.c_str());
+}
+
+static bool TrySync(pink::PbCli* cli, uint32_t filenum, uint64_t offset) {
+  client::CmdRequest request;
+  client::CmdResponse response;
+  request.set_type(client::Type::SYNC);
+  client::CmdRequest_Sync* sync = request.mutable_sync();
+  sync->mutable_node()->set_ip(g_opt.local_ip);
+  sync->mutable_node()->set_port(g_opt.local_port);
+  sync->set_table_name(g_opt.table);
+  client::SyncOffset* sync_offset = sync->mutable_sync_offset();
+  sync_offset->set_partition(g_opt.partition);
+  sync_offset->set_filenum(filenum);
+  sync_offset->set_offset(offset);
+  sync->set_epoch(g_opt.epoch);
+
+  pink::Status ps = cli->Send(&request);
+  if (ps.ok()) {
+    ps = cli->Recv(&response);
+  }
+  if (!ps.ok()) {
+    LOG_ERROR("trysync failed, %s", ps.ToString().c_str());
+    return false;
+  }
+  switch (response.code()) {
+    case client::StatusCode::kOk:
+      printf ("TrySync ok from (%u, %lu)\n", filenum,
+          (unsigned long)offset);
+      return true;
+    case client::StatusCode::kFallback:
+      // The master could not serve our point and answered the one it can
+      printf ("TrySync fallback to (%d, %ld)\n",
+          response.sync().sync_offset().filenum(),
+          (long)response.sync().sync_offset().offset());
+      return TrySync(cli, response.sync().sync_offset().filenum(),
+          response.sync().sync_offset().offset());
+    case client::StatusCode::kWait:
+      printf ("TrySync refused, the master wants a full DBSync first; "
+          "rerun against a master whose binlog still covers (0, 0)\n");
+      return false;
+    default:
+      printf ("TrySync failed: %s\n", response.msg().c_str());
+      return false;
+  }
+}
+
+////// Report //////
+
+static void PrintRate(const char* phase, uint64_t records, uint64_t bytes,
+    uint64_t duration_us) {
+  if (duration_us == 0) {
+    duration_us = 1;
+  }
+  printf ("%-9s %8lu records %8.2f MB in %6.2f s -> %9.0f records/s"
+      " %7.2f MB/s\n", phase, (unsigned long)records,
+      bytes / 1048576.0, duration_us / 1e6,
+      records * 1e6 / duration_us, bytes * 1e6 / 1048576.0 / duration_us);
+}
+
+static void PrintLatency() {
+  std::vector<uint64_t> samples;
+  {
+    slash::MutexLock l(&g_state.mu);
+    samples = g_state.latencies_us;
+  }
+  if (samples.empty()) {
+    printf ("latency   no timestamped record replicated\n");
+    return;
+  }
+  std::sort(samples.begin(), samples.end());
+  uint64_t sum = 0;
+  for (size_t i = 0; i < samples.size(); i++) {
+    sum += samples[i];
+  }
+  size_t p99 = samples.size() * 99 / 100;
+  if (p99 >= samples.size()) {
+    p99 = samples.size() - 1;
+  }
+  printf ("latency   write->replicated over %lu records: avg %lu us"
+      "  p99 %lu us  max %lu us\n", (unsigned long)samples.size(),
+      (unsigned long)(sum / samples.size()),
+      (unsigned long)samples[p99],
+      (unsigned long)samples.back());
+}
+
+static void Usage() {
+  printf ("Usage: sync_bench [options]\n"
+      "  -i ip      master ip (127.0.0.1)\n"
+      "  -p port    master port (8001)\n"
+      "  -l ip      local ip the bench registers as (127.0.0.1)\n"
+      "  -P port    local port the bench registers as (8002), must be\n"
+      "             listed as a slave of the partition in meta\n"
+      "  -t table   table name (test)\n"
+      "  -n num     partition count of the table (2)\n"
+      "  -g id      partition to sync (0)\n"
+      "  -e epoch   meta epoch, default asks the master via INFOSERVER\n"
+      "  -b num     backlog records written before trysync (100000)\n"
+      "  -s bytes   value size (128, min %lu)\n"
+      "  -d secs    steady phase duration (10)\n"
+      "  -w num     writer pipeline depth (64)\n",
+      (unsigned long)kMinValueSize);
+}
+
+int main(int argc, char* argv[]) {
+  int ch;
+  while ((ch = getopt(argc, argv, "i:p:l:P:t:n:g:e:b:s:d:w:h")) != -1) {
+    switch (ch) {
+      case 'i': g_opt.master_ip = optarg; break;
+      case 'p': g_opt.master_port = atoi(optarg); break;
+      case 'l': g_opt.local_ip = optarg; break;
+      case 'P': g_opt.local_port = atoi(optarg); break;
+      case 't': g_opt.table = optarg; break;
+      case 'n': g_opt.partition_num = atoi(optarg); break;
+      case 'g': g_opt.partition = atoi(optarg); break;
+      case 'e': g_opt.epoch = atoll(optarg); break;
+      case 'b': g_opt.backlog_num = strtoull(optarg, NULL, 10); break;
+      case 's': g_opt.value_size = atoi(optarg); break;
+      case 'd': g_opt.duration = atoi(optarg); break;
+      case 'w': g_opt.window = atoi(optarg); break;
+      case 'h':
+      default:
+        Usage();
+        return 0;
+    }
+  }
+  if (g_opt.value_size < kMinValueSize) {
+    g_opt.value_size = kMinValueSize;
+  }
+  for (uint64_t i = 0; ; i++) {
+    g_marker_key = "sync_bench_marker_" + std::to_string(i);
+    if (KeyToPartition(g_marker_key) == g_opt.partition) {
+      break;
+    }
+  }
+
+  pink::PbCli* cli = new pink::PbCli;
+  pink::Status ps = cli->Connect(g_opt.master_ip, g_opt.master_port);
+  if (!ps.ok()) {
+    printf ("Connect master(%s:%d) failed, %s\n", g_opt.master_ip.c_str(),
+        g_opt.master_port, ps.ToString().c_str());
+    return 1;
+  }
+
+  if (g_opt.epoch < 0 && !FetchMasterEpoch(cli, &g_opt.epoch)) {
+    printf ("Cannot fetch the master epoch, pass it with -e\n");
+    return 1;
+  }
+  CheckSlaveListed(cli);
+
+  // Phase 1: backlog, written while no slave consumes the binlog
+  printf ("==== sync_bench against %s:%d %s_%d epoch %ld ====\n",
+      g_opt.master_ip.c_str(), g_opt.master_port, g_opt.table.c_str(),
+      g_opt.partition, (long)g_opt.epoch);
+  WriterReport backlog;
+  uint64_t begin_us = NowMicros();
+  if (!RunWriter(cli, g_opt.backlog_num, 0, false, &backlog)
+      || !WriteMarker(cli)) {
+    return 1;
+  }
+  if (backlog.errors > 0) {
+    printf ("WARNING: %lu backlog writes failed\n",
+        (unsigned long)backlog.errors);
+  }
+  PrintRate("backlog", backlog.records, backlog.bytes,
+      NowMicros() - begin_us);
+
+  // Phase 2: catch up from the configured backlog
+  SyncBenchThread* sync_thread =
+    new SyncBenchThread(g_opt.local_port + kPortShiftSync);
+  sync_thread->StartThread();
+  std::thread acker(&AckerLoop);
+
+  begin_us = NowMicros();
+  if (!TrySync(cli, 0, 0)) {
+    return 1;
+  }
+  while (!g_state.marker_seen) {
+    usleep(1000);
+  }
+  uint64_t catchup_us = g_state.last_arrival_us - begin_us;
+  PrintRate("catch-up", g_state.records, g_state.bytes, catchup_us);
+
+  // Phase 3: steady state, timestamped writes measure the
+  // write-to-replicated latency at the fake slave
+  uint64_t records_before = g_state.records;
+  uint64_t bytes_before = g_state.bytes;
+  begin_us = NowMicros();
+  WriterReport steady;
+  RunWriter(cli, UINT64_MAX, begin_us + g_opt.duration * 1000000ULL,
+      true, &steady);
+  sleep(1);  // let the tail of the stream arrive
+  PrintRate("steady", g_state.records - records_before,
+      g_state.bytes - bytes_before, g_state.last_arrival_us - begin_us);
+  PrintLatency();
+  printf ("frames %lu  skips %lu  leases %lu  acks %lu"
+      "  write errors %lu\n",
+      (unsigned long)g_state.frames.load(),
+      (unsigned long)g_state.skips.load(),
+      (unsigned long)g_state.leases.load(),
+      (unsigned long)g_state.acks_sent.load(),
+      (unsigned long)steady.errors);
+
+  g_state.stop_acker = true;
+  acker.join();
+  cli->Close();
+  delete cli;
+  delete sync_thread;
+  return 0;
+}
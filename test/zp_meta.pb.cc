@@ -3542,6 +3542,7 @@ void MetaCmd_Ping::Swap(MetaCmd_Ping* other) {
 #ifndef _MSC_VER
 const int MetaCmd_Pull::kNodeFieldNumber;
 const int MetaCmd_Pull::kNameFieldNumber;
+const int MetaCmd_Pull::kEpochFieldNumber;
 #endif  // !_MSC_VER
 
 MetaCmd_Pull::MetaCmd_Pull()
@@ -3563,6 +3564,7 @@ void MetaCmd_Pull::SharedCtor() {
   _cached_size_ = 0;
   node_ = NULL;
   name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  epoch_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -3610,6 +3612,7 @@ void MetaCmd_Pull::Clear() {
         name_->clear();
       }
     }
+    epoch_ = 0;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -3647,6 +3650,22 @@ bool MetaCmd_Pull::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(24)) goto parse_epoch;
+        break;
+      }
+
+      // optional int32 epoch = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_epoch:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &epoch_)));
+          set_has_epoch();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -3684,6 +3703,11 @@ void MetaCmd_Pull::SerializeWithCachedSizes(
       2, this->name(), output);
   }
 
+  // optional int32 epoch = 3;
+  if (has_epoch()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->epoch(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -3709,6 +3733,11 @@ void MetaCmd_Pull::SerializeWithCachedSizes(
         2, this->name(), target);
   }
 
+  // optional int32 epoch = 3;
+  if (has_epoch()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->epoch(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -3734,6 +3763,13 @@ int MetaCmd_Pull::ByteSize() const {
           this->name());
     }
 
+    // optional int32 epoch = 3;
+    if (has_epoch()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->epoch());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -3767,6 +3803,9 @@ void MetaCmd_Pull::MergeFrom(const MetaCmd_Pull& from) {
     if (from.has_name()) {
       set_name(from.name());
     }
+    if (from.has_epoch()) {
+      set_epoch(from.epoch());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -3795,6 +3834,7 @@ void MetaCmd_Pull::Swap(MetaCmd_Pull* other) {
   if (other != this) {
     std::swap(node_, other->node_);
     std::swap(name_, other->name_);
+    std::swap(epoch_, other->epoch_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -5718,6 +5758,7 @@ void MetaCmdResponse_Ping::Swap(MetaCmdResponse_Ping* other) {
 #ifndef _MSC_VER
 const int MetaCmdResponse_Pull::kVersionFieldNumber;
 const int MetaCmdResponse_Pull::kInfoFieldNumber;
+const int MetaCmdResponse_Pull::kBaseFieldNumber;
 #endif  // !_MSC_VER
 
 MetaCmdResponse_Pull::MetaCmdResponse_Pull()
@@ -5737,6 +5778,7 @@ MetaCmdResponse_Pull::MetaCmdResponse_Pull(const MetaCmdResponse_Pull& from)
 void MetaCmdResponse_Pull::SharedCtor() {
   _cached_size_ = 0;
   version_ = 0;
+  base_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -5773,6 +5815,7 @@ MetaCmdResponse_Pull* MetaCmdResponse_Pull::New() const {
 void MetaCmdResponse_Pull::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     version_ = 0;
+    base_ = 0;
   }
   info_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
@@ -5811,6 +5854,22 @@ bool MetaCmdResponse_Pull::MergePartialFromCodedStream(
           goto handle_uninterpreted;
         }
         if (input->ExpectTag(18)) goto parse_info;
+        if (input->ExpectTag(24)) goto parse_base;
+        break;
+      }
+
+      // optional int32 base = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_base:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &base_)));
+          set_has_base();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -5844,6 +5903,11 @@ void MetaCmdResponse_Pull::SerializeWithCachedSizes(
       2, this->info(i), output);
   }
 
+  // optional int32 base = 3;
+  if (has_base()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->base(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -5864,6 +5928,11 @@ void MetaCmdResponse_Pull::SerializeWithCachedSizes(
         2, this->info(i), target);
   }
 
+  // optional int32 base = 3;
+  if (has_base()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->base(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -5882,6 +5951,13 @@ int MetaCmdResponse_Pull::ByteSize() const {
           this->version());
     }
 
+    // optional int32 base = 3;
+    if (has_base()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->base());
+    }
+
   }
   // repeated .ZPMeta.Table info = 2;
   total_size += 1 * this->info_size();
@@ -5921,6 +5997,9 @@ void MetaCmdResponse_Pull::MergeFrom(const MetaCmdResponse_Pull& from) {
     if (from.has_version()) {
       set_version(from.version());
     }
+    if (from.has_base()) {
+      set_base(from.base());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -5950,6 +6029,7 @@ void MetaCmdResponse_Pull::Swap(MetaCmdResponse_Pull* other) {
   if (other != this) {
     std::swap(version_, other->version_);
     info_.Swap(&other->info_);
+    std::swap(base_, other->base_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
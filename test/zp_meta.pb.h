@@ -1214,20 +1214,30 @@ class MetaCmd_Pull : public ::google::protobuf::Message {
   inline ::std::string* release_name();
   inline void set_allocated_name(::std::string* name);
 
+  // optional int32 epoch = 3;
+  inline bool has_epoch() const;
+  inline void clear_epoch();
+  static const int kEpochFieldNumber = 3;
+  inline ::google::protobuf::int32 epoch() const;
+  inline void set_epoch(::google::protobuf::int32 value);
+
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmd.Pull)
  private:
   inline void set_has_node();
   inline void clear_has_node();
   inline void set_has_name();
   inline void clear_has_name();
+  inline void set_has_epoch();
+  inline void clear_has_epoch();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::ZPMeta::Node* node_;
   ::std::string* name_;
+  ::google::protobuf::int32 epoch_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
   friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
@@ -2003,18 +2013,28 @@ class MetaCmdResponse_Pull : public ::google::protobuf::Message {
   inline ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table >*
       mutable_info();
 
+  // optional int32 base = 3;
+  inline bool has_base() const;
+  inline void clear_base();
+  static const int kBaseFieldNumber = 3;
+  inline ::google::protobuf::int32 base() const;
+  inline void set_base(::google::protobuf::int32 value);
+
   // @@protoc_insertion_point(class_scope:ZPMeta.MetaCmdResponse.Pull)
  private:
   inline void set_has_version();
   inline void clear_has_version();
+  inline void set_has_base();
+  inline void clear_has_base();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::RepeatedPtrField< ::ZPMeta::Table > info_;
   ::google::protobuf::int32 version_;
+  ::google::protobuf::int32 base_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_zp_5fmeta_2eproto();
   friend void protobuf_AssignDesc_zp_5fmeta_2eproto();
@@ -3441,6 +3461,28 @@ inline void MetaCmd_Pull::set_allocated_name(::std::string* name) {
   }
 }
 
+// optional int32 epoch = 3;
+inline bool MetaCmd_Pull::has_epoch() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void MetaCmd_Pull::set_has_epoch() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void MetaCmd_Pull::clear_has_epoch() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void MetaCmd_Pull::clear_epoch() {
+  epoch_ = 0;
+  clear_has_epoch();
+}
+inline ::google::protobuf::int32 MetaCmd_Pull::epoch() const {
+  return epoch_;
+}
+inline void MetaCmd_Pull::set_epoch(::google::protobuf::int32 value) {
+  set_has_epoch();
+  epoch_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // MetaCmd_Init
@@ -4107,6 +4149,28 @@ MetaCmdResponse_Pull::mutable_info() {
   return &info_;
 }
 
+// optional int32 base = 3;
+inline bool MetaCmdResponse_Pull::has_base() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void MetaCmdResponse_Pull::set_has_base() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void MetaCmdResponse_Pull::clear_has_base() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void MetaCmdResponse_Pull::clear_base() {
+  base_ = 0;
+  clear_has_base();
+}
+inline ::google::protobuf::int32 MetaCmdResponse_Pull::base() const {
+  return base_;
+}
+inline void MetaCmdResponse_Pull::set_base(::google::protobuf::int32 value) {
+  set_has_base();
+  base_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // MetaCmdResponse_ListTable
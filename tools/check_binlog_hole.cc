@@ -1,18 +1,44 @@
+#include <fcntl.h>
+#include <getopt.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include <set>
 #include <map>
+#include <atomic>
+#include <thread>
 #include <vector>
 #include <string>
 #include <iostream>
 #include "slash/include/env.h"
 #include "slash/include/slash_string.h"
 #include "include/zp_const.h"
+#include "include/zp_crc32c.h"
+#include "include/zp_binlog.h"
+
+// Check headers and fragment structure only,
+// without touching the payload pages
+static bool g_quick = false;
 
 struct hole {
   uint32_t left;
   uint32_t right;
 };
 
-bool ExistBinlogHole(const std::string& log_path, struct hole* h) {
+// One binlog file to verify and what came out of it
+struct VerifyTask {
+  std::string path;
+  bool ok;
+  uint64_t records;
+  uint64_t bytes;         // written bytes covered, zero tail excluded
+  uint64_t error_offset;  // where the first corruption sits
+  std::string error;
+};
+
+bool ExistBinlogHole(const std::string& log_path, struct hole* h,
+    std::set<uint32_t>* binlog_nums) {
   // Got all files
   std::vector<std::string> children;
   int ret = slash::GetChildren(log_path, children);
@@ -26,7 +52,6 @@ bool ExistBinlogHole(const std::string& log_path, struct hole* h) {
   // Got parititon id
   int64_t index = 0;
   std::string sindex;
-  std::set<uint32_t> binlog_nums;
   std::vector<std::string>::iterator it;
   for (it = children.begin(); it != children.end(); ++it) {
     if ((*it).compare(0, kBinlogPrefixLen, kBinlogPrefix) != 0) {
@@ -34,14 +59,14 @@ bool ExistBinlogHole(const std::string& log_path, struct hole* h) {
     }
     sindex = (*it).substr(kBinlogPrefixLen);
     if (slash::string2l(sindex.c_str(), sindex.size(), &index) == 1) {
-      binlog_nums.insert(index);
+      binlog_nums->insert(index);
     }
   }
 
 
-  std::set<uint32_t>::iterator num_it = binlog_nums.begin(),
-    pre_num_it = binlog_nums.begin();
-  for (++num_it; num_it != binlog_nums.end(); ++num_it, ++pre_num_it) {
+  std::set<uint32_t>::iterator num_it = binlog_nums->begin(),
+    pre_num_it = binlog_nums->begin();
+  for (++num_it; num_it != binlog_nums->end(); ++num_it, ++pre_num_it) {
     if (*num_it != *pre_num_it + 1) {
       h->left = *num_it;
       h->right = *pre_num_it;
@@ -51,19 +76,212 @@ bool ExistBinlogHole(const std::string& log_path, struct hole* h) {
   return false;
 }
 
+// Walk the record framing of one mapped binlog file
+// A zero header means the fallocated tail of the file, nothing is
+// written past it, the full mode insists the rest really is zeros
+// and recomputes the payload crc of every fragment on the way
+bool VerifyBinlogFile(VerifyTask* task) {
+  task->ok = false;
+  task->records = 0;
+  task->bytes = 0;
+  task->error_offset = 0;
+
+  int fd = open(task->path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    task->error = "open failed";
+    return false;
+  }
+  struct stat sb;
+  if (fstat(fd, &sb) != 0) {
+    close(fd);
+    task->error = "stat failed";
+    return false;
+  }
+  uint64_t size = sb.st_size;
+  if (size == 0) {
+    close(fd);
+    task->ok = true;
+    return true;
+  }
+  void* ptr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (ptr == MAP_FAILED) {
+    close(fd);
+    task->error = "mmap failed";
+    return false;
+  }
+  const char* base = static_cast<const char*>(ptr);
+  madvise(ptr, size, MADV_SEQUENTIAL);
+
+  uint64_t pos = 0;
+  bool inside_record = false;  // between a kFirstType and its kLastType
+  bool zero_tail = false;
+  std::string error;
+  while (pos + kHeaderSize <= size) {
+    uint64_t block_left = kBlockSize - pos % kBlockSize;
+    if (block_left <= kHeaderSize) {
+      // Block trailer
+      pos += block_left;
+      continue;
+    }
+
+    const char* header = base + pos;
+    const uint32_t a = static_cast<uint32_t>(header[0]) & 0xff;
+    const uint32_t b = static_cast<uint32_t>(header[1]) & 0xff;
+    const uint32_t c = static_cast<uint32_t>(header[2]) & 0xff;
+    const unsigned int type = header[3];
+    const uint32_t length = a | (b << 8) | (c << 16);
+    const uint32_t expected_crc = (static_cast<uint32_t>(header[4]) & 0xff)
+      | ((static_cast<uint32_t>(header[5]) & 0xff) << 8)
+      | ((static_cast<uint32_t>(header[6]) & 0xff) << 16)
+      | ((static_cast<uint32_t>(header[7]) & 0xff) << 24);
+
+    if (type == kZeroType && length == 0) {
+      zero_tail = true;
+      break;
+    }
+    if (length > block_left - kHeaderSize) {
+      error = "record length overflows its block";
+      break;
+    }
+    if (pos + kHeaderSize + length > size) {
+      error = "record truncated by end of file";
+      break;
+    }
+
+    switch (type) {
+      case kFullType:
+        if (inside_record) {
+          error = "record begin inside another record";
+        }
+        task->records++;
+        break;
+      case kFirstType:
+        if (inside_record) {
+          error = "record begin inside another record";
+        }
+        inside_record = true;
+        break;
+      case kMiddleType:
+        if (!inside_record) {
+          error = "fragment without record begin";
+        }
+        break;
+      case kLastType:
+        if (!inside_record) {
+          error = "fragment without record begin";
+        } else {
+          inside_record = false;
+          task->records++;
+        }
+        break;
+      case kEmptyType:
+        // Blank filler, carries no record
+        break;
+      default:
+        error = "unknown record type";
+    }
+    if (!error.empty()) {
+      break;
+    }
+
+    if (!g_quick
+        && Crc32c(base + pos + kHeaderSize, length) != expected_crc) {
+      error = "payload crc mismatch";
+      break;
+    }
+
+    pos += kHeaderSize + length;
+    task->bytes = pos;
+  }
+
+  if (error.empty() && inside_record) {
+    error = "unfinished record at file tail";
+    pos = task->bytes;
+  }
+  if (error.empty() && zero_tail && !g_quick) {
+    // Data past a zero header is unreachable for the readers
+    for (uint64_t i = pos; i < size; i++) {
+      if (base[i] != 0) {
+        error = "data beyond zero header";
+        pos = i;
+        break;
+      }
+    }
+  }
+
+  munmap(ptr, size);
+  close(fd);
+
+  if (!error.empty()) {
+    task->error = error;
+    task->error_offset = pos;
+    return false;
+  }
+  task->ok = true;
+  return true;
+}
+
+// Workers pop files off the shared index one by one,
+// the main thread reduces the results once all of them joined
+void VerifyThread(std::vector<VerifyTask>* tasks, std::atomic<size_t>* next) {
+  while (true) {
+    size_t idx = next->fetch_add(1);
+    if (idx >= tasks->size()) {
+      return;
+    }
+    VerifyBinlogFile(&(*tasks)[idx]);
+  }
+}
+
 void print_usage_exit() {
   std::cout << "Usage:" << std::endl;
-  std::cout << "    ./check_lost log_path" << std::endl; 
+  std::cout << "    ./check_binlog_hole log_path [options]" << std::endl;
+  std::cout << "Check for missing binlog file numbers, then verify the"
+    << std::endl;
+  std::cout << "record framing and payload crc of every file in parallel"
+    << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << "    --quick            framing only, skip the payload crc"
+    << std::endl;
+  std::cout << "    --threads <n>      verify workers, default all cores"
+    << std::endl;
   exit(-1);
 }
 
 
 int main(int argc, char* argv[]) {
-  if (argc != 2) {
+  if (argc < 2) {
     print_usage_exit();
   }
 
   std::string log_path(argv[1]);
+  int thread_num = std::thread::hardware_concurrency();
+  if (thread_num < 1) {
+    thread_num = 4;
+  }
+
+  static struct option long_options[] = {
+    {"quick", no_argument, NULL, 'q'},
+    {"threads", required_argument, NULL, 't'},
+    {NULL, 0, NULL, 0}
+  };
+  optind = 2;  // right after log_path
+  int ch;
+  while ((ch = getopt_long(argc, argv, "qt:", long_options, NULL)) != -1) {
+    switch (ch) {
+      case 'q':
+        g_quick = true;
+        break;
+      case 't':
+        thread_num = atoi(optarg);
+        if (thread_num < 1) {
+          thread_num = 1;
+        }
+        break;
+      default:
+        print_usage_exit();
+    }
+  }
 
   // Get all table dir
   std::vector<std::string> tables;
@@ -77,6 +295,7 @@ int main(int argc, char* argv[]) {
   std::string table_path, partition_path;
   std::vector<std::string> partitions;
   std::map<std::string, struct hole> failed_db;
+  std::vector<VerifyTask> tasks;
   for (auto& table : tables) {
     table_path = log_path + "/" + table;
     if (!slash::IsDir(table_path)) {
@@ -99,7 +318,8 @@ int main(int argc, char* argv[]) {
         std::cout << "Check binlog files of: " << partition_path
           << std::endl;
         struct hole binlog_hole;
-        if (ExistBinlogHole(partition_path, &binlog_hole)) {
+        std::set<uint32_t> binlog_nums;
+        if (ExistBinlogHole(partition_path, &binlog_hole, &binlog_nums)) {
           std::cout << "Failed!" << std::endl;
           failed_db.insert(std::pair<std::string, struct hole>(partition_path,
                 binlog_hole));
@@ -107,10 +327,43 @@ int main(int argc, char* argv[]) {
           std::cout << "Success!" << std::endl;
         }
         std::cout << std::endl;
+
+        for (auto num : binlog_nums) {
+          VerifyTask task;
+          task.path = partition_path + "/" + kBinlogPrefix
+            + std::to_string(num);
+          tasks.push_back(task);
+        }
       }
     }
   }
-  
+
+  // Verify all the files of all the partitions in parallel
+  uint64_t verify_begin = slash::NowMicros();
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < thread_num; i++) {
+    threads.push_back(std::thread(VerifyThread, &tasks, &next));
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  uint64_t verify_us = slash::NowMicros() - verify_begin;
+
+  uint64_t total_records = 0, total_bytes = 0, corrupt = 0;
+  for (auto& task : tasks) {
+    total_records += task.records;
+    total_bytes += task.bytes;
+    if (!task.ok) {
+      corrupt++;
+    }
+  }
+  std::cout << "Verified " << tasks.size() << " files ("
+    << (g_quick ? "quick" : "full") << " mode, "
+    << thread_num << " threads): "
+    << total_records << " records, " << total_bytes << " bytes in "
+    << verify_us / 1000000.0 << "s" << std::endl;
+
   std::cout << "--------------------------------------------------------" << std::endl;
   std::cout << "| Error path          | hole_left | hole_right |" << std::endl;
   for (auto& f : failed_db) {
@@ -120,5 +373,18 @@ int main(int argc, char* argv[]) {
       << " | " << std::endl;
   }
 
+  if (corrupt > 0) {
+    std::cout << "--------------------------------------------------------" << std::endl;
+    std::cout << "| Corrupt file          | offset | error |" << std::endl;
+    for (auto& task : tasks) {
+      if (!task.ok) {
+        std::cout << "| " << task.path
+          << "   |   " << task.error_offset
+          << "   |   " << task.error
+          << " | " << std::endl;
+      }
+    }
+  }
+
   return 1;
 }
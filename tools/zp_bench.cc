@@ -0,0 +1,541 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+#include <map>
+#include <deque>
+#include <vector>
+#include <string>
+#include <random>
+#include <thread>
+#include <functional>
+#include <iostream>
+#include <unordered_map>
+#include "slash/include/env.h"
+#include "pink/include/pink_cli.h"
+#include "include/client.pb.h"
+
+// zp_bench: in-tree load generator against one zeppelin table.
+// Pulls the partition map out of the nodes via INFOREPL, then drives
+// a SET/GET/MGET/DEL mix from several client threads with optional
+// pipelining, and reports throughput and latency percentiles.
+
+struct BenchOption {
+  std::vector<std::string> servers;  // data node ip:port list
+  std::string table;
+  int clients;
+  int requests;       // per client
+  int value_size;
+  uint64_t key_space;
+  std::string dist;   // uniform | zipfian
+  int pipeline;
+  int mget_batch;
+  std::string mix;    // e.g. set:50,get:45,mget:3,del:2
+
+  BenchOption()
+    : clients(4),
+    requests(100000),
+    value_size(128),
+    key_space(1000000),
+    dist("uniform"),
+    pipeline(1),
+    mget_batch(10),
+    mix("set:50,get:50") {}
+};
+
+// Same power-of-two bucket layout the server uses for INFOLATENCY,
+// non-atomic since every thread owns its own copy
+struct BenchHistogram {
+  static const int kBucketNum = 32;
+  uint64_t buckets[kBucketNum];
+  uint64_t count;
+  uint64_t total_us;
+
+  BenchHistogram() : count(0), total_us(0) {
+    memset(buckets, 0, sizeof(buckets));
+  }
+
+  void Add(uint64_t us) {
+    int index = 0;
+    while (index < kBucketNum - 1 && (1ULL << index) < us) {
+      index++;
+    }
+    buckets[index]++;
+    count++;
+    total_us += us;
+  }
+
+  void Merge(const BenchHistogram& other) {
+    for (int i = 0; i < kBucketNum; i++) {
+      buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    total_us += other.total_us;
+  }
+
+  uint64_t Quantile(double q) const {
+    uint64_t target = static_cast<uint64_t>(count * q);
+    if (target < 1) {
+      target = 1;
+    }
+    uint64_t acc = 0;
+    for (int i = 0; i < kBucketNum; i++) {
+      acc += buckets[i];
+      if (acc >= target) {
+        return 1ULL << i;
+      }
+    }
+    return 1ULL << (kBucketNum - 1);
+  }
+};
+
+// YCSB style zipfian generator over [0, n)
+class ZipfGenerator {
+ public:
+  ZipfGenerator(uint64_t n, double theta)
+    : n_(n), theta_(theta) {
+    zetan_ = Zeta(n_);
+    zeta2_ = Zeta(2);
+    alpha_ = 1.0 / (1.0 - theta_);
+    eta_ = (1 - pow(2.0 / n_, 1 - theta_)) / (1 - zeta2_ / zetan_);
+  }
+
+  uint64_t Next(std::mt19937_64* rng) {
+    double u = static_cast<double>((*rng)()) / std::mt19937_64::max();
+    double uz = u * zetan_;
+    if (uz < 1.0) {
+      return 0;
+    }
+    if (uz < 1.0 + pow(0.5, theta_)) {
+      return 1;
+    }
+    return static_cast<uint64_t>(n_ * pow(eta_ * u - eta_ + 1, alpha_));
+  }
+
+ private:
+  double Zeta(uint64_t n) {
+    double sum = 0;
+    for (uint64_t i = 1; i <= n; i++) {
+      sum += 1.0 / pow(static_cast<double>(i), theta_);
+    }
+    return sum;
+  }
+
+  uint64_t n_;
+  double theta_;
+  double alpha_;
+  double zetan_;
+  double zeta2_;
+  double eta_;
+};
+
+enum BenchOp {
+  kBenchSet = 0,
+  kBenchGet,
+  kBenchMget,
+  kBenchDel,
+};
+
+struct BenchConn {
+  pink::PinkCli* cli;
+  std::deque<uint64_t> pending_us;  // send time of in-flight requests
+};
+
+struct BenchResult {
+  uint64_t sent;
+  uint64_t errors;
+  uint64_t moved;
+  uint64_t not_found;
+  BenchHistogram histogram;
+
+  BenchResult() : sent(0), errors(0), moved(0), not_found(0) {}
+};
+
+static BenchOption g_option;
+static int g_partition_cnt = 0;
+// partition id -> master ip:port
+static std::map<int, std::string> g_partition_master;
+
+void print_usage_exit() {
+  std::cout << "Usage:" << std::endl;
+  std::cout << "    ./zp_bench -s ip:port[,ip:port...] -t table [options]"
+    << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << "    --clients <n>      client threads, default 4" << std::endl;
+  std::cout << "    --requests <n>     requests per client, default 100000"
+    << std::endl;
+  std::cout << "    --value_size <n>   value bytes, default 128" << std::endl;
+  std::cout << "    --key_space <n>    distinct keys, default 1000000"
+    << std::endl;
+  std::cout << "    --dist <d>         uniform | zipfian, default uniform"
+    << std::endl;
+  std::cout << "    --pipeline <n>     in-flight requests per conn, default 1"
+    << std::endl;
+  std::cout << "    --mget_batch <n>   keys per MGET, default 10" << std::endl;
+  std::cout << "    --mix <m>          op weights, default set:50,get:50"
+    << std::endl;
+  exit(-1);
+}
+
+void ParseOptions(int argc, char* argv[]) {
+  static struct option const long_options[] = {
+    {"server", required_argument, NULL, 's'},
+    {"table", required_argument, NULL, 't'},
+    {"clients", required_argument, NULL, 'c'},
+    {"requests", required_argument, NULL, 'n'},
+    {"value_size", required_argument, NULL, 'v'},
+    {"key_space", required_argument, NULL, 'k'},
+    {"dist", required_argument, NULL, 'd'},
+    {"pipeline", required_argument, NULL, 'p'},
+    {"mget_batch", required_argument, NULL, 'b'},
+    {"mix", required_argument, NULL, 'm'},
+    {NULL, 0, NULL, 0} };
+
+  int opt, optindex;
+  std::string server_str;
+  while ((opt = getopt_long(argc, argv, "s:t:c:n:v:k:d:p:b:m:",
+          long_options, &optindex)) != -1) {
+    switch (opt) {
+      case 's': server_str = optarg; break;
+      case 't': g_option.table = optarg; break;
+      case 'c': g_option.clients = atoi(optarg); break;
+      case 'n': g_option.requests = atoi(optarg); break;
+      case 'v': g_option.value_size = atoi(optarg); break;
+      case 'k': g_option.key_space = strtoull(optarg, NULL, 10); break;
+      case 'd': g_option.dist = optarg; break;
+      case 'p': g_option.pipeline = atoi(optarg); break;
+      case 'b': g_option.mget_batch = atoi(optarg); break;
+      case 'm': g_option.mix = optarg; break;
+      default: print_usage_exit();
+    }
+  }
+
+  size_t prev = 0, pos;
+  while (prev < server_str.size()) {
+    pos = server_str.find(',', prev);
+    if (pos == std::string::npos) {
+      pos = server_str.size();
+    }
+    g_option.servers.push_back(server_str.substr(prev, pos - prev));
+    prev = pos + 1;
+  }
+
+  if (g_option.servers.empty() || g_option.table.empty()
+      || (g_option.dist != "uniform" && g_option.dist != "zipfian")) {
+    print_usage_exit();
+  }
+}
+
+// Weight table out of the mix string, e.g. set:50,get:45,del:5
+std::vector<std::pair<BenchOp, int>> ParseMix(const std::string& mix) {
+  std::vector<std::pair<BenchOp, int>> weights;
+  size_t prev = 0, pos;
+  while (prev < mix.size()) {
+    pos = mix.find(',', prev);
+    if (pos == std::string::npos) {
+      pos = mix.size();
+    }
+    std::string item = mix.substr(prev, pos - prev);
+    prev = pos + 1;
+    size_t colon = item.find(':');
+    if (colon == std::string::npos) {
+      break;
+    }
+    std::string op = item.substr(0, colon);
+    int weight = atoi(item.substr(colon + 1).c_str());
+    if (op == "set") {
+      weights.push_back(std::make_pair(kBenchSet, weight));
+    } else if (op == "get") {
+      weights.push_back(std::make_pair(kBenchGet, weight));
+    } else if (op == "mget") {
+      weights.push_back(std::make_pair(kBenchMget, weight));
+    } else if (op == "del") {
+      weights.push_back(std::make_pair(kBenchDel, weight));
+    } else {
+      std::cout << "Unknown op in mix: " << op << std::endl;
+      print_usage_exit();
+    }
+  }
+  if (weights.empty()) {
+    print_usage_exit();
+  }
+  return weights;
+}
+
+// Ask every node for its partitions; the union is the routing table
+bool BuildPartitionMap() {
+  for (auto& server : g_option.servers) {
+    size_t pos = server.find(':');
+    std::string ip = server.substr(0, pos);
+    int port = atoi(server.substr(pos + 1).c_str());
+
+    pink::PinkCli* cli = pink::NewPbCli();
+    slash::Status s = cli->Connect(ip, port);
+    if (!s.ok()) {
+      std::cout << "Connect (" << server << ") failed: "
+        << s.ToString() << std::endl;
+      delete cli;
+      return false;
+    }
+
+    client::CmdRequest request;
+    request.set_type(client::Type::INFOREPL);
+    request.mutable_info()->set_table_name(g_option.table);
+    s = cli->Send(&request);
+    client::CmdResponse response;
+    if (s.ok()) {
+      s = cli->Recv(&response);
+    }
+    cli->Close();
+    delete cli;
+    if (!s.ok()) {
+      std::cout << "INFOREPL (" << server << ") failed: "
+        << s.ToString() << std::endl;
+      return false;
+    }
+
+    for (int i = 0; i < response.info_repl_size(); i++) {
+      const client::CmdResponse_InfoRepl& repl = response.info_repl(i);
+      if (repl.table_name() != g_option.table) {
+        continue;
+      }
+      g_partition_cnt = repl.partition_cnt();
+      for (int j = 0; j < repl.partition_state_size(); j++) {
+        const client::PartitionState& state = repl.partition_state(j);
+        g_partition_master[state.partition_id()] = state.master().ip()
+          + ":" + std::to_string(state.master().port());
+      }
+    }
+  }
+
+  if (g_partition_cnt <= 0
+      || static_cast<int>(g_partition_master.size()) < g_partition_cnt) {
+    std::cout << "Incomplete partition map for table " << g_option.table
+      << ": know " << g_partition_master.size() << " of "
+      << g_partition_cnt << " masters,"
+      << " pass every data node with -s" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+std::string GenKey(uint64_t num) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "benchkey_%016lu", num);
+  return std::string(buf);
+}
+
+// Same mapping Table::KeyToPartition uses on the node
+int KeyToPartition(const std::string& key) {
+  return std::hash<std::string>()(key) % g_partition_cnt;
+}
+
+BenchConn* GetConn(std::unordered_map<std::string, BenchConn>* conns,
+    const std::string& server) {
+  auto it = conns->find(server);
+  if (it != conns->end()) {
+    return &(it->second);
+  }
+  size_t pos = server.find(':');
+  BenchConn conn;
+  conn.cli = pink::NewPbCli();
+  slash::Status s = conn.cli->Connect(server.substr(0, pos),
+      atoi(server.substr(pos + 1).c_str()));
+  if (!s.ok()) {
+    std::cout << "Connect (" << server << ") failed: "
+      << s.ToString() << std::endl;
+    delete conn.cli;
+    return NULL;
+  }
+  return &(conns->insert(std::make_pair(server, conn)).first->second);
+}
+
+// Pop responses until only max_pending requests stay in flight
+void Drain(BenchConn* conn, size_t max_pending, BenchResult* result) {
+  client::CmdResponse response;
+  while (conn->pending_us.size() > max_pending) {
+    slash::Status s = conn->cli->Recv(&response);
+    uint64_t sent_us = conn->pending_us.front();
+    conn->pending_us.pop_front();
+    if (!s.ok()) {
+      result->errors++;
+      continue;
+    }
+    result->histogram.Add(slash::NowMicros() - sent_us);
+    if (response.code() == client::StatusCode::kOk) {
+      // done
+    } else if (response.code() == client::StatusCode::kNotFound) {
+      result->not_found++;
+    } else if (response.code() == client::StatusCode::kMove) {
+      result->moved++;
+    } else {
+      result->errors++;
+    }
+  }
+}
+
+void SendOne(BenchConn* conn, client::CmdRequest* request,
+    BenchResult* result) {
+  slash::Status s = conn->cli->Send(request);
+  if (!s.ok()) {
+    result->errors++;
+    return;
+  }
+  conn->pending_us.push_back(slash::NowMicros());
+  result->sent++;
+  Drain(conn, g_option.pipeline - 1, result);
+}
+
+void BenchThread(int seed, BenchResult* result) {
+  std::mt19937_64 rng(seed);
+  ZipfGenerator zipf(g_option.key_space, 0.99);
+  std::vector<std::pair<BenchOp, int>> weights = ParseMix(g_option.mix);
+  int total_weight = 0;
+  for (auto& w : weights) {
+    total_weight += w.second;
+  }
+
+  std::string value;
+  for (int i = 0; i < g_option.value_size; i++) {
+    value.push_back('!' + rng() % 94);  // printable
+  }
+
+  std::unordered_map<std::string, BenchConn> conns;
+  client::CmdRequest request;
+  for (int n = 0; n < g_option.requests; n++) {
+    uint64_t num = (g_option.dist == "zipfian")
+      ? zipf.Next(&rng) : rng() % g_option.key_space;
+    std::string key = GenKey(num);
+
+    int pick = rng() % total_weight;
+    BenchOp op = weights.back().first;
+    for (auto& w : weights) {
+      pick -= w.second;
+      if (pick < 0) {
+        op = w.first;
+        break;
+      }
+    }
+
+    if (op == kBenchMget) {
+      // One MGET request per involved partition
+      std::unordered_map<std::string, std::vector<std::string>> batches;
+      batches[g_partition_master[KeyToPartition(key)]].push_back(key);
+      for (int i = 1; i < g_option.mget_batch; i++) {
+        std::string k = GenKey(rng() % g_option.key_space);
+        batches[g_partition_master[KeyToPartition(k)]].push_back(k);
+      }
+      for (auto& batch : batches) {
+        BenchConn* conn = GetConn(&conns, batch.first);
+        if (conn == NULL) {
+          result->errors++;
+          continue;
+        }
+        request.Clear();
+        request.set_type(client::Type::MGET);
+        client::CmdRequest_Mget* mget = request.mutable_mget();
+        mget->set_table_name(g_option.table);
+        for (auto& k : batch.second) {
+          mget->add_keys(k);
+        }
+        SendOne(conn, &request, result);
+      }
+      continue;
+    }
+
+    BenchConn* conn = GetConn(&conns,
+        g_partition_master[KeyToPartition(key)]);
+    if (conn == NULL) {
+      result->errors++;
+      continue;
+    }
+    request.Clear();
+    switch (op) {
+      case kBenchSet: {
+        request.set_type(client::Type::SET);
+        client::CmdRequest_Set* set = request.mutable_set();
+        set->set_table_name(g_option.table);
+        set->set_key(key);
+        set->set_value(value);
+        break;
+      }
+      case kBenchGet: {
+        request.set_type(client::Type::GET);
+        client::CmdRequest_Get* get = request.mutable_get();
+        get->set_table_name(g_option.table);
+        get->set_key(key);
+        break;
+      }
+      case kBenchDel: {
+        request.set_type(client::Type::DEL);
+        client::CmdRequest_Del* del = request.mutable_del();
+        del->set_table_name(g_option.table);
+        del->set_key(key);
+        break;
+      }
+      default:
+        break;
+    }
+    SendOne(conn, &request, result);
+  }
+
+  for (auto& conn : conns) {
+    Drain(&conn.second, 0, result);
+    conn.second.cli->Close();
+    delete conn.second.cli;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  ParseOptions(argc, argv);
+  ParseMix(g_option.mix);  // fail fast on a bad mix string
+
+  if (!BuildPartitionMap()) {
+    return -1;
+  }
+  std::cout << "Table " << g_option.table << " with " << g_partition_cnt
+    << " partitions on " << g_option.servers.size() << " servers"
+    << std::endl;
+  std::cout << "Run " << g_option.clients << " clients x "
+    << g_option.requests << " requests, value_size "
+    << g_option.value_size << ", " << g_option.dist
+    << " keys over " << g_option.key_space << ", pipeline "
+    << g_option.pipeline << ", mix " << g_option.mix << std::endl;
+
+  std::vector<BenchResult> results(g_option.clients);
+  std::vector<std::thread> threads;
+  uint64_t begin_us = slash::NowMicros();
+  for (int i = 0; i < g_option.clients; i++) {
+    threads.push_back(std::thread(BenchThread, i + 1, &results[i]));
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  uint64_t elapsed_us = slash::NowMicros() - begin_us + 1;
+
+  BenchResult total;
+  for (auto& r : results) {
+    total.sent += r.sent;
+    total.errors += r.errors;
+    total.moved += r.moved;
+    total.not_found += r.not_found;
+    total.histogram.Merge(r.histogram);
+  }
+
+  std::cout << "--------------------------------------------------------"
+    << std::endl;
+  std::cout << "Requests:  " << total.sent
+    << " (not_found " << total.not_found
+    << ", moved " << total.moved
+    << ", errors " << total.errors << ")" << std::endl;
+  std::cout << "Elapsed:   " << elapsed_us / 1000000.0 << " s" << std::endl;
+  std::cout << "QPS:       " << total.sent * 1000000 / elapsed_us << std::endl;
+  if (total.histogram.count > 0) {
+    std::cout << "Latency:   avg "
+      << total.histogram.total_us / total.histogram.count << " us"
+      << ", p50 " << total.histogram.Quantile(0.50) << " us"
+      << ", p99 " << total.histogram.Quantile(0.99) << " us"
+      << ", p999 " << total.histogram.Quantile(0.999) << " us" << std::endl;
+  }
+  return 0;
+}